@@ -48,6 +48,15 @@
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
 
+//---- Make the current context pointer (GImGui) thread_local, so N threads can each build their own context concurrently.
+// A font atlas shared between those contexts must be built and locked (atlas->Locked = true) before any thread uses it: contexts then never write to it.
+// Call SetAllocatorFunctions() before starting threads. Not compatible with DLL builds (thread_local variables can't be exported).
+//#define IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+
+//---- Write .ini files from a background thread (uses <thread>): SaveIniSettingsToDisk(), including the automatic saves every io.IniSavingRate, only formats and queues the data.
+// Files are always written to "<name>.tmp" then renamed over "<name>", so they are never seen partially written. LoadIniSettingsFromDisk() and DestroyContext() wait for pending writes.
+//#define IMGUI_ENABLE_ASYNC_INI_SAVING
+
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 //#define IMGUI_INCLUDE_IMGUI_USER_H
 
@@ -64,6 +73,9 @@
 //#define IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION
 //#define IMGUI_DISABLE_STB_RECT_PACK_IMPLEMENTATION
 
+//---- Pack the font atlas with ImRectPacker (guillotine packer with free rectangles indexed by height, see imgui_internal.h) instead of stb_rect_pack's skyline packer.
+//#define IMGUI_ENABLE_GUILLOTINE_RECT_PACK
+
 //---- Use stb_printf's faster implementation of vsnprintf instead of the one from libc (unless IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS is defined)
 // Requires 'stb_sprintf.h' to be available in the include path. Compatibility checks of arguments and formats done by clang and GCC will be disabled in order to support the extra formats provided by STB sprintf.
 // #define IMGUI_USE_STB_SPRINTF
@@ -95,6 +107,11 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12-bytes ImDrawVert (16-bit fixed point positions relative to ImDrawList::VtxOrigin, 16-bit normalized UV, packed color) instead of 20 bytes.
+// This reduces vertex upload volume by 40%. Your renderer backend will need to support it (imgui_impl_opengl3, imgui_impl_softraster and imgui_impl_null do).
+// Positions are limited to +/-4096 pixels around the center of their window with a 1/8 pixel precision (asserts beyond), UV to the 0..1 range. See ImDrawVert in imgui.h.
+//#define IMGUI_USE_COMPACT_DRAWVERT
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -61,6 +61,7 @@ CODE
 // [SECTION] MISC HELPERS/UTILITIES (Geometry functions)
 // [SECTION] MISC HELPERS/UTILITIES (String, Format, Hash functions)
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
+// [SECTION] MISC HELPERS/UTILITIES (Time functions)
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 // [SECTION] MISC HELPERS/UTILITIES (Color functions)
 // [SECTION] ImGuiStorage
@@ -390,6 +391,7 @@ CODE
  - 2021/XX/XX (1.XX) - Moved IME support functions from io.ImeSetInputScreenPosFn, io.ImeWindowHandle to the PlatformIO api.
 
 
+ - 2026/10/19 (1.86) - ImFont: IndexAdvanceX[] and IndexLookup[] are stored by pages of 256 code-points (see IndexPages[], IndexDirectSize) and IndexLookup[] is now ImU16. Use GetCharAdvance() and FindGlyph() instead of indexing them by code-point.
  - 2021/12/20 (1.86) - backends: removed obsolete Marmalade backend (imgui_impl_marmalade.cpp) + example. Find last supported version at https://github.com/ocornut/imgui/wiki/Bindings
  - 2021/11/04 (1.86) - removed CalcListClipping() function. Prefer using ImGuiListClipper which can return non-contiguous ranges. Please open an issue if you think you really need this function.
  - 2021/08/23 (1.85) - removed GetWindowContentRegionWidth() function. keep inline redirection helper. can use 'GetWindowContentRegionMax().x - GetWindowContentRegionMin().x' instead for generally 'GetContentRegionAvail().x' is more useful.
@@ -801,11 +803,27 @@ CODE
 // System includes
 #include <ctype.h>      // toupper
 #include <stdio.h>      // vsnprintf, sscanf, printf
+#include <time.h>       // clock_gettime, clock
+#if defined(_MSC_VER) && defined(IMGUI_ENABLE_SSE2)
+#include <intrin.h>     // _BitScanForward
+#endif
+#if (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)) && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>     // std::to_chars (ImFormatStringV() fast path, enabled when __cpp_lib_to_chars is defined)
+#include <locale.h>     // localeconv
+#endif
+#endif
 #if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
 #include <stddef.h>     // intptr_t
 #else
 #include <stdint.h>     // intptr_t
 #endif
+#include <atomic>       // std::atomic (MemAlloc()/MemFree() counter)
+#ifdef IMGUI_ENABLE_ASYNC_INI_SAVING
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
 
 // [Windows] On non-Visual Studio compilers, we default to IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS unless explicitly enabled
 #if defined(_WIN32) && !defined(_MSC_VER) && !defined(IMGUI_ENABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
@@ -917,6 +935,10 @@ static void*            WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSetti
 static void             WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             WindowSettingsHandler_ApplyAll(ImGuiContext*, ImGuiSettingsHandler*);
 static void             WindowSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+#ifdef IMGUI_ENABLE_ASYNC_INI_SAVING
+static void             SettingsIniWriter_WaitIdle(ImGuiContext* ctx);
+static void             SettingsIniWriter_Shutdown(ImGuiContext* ctx);
+#endif
 
 // Platform Dependents default implementation for IO functions
 static const char*      GetClipboardTextFn_DefaultImpl(void* user_data);
@@ -951,6 +973,7 @@ static void             ErrorCheckNewFrameSanityChecks();
 static void             ErrorCheckEndFrameSanityChecks();
 static void             UpdateDebugToolItemPicker();
 static void             UpdateDebugToolStackQueries();
+static void             UpdateDebugToolWindowsPerf();
 
 // Misc
 static void             UpdateSettings();
@@ -998,16 +1021,20 @@ static void             UpdateViewportPlatformMonitor(ImGuiViewportP* viewport);
 // - Important: Dear ImGui functions are not thread-safe because of this pointer.
 //   If you want thread-safety to allow N threads to access N different contexts:
 //   - Change this variable to use thread local storage so each thread can refer to a different context, in your imconfig.h:
-//         struct ImGuiContext;
-//         extern thread_local ImGuiContext* MyImGuiTLS;
-//         #define GImGui MyImGuiTLS
-//     And then define MyImGuiTLS in one of your cpp files. Note that thread_local is a C++11 keyword, earlier C++ uses compiler-specific keyword.
+//         #define IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+//     Each thread then calls CreateContext()/SetCurrentContext() for its own context. Contexts may share one font atlas
+//     passed to CreateContext(), as long as it is built and locked beforehand (atlas->Locked = true): it is then only read from.
+//     (You may also provide your own variable: '#define GImGui MyImGuiTLS' in imconfig.h, and define MyImGuiTLS in one of your cpp files.)
 //   - Future development aims to make this context pointer explicit to all calls. Also read https://github.com/ocornut/imgui/issues/586
 //   - If you need a finite number of contexts, you may compile and use multiple instances of the ImGui code from a different namespace.
 // - DLL users: read comments above.
 #ifndef GImGui
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+thread_local ImGuiContext* GImGui = NULL;
+#else
 ImGuiContext*   GImGui = NULL;
 #endif
+#endif
 
 // Memory Allocator functions. Use SetAllocatorFunctions() to change them.
 // - You probably don't want to modify that mid-program, and if you use global/static e.g. ImVector<> instances you may need to keep them accessible during program destruction.
@@ -1022,6 +1049,7 @@ static void    FreeWrapper(void* ptr, void* user_data)        { IM_UNUSED(user_d
 static ImGuiMemAllocFunc    GImAllocatorAllocFunc = MallocWrapper;
 static ImGuiMemFreeFunc     GImAllocatorFreeFunc = FreeWrapper;
 static void*                GImAllocatorUserData = NULL;
+static std::atomic<int>     GImAllocatorActiveAllocations(0);   // Any thread may allocate (e.g. standalone draw lists built by workers): copied to io.MetricsActiveAllocations by EndFrame()
 
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO)
@@ -1154,6 +1182,9 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigMemoryCompactBudget = 0;
+    ConfigTextLayoutCacheBudget = 256 * 1024;
+    ConfigTablesVirtualizeColumnsMin = 64;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1492,6 +1523,16 @@ const char* ImStrSkipBlank(const char* str)
     return str;
 }
 
+// On some platform vsnprintf() takes va_list by reference and modifies it.
+// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
+#ifndef va_copy
+#if defined(__GNUC__) || defined(__clang__)
+#define va_copy(dest, src) __builtin_va_copy(dest, src)
+#else
+#define va_copy(dest, src) (dest = src)
+#endif
+#endif
+
 // A) MSVC version appears to return -1 on overflow, whereas glibc appears to return total count (which may be >= buf_size).
 // Ideally we would test for only one of those limits at runtime depending on the behavior the vsnprintf(), but trying to deduct it at compile time sounds like a pandora can of worm.
 // B) When buf==NULL vsnprintf() will return the output size.
@@ -1510,31 +1551,181 @@ const char* ImStrSkipBlank(const char* str)
 #define vsnprintf _vsnprintf
 #endif
 
+#ifdef __cpp_lib_to_chars
+static inline void ImFormatStringFastAppend(char* buf, size_t buf_size, size_t* out_len, const char* s, size_t len)
+{
+    if (len == 0)
+        return;
+    if (*out_len + 1 < buf_size)
+        memcpy(buf + *out_len, s, ImMin(len, buf_size - 1 - *out_len));
+    *out_len += len;
+}
+
+static inline void ImFormatStringFastAppendZeros(char* buf, size_t buf_size, size_t* out_len, size_t count)
+{
+    if (*out_len + 1 < buf_size)
+        memset(buf + *out_len, '0', ImMin(count, buf_size - 1 - *out_len));
+    *out_len += count;
+}
+
+// Fast path for the formats submitted by most widgets every frame ("%d", "%.3f", "%s", "Frame %u", "%08X"...), without the generic
+// parsing and locale handling of vsnprintf(). Supports literal text, "%%", %c, %s, %d %i %u %x %X with an optional zero-padded width
+// and the l/ll (I64 on MSVC) length modifiers, %f %lf with an optional precision. Integers are converted with std::to_chars(), floats
+// with std::to_chars(..., std::chars_format::fixed, precision), which is specified to give the same output as printf() in the "C" locale.
+// Returns -1 for anything else (other flags/widths, '*', %e %g %p..., non-finite or very large floats, a locale whose decimal point isn't '.'),
+// after which the caller formats the string again with vsnprintf(). Otherwise returns the untruncated length, like vsnprintf().
+static int ImFormatStringFastV(char* buf, size_t buf_size, const char* fmt, va_list args)
+{
+    size_t out_len = 0;
+    bool locale_checked = false;
+    char tmp[64];
+    const char* p = fmt;
+    while (true)
+    {
+        const char* literal = p;
+        while (*p != 0 && *p != '%')
+            p++;
+        ImFormatStringFastAppend(buf, buf_size, &out_len, literal, (size_t)(p - literal));
+        if (*p == 0)
+            break;
+        p++;
+        if (*p == '%')
+        {
+            ImFormatStringFastAppend(buf, buf_size, &out_len, p++, 1);
+            continue;
+        }
+
+        // Zero-padded width, precision, length
+        int zero_pad_width = -1;
+        if (*p == '0')
+            for (zero_pad_width = 0, p++; *p >= '0' && *p <= '9' && zero_pad_width < 64; p++)
+                zero_pad_width = zero_pad_width * 10 + (*p - '0');
+        int precision = -1;
+        if (*p == '.')
+            for (precision = 0, p++; *p >= '0' && *p <= '9' && precision < 64; p++)
+                precision = precision * 10 + (*p - '0');
+        int length = 0; // 0: int, 1: long, 2: long long
+        if (p[0] == 'l')
+        {
+            length = (p[1] == 'l') ? 2 : 1;
+            p += length;
+        }
+#ifdef _MSC_VER
+        else if (p[0] == 'I' && p[1] == '6' && p[2] == '4')
+        {
+            length = 2;
+            p += 3;
+        }
+#endif
+        if ((*p >= '0' && *p <= '9') || zero_pad_width >= 64 || precision >= 64)
+            return -1;
+
+        const char type = *p++;
+        const char* value = tmp;
+        std::to_chars_result res;
+        switch (type)
+        {
+        case 'd': case 'i':
+            if (precision >= 0)
+                return -1;
+            if (length == 0)
+                res = std::to_chars(tmp, tmp + IM_ARRAYSIZE(tmp), va_arg(args, int));
+            else if (length == 1)
+                res = std::to_chars(tmp, tmp + IM_ARRAYSIZE(tmp), va_arg(args, long));
+            else
+                res = std::to_chars(tmp, tmp + IM_ARRAYSIZE(tmp), va_arg(args, long long));
+            break;
+        case 'u': case 'x': case 'X':
+            if (precision >= 0)
+                return -1;
+            if (length == 0)
+                res = std::to_chars(tmp, tmp + IM_ARRAYSIZE(tmp), va_arg(args, unsigned int), type == 'u' ? 10 : 16);
+            else if (length == 1)
+                res = std::to_chars(tmp, tmp + IM_ARRAYSIZE(tmp), va_arg(args, unsigned long), type == 'u' ? 10 : 16);
+            else
+                res = std::to_chars(tmp, tmp + IM_ARRAYSIZE(tmp), va_arg(args, unsigned long long), type == 'u' ? 10 : 16);
+            if (type == 'X')
+                for (char* c = tmp; c < res.ptr; c++)
+                    *c -= (*c >= 'a') ? 'a' - 'A' : 0; // No branch: letters and digits are equally likely
+            break;
+        case 'f':
+        {
+            if (zero_pad_width >= 0 || length == 2)
+                return -1;
+            if (!locale_checked)
+            {
+                const char* decimal_point = localeconv()->decimal_point;
+                if (decimal_point[0] != '.' || decimal_point[1] != 0)
+                    return -1;
+                locale_checked = true;
+            }
+            res = std::to_chars(tmp, tmp + IM_ARRAYSIZE(tmp), va_arg(args, double), std::chars_format::fixed, precision < 0 ? 6 : precision);
+            if (res.ec != std::errc() || tmp[tmp[0] == '-'] == 'i' || tmp[tmp[0] == '-'] == 'n') // Doesn't fit, inf, nan: spelling varies between C libraries
+                return -1;
+            break;
+        }
+        case 'c':
+            if (zero_pad_width >= 0 || precision >= 0 || length != 0)
+                return -1;
+            tmp[0] = (char)va_arg(args, int);
+            res.ptr = tmp + 1;
+            break;
+        case 's':
+            if (zero_pad_width >= 0 || precision >= 0 || length != 0)
+                return -1;
+            value = va_arg(args, const char*);
+            if (value == NULL)
+                value = "(null)";
+            ImFormatStringFastAppend(buf, buf_size, &out_len, value, strlen(value));
+            continue;
+        default:
+            return -1;
+        }
+
+        // Integers are zero-padded after their sign
+        size_t value_len = (size_t)(res.ptr - value);
+        if (zero_pad_width > (int)value_len)
+        {
+            if (value[0] == '-')
+                ImFormatStringFastAppend(buf, buf_size, &out_len, value++, 1);
+            ImFormatStringFastAppendZeros(buf, buf_size, &out_len, (size_t)zero_pad_width - value_len);
+            value_len = (size_t)(res.ptr - value);
+        }
+        ImFormatStringFastAppend(buf, buf_size, &out_len, value, value_len);
+    }
+    return (int)out_len;
+}
+#endif // #ifdef __cpp_lib_to_chars
+
 int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
 {
     va_list args;
     va_start(args, fmt);
-#ifdef IMGUI_USE_STB_SPRINTF
-    int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
-#else
-    int w = vsnprintf(buf, buf_size, fmt, args);
-#endif
+    int w = ImFormatStringV(buf, buf_size, fmt, args);
     va_end(args);
-    if (buf == NULL)
-        return w;
-    if (w == -1 || w >= (int)buf_size)
-        w = (int)buf_size - 1;
-    buf[w] = 0;
     return w;
 }
 
 int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 {
+    int w = -1;
+#ifdef __cpp_lib_to_chars
+    if (buf != NULL && buf_size > 0)
+    {
+        va_list args_copy;
+        va_copy(args_copy, args);
+        w = ImFormatStringFastV(buf, buf_size, fmt, args_copy);
+        va_end(args_copy);
+    }
+#endif
+    if (w < 0)
+    {
 #ifdef IMGUI_USE_STB_SPRINTF
-    int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
+        w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
 #else
-    int w = vsnprintf(buf, buf_size, fmt, args);
+        w = vsnprintf(buf, buf_size, fmt, args);
 #endif
+    }
     if (buf == NULL)
         return w;
     if (w == -1 || w >= (int)buf_size)
@@ -1544,6 +1735,36 @@ int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 }
 #endif // #ifdef IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS
 
+// Format into g.TempBuffer, or skip formatting and return the argument itself for "%s" and "%.*s" (no copy, no length limit).
+void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end, const char* fmt, va_list args)
+{
+    ImGuiContext& g = *GImGui;
+    if (fmt[0] == '%' && fmt[1] == 's' && fmt[2] == 0)
+    {
+        const char* buf = va_arg(args, const char*);
+        if (buf == NULL)
+            buf = "(null)";
+        *out_buf = buf;
+        *out_buf_end = buf + strlen(buf);
+    }
+    else if (fmt[0] == '%' && fmt[1] == '.' && fmt[2] == '*' && fmt[3] == 's' && fmt[4] == 0)
+    {
+        // Same as printf(): a negative precision is ignored, and the argument stops at its zero-terminator
+        const int buf_len = va_arg(args, int);
+        const char* buf = va_arg(args, const char*);
+        if (buf == NULL)
+            buf = "(null)";
+        const char* buf_end = (buf_len < 0) ? NULL : (const char*)memchr(buf, 0, (size_t)buf_len);
+        *out_buf = buf;
+        *out_buf_end = buf_end ? buf_end : (buf_len < 0) ? buf + strlen(buf) : buf + buf_len;
+    }
+    else
+    {
+        *out_buf = g.TempBuffer;
+        *out_buf_end = g.TempBuffer + ImFormatStringV(g.TempBuffer, IM_ARRAYSIZE(g.TempBuffer), fmt, args);
+    }
+}
+
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -1687,6 +1908,39 @@ void*   ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_f
     return file_data;
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] MISC HELPERS/UTILITIES (Time functions)
+//-----------------------------------------------------------------------------
+
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+static LONGLONG ImTimeGetFrequency()
+{
+    LARGE_INTEGER frequency;
+    ::QueryPerformanceFrequency(&frequency);
+    return frequency.QuadPart;
+}
+
+ImU64 ImTimeGetMicroseconds()
+{
+    static const LONGLONG frequency = ImTimeGetFrequency(); // Thread-safe initialization
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return (ImU64)((counter.QuadPart / frequency) * 1000000 + ((counter.QuadPart % frequency) * 1000000) / frequency);
+}
+#elif defined(CLOCK_MONOTONIC)
+ImU64 ImTimeGetMicroseconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000 + (ImU64)ts.tv_nsec / 1000;
+}
+#else
+ImU64 ImTimeGetMicroseconds()
+{
+    return (ImU64)clock() * 1000000 / CLOCKS_PER_SEC;
+}
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
@@ -1746,14 +2000,116 @@ int ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char*
     return wanted;
 }
 
+// The functions converting whole strings process runs of ASCII characters (and in ImTextStrToUtf8(), of 2-bytes characters)
+// by blocks with SSE2, and other characters one at a time. The output is the same as converting every character separately.
+
+// Valid 2, 3 and 4-bytes sequences, decoded without the error handling of ImTextCharFromUtf8(), with the same result
+// (including IM_UNICODE_CODEPOINT_INVALID for characters above IM_UNICODE_CODEPOINT_MAX). Returns 0 for anything else.
+static inline int ImTextCharFromUtf8Valid(unsigned int* out_char, const char* in_text, const char* in_text_end)
+{
+    const unsigned char* s = (const unsigned char*)in_text;
+    if (s[0] >= 0xC2 && s[0] <= 0xDF && in_text_end - in_text >= 2 && (s[1] & 0xC0) == 0x80)
+    {
+        *out_char = ((unsigned int)(s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+        return 2;
+    }
+    if ((s[0] & 0xF0) == 0xE0 && in_text_end - in_text >= 3 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80)
+    {
+        const unsigned int c = ((unsigned int)(s[0] & 0x0F) << 12) | ((unsigned int)(s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+        if (c >= 0x800 && (c & 0xF800) != 0xD800) // Not overlong, not a surrogate half
+        {
+            *out_char = c;
+            return 3;
+        }
+    }
+    if (s[0] >= 0xF0 && s[0] <= 0xF4 && in_text_end - in_text >= 4 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80 && (s[3] & 0xC0) == 0x80)
+    {
+        const unsigned int c = ((unsigned int)(s[0] & 0x07) << 18) | ((unsigned int)(s[1] & 0x3F) << 12) | ((unsigned int)(s[2] & 0x3F) << 6) | (s[3] & 0x3F);
+        if (c >= 0x10000 && c <= 0x10FFFF)
+        {
+            *out_char = (c <= IM_UNICODE_CODEPOINT_MAX) ? c : IM_UNICODE_CODEPOINT_INVALID;
+            return 4;
+        }
+    }
+    return 0;
+}
+
+#ifdef IMGUI_ENABLE_SSE2
+static inline int ImTextLowestSetBit(unsigned int mask)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (int)index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+// Mask of the bytes which stop a run of ASCII characters (non-ASCII or zero), 1 bit per byte
+static inline int ImTextAsciiStopMask16(__m128i bytes)
+{
+    return _mm_movemask_epi8(_mm_or_si128(bytes, _mm_cmpeq_epi8(bytes, _mm_setzero_si128())));
+}
+
+static inline void ImTextStoreAscii16(ImWchar* out, __m128i bytes)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+    const __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+#ifdef IMGUI_USE_WCHAR32
+    _mm_storeu_si128((__m128i*)(void*)(out + 0), _mm_unpacklo_epi16(lo, zero));
+    _mm_storeu_si128((__m128i*)(void*)(out + 4), _mm_unpackhi_epi16(lo, zero));
+    _mm_storeu_si128((__m128i*)(void*)(out + 8), _mm_unpacklo_epi16(hi, zero));
+    _mm_storeu_si128((__m128i*)(void*)(out + 12), _mm_unpackhi_epi16(hi, zero));
+#else
+    _mm_storeu_si128((__m128i*)(void*)(out + 0), lo);
+    _mm_storeu_si128((__m128i*)(void*)(out + 8), hi);
+#endif
+}
+
+// Load 8 characters as 16-bit lanes. With 32-bit ImWchar, return false when one of them doesn't fit in 16 bits.
+static inline bool ImTextLoadWchar8(const ImWchar* in, __m128i* out)
+{
+#ifdef IMGUI_USE_WCHAR32
+    const __m128i a = _mm_loadu_si128((const __m128i*)(const void*)(in + 0));
+    const __m128i b = _mm_loadu_si128((const __m128i*)(const void*)(in + 4));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_srli_epi32(_mm_or_si128(a, b), 16), _mm_setzero_si128())) != 0xFFFF)
+        return false;
+    // No _mm_packus_epi32() in SSE2: offset to the signed range, pack with signed saturation, offset back.
+    const __m128i bias = _mm_set1_epi32(0x8000);
+    *out = _mm_add_epi16(_mm_packs_epi32(_mm_sub_epi32(a, bias), _mm_sub_epi32(b, bias)), _mm_set1_epi16((short)0x8000));
+#else
+    *out = _mm_loadu_si128((const __m128i*)(const void*)in);
+#endif
+    return true;
+}
+#endif // #ifdef IMGUI_ENABLE_SSE2
+
 int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const char* in_text_end, const char** in_text_remaining)
 {
     ImWchar* buf_out = buf;
     ImWchar* buf_end = buf + buf_size;
-    while (buf_out < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
+    if (!in_text_end)
+        in_text_end = in_text + strlen(in_text); // Blocks can only be read up to a known end
+    while (buf_out < buf_end - 1 && in_text < in_text_end && *in_text)
     {
+#ifdef IMGUI_ENABLE_SSE2
+        if ((unsigned char)*in_text < 0x80 && in_text_end - in_text >= 16 && buf_end - 1 - buf_out >= 16)
+        {
+            // Up to 16 ASCII characters (at least 1)
+            const __m128i bytes = _mm_loadu_si128((const __m128i*)(const void*)in_text);
+            const int stop_mask = ImTextAsciiStopMask16(bytes);
+            const int n = stop_mask ? ImTextLowestSetBit((unsigned int)stop_mask) : 16;
+            ImTextStoreAscii16(buf_out, bytes);
+            in_text += n;
+            buf_out += n;
+            continue;
+        }
+#endif
         unsigned int c;
-        in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
+        const int c_len = ImTextCharFromUtf8Valid(&c, in_text, in_text_end);
+        in_text += c_len ? c_len : ImTextCharFromUtf8(&c, in_text, in_text_end);
         if (c == 0)
             break;
         *buf_out++ = (ImWchar)c;
@@ -1767,10 +2123,23 @@ int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const cha
 int ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end)
 {
     int char_count = 0;
-    while ((!in_text_end || in_text < in_text_end) && *in_text)
+    if (!in_text_end)
+        in_text_end = in_text + strlen(in_text);
+    while (in_text < in_text_end && *in_text)
     {
+#ifdef IMGUI_ENABLE_SSE2
+        if ((unsigned char)*in_text < 0x80 && in_text_end - in_text >= 16)
+        {
+            const int stop_mask = ImTextAsciiStopMask16(_mm_loadu_si128((const __m128i*)(const void*)in_text));
+            const int n = stop_mask ? ImTextLowestSetBit((unsigned int)stop_mask) : 16;
+            in_text += n;
+            char_count += n;
+            continue;
+        }
+#endif
         unsigned int c;
-        in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
+        const int c_len = ImTextCharFromUtf8Valid(&c, in_text, in_text_end);
+        in_text += c_len ? c_len : ImTextCharFromUtf8(&c, in_text, in_text_end);
         if (c == 0)
             break;
         char_count++;
@@ -1843,6 +2212,43 @@ int ImTextStrToUtf8(char* out_buf, int out_buf_size, const ImWchar* in_text, con
     const char* buf_end = out_buf + out_buf_size;
     while (buf_p < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
     {
+#ifdef IMGUI_ENABLE_SSE2
+        __m128i chars;
+        if (in_text_end && in_text_end - in_text >= 8 && buf_end - 1 - buf_p >= 24 && ImTextLoadWchar8(in_text, &chars))
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const int ascii_mask = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chars, _mm_set1_epi16((short)0xFF80)), zero)); // 2 bits per character
+            const int zero_mask = _mm_movemask_epi8(_mm_cmpeq_epi16(chars, zero));
+            if (ascii_mask & 3)
+            {
+                // Up to 8 ASCII characters (at least 1)
+                const int stop_mask = ~ascii_mask | zero_mask;
+                const int n = (stop_mask & 0xFFFF) ? ImTextLowestSetBit((unsigned int)stop_mask) / 2 : 8;
+                _mm_storel_epi64((__m128i*)(void*)buf_p, _mm_packus_epi16(chars, chars));
+                in_text += n;
+                buf_p += n;
+                continue;
+            }
+            const int two_bytes_mask = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chars, _mm_set1_epi16((short)0xF800)), zero));
+            if (two_bytes_mask == 0xFFFF && ascii_mask == 0)
+            {
+                // 8 characters in [U+0080, U+07FF], 16 bytes: lead byte 110xxxxx, continuation byte 10xxxxxx
+                const __m128i lead = _mm_or_si128(_mm_srli_epi16(chars, 6), _mm_set1_epi16(0xC0));
+                const __m128i cont = _mm_or_si128(_mm_and_si128(chars, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+                _mm_storeu_si128((__m128i*)(void*)buf_p, _mm_or_si128(lead, _mm_slli_epi16(cont, 8)));
+                in_text += 8;
+                buf_p += 16;
+                continue;
+            }
+            if (zero_mask == 0)
+            {
+                // Mixed block: 8 characters one at a time before trying again, there is room for 8 3-bytes characters
+                for (int n = 0; n < 8; n++)
+                    buf_p += ImTextCharToUtf8_inline(buf_p, 3, (unsigned int)*in_text++);
+                continue;
+            }
+        }
+#endif
         unsigned int c = (unsigned int)(*in_text++);
         if (c < 0x80)
             *buf_p++ = (char)c;
@@ -1853,11 +2259,59 @@ int ImTextStrToUtf8(char* out_buf, int out_buf_size, const ImWchar* in_text, con
     return (int)(buf_p - out_buf);
 }
 
+#ifdef IMGUI_ENABLE_SSE2
+// Count the UTF-8 bytes of blocks of 8 characters, until the end, a zero or (with 32-bit ImWchar) a character above U+FFFF.
+static int ImTextCountUtf8BytesFromStrBlocks(const ImWchar** p_in_text, const ImWchar* in_text_end)
+{
+    const ImWchar* in_text = *p_in_text;
+    const __m128i zero = _mm_setzero_si128();
+    int bytes_count = 0;
+    for (bool stopped = false; !stopped && in_text_end - in_text >= 8; )
+    {
+        // Each character is 3 bytes minus (c < 0x80) minus (c < 0x800). Those are counted per lane, and the 16-bit
+        // counters are added up every 8192 blocks at most so they can't overflow.
+        __m128i below_counts = zero;
+        int blocks = 0;
+        for (; blocks < 8192 && in_text_end - in_text >= 8; blocks++, in_text += 8)
+        {
+            __m128i chars;
+            if (!ImTextLoadWchar8(in_text, &chars) || _mm_movemask_epi8(_mm_cmpeq_epi16(chars, zero)) != 0)
+            {
+                stopped = true;
+                break;
+            }
+            below_counts = _mm_sub_epi16(below_counts, _mm_cmpeq_epi16(_mm_and_si128(chars, _mm_set1_epi16((short)0xFF80)), zero));
+            below_counts = _mm_sub_epi16(below_counts, _mm_cmpeq_epi16(_mm_and_si128(chars, _mm_set1_epi16((short)0xF800)), zero));
+        }
+        __m128i sums = _mm_madd_epi16(below_counts, _mm_set1_epi16(1));
+        sums = _mm_add_epi32(sums, _mm_shuffle_epi32(sums, _MM_SHUFFLE(1, 0, 3, 2)));
+        sums = _mm_add_epi32(sums, _mm_shuffle_epi32(sums, _MM_SHUFFLE(2, 3, 0, 1)));
+        bytes_count += blocks * 24 - _mm_cvtsi128_si32(sums);
+    }
+    *p_in_text = in_text;
+    return bytes_count;
+}
+#endif
+
 int ImTextCountUtf8BytesFromStr(const ImWchar* in_text, const ImWchar* in_text_end)
 {
     int bytes_count = 0;
+#ifdef IMGUI_ENABLE_SSE2
+    const ImWchar* blocks_retry = in_text;
+#endif
     while ((!in_text_end || in_text < in_text_end) && *in_text)
     {
+#ifdef IMGUI_ENABLE_SSE2
+        if (in_text_end && in_text >= blocks_retry && in_text_end - in_text >= 8)
+        {
+            // The characters of the block which stopped ImTextCountUtf8BytesFromStrBlocks() are counted one by one
+            const ImWchar* blocks_start = in_text;
+            bytes_count += ImTextCountUtf8BytesFromStrBlocks(&in_text, in_text_end);
+            blocks_retry = in_text + 8;
+            if (in_text != blocks_start)
+                continue;
+        }
+#endif
         unsigned int c = (unsigned int)(*in_text++);
         if (c < 0x80)
             bytes_count++;
@@ -2100,6 +2554,204 @@ void ImGuiStorage::SetAllInt(int v)
         Data[i].val_i = v;
 }
 
+// Helper: ImRectGrid
+// Cell coordinates are clamped to 16-bit so each cell has its own key (parts of rectangles further away share the border cells).
+static inline int ImRectGridCellCoord(float v, float cell_size)
+{
+    return (int)ImFloor(ImClamp(v / cell_size, -32768.0f, 32767.0f));
+}
+
+static inline ImGuiID ImRectGridCellKey(int cx, int cy)
+{
+    return ((ImGuiID)(cx + 32768) << 16) | (ImGuiID)(cy + 32768);
+}
+
+void ImRectGrid::Clear()
+{
+    // Keep the keys of the cells used recently, unless most of them are unused (e.g. after rectangles moved a lot)
+    int used_cells = 0;
+    for (int i = 0; i < Cells.Data.Size; i++)
+        if (Cells.Data[i].val_i != 0)
+        {
+            Cells.Data[i].val_i = 0;
+            used_cells++;
+        }
+    if (Cells.Data.Size > used_cells * 4 + 256)
+        Cells.Clear();
+    Entries.resize(0);
+    LargeValues.resize(0);
+}
+
+void ImRectGrid::Add(const ImRect& r, int value)
+{
+    const int LARGE_RECT_MAX_CELLS = 64;
+    const int cx0 = ImRectGridCellCoord(r.Min.x, CellSize), cx1 = ImRectGridCellCoord(r.Max.x, CellSize);
+    const int cy0 = ImRectGridCellCoord(r.Min.y, CellSize), cy1 = ImRectGridCellCoord(r.Max.y, CellSize);
+    if (cx1 < cx0 || cy1 < cy0)
+        return; // Inverted rectangle (e.g. fully clipped child window): can't contain any point
+    if (cx1 - cx0 + 1 > LARGE_RECT_MAX_CELLS || (cx1 - cx0 + 1) * (cy1 - cy0 + 1) > LARGE_RECT_MAX_CELLS)
+    {
+        LargeValues.push_back(value);
+        return;
+    }
+    for (int cy = cy0; cy <= cy1; cy++)
+        for (int cx = cx0; cx <= cx1; cx++)
+        {
+            int* first_entry = Cells.GetIntRef(ImRectGridCellKey(cx, cy), 0);
+            Entry entry;
+            entry.Value = value;
+            entry.Next = *first_entry - 1;
+            entry.Count = (entry.Next != -1) ? Entries[entry.Next].Count + 1 : 1;
+            Entries.push_back(entry);
+            *first_entry = Entries.Size;
+        }
+}
+
+int ImRectGrid::GetFirstEntry(const ImVec2& p) const
+{
+    return Cells.GetInt(ImRectGridCellKey(ImRectGridCellCoord(p.x, CellSize), ImRectGridCellCoord(p.y, CellSize)), 0) - 1;
+}
+
+// Helper: ImTextLayoutCache
+static inline size_t ImTextLayoutBytes(const ImTextLayout& layout)
+{
+    return sizeof(ImTextLayout) + sizeof(ImGuiStorage::ImGuiStoragePair) + (size_t)layout.WrapEols.Size * sizeof(int) + (size_t)layout.Text.Size;
+}
+
+void ImTextLayoutCache::Clear()
+{
+    for (int n = 0; n < Layouts.Size; n++)
+    {
+        Layouts[n].WrapEols.clear();
+        Layouts[n].Text.clear();
+    }
+    Layouts.clear();
+    Map.Clear();
+    Bytes = 0;
+}
+
+const ImTextLayout* ImTextLayoutCache::GetLayout(const ImFont* font, float size, float max_width, float wrap_width, const char* text, const char* text_end, int frame_count, size_t budget)
+{
+    if (text_end == NULL)
+        text_end = text + strlen(text);
+    const int text_len = (int)(text_end - text);
+    if (text_len < MIN_TEXT_LEN || budget == 0)
+        return NULL;
+    if (FrameCount != frame_count)
+    {
+        FrameCount = frame_count;
+        FrameHits = FrameMisses = 0;
+    }
+
+    // Glyph advances change when the atlas is built again, possibly with new ImFont instances at the same addresses
+    IM_ASSERT(font->ContainerAtlas != NULL);
+    if (FontAtlas != font->ContainerAtlas || FontAtlasBuildCount != font->ContainerAtlas->TexBuildCount)
+    {
+        Clear();
+        FontAtlas = font->ContainerAtlas;
+        FontAtlasBuildCount = font->ContainerAtlas->TexBuildCount;
+    }
+
+    // Hash the text with ImHashData(): ImHashStr() would give the same hash for "a###b" and "c###b"
+    if (wrap_width <= 0.0f)
+        wrap_width = 0.0f;
+    const float params[3] = { size, max_width, wrap_width };
+    const ImGuiID seed = ImHashData(params, sizeof(params), ImHashData(&font, sizeof(font)));
+    const ImGuiID key = ImHashData(text, (size_t)text_len, seed);
+    if (int layout_idx = Map.GetInt(key, 0))
+    {
+        ImTextLayout& layout = Layouts[layout_idx - 1];
+        if (layout.TextLen != text_len || layout.Font != font || layout.Size != size || layout.MaxWidth != max_width || layout.WrapWidth != wrap_width || memcmp(layout.Text.Data, text, (size_t)text_len) != 0)
+            return NULL; // Hash collision: leave it to the caller
+        layout.LastFrameUsed = frame_count;
+        FrameHits++;
+        return &layout;
+    }
+    FrameMisses++;
+
+    // Make room, at most once per frame if entries used during the frame alone are over the budget
+    if (Bytes >= budget)
+    {
+        if (FrameCountTrimmed == frame_count)
+            return NULL;
+        Trim(budget - budget / 4, frame_count);
+        if (Bytes >= budget)
+        {
+            FrameCountTrimmed = frame_count;
+            return NULL;
+        }
+    }
+
+    Layouts.push_back(ImTextLayout());
+    ImTextLayout& layout = Layouts.back();
+    layout.Key = key;
+    layout.TextLen = text_len;
+    layout.Font = font;
+    layout.Size = size;
+    layout.MaxWidth = max_width;
+    layout.WrapWidth = wrap_width;
+    layout.LastFrameUsed = frame_count;
+    layout.Text.resize(text_len);
+    memcpy(layout.Text.Data, text, (size_t)text_len);
+    const char* remaining = NULL;
+    layout.TextSize = ImFontCalcTextSizeEx(font, size, max_width, wrap_width, text, text_end, &remaining, (wrap_width > 0.0f) ? &layout.WrapEols : NULL);
+    layout.RemainingOffset = (int)(remaining - text);
+    Map.SetInt(key, Layouts.Size);
+    Bytes += ImTextLayoutBytes(layout);
+    return &layout;
+}
+
+void ImTextLayoutCache::Trim(size_t max_bytes, int frame_count)
+{
+    if (Bytes <= max_bytes)
+        return;
+    struct TrimCandidate
+    {
+        int     LastFrameUsed;
+        int     Index;
+
+        static int IMGUI_CDECL CompareByLastFrameUsed(const void* lhs, const void* rhs)
+        {
+            const int a = ((const TrimCandidate*)lhs)->LastFrameUsed;
+            const int b = ((const TrimCandidate*)rhs)->LastFrameUsed;
+            return (a < b) ? -1 : (a > b) ? +1 : 0;
+        }
+    };
+    ImVector<TrimCandidate> candidates;
+    for (int n = 0; n < Layouts.Size; n++)
+        if (Layouts[n].LastFrameUsed != frame_count)
+        {
+            TrimCandidate candidate = { Layouts[n].LastFrameUsed, n };
+            candidates.push_back(candidate);
+        }
+    if (candidates.Size == 0)
+        return;
+    ImQsort(candidates.Data, (size_t)candidates.Size, sizeof(TrimCandidate), TrimCandidate::CompareByLastFrameUsed);
+
+    // Evicted entries get TextLen = -1, then the others are moved down and the map is built again
+    for (int n = 0; n < candidates.Size && Bytes > max_bytes; n++)
+    {
+        ImTextLayout& layout = Layouts[candidates[n].Index];
+        Bytes -= ImTextLayoutBytes(layout);
+        layout.WrapEols.clear();
+        layout.Text.clear();
+        layout.TextLen = -1;
+    }
+    int dst = 0;
+    for (int n = 0; n < Layouts.Size; n++)
+        if (Layouts[n].TextLen >= 0)
+        {
+            if (dst != n)
+                memcpy(&Layouts[dst], &Layouts[n], sizeof(ImTextLayout)); // Not operator=, which would copy WrapEols and Text: their buffers are moved to Layouts[dst]
+            dst++;
+        }
+    Layouts.resize(dst);
+    Map.Data.resize(0);
+    for (int n = 0; n < Layouts.Size; n++)
+        Map.Data.push_back(ImGuiStorage::ImGuiStoragePair(Layouts[n].Key, n + 1));
+    Map.BuildSortByKey();
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiTextFilter
 //-----------------------------------------------------------------------------
@@ -2206,16 +2858,6 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
 // [SECTION] ImGuiTextBuffer
 //-----------------------------------------------------------------------------
 
-// On some platform vsnprintf() takes va_list by reference and modifies it.
-// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
-#ifndef va_copy
-#if defined(__GNUC__) || defined(__clang__)
-#define va_copy(dest, src) __builtin_va_copy(dest, src)
-#else
-#define va_copy(dest, src) (dest = src)
-#endif
-#endif
-
 char ImGuiTextBuffer::EmptyString[1] = { 0 };
 
 void ImGuiTextBuffer::append(const char* str, const char* str_end)
@@ -2876,7 +3518,19 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
 
     if (text != text_end)
     {
-        window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
+        // Long wrapped texts: take the word-wrap positions from the cache (the same as CalcTextSize() used for the item size)
+        const ImTextLayout* layout = (wrap_width > 0.0f) ? GetTextLayout(g.Font, g.FontSize, FLT_MAX, wrap_width, text, text_end) : NULL;
+        if (layout)
+        {
+            ImDrawList* draw_list = window->DrawList;
+            const ImU32 col = GetColorU32(ImGuiCol_Text);
+            if (col & IM_COL32_A_MASK)
+                ImFontRenderTextEx(g.Font, draw_list, g.FontSize, pos, col, draw_list->_CmdHeader.ClipRect, text, text_end, wrap_width, false, &layout->WrapEols);
+        }
+        else
+        {
+            window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
+        }
         if (g.LogEnabled)
             LogRenderedText(&pos, text, text_end);
     }
@@ -2975,7 +3629,16 @@ void ImGui::RenderTextEllipsis(ImDrawList* draw_list, const ImVec2& pos_min, con
 
         // We can now claim the space between pos_max.x and ellipsis_max.x
         const float text_avail_width = ImMax((ImMax(pos_max.x, ellipsis_max_x) - ellipsis_total_width) - pos_min.x, 1.0f);
-        float text_size_clipped_x = font->CalcTextSizeA(font_size, text_avail_width, 0.0f, text, text_end_full, &text_end_ellipsis).x;
+        float text_size_clipped_x;
+        if (const ImTextLayout* layout = GetTextLayout(font, font_size, text_avail_width, 0.0f, text, text_end_full))
+        {
+            text_size_clipped_x = layout->TextSize.x;
+            text_end_ellipsis = text + layout->RemainingOffset;
+        }
+        else
+        {
+            text_size_clipped_x = font->CalcTextSizeA(font_size, text_avail_width, 0.0f, text, text_end_full, &text_end_ellipsis).x;
+        }
         if (text == text_end_ellipsis && text_end_ellipsis < text_end_full)
         {
             // Always display at least 1 character if there's no room for character + ellipsis
@@ -3103,6 +3766,7 @@ ImGuiWindow::~ImGuiWindow()
 {
     IM_ASSERT(DrawList == &DrawListInst);
     IM_DELETE(Name);
+    IM_DELETE(PerfStats);
     ColumnsStorage.clear_destruct();
 }
 
@@ -3193,6 +3857,7 @@ void ImGui::GcCompactTransientMiscBuffers()
     ImGuiContext& g = *GImGui;
     g.ItemFlagsStack.clear();
     g.GroupStack.clear();
+    g.TextLayoutCache.Clear();
     TableGcCompactSettings();
 }
 
@@ -3222,6 +3887,189 @@ void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
 }
 
+template<typename T>
+static inline size_t ImVectorMemoryUsage(const ImVector<T>& v)
+{
+    return (size_t)v.Capacity * sizeof(T);
+}
+
+static size_t ImDrawListMemoryUsage(const ImDrawList* draw_list)
+{
+    size_t bytes = ImVectorMemoryUsage(draw_list->CmdBuffer) + ImVectorMemoryUsage(draw_list->IdxBuffer) + ImVectorMemoryUsage(draw_list->VtxBuffer);
+    bytes += ImVectorMemoryUsage(draw_list->_ClipRectStack) + ImVectorMemoryUsage(draw_list->_TextureIdStack) + ImVectorMemoryUsage(draw_list->_Path);
+    bytes += ImVectorMemoryUsage(draw_list->_Splitter._Channels);
+    for (int n = 0; n < draw_list->_Splitter._Channels.Size; n++)
+        if (n != draw_list->_Splitter._Current) // Current channel is a copy of CmdBuffer/IdxBuffer
+            bytes += ImVectorMemoryUsage(draw_list->_Splitter._Channels[n]._CmdBuffer) + ImVectorMemoryUsage(draw_list->_Splitter._Channels[n]._IdxBuffer);
+    return bytes;
+}
+
+static size_t ImDrawListSplitterMemoryUsage(const ImDrawListSplitter* splitter)
+{
+    // Channel 0 doesn't own buffers while splitting (see ImDrawListSplitter::Split()), and outside of splitting only channel 0 is current
+    size_t bytes = ImVectorMemoryUsage(splitter->_Channels);
+    for (int n = 1; n < splitter->_Channels.Size; n++)
+        bytes += ImVectorMemoryUsage(splitter->_Channels[n]._CmdBuffer) + ImVectorMemoryUsage(splitter->_Channels[n]._IdxBuffer);
+    return bytes;
+}
+
+// What GcCompactTransientWindowBuffers() would free
+static size_t GcWindowTransientMemoryUsage(const ImGuiWindow* window)
+{
+    size_t bytes = ImDrawListMemoryUsage(window->DrawList) + ImVectorMemoryUsage(window->IDStack);
+    bytes += ImVectorMemoryUsage(window->DC.ChildWindows) + ImVectorMemoryUsage(window->DC.ItemWidthStack) + ImVectorMemoryUsage(window->DC.TextWrapPosStack);
+    return bytes;
+}
+
+// What TableGcCompactTransientBuffers() would free
+static size_t GcTableTransientMemoryUsage(const ImGuiTable* table)
+{
+    return ImVectorMemoryUsage(table->ColumnsNames.Buf) + ImVectorMemoryUsage(table->SortSpecsMulti);
+}
+
+static bool GcIsWindowCompactable(const ImGuiWindow* window)
+{
+    return !window->Active && !window->WasActive && !window->MemoryCompacted;
+}
+
+ImGuiMemoryUsage ImGui::GetMemoryUsage()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiMemoryUsage usage;
+    size_t* bytes = usage.Bytes;
+
+    // Windows and their draw lists
+    bytes[ImGuiMemoryCategory_Windows] += ImVectorMemoryUsage(g.Windows) + ImVectorMemoryUsage(g.WindowsFocusOrder) + ImVectorMemoryUsage(g.WindowsTempSortBuffer) + ImVectorMemoryUsage(g.CurrentWindowStack);
+    for (int i = 0; i < g.Windows.Size; i++)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        bytes[ImGuiMemoryCategory_Windows] += sizeof(ImGuiWindow) + strlen(window->Name) + 1 + ImVectorMemoryUsage(window->IDStack) + ImVectorMemoryUsage(window->ColumnsStorage);
+        bytes[ImGuiMemoryCategory_Windows] += ImVectorMemoryUsage(window->DC.ChildWindows) + ImVectorMemoryUsage(window->DC.ItemWidthStack) + ImVectorMemoryUsage(window->DC.TextWrapPosStack);
+        for (int n = 0; n < window->ColumnsStorage.Size; n++)
+            bytes[ImGuiMemoryCategory_Windows] += ImVectorMemoryUsage(window->ColumnsStorage[n].Columns);
+        bytes[ImGuiMemoryCategory_DrawLists] += ImDrawListMemoryUsage(window->DrawList); // sizeof(ImDrawList) is part of sizeof(ImGuiWindow)
+        bytes[ImGuiMemoryCategory_Storage] += ImVectorMemoryUsage(window->StateStorage.Data);
+        if (GcIsWindowCompactable(window))
+            usage.CompactableBytes += GcWindowTransientMemoryUsage(window);
+    }
+    for (int n = 0; n < g.DockContext.Nodes.Data.Size; n++)
+        if (ImGuiDockNode* node = (ImGuiDockNode*)g.DockContext.Nodes.Data[n].val_p)
+            bytes[ImGuiMemoryCategory_Windows] += sizeof(ImGuiDockNode) + ImVectorMemoryUsage(node->Windows) + (node->TabBar ? sizeof(ImGuiTabBar) + ImVectorMemoryUsage(node->TabBar->Tabs) : 0);
+    for (int n = 0; n < g.Viewports.Size; n++)
+    {
+        ImGuiViewportP* viewport = g.Viewports[n];
+        for (int layer = 0; layer < IM_ARRAYSIZE(viewport->DrawLists); layer++)
+            if (viewport->DrawLists[layer])
+                bytes[ImGuiMemoryCategory_DrawLists] += sizeof(ImDrawList) + ImDrawListMemoryUsage(viewport->DrawLists[layer]);
+        for (int layer = 0; layer < IM_ARRAYSIZE(viewport->DrawDataBuilder.Layers); layer++)
+            bytes[ImGuiMemoryCategory_DrawLists] += ImVectorMemoryUsage(viewport->DrawDataBuilder.Layers[layer]);
+    }
+
+    // Fonts
+    if (ImFontAtlas* atlas = g.IO.Fonts)
+    {
+        if (atlas->TexPixelsAlpha8)
+            bytes[ImGuiMemoryCategory_Fonts] += (size_t)atlas->TexWidth * atlas->TexHeight;
+        if (atlas->TexPixelsRGBA32)
+            bytes[ImGuiMemoryCategory_Fonts] += (size_t)atlas->TexWidth * atlas->TexHeight * 4;
+        bytes[ImGuiMemoryCategory_Fonts] += ImVectorMemoryUsage(atlas->Fonts) + ImVectorMemoryUsage(atlas->CustomRects) + ImVectorMemoryUsage(atlas->ConfigData);
+        for (int n = 0; n < atlas->ConfigData.Size; n++)
+            if (atlas->ConfigData[n].FontDataOwnedByAtlas && atlas->ConfigData[n].FontData)
+                bytes[ImGuiMemoryCategory_Fonts] += (size_t)atlas->ConfigData[n].FontDataSize;
+        for (int n = 0; n < atlas->Fonts.Size; n++)
+        {
+            const ImFont* font = atlas->Fonts[n];
+            bytes[ImGuiMemoryCategory_Fonts] += sizeof(ImFont) + ImVectorMemoryUsage(font->IndexPages) + ImVectorMemoryUsage(font->IndexAdvanceX) + ImVectorMemoryUsage(font->IndexLookup) + ImVectorMemoryUsage(font->Glyphs);
+        }
+    }
+
+    // Tables
+    bytes[ImGuiMemoryCategory_Tables] += ImVectorMemoryUsage(g.Tables.Buf) + ImVectorMemoryUsage(g.TablesLastTimeActive) + ImVectorMemoryUsage(g.TablesTempData) + ImVectorMemoryUsage(g.DrawChannelsTempMergeBuffer) + ImVectorMemoryUsage(g.DrawChannelsTempMergeMasks);
+    for (int n = 0; n < g.Tables.GetMapSize(); n++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(n))
+        {
+            bytes[ImGuiMemoryCategory_Tables] += table->Columns.size_in_bytes() + table->DisplayOrderToIndex.size_in_bytes() + table->RowCellData.size_in_bytes() + table->OffsetsByDisplayOrder.size_in_bytes() + table->OutputColumns.size_in_bytes() + ImBitArrayGetStorageSizeInBytes(table->Columns.size()) * 6; // RawData
+            bytes[ImGuiMemoryCategory_Tables] += GcTableTransientMemoryUsage(table);
+            const int table_idx = g.Tables.GetIndex(table);
+            if (table->LastFrameActive < g.FrameCount - 1 && table_idx < g.TablesLastTimeActive.Size && g.TablesLastTimeActive[table_idx] >= 0.0f)
+                usage.CompactableBytes += GcTableTransientMemoryUsage(table);
+        }
+    for (int n = 0; n < g.TablesTempData.Size; n++)
+    {
+        const ImGuiTableTempData* temp_data = &g.TablesTempData[n];
+        const size_t splitter_bytes = ImDrawListSplitterMemoryUsage(&temp_data->DrawSplitter);
+        bytes[ImGuiMemoryCategory_Tables] += splitter_bytes;
+        if (temp_data->LastFrameActive < g.FrameCount - 1 && temp_data->LastTimeActive >= 0.0f)
+            usage.CompactableBytes += splitter_bytes;
+    }
+
+    // Storage
+    bytes[ImGuiMemoryCategory_Storage] += ImVectorMemoryUsage(g.WindowsById.Data) + ImVectorMemoryUsage(g.Tables.Map.Data) + ImVectorMemoryUsage(g.TabBars.Map.Data) + ImVectorMemoryUsage(g.DockContext.Nodes.Data);
+    bytes[ImGuiMemoryCategory_Storage] += ImVectorMemoryUsage(g.WindowsHitGrid.Cells.Data) + ImVectorMemoryUsage(g.WindowsHitGrid.Entries) + ImVectorMemoryUsage(g.WindowsHitGrid.LargeValues) + ImVectorMemoryUsage(g.WindowsHitGridWindows);
+    bytes[ImGuiMemoryCategory_Storage] += ImVectorMemoryUsage(g.SettingsWindowsById.Data) + ImVectorMemoryUsage(g.SettingsTablesById.Data) + ImVectorMemoryUsage(g.DockContext.NodesSettingsById.Data);
+
+    // Settings
+    bytes[ImGuiMemoryCategory_Settings] += ImVectorMemoryUsage(g.SettingsIniData.Buf) + ImVectorMemoryUsage(g.SettingsHandlers) + ImVectorMemoryUsage(g.SettingsWindows.Buf) + ImVectorMemoryUsage(g.SettingsTables.Buf);
+    bytes[ImGuiMemoryCategory_Settings] += ImVectorMemoryUsage(g.SettingsWindowsIniCache) + ImVectorMemoryUsage(g.SettingsWindowsIniText.Buf) + ImVectorMemoryUsage(g.SettingsTablesIniText.Buf) + ImVectorMemoryUsage(g.DockContext.NodesSettings);
+
+    // Text layouts
+    bytes[ImGuiMemoryCategory_TextLayouts] += ImVectorMemoryUsage(g.TextLayoutCache.Layouts) + ImVectorMemoryUsage(g.TextLayoutCache.Map.Data);
+    for (int n = 0; n < g.TextLayoutCache.Layouts.Size; n++)
+        bytes[ImGuiMemoryCategory_TextLayouts] += ImVectorMemoryUsage(g.TextLayoutCache.Layouts[n].WrapEols) + ImVectorMemoryUsage(g.TextLayoutCache.Layouts[n].Text);
+
+    for (int n = 0; n < ImGuiMemoryCategory_COUNT; n++)
+        usage.TotalBytes += bytes[n];
+    return usage;
+}
+
+// Free transient buffers of hidden windows and of tables not used in the last frame, least recently used first,
+// until at least 'bytes_to_free' bytes were freed or there is nothing left to free. Used when over io.ConfigMemoryCompactBudget.
+void ImGui::GcCompactLeastRecentlyUsed(size_t bytes_to_free)
+{
+    ImGuiContext& g = *GImGui;
+    struct GcCandidate
+    {
+        float   LastTimeActive;
+        int     Type;           // 0: window, 1: table, 2: table temp data
+        int     Index;          // In g.Windows[], g.Tables.Buf[] or g.TablesTempData[]
+        size_t  Bytes;
+
+        GcCandidate(float last_time_active, int type, int index, size_t bytes) { LastTimeActive = last_time_active; Type = type; Index = index; Bytes = bytes; }
+        static int IMGUI_CDECL CompareByLastTimeActive(const void* lhs, const void* rhs)
+        {
+            const float a = ((const GcCandidate*)lhs)->LastTimeActive;
+            const float b = ((const GcCandidate*)rhs)->LastTimeActive;
+            return (a < b) ? -1 : (a > b) ? +1 : 0;
+        }
+    };
+    ImVector<GcCandidate> candidates;
+    for (int i = 0; i < g.Windows.Size; i++)
+        if (GcIsWindowCompactable(g.Windows[i]))
+            candidates.push_back(GcCandidate(g.Windows[i]->LastTimeActive, 0, i, GcWindowTransientMemoryUsage(g.Windows[i])));
+    for (int i = 0; i < g.TablesLastTimeActive.Size; i++)
+        if (g.TablesLastTimeActive[i] >= 0.0f && g.Tables.GetByIndex(i)->LastFrameActive < g.FrameCount - 1)
+            candidates.push_back(GcCandidate(g.TablesLastTimeActive[i], 1, i, GcTableTransientMemoryUsage(g.Tables.GetByIndex(i))));
+    for (int i = 0; i < g.TablesTempData.Size; i++)
+        if (g.TablesTempData[i].LastTimeActive >= 0.0f && g.TablesTempData[i].LastFrameActive < g.FrameCount - 1)
+            candidates.push_back(GcCandidate(g.TablesTempData[i].LastTimeActive, 2, i, ImDrawListSplitterMemoryUsage(&g.TablesTempData[i].DrawSplitter)));
+    if (candidates.Size == 0)
+        return;
+    ImQsort(candidates.Data, (size_t)candidates.Size, sizeof(GcCandidate), GcCandidate::CompareByLastTimeActive);
+
+    size_t bytes_freed = 0;
+    for (int n = 0; n < candidates.Size && bytes_freed < bytes_to_free; n++)
+    {
+        const GcCandidate& candidate = candidates[n];
+        if (candidate.Type == 0)
+            GcCompactTransientWindowBuffers(g.Windows[candidate.Index]);
+        else if (candidate.Type == 1)
+            TableGcCompactTransientBuffers(g.Tables.GetByIndex(candidate.Index));
+        else
+            TableGcCompactTransientBuffers(&g.TablesTempData[candidate.Index]);
+        bytes_freed += candidate.Bytes;
+    }
+}
+
 void ImGui::SetActiveID(ImGuiID id, ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
@@ -3482,8 +4330,7 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
 // IM_ALLOC() == ImGui::MemAlloc()
 void* ImGui::MemAlloc(size_t size)
 {
-    if (ImGuiContext* ctx = GImGui)
-        ctx->IO.MetricsActiveAllocations++;
+    GImAllocatorActiveAllocations.fetch_add(1, std::memory_order_relaxed);
     return (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 }
 
@@ -3491,8 +4338,7 @@ void* ImGui::MemAlloc(size_t size)
 void ImGui::MemFree(void* ptr)
 {
     if (ptr)
-        if (ImGuiContext* ctx = GImGui)
-            ctx->IO.MetricsActiveAllocations--;
+        GImAllocatorActiveAllocations.fetch_sub(1, std::memory_order_relaxed);
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
 
@@ -3641,6 +4487,9 @@ static ImDrawList* GetViewportDrawList(ImGuiViewportP* viewport, size_t drawlist
     if (viewport->DrawListsLastFrame[drawlist_no] != g.FrameCount)
     {
         draw_list->_ResetForNewFrame();
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        draw_list->VtxOrigin = ImFloor(viewport->GetCenter());
+#endif
         draw_list->PushTextureID(g.IO.Fonts->TexID);
         draw_list->PushClipRect(viewport->Pos, viewport->Pos + viewport->Size, false);
         viewport->DrawListsLastFrame[drawlist_no] = g.FrameCount;
@@ -3675,6 +4524,18 @@ ImDrawListSharedData* ImGui::GetDrawListSharedData()
     return &GImGui->DrawListSharedData;
 }
 
+// The context's shared data is updated during the frame (current font, fullscreen clip rectangle), a copy isn't.
+ImDrawListSharedData* ImGui::CreateDrawListSharedDataSnapshot()
+{
+    ImGuiContext& g = *GImGui;
+    return IM_NEW(ImDrawListSharedData)(g.DrawListSharedData);
+}
+
+void ImGui::DestroyDrawListSharedDataSnapshot(ImDrawListSharedData* shared_data)
+{
+    IM_DELETE(shared_data);
+}
+
 void ImGui::StartMouseMovingWindow(ImGuiWindow* window)
 {
     // Set ActiveId even if the _NoMove flag is set. Without it, dragging away from a window with _NoMove would activate hover on other windows.
@@ -3847,6 +4708,7 @@ void ImGui::UpdateMouseMovingWindowEndFrame()
 
 static void TranslateWindow(ImGuiWindow* window, const ImVec2& delta)
 {
+    GImGui->WindowsHitGridDirty = true; // OuterRectClipped moves away from its cells in WindowsHitGrid
     window->Pos += delta;
     window->ClipRect.Translate(delta);
     window->OuterRectClipped.Translate(delta);
@@ -4156,6 +5018,12 @@ void ImGui::NewFrame()
 
     // Setup current font and draw list shared data
     // FIXME-VIEWPORT: the concept of a single ClipRectFullscreen is not ideal!
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+    // A font atlas shared between contexts may be used by other threads: it is locked once by its owner and never written to here.
+    if (!g.FontAtlasOwnedByContext)
+        IM_ASSERT(g.IO.Fonts->Locked && "A font atlas shared between contexts must be built and locked before calling NewFrame()!");
+    else
+#endif
     g.IO.Fonts->Locked = true;
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
@@ -4283,6 +5151,12 @@ void ImGui::NewFrame()
     // Mouse wheel scrolling, scale
     UpdateMouseWheel();
 
+    // Windows submitted in this frame will be added to the hit-testing grid again (FindHoveredWindow() above used the one of the previous frame)
+    g.WindowsHitGrid.Clear();
+    g.WindowsHitGridWindows.resize(0);
+    g.WindowsHitGridPadding = ImMax(g.Style.TouchExtraPadding, g.WindowsHoverPadding);
+    g.WindowsHitGridDirty = false;
+
     // Mark all windows as not visible and compact unused memory.
     IM_ASSERT(g.WindowsFocusOrder.Size <= g.Windows.Size);
     const float memory_compact_start_time = (g.GcCompactAll || g.IO.ConfigMemoryCompactTimer < 0.0f) ? FLT_MAX : (float)g.Time - g.IO.ConfigMemoryCompactTimer;
@@ -4306,6 +5180,12 @@ void ImGui::NewFrame()
     for (int i = 0; i < g.TablesTempData.Size; i++)
         if (g.TablesTempData[i].LastTimeActive >= 0.0f && g.TablesTempData[i].LastTimeActive < memory_compact_start_time)
             TableGcCompactTransientBuffers(&g.TablesTempData[i]);
+    if (g.IO.ConfigMemoryCompactBudget > 0)
+    {
+        const size_t memory_used = GetMemoryUsage().TotalBytes;
+        if (memory_used > g.IO.ConfigMemoryCompactBudget)
+            GcCompactLeastRecentlyUsed(memory_used - g.IO.ConfigMemoryCompactBudget);
+    }
     if (g.GcCompactAll)
         GcCompactTransientMiscBuffers();
     g.GcCompactAll = false;
@@ -4402,6 +5282,9 @@ void ImGui::Shutdown(ImGuiContext* context)
         SaveIniSettingsToDisk(g.IO.IniFilename);
         SetCurrentContext(backup_context);
     }
+#ifdef IMGUI_ENABLE_ASYNC_INI_SAVING
+    SettingsIniWriter_Shutdown(&g); // Wait for pending writes
+#endif
 
     // Destroy platform windows
     ImGuiContext* backup_context = ImGui::GetCurrentContext();
@@ -4436,6 +5319,7 @@ void ImGui::Shutdown(ImGuiContext* context)
 
     g.TabBars.Clear();
     g.CurrentTabBarStack.clear();
+    g.TextLayoutCache.Clear();
     g.ShrinkWidthBuffer.clear();
 
     g.ClipperTempData.clear_destruct();
@@ -4443,12 +5327,19 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.Tables.Clear();
     g.TablesTempData.clear_destruct();
     g.DrawChannelsTempMergeBuffer.clear();
+    g.DrawChannelsTempMergeMasks.clear();
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
     g.InputTextState.ClearFreeMemory();
 
     g.SettingsWindows.clear();
+    g.SettingsWindowsById.Clear();
+    g.SettingsWindowsIniCache.clear();
+    g.SettingsWindowsIniText.clear();
+    g.SettingsTables.clear();
+    g.SettingsTablesById.Clear();
+    g.SettingsTablesIniText.clear();
     g.SettingsHandlers.clear();
 
     if (g.LogFile)
@@ -4813,10 +5704,16 @@ void ImGui::EndFrame()
 
     // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
     IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
+    if (g.Windows.Size > 0 && memcmp(g.Windows.Data, g.WindowsTempSortBuffer.Data, (size_t)g.Windows.Size * sizeof(ImGuiWindow*)) != 0)
+        g.WindowsDisplayIndexDirty = true;
     g.Windows.swap(g.WindowsTempSortBuffer);
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
+    g.IO.MetricsActiveAllocations = GImAllocatorActiveAllocations.load(std::memory_order_relaxed);
 
     // Unlock font atlas
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+    if (g.FontAtlasOwnedByContext)
+#endif
     g.IO.Fonts->Locked = false;
 
     // Clear Input data for next frame
@@ -4872,6 +5769,10 @@ void ImGui::Render()
     if (first_render_of_frame)
         RenderDimmedBackgrounds();
 
+    // Record per-window CPU time and geometry for the Metrics window
+    if (first_render_of_frame)
+        UpdateDebugToolWindowsPerf();
+
     ImVec2 mouse_cursor_offset, mouse_cursor_size, mouse_cursor_uv[4];
     if (g.IO.MouseDrawCursor && g.MouseCursor != ImGuiMouseCursor_None)
         g.IO.Fonts->GetMouseCursorTexData(g.MouseCursor, &mouse_cursor_offset, &mouse_cursor_size, &mouse_cursor_uv[0], &mouse_cursor_uv[2]);
@@ -4921,7 +5822,11 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+    ImVec2 text_size;
+    if (const ImTextLayout* layout = GetTextLayout(font, font_size, FLT_MAX, wrap_width, text, text_display_end))
+        text_size = layout->TextSize;
+    else
+        text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
     // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
@@ -4933,10 +5838,53 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     return text_size;
 }
 
+// Same as ImFont::CalcTextSizeA() for texts of ImTextLayoutCache::MIN_TEXT_LEN bytes or more, from the cache of the context (see io.ConfigTextLayoutCacheBudget).
+// Returns NULL for shorter texts or when the cache is disabled or full: use ImFont::CalcTextSizeA() then.
+const ImTextLayout* ImGui::GetTextLayout(const ImFont* font, float size, float max_width, float wrap_width, const char* text, const char* text_end)
+{
+    ImGuiContext& g = *GImGui;
+    return g.TextLayoutCache.GetLayout(font, size, max_width, wrap_width, text, text_end, g.FrameCount, g.IO.ConfigTextLayoutCacheBudget);
+}
+
+// Test a window for FindHoveredWindow()
+static bool IsWindowHoveredByMousePos(ImGuiWindow* window, const ImVec2& padding_regular, const ImVec2& padding_for_resize)
+{
+    ImGuiContext& g = *GImGui;
+    if (!window->Active || window->Hidden)
+        return false;
+    if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
+        return false;
+    IM_ASSERT(window->Viewport);
+    if (window->Viewport != g.MouseViewport)
+        return false;
+
+    // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
+    ImRect bb(window->OuterRectClipped);
+    if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
+        bb.Expand(padding_regular);
+    else
+        bb.Expand(padding_for_resize);
+    if (!bb.Contains(g.IO.MousePos))
+        return false;
+
+    // Support for one rectangular hole in any given window
+    // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
+    if (window->HitTestHoleSize.x != 0)
+    {
+        ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
+        ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
+        if (ImRect(hole_pos, hole_pos + hole_size).Contains(g.IO.MousePos))
+            return false;
+    }
+    return true;
+}
+
 // Find window given position, search front-to-back
 // FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
 // with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
 // called, aka before the next Begin(). Moving window isn't affected.
+// Only the windows found in the cell of the mouse position in g.WindowsHitGrid are tested: the windows which can be hovered are
+// the ones which were Active in the previous frame, and they were all added to the grid by Begin() with their current OuterRectClipped.
 static void FindHoveredWindow()
 {
     ImGuiContext& g = *GImGui;
@@ -4953,44 +5901,72 @@ static void FindHoveredWindow()
 
     ImVec2 padding_regular = g.Style.TouchExtraPadding;
     ImVec2 padding_for_resize = g.IO.ConfigWindowsResizeFromEdges ? g.WindowsHoverPadding : padding_regular;
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
-    {
-        ImGuiWindow* window = g.Windows[i];
-        IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
-        if (!window->Active || window->Hidden)
-            continue;
-        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
-            continue;
-        IM_ASSERT(window->Viewport);
-        if (window->Viewport != g.MouseViewport)
-            continue;
-
-        // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
-        ImRect bb(window->OuterRectClipped);
-        if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
-            bb.Expand(padding_regular);
-        else
-            bb.Expand(padding_for_resize);
-        if (!bb.Contains(g.IO.MousePos))
-            continue;
 
-        // Support for one rectangular hole in any given window
-        // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
-        if (window->HitTestHoleSize.x != 0)
+    // Test the windows in the cell of the mouse position, keeping the front-most ones (highest index in g.Windows[]).
+    // - The grid can't be used if windows moved or if the padding grew since it was built.
+    // - All the windows of the cell are visited, while the front-to-back search stops at the first window containing the mouse:
+    //   when K windows overlap a cell (deep stacks of windows), that's expected after about g.Windows.Size/K windows.
+    const ImVec2 padding_max = ImMax(padding_regular, padding_for_resize);
+    const ImRectGrid& grid = g.WindowsHitGrid;
+    int grid_entry_n = -1;
+    bool use_grid = !g.WindowsHitGridDirty && !g.DebugMetricsConfig.DisableSpatialIndex && padding_max.x <= g.WindowsHitGridPadding.x && padding_max.y <= g.WindowsHitGridPadding.y;
+    if (use_grid)
+    {
+        grid_entry_n = grid.GetFirstEntry(g.IO.MousePos);
+        const int grid_count = (grid_entry_n != -1 ? grid.Entries[grid_entry_n].Count : 0) + grid.LargeValues.Size;
+        use_grid = grid_count * grid_count <= g.Windows.Size * 4;
+    }
+    if (use_grid)
+    {
+        if (g.WindowsDisplayIndexDirty)
+        {
+            for (int i = 0; i < g.Windows.Size; i++)
+                g.Windows[i]->DisplayIndex = i;
+            g.WindowsDisplayIndexDirty = false;
+        }
+        const bool hovered_window_is_moving_window = (hovered_window != NULL);
+        int entry_n = grid_entry_n;
+        for (int large_n = 0; entry_n != -1 || large_n < grid.LargeValues.Size; )
         {
-            ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
-            ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
-            if (ImRect(hole_pos, hole_pos + hole_size).Contains(g.IO.MousePos))
+            ImGuiWindow* window;
+            if (entry_n != -1)
+            {
+                window = g.WindowsHitGridWindows[grid.Entries[entry_n].Value];
+                entry_n = grid.Entries[entry_n].Next;
+            }
+            else
+            {
+                window = g.WindowsHitGridWindows[grid.LargeValues[large_n++]];
+            }
+            const bool candidate_for_hovered = !hovered_window_is_moving_window && (hovered_window == NULL || window->DisplayIndex > hovered_window->DisplayIndex);
+            const bool candidate_for_hovered_ignoring_moving = (hovered_window_ignoring_moving_window == NULL || window->DisplayIndex > hovered_window_ignoring_moving_window->DisplayIndex) && (!g.MovingWindow || window->RootWindowDockTree != g.MovingWindow->RootWindowDockTree);
+            if (!candidate_for_hovered && !candidate_for_hovered_ignoring_moving)
+                continue;
+            if (!IsWindowHoveredByMousePos(window, padding_regular, padding_for_resize))
                 continue;
+            if (candidate_for_hovered)
+                hovered_window = window;
+            if (candidate_for_hovered_ignoring_moving)
+                hovered_window_ignoring_moving_window = window;
         }
+    }
+    else
+    {
+        for (int i = g.Windows.Size - 1; i >= 0; i--)
+        {
+            ImGuiWindow* window = g.Windows[i];
+            IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
+            if (!IsWindowHoveredByMousePos(window, padding_regular, padding_for_resize))
+                continue;
 
-        if (hovered_window == NULL)
-            hovered_window = window;
-        IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
-        if (hovered_window_ignoring_moving_window == NULL && (!g.MovingWindow || window->RootWindowDockTree != g.MovingWindow->RootWindowDockTree))
-            hovered_window_ignoring_moving_window = window;
-        if (hovered_window && hovered_window_ignoring_moving_window)
-            break;
+            if (hovered_window == NULL)
+                hovered_window = window;
+            IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
+            if (hovered_window_ignoring_moving_window == NULL && (!g.MovingWindow || window->RootWindowDockTree != g.MovingWindow->RootWindowDockTree))
+                hovered_window_ignoring_moving_window = window;
+            if (hovered_window && hovered_window_ignoring_moving_window)
+                break;
+        }
     }
 
     g.HoveredWindow = hovered_window;
@@ -5612,6 +6588,7 @@ static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
         g.Windows.push_front(window); // Quite slow but rare and only once
     else
         g.Windows.push_back(window);
+    g.WindowsDisplayIndexDirty = true;
     UpdateWindowInFocusOrderList(window, true, window->Flags);
 
     return window;
@@ -6293,6 +7270,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
     IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
+    const ImU64 perf_begin_time = g.DebugMetricsConfig.ShowWindowsPerf ? ImTimeGetMicroseconds() : 0;
 
     // Find or create
     ImGuiWindow* window = FindWindowByName(name);
@@ -6392,6 +7370,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     window_stack_data.Window = window;
     window_stack_data.ParentLastItemDataBackup = g.LastItemData;
     window_stack_data.StackSizesOnBegin.SetToCurrentState();
+    window_stack_data.PerfBeginTime = perf_begin_time;
+    window_stack_data.PerfChildTime = 0;
     g.CurrentWindowStack.push_back(window_stack_data);
     g.CurrentWindow = NULL;
     if (flags & ImGuiWindowFlags_ChildMenu)
@@ -6800,6 +7780,10 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
             window->OuterRectClipped.Min.y += window->TitleBarHeight();
         window->OuterRectClipped.ClipWith(host_rect);
 
+        // Add to hit-testing grid for FindHoveredWindow() in the next frame, with the largest padding it may apply
+        g.WindowsHitGrid.Add(ImRect(window->OuterRectClipped.Min - g.WindowsHitGridPadding, window->OuterRectClipped.Max + g.WindowsHitGridPadding), g.WindowsHitGridWindows.Size);
+        g.WindowsHitGridWindows.push_back(window);
+
         // Inner rectangle
         // Not affected by window border size. Used by:
         // - InnerClipRect
@@ -6847,6 +7831,9 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
         // Setup draw list and outer clipping rectangle
         IM_ASSERT(window->DrawList->CmdBuffer.Size == 1 && window->DrawList->CmdBuffer[0].ElemCount == 0);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        window->DrawList->VtxOrigin = ImFloor(window->Rect().GetCenter());  // Compact vertices are stored relative to this (see ImDrawVert)
+#endif
         window->DrawList->PushTextureID(g.Font->ContainerAtlas->TexID);
         PushClipRect(host_rect.Min, host_rect.Max, false);
 
@@ -7130,8 +8117,20 @@ void ImGui::End()
         if (ImGuiWindow* host_window = window->DockNode->HostWindow)         // FIXME-DOCK
             host_window->DC.CursorMaxPos = window->DC.CursorMaxPos + window->WindowPadding - host_window->WindowPadding;
 
+    // Metrics: accumulate self time (excluding windows submitted within our Begin()/End() pair) and report total time to parent in stack
+    ImGuiWindowStackData& window_stack_data = g.CurrentWindowStack.back();
+    if (window_stack_data.PerfBeginTime != 0 && g.DebugMetricsConfig.ShowWindowsPerf)
+    {
+        const ImU64 elapsed = ImTimeGetMicroseconds() - window_stack_data.PerfBeginTime;
+        if (window->PerfStats == NULL)
+            window->PerfStats = IM_NEW(ImGuiWindowPerfStats)();
+        window->PerfStats->FrameCpuTime += (elapsed > window_stack_data.PerfChildTime) ? elapsed - window_stack_data.PerfChildTime : 0;
+        if (g.CurrentWindowStack.Size > 1)
+            g.CurrentWindowStack[g.CurrentWindowStack.Size - 2].PerfChildTime += elapsed;
+    }
+
     // Pop from window stack
-    g.LastItemData = g.CurrentWindowStack.back().ParentLastItemDataBackup;
+    g.LastItemData = window_stack_data.ParentLastItemDataBackup;
     if (window->Flags & ImGuiWindowFlags_ChildMenu)
         g.BeginMenuCount--;
     if (window->Flags & ImGuiWindowFlags_Popup)
@@ -7175,6 +8174,7 @@ void ImGui::BringWindowToDisplayFront(ImGuiWindow* window)
         {
             memmove(&g.Windows[i], &g.Windows[i + 1], (size_t)(g.Windows.Size - i - 1) * sizeof(ImGuiWindow*));
             g.Windows[g.Windows.Size - 1] = window;
+            g.WindowsDisplayIndexDirty = true;
             break;
         }
 }
@@ -7189,6 +8189,7 @@ void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
         {
             memmove(&g.Windows[1], &g.Windows[0], (size_t)i * sizeof(ImGuiWindow*));
             g.Windows[0] = window;
+            g.WindowsDisplayIndexDirty = true;
             break;
         }
 }
@@ -7201,6 +8202,7 @@ void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_
     behind_window = behind_window->RootWindow;
     int pos_wnd = FindWindowDisplayIndex(window);
     int pos_beh = FindWindowDisplayIndex(behind_window);
+    g.WindowsDisplayIndexDirty = true;
     if (pos_wnd < pos_beh)
     {
         size_t copy_bytes = (pos_beh - pos_wnd - 1) * sizeof(ImGuiWindow*);
@@ -9719,6 +10721,50 @@ static void inline NavClampRectToVisibleAreaForMoveDir(ImGuiDir move_dir, ImRect
     }
 }
 
+// Distance between boxes for NavScoreItem()
+// FIXME-NAV: Introducing biases for vertical navigation, needs to be removed.
+static void inline NavScoreItemDistBox(const ImRect& cand, const ImRect& curr, float* out_dbx, float* out_dby)
+{
+    float dbx = NavScoreItemDistInterval(cand.Min.x, cand.Max.x, curr.Min.x, curr.Max.x);
+    float dby = NavScoreItemDistInterval(ImLerp(cand.Min.y, cand.Max.y, 0.2f), ImLerp(cand.Min.y, cand.Max.y, 0.8f), ImLerp(curr.Min.y, curr.Max.y, 0.2f), ImLerp(curr.Min.y, curr.Max.y, 0.8f)); // Scale down on Y to keep using box-distance for vertically touching items
+    if (dby != 0.0f && dbx != 0.0f)
+        dbx = (dbx / 1000.0f) + ((dbx > 0.0f) ? +1.0f : -1.0f);
+    *out_dbx = dbx;
+    *out_dby = dby;
+}
+
+// Early out for NavScoreItem(), which would return false for the current item: it either lies entirely on the wrong side of
+// the source rectangle for the move direction, or it is farther from it than the best candidate so far (box distance).
+// Not used on the menu layer, where the axial check may also pick items in other quadrants.
+static bool NavScoreItemCanSkip(const ImGuiNavItemData* result)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (g.DebugMetricsConfig.DisableSpatialIndex || g.NavLayer != ImGuiNavLayer_Main || window->DC.NavLayerCurrent != ImGuiNavLayer_Main || window->ParentWindow == g.NavWindow)
+        return false;
+
+    // Same rectangles as NavScoreItem()
+    ImRect cand = g.LastItemData.NavRect;
+    const ImRect curr = g.NavScoringRect;
+    NavClampRectToVisibleAreaForMoveDir(g.NavMoveClipDir, cand, window->ClipRect);
+    if (cand.IsInverted())
+        return false;
+
+    switch (g.NavMoveDir)
+    {
+    case ImGuiDir_Left:     if (cand.Min.x > curr.Max.x) return true; break;
+    case ImGuiDir_Right:    if (cand.Max.x < curr.Min.x) return true; break;
+    case ImGuiDir_Up:       if (cand.Min.y > curr.Max.y) return true; break;
+    case ImGuiDir_Down:     if (cand.Max.y < curr.Min.y) return true; break;
+    default:                return false;
+    }
+    if (result->DistBox == FLT_MAX)
+        return false;
+    float dbx, dby;
+    NavScoreItemDistBox(cand, curr, &dbx, &dby);
+    return ImFabs(dbx) + ImFabs(dby) > result->DistBox;
+}
+
 // Scoring function for gamepad/keyboard directional navigation. Based on https://gist.github.com/rygorous/6981057
 static bool ImGui::NavScoreItem(ImGuiNavItemData* result)
 {
@@ -9746,11 +10792,8 @@ static bool ImGui::NavScoreItem(ImGuiNavItemData* result)
     NavClampRectToVisibleAreaForMoveDir(g.NavMoveClipDir, cand, window->ClipRect);
 
     // Compute distance between boxes
-    // FIXME-NAV: Introducing biases for vertical navigation, needs to be removed.
-    float dbx = NavScoreItemDistInterval(cand.Min.x, cand.Max.x, curr.Min.x, curr.Max.x);
-    float dby = NavScoreItemDistInterval(ImLerp(cand.Min.y, cand.Max.y, 0.2f), ImLerp(cand.Min.y, cand.Max.y, 0.8f), ImLerp(curr.Min.y, curr.Max.y, 0.2f), ImLerp(curr.Min.y, curr.Max.y, 0.8f)); // Scale down on Y to keep using box-distance for vertically touching items
-    if (dby != 0.0f && dbx != 0.0f)
-        dbx = (dbx / 1000.0f) + ((dbx > 0.0f) ? +1.0f : -1.0f);
+    float dbx, dby;
+    NavScoreItemDistBox(cand, curr, &dbx, &dby);
     float dist_box = ImFabs(dbx) + ImFabs(dby);
 
     // Compute distance between centers (this is off by a factor of 2, but we only compare center distances with each other so it doesn't matter)
@@ -9907,14 +10950,14 @@ static void ImGui::NavProcessItem()
             ImGuiNavItemData* result = (window == g.NavWindow) ? &g.NavMoveResultLocal : &g.NavMoveResultOther;
             if (!is_tabbing)
             {
-                if (NavScoreItem(result))
+                if (!NavScoreItemCanSkip(result) && NavScoreItem(result))
                     NavApplyItemToResult(result);
 
                 // Features like PageUp/PageDown need to maintain a separate score for the visible set of items.
                 const float VISIBLE_RATIO = 0.70f;
                 if ((g.NavMoveFlags & ImGuiNavMoveFlags_AlsoScoreVisibleSet) && window->ClipRect.Overlaps(nav_bb))
                     if (ImClamp(nav_bb.Max.y, window->ClipRect.Min.y, window->ClipRect.Max.y) - ImClamp(nav_bb.Min.y, window->ClipRect.Min.y, window->ClipRect.Max.y) >= (nav_bb.Max.y - nav_bb.Min.y) * VISIBLE_RATIO)
-                        if (NavScoreItem(&g.NavMoveResultLocalVisible))
+                        if (!NavScoreItemCanSkip(&g.NavMoveResultLocalVisible) && NavScoreItem(&g.NavMoveResultLocalVisible))
                             NavApplyItemToResult(&g.NavMoveResultLocalVisible);
             }
         }
@@ -11638,6 +12681,8 @@ void ImGui::LogButtons()
 // - ClearIniSettings() [Internal]
 // - LoadIniSettingsFromDisk()
 // - LoadIniSettingsFromMemory()
+// - SaveIniSettingsFile() [Internal]
+// - SettingsIniWriter_***() [Internal]
 // - SaveIniSettingsToDisk()
 // - SaveIniSettingsToMemory()
 // - WindowSettingsHandler_***() [Internal]
@@ -11705,16 +12750,21 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
     settings->ID = ImHashStr(name, name_len);
     memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
 
+    // Index (keep the first entry if the same ID was created twice, as a linear search would)
+    if (FindWindowSettings(settings->ID) == NULL)
+        g.SettingsWindowsById.SetInt(settings->ID, g.SettingsWindows.offset_from_ptr(settings) + 1);
+
     return settings;
 }
 
 ImGuiWindowSettings* ImGui::FindWindowSettings(ImGuiID id)
 {
     ImGuiContext& g = *GImGui;
-    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
-        if (settings->ID == id)
-            return settings;
-    return NULL;
+    const int offset_plus_1 = g.SettingsWindowsById.GetInt(id);
+    if (offset_plus_1 == 0)
+        return NULL;
+    ImGuiWindowSettings* settings = g.SettingsWindows.ptr_from_offset(offset_plus_1 - 1);
+    return (settings->ID == id) ? settings : NULL;
 }
 
 ImGuiWindowSettings* ImGui::FindOrCreateWindowSettings(const char* name)
@@ -11745,6 +12795,9 @@ void ImGui::ClearIniSettings()
 
 void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
 {
+#ifdef IMGUI_ENABLE_ASYNC_INI_SAVING
+    SettingsIniWriter_WaitIdle(GImGui);    // Read what was last saved
+#endif
     size_t file_data_size = 0;
     char* file_data = (char*)ImFileLoadToMemory(ini_filename, "rb", &file_data_size);
     if (!file_data)
@@ -11824,6 +12877,160 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
             g.SettingsHandlers[handler_n].ApplyAllFn(&g, &g.SettingsHandlers[handler_n]);
 }
 
+#ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+// Replace 'dst_filename' by 'src_filename' in a single step: readers see either the old or the new file.
+static bool ImFileReplace(const char* src_filename, const char* dst_filename)
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(__CYGWIN__)
+    // No heap allocation: may be called from the .ini writer thread
+    wchar_t src_wfilename[1024], dst_wfilename[1024];
+    if (::MultiByteToWideChar(CP_UTF8, 0, src_filename, -1, src_wfilename, IM_ARRAYSIZE(src_wfilename)) == 0 || ::MultiByteToWideChar(CP_UTF8, 0, dst_filename, -1, dst_wfilename, IM_ARRAYSIZE(dst_wfilename)) == 0)
+        return false;
+    return ::MoveFileExW(src_wfilename, dst_wfilename, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#elif defined(_WIN32) && !defined(__CYGWIN__)
+    // IMGUI_DISABLE_WIN32_FUNCTIONS: the CRT rename() doesn't replace existing files, so this is NOT atomic.
+    // A crash between the two calls leaves no 'dst_filename' (the complete data is still in 'src_filename').
+    remove(dst_filename);
+    return rename(src_filename, dst_filename) == 0;
+#else
+    return rename(src_filename, dst_filename) == 0;
+#endif
+}
+#endif
+
+// Write .ini data to 'tmp_filename' then rename it over 'ini_filename', so a crash or a concurrent reader never sees a partially written file.
+// (With IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS, your file functions may not be backed by the OS file system: we write to 'ini_filename' directly)
+static bool SaveIniSettingsFile(const char* ini_filename, const char* tmp_filename, const char* ini_data, size_t ini_data_size)
+{
+#ifdef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+    tmp_filename = ini_filename;
+#endif
+    ImFileHandle f = ImFileOpen(tmp_filename, "wt");
+    if (!f)
+        return false;
+    const bool written = ImFileWrite(ini_data, sizeof(char), ini_data_size, f) == ini_data_size;
+    const bool closed = ImFileClose(f);
+    if (!written || !closed)
+        return false;
+#ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+    return ImFileReplace(tmp_filename, ini_filename);
+#else
+    return true;
+#endif
+}
+
+// "<ini_filename>\0<ini_filename>.tmp\0<ini_data>"
+static void SaveIniSettingsFileRequest(ImVector<char>* out_buf, int* out_tmp_filename_offset, int* out_data_offset, const char* ini_filename, const char* ini_data, size_t ini_data_size)
+{
+    const int filename_len = (int)strlen(ini_filename);
+    *out_tmp_filename_offset = filename_len + 1;
+    *out_data_offset = *out_tmp_filename_offset + filename_len + 5;
+    out_buf->resize(*out_data_offset + (int)ini_data_size);
+    memcpy(out_buf->Data, ini_filename, (size_t)filename_len + 1);
+    memcpy(out_buf->Data + *out_tmp_filename_offset, ini_filename, (size_t)filename_len);
+    memcpy(out_buf->Data + *out_tmp_filename_offset + filename_len, ".tmp", 5);
+    memcpy(out_buf->Data + *out_data_offset, ini_data, ini_data_size);
+}
+
+#ifdef IMGUI_ENABLE_ASYNC_INI_SAVING
+
+// Background thread writing .ini files, so SaveIniSettingsToDisk() only formats the data on the calling thread.
+// - Requests for the same file are coalesced: if several are queued while a file is being written, only the last one is written next.
+//   A request for another file first waits for the writer thread to take the pending one (applications rarely alternate .ini files).
+// - Every ImVector<> is resized and freed on the UI thread: the writer thread only swaps Pending with Writing.
+struct ImGuiSettingsIniWriter
+{
+    struct Request
+    {
+        ImVector<char>          Buf;            // See SaveIniSettingsFileRequest()
+        int                     TmpFilenameOffset;
+        int                     DataOffset;
+        Request()               { TmpFilenameOffset = DataOffset = 0; }
+    };
+
+    std::thread                 Thread;
+    std::mutex                  Mutex;
+    std::condition_variable     Cond;           // Signaled when a request is queued or taken, and when the writer thread becomes idle
+    Request                     Pending;        // Queued by the UI thread
+    Request                     Writing;        // Owned by the writer thread while Busy
+    bool                        HasPending;
+    bool                        Busy;
+    bool                        QuitRequested;
+
+    ImGuiSettingsIniWriter()    { HasPending = Busy = QuitRequested = false; }
+};
+
+static void SettingsIniWriter_ThreadMain(ImGuiSettingsIniWriter* writer)
+{
+    std::unique_lock<std::mutex> lock(writer->Mutex);
+    for (;;)
+    {
+        while (!writer->HasPending && !writer->QuitRequested)
+            writer->Cond.wait(lock);
+        if (!writer->HasPending)
+            return; // Quit once every queued request is written
+        writer->Writing.Buf.swap(writer->Pending.Buf);
+        ImSwap(writer->Writing.TmpFilenameOffset, writer->Pending.TmpFilenameOffset);
+        ImSwap(writer->Writing.DataOffset, writer->Pending.DataOffset);
+        writer->HasPending = false;
+        writer->Busy = true;
+        writer->Cond.notify_all();
+        lock.unlock();
+
+        const ImGuiSettingsIniWriter::Request& req = writer->Writing;
+        SaveIniSettingsFile(req.Buf.Data, req.Buf.Data + req.TmpFilenameOffset, req.Buf.Data + req.DataOffset, (size_t)(req.Buf.Size - req.DataOffset));
+
+        lock.lock();
+        writer->Busy = false;
+        writer->Cond.notify_all();
+    }
+}
+
+static void SettingsIniWriter_Queue(ImGuiContext* ctx, const char* ini_filename, const char* ini_data, size_t ini_data_size)
+{
+    ImGuiContext& g = *ctx;
+    if (g.SettingsIniWriter == NULL)
+    {
+        g.SettingsIniWriter = IM_NEW(ImGuiSettingsIniWriter)();
+        g.SettingsIniWriter->Thread = std::thread(SettingsIniWriter_ThreadMain, g.SettingsIniWriter);
+    }
+    ImGuiSettingsIniWriter* writer = g.SettingsIniWriter;
+    std::unique_lock<std::mutex> lock(writer->Mutex);
+    while (writer->HasPending && strcmp(writer->Pending.Buf.Data, ini_filename) != 0)
+        writer->Cond.wait(lock);
+    SaveIniSettingsFileRequest(&writer->Pending.Buf, &writer->Pending.TmpFilenameOffset, &writer->Pending.DataOffset, ini_filename, ini_data, ini_data_size);
+    writer->HasPending = true;
+    writer->Cond.notify_all();
+}
+
+static void SettingsIniWriter_WaitIdle(ImGuiContext* ctx)
+{
+    ImGuiSettingsIniWriter* writer = ctx->SettingsIniWriter;
+    if (writer == NULL)
+        return;
+    std::unique_lock<std::mutex> lock(writer->Mutex);
+    while (writer->HasPending || writer->Busy)
+        writer->Cond.wait(lock);
+}
+
+static void SettingsIniWriter_Shutdown(ImGuiContext* ctx)
+{
+    ImGuiSettingsIniWriter* writer = ctx->SettingsIniWriter;
+    if (writer == NULL)
+        return;
+    {
+        std::unique_lock<std::mutex> lock(writer->Mutex);
+        writer->QuitRequested = true;
+        writer->Cond.notify_all();
+    }
+    writer->Thread.join();
+    IM_DELETE(writer);
+    ctx->SettingsIniWriter = NULL;
+}
+
+#endif // #ifdef IMGUI_ENABLE_ASYNC_INI_SAVING
+
+// With IMGUI_ENABLE_ASYNC_INI_SAVING, this returns once the data is formatted and queued: the file is written by a background thread.
 void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 {
     ImGuiContext& g = *GImGui;
@@ -11833,11 +13040,14 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 
     size_t ini_data_size = 0;
     const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
-    ImFileHandle f = ImFileOpen(ini_filename, "wt");
-    if (!f)
-        return;
-    ImFileWrite(ini_data, sizeof(char), ini_data_size, f);
-    ImFileClose(f);
+#ifdef IMGUI_ENABLE_ASYNC_INI_SAVING
+    SettingsIniWriter_Queue(&g, ini_filename, ini_data, ini_data_size);
+#else
+    ImVector<char> req_buf;
+    int tmp_filename_offset = 0, data_offset = 0;
+    SaveIniSettingsFileRequest(&req_buf, &tmp_filename_offset, &data_offset, ini_filename, ini_data, ini_data_size);
+    SaveIniSettingsFile(req_buf.Data, req_buf.Data + tmp_filename_offset, req_buf.Data + data_offset, ini_data_size);
+#endif
 }
 
 // Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
@@ -11863,6 +13073,9 @@ static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandl
     for (int i = 0; i != g.Windows.Size; i++)
         g.Windows[i]->SettingsOffset = -1;
     g.SettingsWindows.clear();
+    g.SettingsWindowsById.Clear();
+    g.SettingsWindowsIniCache.clear();
+    g.SettingsWindowsIniText.clear();
 }
 
 static void* WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
@@ -11934,9 +13147,29 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
     }
 
     // Write to text buffer
+    // Entries are compared with the values their text was last written from (they may be modified from many places e.g. docking code),
+    // and only the changed ones are formatted again. The others, usually almost all of them, are copied from the last saved text.
+    const int section_start = buf->size();
     buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
-    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+    int settings_n = 0;
+    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings), settings_n++)
     {
+        const int text_offset = buf->size() - section_start;
+        if (settings_n < g.SettingsWindowsIniCache.Size)
+        {
+            ImGuiWindowSettingsIniText* entry_text = &g.SettingsWindowsIniCache[settings_n];
+            const ImGuiWindowSettings* values = &entry_text->Values;
+            if (values->ID == settings->ID && values->Pos.x == settings->Pos.x && values->Pos.y == settings->Pos.y && values->Size.x == settings->Size.x && values->Size.y == settings->Size.y
+                && values->ViewportPos.x == settings->ViewportPos.x && values->ViewportPos.y == settings->ViewportPos.y && values->ViewportId == settings->ViewportId
+                && values->DockId == settings->DockId && values->ClassId == settings->ClassId && values->DockOrder == settings->DockOrder && values->Collapsed == settings->Collapsed)
+            {
+                const char* text = g.SettingsWindowsIniText.begin() + entry_text->TextOffset;
+                buf->append(text, text + entry_text->TextLen);
+                entry_text->TextOffset = text_offset;
+                continue;
+            }
+        }
+
         const char* settings_name = settings->GetName();
         buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
         if (settings->ViewportId != 0 && settings->ViewportId != ImGui::IMGUI_VIEWPORT_DEFAULT_ID)
@@ -11959,7 +13192,16 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
                 buf->appendf("ClassId=0x%08X\n", settings->ClassId);
         }
         buf->append("\n");
+
+        if (settings_n == g.SettingsWindowsIniCache.Size)
+            g.SettingsWindowsIniCache.resize(settings_n + 1);
+        ImGuiWindowSettingsIniText* entry_text = &g.SettingsWindowsIniCache[settings_n];
+        entry_text->Values = *settings;
+        entry_text->TextOffset = text_offset;
+        entry_text->TextLen = buf->size() - section_start - text_offset;
     }
+    g.SettingsWindowsIniText.Buf.resize(0);
+    g.SettingsWindowsIniText.append(buf->begin() + section_start, buf->end());
 }
 
 
@@ -16589,12 +17831,19 @@ static void ImGui::DockSettingsRemoveNodeReferences(ImGuiID* node_ids, int node_
 
 static ImGuiDockNodeSettings* ImGui::DockSettingsFindNodeSettings(ImGuiContext* ctx, ImGuiID id)
 {
-    // FIXME-OPT
     ImGuiDockContext* dc  = &ctx->DockContext;
-    for (int n = 0; n < dc->NodesSettings.Size; n++)
-        if (dc->NodesSettings[n].ID == id)
-            return &dc->NodesSettings[n];
-    return NULL;
+    const int index_plus_1 = dc->NodesSettingsById.GetInt(id);
+    if (index_plus_1 == 0 || dc->NodesSettings[index_plus_1 - 1].ID != id) // Pruned settings have their ID cleared
+        return NULL;
+    return &dc->NodesSettings[index_plus_1 - 1];
+}
+
+static void DockSettingsAddNodeSettings(ImGuiDockContext* dc, const ImGuiDockNodeSettings& node_settings)
+{
+    // Keep the first entry if the same ID appears twice, as a linear search would
+    if (dc->NodesSettingsById.GetInt(node_settings.ID) == 0)
+        dc->NodesSettingsById.SetInt(node_settings.ID, dc->NodesSettings.Size + 1);
+    dc->NodesSettings.push_back(node_settings);
 }
 
 // Clear settings data
@@ -16602,6 +17851,7 @@ static void ImGui::DockSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettings
 {
     ImGuiDockContext* dc  = &ctx->DockContext;
     dc->NodesSettings.clear();
+    dc->NodesSettingsById.Clear();
     DockContextClearNodes(ctx, 0, true);
 }
 
@@ -16661,7 +17911,7 @@ static void ImGui::DockSettingsHandler_ReadLine(ImGuiContext* ctx, ImGuiSettings
     if (node.ParentNodeId != 0)
         if (ImGuiDockNodeSettings* parent_settings = DockSettingsFindNodeSettings(ctx, node.ParentNodeId))
             node.Depth = parent_settings->Depth + 1;
-    ctx->DockContext.NodesSettings.push_back(node);
+    DockSettingsAddNodeSettings(&ctx->DockContext, node);
 }
 
 static void DockSettingsHandler_DockNodeToSettings(ImGuiDockContext* dc, ImGuiDockNode* node, int depth)
@@ -16678,7 +17928,7 @@ static void DockSettingsHandler_DockNodeToSettings(ImGuiDockContext* dc, ImGuiDo
     node_settings.Pos = ImVec2ih(node->Pos);
     node_settings.Size = ImVec2ih(node->Size);
     node_settings.SizeRef = ImVec2ih(node->SizeRef);
-    dc->NodesSettings.push_back(node_settings);
+    DockSettingsAddNodeSettings(dc, node_settings);
     if (node->ChildNodes[0])
         DockSettingsHandler_DockNodeToSettings(dc, node->ChildNodes[0], depth + 1);
     if (node->ChildNodes[1])
@@ -16696,6 +17946,7 @@ static void ImGui::DockSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettings
     // (unlike our windows settings, because nodes are always built we can do a full rewrite of the SettingsNode buffer)
     dc->NodesSettings.resize(0);
     dc->NodesSettings.reserve(dc->Nodes.Data.Size);
+    dc->NodesSettingsById.Data.resize(0);
     for (int n = 0; n < dc->Nodes.Data.Size; n++)
         if (ImGuiDockNode* node = (ImGuiDockNode*)dc->Nodes.Data[n].val_p)
             if (node->IsRootNode())
@@ -17133,6 +18384,10 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             }
         }
 
+        Checkbox("Disable spatial index", &cfg->DisableSpatialIndex);
+        SameLine();
+        MetricsHelpMarker("Test every window in FindHoveredWindow() and score every item for keyboard/gamepad navigation.\nResults are the same: this is to compare timings.");
+
         // The Item Picker tool is super useful to visually select an item and break into the call-stack of where it was submitted.
         if (Button("Item Picker.."))
             DebugStartItemPicker();
@@ -17165,6 +18420,13 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+    // Windows CPU time and geometry
+    if (TreeNode("Windows Perf"))
+    {
+        DebugNodeWindowsPerf();
+        TreePop();
+    }
+
     // DrawLists
     int drawlist_count = 0;
     for (int viewport_i = 0; viewport_i < g.Viewports.Size; viewport_i++)
@@ -17214,7 +18476,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
         if (TreeNode("Inferred order (front-to-back)"))
         {
-            static ImVector<ImGuiViewportP*> viewports;
+            ImVector<ImGuiViewportP*> viewports;
             viewports.resize(g.Viewports.Size);
             memcpy(viewports.Data, g.Viewports.Data, g.Viewports.size_in_bytes());
             if (viewports.Size > 1)
@@ -17276,16 +18538,15 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 #ifdef IMGUI_HAS_DOCK
     if (TreeNode("Docking"))
     {
-        static bool root_nodes_only = true;
         ImGuiDockContext* dc = &g.DockContext;
-        Checkbox("List root nodes", &root_nodes_only);
+        Checkbox("List root nodes", &cfg->ShowDockingRootNodesOnly);
         Checkbox("Ctrl shows window dock info", &cfg->ShowDockingNodes);
         if (SmallButton("Clear nodes")) { DockContextClearNodes(&g, 0, true); }
         SameLine();
         if (SmallButton("Rebuild all")) { dc->WantFullRebuild = true; }
         for (int n = 0; n < dc->Nodes.Data.Size; n++)
             if (ImGuiDockNode* node = (ImGuiDockNode*)dc->Nodes.Data[n].val_p)
-                if (!root_nodes_only || node->IsRootNode())
+                if (!cfg->ShowDockingRootNodesOnly || node->IsRootNode())
                     DebugNodeDockNode(node, "Node");
         TreePop();
     }
@@ -17362,6 +18623,24 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+    // Details for Memory
+    const ImGuiMemoryUsage memory_usage = GetMemoryUsage();
+    if (TreeNode("Memory", "Memory (%.1f KB)", memory_usage.TotalBytes / 1024.0f))
+    {
+        const char* category_names[] = { "Windows", "DrawLists", "Fonts", "Tables", "Storage", "Settings", "TextLayouts" }; IM_ASSERT(IM_ARRAYSIZE(category_names) == ImGuiMemoryCategory_COUNT);
+        for (int n = 0; n < ImGuiMemoryCategory_COUNT; n++)
+            BulletText("%s: %.1f KB", category_names[n], memory_usage.Bytes[n] / 1024.0f);
+        Text("Compactable (hidden windows, unused tables): %.1f KB", memory_usage.CompactableBytes / 1024.0f);
+        if (io.ConfigMemoryCompactBudget > 0)
+            Text("Budget (io.ConfigMemoryCompactBudget): %.1f KB", io.ConfigMemoryCompactBudget / 1024.0f);
+        else
+            Text("Budget (io.ConfigMemoryCompactBudget): none");
+        Text("Text layout cache: %d texts, %d hits, %d misses this frame, budget (io.ConfigTextLayoutCacheBudget): %.1f KB", g.TextLayoutCache.Layouts.Size, g.TextLayoutCache.FrameHits, g.TextLayoutCache.FrameMisses, io.ConfigTextLayoutCacheBudget / 1024.0f);
+        if (SmallButton("Compact now"))
+            g.GcCompactAll = true;
+        TreePop();
+    }
+
     // Misc Details
     if (TreeNode("Internal state"))
     {
@@ -17645,7 +18924,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         {
             ImVec2 triangle[3];
             for (int n = 0; n < 3; n++, idx_n++)
-                triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos;
+                triangle[n] = draw_list->GetVtxPos(vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n]);
             total_area += ImTriangleArea(triangle[0], triangle[1], triangle[2]);
         }
 
@@ -17666,9 +18945,10 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
                     const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
-                    triangle[n] = v.pos;
+                    const ImVec2 uv = draw_list->GetVtxUV(v);
+                    triangle[n] = draw_list->GetVtxPos(v);
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, triangle[n].x, triangle[n].y, uv.x, uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -17702,7 +18982,7 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
 
         ImVec2 triangle[3];
         for (int n = 0; n < 3; n++, idx_n++)
-            vtxs_rect.Add((triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos));
+            vtxs_rect.Add((triangle[n] = draw_list->GetVtxPos(vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n])));
         if (show_mesh)
             out_draw_list->AddPolyline(triangle, 3, IM_COL32(255, 255, 0, 255), ImDrawFlags_Closed, 1.0f); // In yellow: mesh triangles
     }
@@ -17744,6 +19024,8 @@ void ImGui::DebugNodeFont(ImFont* font)
     char c_str[5];
     Text("Fallback character: '%s' (U+%04X)", ImTextCharToUtf8(c_str, font->FallbackChar), font->FallbackChar);
     Text("Ellipsis character: '%s' (U+%04X)", ImTextCharToUtf8(c_str, font->EllipsisChar), font->EllipsisChar);
+    if (font->SignedDistanceField)
+        Text("Signed distance field: %s", (font->ContainerAtlas->TexIDSdf != (ImTextureID)NULL) ? "drawn with ImFontAtlas::TexIDSdf" : "drawn as coverage, the renderer backend doesn't set ImFontAtlas::TexIDSdf");
     const int surface_sqrt = (int)ImSqrt((float)font->MetricsTotalSurface);
     Text("Texture Area: about %d px ~%dx%d px", font->MetricsTotalSurface, surface_sqrt, surface_sqrt);
     for (int config_i = 0; config_i < font->ConfigDataCount; config_i++)
@@ -18003,10 +19285,162 @@ void ImGui::DebugNodeWindowsListByBeginStackParent(ImGuiWindow** windows, int wi
     }
 }
 
+// [DEBUG] Display sortable table of per-window CPU time and geometry, to find the most expensive windows.
+void ImGui::DebugNodeWindowsPerf()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiMetricsConfig* cfg = &g.DebugMetricsConfig;
+    Checkbox("Record per-window CPU time and geometry", &cfg->ShowWindowsPerf);
+    SameLine();
+    MetricsHelpMarker("CPU time is measured between Begin() and End(), excluding child windows and popups submitted in-between (they are listed separately).\nGeometry is the contents of the window ImDrawList at Render() time.");
+    SameLine();
+    if (SmallButton("Clear"))
+        for (int n = 0; n < g.Windows.Size; n++)
+            if (g.Windows[n]->PerfStats)
+                g.Windows[n]->PerfStats->Clear();
+
+    enum { WPC_Name, WPC_CpuAvg, WPC_CpuPeak, WPC_VtxAvg, WPC_VtxPeak, WPC_IdxAvg, WPC_CmdAvg, WPC_Count }; // Windows Perf Column
+    struct WindowPerfRow
+    {
+        ImGuiWindow*    Window;
+        float           Values[WPC_Count];
+        float           SortKey;
+        static int IMGUI_CDECL CompareBySortKey(const void* lhs, const void* rhs)
+        {
+            const WindowPerfRow* a = (const WindowPerfRow*)lhs;
+            const WindowPerfRow* b = (const WindowPerfRow*)rhs;
+            return (a->SortKey < b->SortKey) ? -1 : (a->SortKey > b->SortKey) ? +1 : strcmp(a->Window->Name, b->Window->Name);
+        }
+        static int IMGUI_CDECL CompareByName(const void* lhs, const void* rhs)
+        {
+            return strcmp(((const WindowPerfRow*)lhs)->Window->Name, ((const WindowPerfRow*)rhs)->Window->Name);
+        }
+    };
+
+    // Gather rolling averages and peaks
+    ImVector<WindowPerfRow> rows;
+    for (int n = 0; n < g.Windows.Size; n++)
+    {
+        ImGuiWindow* window = g.Windows[n];
+        ImGuiWindowPerfStats* stats = window->PerfStats;
+        if (stats == NULL || stats->HistoryCount == 0)
+            continue;
+        WindowPerfRow row;
+        memset(&row, 0, sizeof(row));
+        row.Window = window;
+        for (int i = 0; i < stats->HistoryCount; i++)
+        {
+            row.Values[WPC_CpuAvg] += stats->CpuTime[i];
+            row.Values[WPC_CpuPeak] = ImMax(row.Values[WPC_CpuPeak], stats->CpuTime[i]);
+            row.Values[WPC_VtxAvg] += (float)stats->VtxCount[i];
+            row.Values[WPC_VtxPeak] = ImMax(row.Values[WPC_VtxPeak], (float)stats->VtxCount[i]);
+            row.Values[WPC_IdxAvg] += (float)stats->IdxCount[i];
+            row.Values[WPC_CmdAvg] += (float)stats->CmdCount[i];
+        }
+        row.Values[WPC_CpuAvg] /= stats->HistoryCount;
+        row.Values[WPC_VtxAvg] /= stats->HistoryCount;
+        row.Values[WPC_IdxAvg] /= stats->HistoryCount;
+        row.Values[WPC_CmdAvg] /= stats->HistoryCount;
+        rows.push_back(row);
+    }
+    if (rows.Size == 0)
+    {
+        TextDisabled(cfg->ShowWindowsPerf ? "(no window recorded yet)" : "(recording disabled)");
+        return;
+    }
+
+    const ImGuiTableFlags table_flags = ImGuiTableFlags_Sortable | ImGuiTableFlags_SortTristate | ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable;
+    const float table_height = GetTextLineHeightWithSpacing() * ImMin(rows.Size + 1, 20) + g.Style.CellPadding.y * 2.0f;
+    if (!BeginTable("##windows_perf", WPC_Count, table_flags, ImVec2(0.0f, table_height)))
+        return;
+    TableSetupScrollFreeze(0, 1);
+    TableSetupColumn("Window", ImGuiTableColumnFlags_WidthStretch, 0.0f, WPC_Name);
+    TableSetupColumn("CPU avg (us)", ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_DefaultSort, 0.0f, WPC_CpuAvg);
+    TableSetupColumn("CPU peak (us)", ImGuiTableColumnFlags_PreferSortDescending, 0.0f, WPC_CpuPeak);
+    TableSetupColumn("Vtx avg", ImGuiTableColumnFlags_PreferSortDescending, 0.0f, WPC_VtxAvg);
+    TableSetupColumn("Vtx peak", ImGuiTableColumnFlags_PreferSortDescending, 0.0f, WPC_VtxPeak);
+    TableSetupColumn("Idx avg", ImGuiTableColumnFlags_PreferSortDescending, 0.0f, WPC_IdxAvg);
+    TableSetupColumn("Cmd avg", ImGuiTableColumnFlags_PreferSortDescending, 0.0f, WPC_CmdAvg);
+    TableHeadersRow();
+
+    // Sort (we only use the primary sort specs, rows are few and re-sorted every frame as values are changing)
+    if (ImGuiTableSortSpecs* sort_specs = TableGetSortSpecs())
+        if (sort_specs->SpecsCount > 0)
+        {
+            const ImGuiTableColumnSortSpecs* spec = &sort_specs->Specs[0];
+            const float sign = (spec->SortDirection == ImGuiSortDirection_Descending) ? -1.0f : +1.0f;
+            if (spec->ColumnUserID == WPC_Name)
+            {
+                ImQsort(rows.Data, (size_t)rows.Size, sizeof(WindowPerfRow), WindowPerfRow::CompareByName);
+                if (sign < 0.0f)
+                    for (int i = 0, j = rows.Size - 1; i < j; i++, j--)
+                        ImSwap(rows[i], rows[j]);
+            }
+            else
+            {
+                for (int n = 0; n < rows.Size; n++)
+                    rows[n].SortKey = rows[n].Values[spec->ColumnUserID] * sign;
+                ImQsort(rows.Data, (size_t)rows.Size, sizeof(WindowPerfRow), WindowPerfRow::CompareBySortKey);
+            }
+            sort_specs->SpecsDirty = false;
+        }
+
+    for (int n = 0; n < rows.Size; n++)
+    {
+        const WindowPerfRow& row = rows[n];
+        ImGuiWindow* window = row.Window;
+        TableNextRow();
+        TableNextColumn();
+        PushID(window);
+        Selectable(window->Name, false, ImGuiSelectableFlags_SpanAllColumns);
+        PopID();
+        if (IsItemHovered())
+        {
+            if (window->WasActive)
+                GetForegroundDrawList(window)->AddRect(window->Pos, window->Pos + window->Size, IM_COL32(255, 255, 0, 255));
+            ImGuiWindowPerfStats* stats = window->PerfStats;
+            const int values_offset = (stats->HistoryCount < IMGUI_WINDOW_PERF_HISTORY_SIZE) ? 0 : stats->HistoryOffset;
+            BeginTooltip();
+            PlotLines("##cpu", stats->CpuTime, stats->HistoryCount, values_offset, "CPU (us)", 0.0f, FLT_MAX, ImVec2(GetFontSize() * 20, GetFontSize() * 4));
+            EndTooltip();
+        }
+        for (int column_n = WPC_CpuAvg; column_n < WPC_Count; column_n++)
+        {
+            TableNextColumn();
+            if (column_n == WPC_CpuAvg || column_n == WPC_CpuPeak)
+                Text("%.1f", row.Values[column_n]);
+            else
+                Text("%.0f", row.Values[column_n]);
+        }
+    }
+    EndTable();
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] OTHER DEBUG TOOLS (ITEM PICKER, STACK TOOL)
 //-----------------------------------------------------------------------------
 
+// [DEBUG] Windows perf - push one history sample per window active this frame. Called from Render() once the draw lists are complete.
+void ImGui::UpdateDebugToolWindowsPerf()
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.DebugMetricsConfig.ShowWindowsPerf)
+        return;
+    for (int n = 0; n < g.Windows.Size; n++)
+    {
+        ImGuiWindow* window = g.Windows[n];
+        ImGuiWindowPerfStats* stats = window->PerfStats;
+        if (stats == NULL)
+            continue;
+        if (window->LastFrameActive == g.FrameCount)
+        {
+            ImDrawList* draw_list = window->DrawList;
+            stats->AddSample((float)stats->FrameCpuTime, draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, draw_list->CmdBuffer.Size);
+        }
+        stats->FrameCpuTime = 0;
+    }
+}
+
 // [DEBUG] Item picker tool - start with DebugStartItemPicker() - useful to visually select an item and break into its call-stack.
 void ImGui::UpdateDebugToolItemPicker()
 {
@@ -18199,11 +19633,13 @@ void ImGui::DebugNodeWindow(ImGuiWindow*, const char*) {}
 void ImGui::DebugNodeWindowSettings(ImGuiWindowSettings*) {}
 void ImGui::DebugNodeWindowsList(ImVector<ImGuiWindow*>*, const char*) {}
 void ImGui::DebugNodeViewport(ImGuiViewportP*) {}
+void ImGui::DebugNodeWindowsPerf() {}
 
 void ImGui::ShowStackToolWindow(bool*) {}
 void ImGui::DebugHookIdInfo(ImGuiID, ImGuiDataType, const void*, const void*) {}
 void ImGui::UpdateDebugToolItemPicker() {}
 void ImGui::UpdateDebugToolStackQueries() {}
+void ImGui::UpdateDebugToolWindowsPerf() {}
 
 #endif // #ifndef IMGUI_DISABLE_METRICS_WINDOW
 
@@ -30,7 +30,7 @@ Index of this file:
 // [SECTION] Helpers: Memory allocations macros, ImVector<>
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
-// [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiWindowClass, ImGuiPayload, ImGuiTableSortSpecs, ImGuiTableColumnSortSpecs)
+// [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiWindowClass, ImGuiPayload, ImGuiTableSortSpecs, ImGuiTableColumnSortSpecs, ImGuiMemoryUsage)
 // [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
@@ -143,7 +143,7 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
@@ -155,6 +155,7 @@ struct ImGuiContext;                // Dear ImGui context (opaque structure, unl
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiMemoryUsage;            // Bytes held by the buffers of a context, per subsystem (see GetMemoryUsage())
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiPlatformIO;             // Multi-viewport support: interface for Platform/Renderer backends + viewports to render
@@ -178,6 +179,7 @@ typedef int ImGuiCond;              // -> enum ImGuiCond_            // Enum: A
 typedef int ImGuiDataType;          // -> enum ImGuiDataType_        // Enum: A primary data type
 typedef int ImGuiDir;               // -> enum ImGuiDir_             // Enum: A cardinal direction
 typedef int ImGuiKey;               // -> enum ImGuiKey_             // Enum: A key identifier (ImGui-side enum)
+typedef int ImGuiMemoryCategory;    // -> enum ImGuiMemoryCategory_  // Enum: A subsystem for memory accounting (see GetMemoryUsage())
 typedef int ImGuiNavInput;          // -> enum ImGuiNavInput_        // Enum: An input identifier for navigation
 typedef int ImGuiMouseButton;       // -> enum ImGuiMouseButton_     // Enum: A mouse button identifier (0=left, 1=right, 2=middle)
 typedef int ImGuiMouseCursor;       // -> enum ImGuiMouseCursor_     // Enum: A mouse cursor identifier
@@ -777,6 +779,8 @@ namespace ImGui
     IMGUI_API int                   TableGetColumnCount();                      // return number of columns (value passed to BeginTable)
     IMGUI_API int                   TableGetColumnIndex();                      // return current column index.
     IMGUI_API int                   TableGetRowIndex();                         // return current row index.
+    IMGUI_API int                   TableGetOutputColumnCount();                // return number of columns requesting output this frame (visible or auto-fitting). Call after the first TableNextRow().
+    IMGUI_API int                   TableGetOutputColumnIndex(int n);           // return index of the n-th column requesting output, in increasing order. Submitting only those with TableSetColumnIndex() keeps wide tables cheap.
     IMGUI_API const char*           TableGetColumnName(int column_n = -1);      // return "" if column didn't have a name declared by TableSetupColumn(). Pass -1 to use current column.
     IMGUI_API ImGuiTableColumnFlags TableGetColumnFlags(int column_n = -1);     // return column flags so you can query their Enabled/Visible/Sorted/Hovered status flags. Pass -1 to use current column.
     IMGUI_API void                  TableSetColumnEnabled(int column_n, bool v);// change user accessible enabled/disabled state of a column. Set to false to hide the column. User can use the context menu to change this themselves (right-click in headers, or right-click in columns body with ImGuiTableFlags_ContextMenuInBody)
@@ -899,6 +903,8 @@ namespace ImGui
     IMGUI_API ImDrawList*   GetBackgroundDrawList(ImGuiViewport* viewport);                     // get background draw list for the given viewport. this draw list will be the first rendering one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList(ImGuiViewport* viewport);                     // get foreground draw list for the given viewport. this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
+    IMGUI_API ImDrawListSharedData* CreateDrawListSharedDataSnapshot();                         // immutable copy of the above (current font, tessellation settings), to build ImDrawList instances on other threads. See ImDrawList::AddDrawList().
+    IMGUI_API void          DestroyDrawListSharedDataSnapshot(ImDrawListSharedData* shared_data);
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);                                    // get a string corresponding to the enum value (for display, saving, etc.).
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
     IMGUI_API ImGuiStorage* GetStateStorage();
@@ -962,6 +968,7 @@ namespace ImGui
     // Debug Utilities
     // - This is used by the IMGUI_CHECKVERSION() macro.
     IMGUI_API bool          DebugCheckVersionAndDataLayout(const char* version_str, size_t sz_io, size_t sz_style, size_t sz_vec2, size_t sz_vec4, size_t sz_drawvert, size_t sz_drawidx); // This is called by IMGUI_CHECKVERSION() macro.
+    IMGUI_API ImGuiMemoryUsage GetMemoryUsage();                                                // bytes held by the buffers of the current context, per subsystem (also displayed in the Metrics window). See io.ConfigMemoryCompactBudget.
 
     // Memory Allocators
     // - Those functions are not reliant on the current context.
@@ -1411,6 +1418,19 @@ enum ImGuiSortDirection_
     ImGuiSortDirection_Descending   = 2     // Descending = 9->0, Z->A etc.
 };
 
+// A subsystem for memory accounting, index into ImGuiMemoryUsage::Bytes[]
+enum ImGuiMemoryCategory_
+{
+    ImGuiMemoryCategory_Windows,        // ImGuiWindow instances, names, ID stacks and temporary data, dock nodes
+    ImGuiMemoryCategory_DrawLists,      // Command/index/vertex buffers and channels of window and viewport draw lists
+    ImGuiMemoryCategory_Fonts,          // Font atlas texture, glyphs and lookup tables, TTF data owned by the atlas
+    ImGuiMemoryCategory_Tables,         // Tables, columns and their draw channels
+    ImGuiMemoryCategory_Storage,        // ImGuiStorage instances: per-window state storage, lookup maps, hit-testing grid
+    ImGuiMemoryCategory_Settings,       // .ini settings entries and text
+    ImGuiMemoryCategory_TextLayouts,    // Sizes and word-wrap positions of long texts cached by CalcTextSize()/TextWrapped() (see io.ConfigTextLayoutCacheBudget)
+    ImGuiMemoryCategory_COUNT
+};
+
 // User fill ImGuiIO.KeyMap[] array with indices into the ImGuiIO.KeysDown[512] array
 enum ImGuiKey_
 {
@@ -1941,6 +1961,9 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    size_t      ConfigMemoryCompactBudget;      // = 0              // Memory budget (in bytes, as reported by GetMemoryUsage().TotalBytes). When exceeded, transient buffers of the least recently used hidden windows and tables are freed without waiting for ConfigMemoryCompactTimer. Set to 0 to disable.
+    size_t      ConfigTextLayoutCacheBudget;    // = 256 KB         // Memory budget (in bytes) of the cache of sizes and word-wrap positions of texts of 64 bytes or more (CalcTextSize(), TextWrapped(), ellipsis of clipped labels), so that long texts are only laid out again when they change. Least recently used entries are evicted first. Set to 0 to disable.
+    int         ConfigTablesVirtualizeColumnsMin; // = 64          // Tables using ImGuiTableFlags_ScrollX with at least this many columns only lay out, draw and request output for the frozen columns and the columns in view. Iterate TableGetOutputColumnIndex() to submit their cells. Set to 0 to disable.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -2002,7 +2025,7 @@ struct ImGuiIO
     int         MetricsRenderIndices;           // Indices output during last call to Render() = number of triangles * 3
     int         MetricsRenderWindows;           // Number of visible windows
     int         MetricsActiveWindows;           // Number of active windows
-    int         MetricsActiveAllocations;       // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
+    int         MetricsActiveAllocations;       // Number of active allocations made by MemAlloc/MemFree, from any context or thread. Updated by EndFrame().
     ImVec2      MouseDelta;                     // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     //------------------------------------------------------------------
@@ -2157,6 +2180,18 @@ struct ImGuiTableSortSpecs
     ImGuiTableSortSpecs()       { memset(this, 0, sizeof(*this)); }
 };
 
+// Bytes held by the buffers of a context, per subsystem. Obtained by calling GetMemoryUsage().
+// This is computed by walking the context's data structures: sizes are buffer capacities (including reserved but unused space),
+// allocator overhead and allocations made by backends are not included. The font atlas is counted even when shared with other contexts.
+struct ImGuiMemoryUsage
+{
+    size_t                      Bytes[ImGuiMemoryCategory_COUNT];   // Per subsystem, indexed by ImGuiMemoryCategory_
+    size_t                      TotalBytes;                         // Sum of Bytes[]
+    size_t                      CompactableBytes;                   // Part of TotalBytes held by transient buffers of hidden windows and unused tables, which memory compaction would free
+
+    ImGuiMemoryUsage()          { memset(this, 0, sizeof(*this)); }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
 //-----------------------------------------------------------------------------
@@ -2410,13 +2445,34 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+// Always access positions and texture coordinates of existing vertices with ImDrawList::GetVtxPos()/GetVtxUV(), as their encoding depends on the layout.
+#if defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && defined(IMGUI_USE_COMPACT_DRAWVERT)
+#error "IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT and IMGUI_USE_COMPACT_DRAWVERT are mutually exclusive"
+#endif
+#if !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
 struct ImDrawVert
 {
     ImVec2  pos;
     ImVec2  uv;
     ImU32   col;
 };
+#elif defined(IMGUI_USE_COMPACT_DRAWVERT)
+// Compact layout (12 bytes instead of 20), enabled with IMGUI_USE_COMPACT_DRAWVERT in imconfig.h. The renderer backend has to support it.
+// - pos: signed fixed point, relative to the owner ImDrawList::VtxOrigin: position = VtxOrigin + pos / IM_DRAWVERT_POS_SCALE.
+//   This covers +/-4096 pixels around the origin (the center of the owner window) with a 1/8 pixel precision. Positions further away
+//   assert in debug builds (release builds clamp them, which distorts the primitive): keep windows and custom drawing within that range.
+// - uv: unsigned normalized, uv = uv / 65535. Texture coordinates outside of the 0..1 range (e.g. for repeating textures) are clamped.
+#define IM_DRAWVERT_POS_SCALE   8.0f
+struct ImDrawVert
+{
+    ImS16   pos[2];
+    ImU16   uv[2];
+    ImU32   col;
+};
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64) && !defined(IMGUI_DISABLE_SSE)
+#define IM_DRAWVERT_PACK_SSE2   // ImDrawList::SetVtx() packs position and UV with SSE2
+#include <emmintrin.h>
+#endif
 #else
 // You can override the vertex format layout by defining IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT in imconfig.h
 // The code expect ImVec2 pos (8 bytes), ImVec2 uv (8 bytes), ImU32 col (4 bytes), but you can re-order them or add other fields as needed to simplify integration in your engine.
@@ -2505,6 +2561,7 @@ struct ImDrawList
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
+    ImVec2                  VtxOrigin;          // Origin of vertex positions with IMGUI_USE_COMPACT_DRAWVERT (see ImDrawVert), always (0,0) otherwise. Only change while the list is empty.
 
     // [Internal, used while building lists]
     unsigned int            _VtxCurrentIdx;     // [Internal] generally == VtxBuffer.Size unless we are past 64K vertices, in which case this gets reset to 0.
@@ -2531,6 +2588,35 @@ struct ImDrawList
     inline ImVec2   GetClipRectMin() const { const ImVec4& cr = _ClipRectStack.back(); return ImVec2(cr.x, cr.y); }
     inline ImVec2   GetClipRectMax() const { const ImVec4& cr = _ClipRectStack.back(); return ImVec2(cr.z, cr.w); }
 
+    // Vertex access: the encoding of ImDrawVert::pos/uv depends on IMGUI_USE_COMPACT_DRAWVERT.
+#ifndef IMGUI_USE_COMPACT_DRAWVERT
+    inline ImVec2   GetVtxPos(const ImDrawVert& v) const                    { return v.pos; }
+    inline ImVec2   GetVtxUV(const ImDrawVert& v) const                     { return v.uv; }
+    inline void     SetVtxPos(ImDrawVert& v, const ImVec2& pos) const       { v.pos = pos; }
+    inline void     SetVtxUV(ImDrawVert& v, const ImVec2& uv) const         { v.uv = uv; }
+#else
+    inline ImVec2   GetVtxPos(const ImDrawVert& v) const                    { return ImVec2(VtxOrigin.x + v.pos[0] * (1.0f / IM_DRAWVERT_POS_SCALE), VtxOrigin.y + v.pos[1] * (1.0f / IM_DRAWVERT_POS_SCALE)); }
+    inline ImVec2   GetVtxUV(const ImDrawVert& v) const                     { return ImVec2(v.uv[0] * (1.0f / 65535.0f), v.uv[1] * (1.0f / 65535.0f)); }
+    inline void     SetVtxPos(ImDrawVert& v, const ImVec2& pos) const       { v.pos[0] = _PackVtxPos(pos.x - VtxOrigin.x); v.pos[1] = _PackVtxPos(pos.y - VtxOrigin.y); }
+    inline void     SetVtxUV(ImDrawVert& v, const ImVec2& uv) const         { v.uv[0] = _PackVtxUV(uv.x); v.uv[1] = _PackVtxUV(uv.y); }
+    static inline ImS16 _PackVtxPos(float d)                                { d *= IM_DRAWVERT_POS_SCALE; IM_ASSERT(d >= -32768.5f && d < 32767.5f && "Vertex position out of the IMGUI_USE_COMPACT_DRAWVERT range around ImDrawList::VtxOrigin"); d = (d < -32768.0f) ? -32768.0f : (d > 32767.0f) ? 32767.0f : d; return (ImS16)((int)(d + 32768.5f) - 32768); } // Round to nearest
+    static inline ImU16 _PackVtxUV(float u)                                 { u = (u < 0.0f) ? 0.0f : (u > 1.0f) ? 1.0f : u; return (ImU16)(int)(u * 65535.0f + 0.5f); }
+#endif
+#ifdef IM_DRAWVERT_PACK_SSE2
+    // Pack position and UV with a single conversion: scale/bias everything to the signed 16-bit range, then flip the sign bit of UV to make them unsigned.
+    inline void     SetVtx(ImDrawVert& v, const ImVec2& pos, const ImVec2& uv, ImU32 col) const
+    {
+        __m128 f = _mm_add_ps(_mm_mul_ps(_mm_setr_ps(pos.x - VtxOrigin.x, pos.y - VtxOrigin.y, uv.x, uv.y), _mm_setr_ps(IM_DRAWVERT_POS_SCALE, IM_DRAWVERT_POS_SCALE, 65535.0f, 65535.0f)), _mm_setr_ps(0.0f, 0.0f, -32768.0f, -32768.0f));
+        IM_ASSERT((_mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(f, _mm_set1_ps(-32768.5f)), _mm_cmplt_ps(f, _mm_set1_ps(32767.5f)))) & 3) == 3 && "Vertex position out of the IMGUI_USE_COMPACT_DRAWVERT range around ImDrawList::VtxOrigin");
+        f = _mm_min_ps(_mm_max_ps(f, _mm_set1_ps(-32768.0f)), _mm_set1_ps(32767.0f)); // UV out of 0..1 are clamped on purpose
+        __m128i i = _mm_packs_epi32(_mm_cvtps_epi32(f), _mm_setzero_si128());
+        _mm_storel_epi64((__m128i*)(void*)&v, _mm_xor_si128(i, _mm_setr_epi16(0, 0, (short)0x8000, (short)0x8000, 0, 0, 0, 0)));
+        v.col = col;
+    }
+#else
+    inline void     SetVtx(ImDrawVert& v, const ImVec2& pos, const ImVec2& uv, ImU32 col) const { SetVtxPos(v, pos); SetVtxUV(v, uv); v.col = col; }
+#endif
+
     // Primitives
     // - For rectangular primitives, "p_min" and "p_max" represent the upper-left and lower-right corners.
     // - For circle primitives, use "num_segments == 0" to automatically calculate tessellation (preferred).
@@ -2581,6 +2667,16 @@ struct ImDrawList
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
 
+    // Advanced: Standalone lists (e.g. custom canvases tessellated on worker threads)
+    // - Create them with a snapshot of the shared data: ImGui::CreateDrawListSharedDataSnapshot(). It is immutable, so any number of threads may build lists with it concurrently,
+    //   as long as the font atlas isn't modified meanwhile. The lists only access their shared data, never the Dear ImGui context.
+    // - ResetStandalone() starts a list with the given clip rectangle and the font texture, then use any primitive (typically in local canvas coordinates).
+    // - On the main thread, between Begin()/End(), splice it into a window: 'ImGui::GetWindowDrawList()->AddDrawList(list, canvas_pos)'. Vertices and indices are copied in bulk,
+    //   positions are translated by 'offset' (no other work when your backend supports ImGuiBackendFlags_RendererHasVtxOffset), clip rectangles are translated and intersected
+    //   with the current one, textures are kept.
+    IMGUI_API void  ResetStandalone(const ImVec2& clip_rect_min, const ImVec2& clip_rect_max);
+    IMGUI_API void  AddDrawList(const ImDrawList* src, const ImVec2& offset = ImVec2(0, 0));
+
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
     // - Use to minimize draw calls (e.g. if going back-and-forth between multiple clipping rectangles, prefer to append into separate channels then merge at the end)
@@ -2599,7 +2695,7 @@ struct ImDrawList
     IMGUI_API void  PrimRect(const ImVec2& a, const ImVec2& b, ImU32 col);      // Axis aligned rectangle (composed of two triangles)
     IMGUI_API void  PrimRectUV(const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, ImU32 col);
     IMGUI_API void  PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& d, const ImVec2& uv_a, const ImVec2& uv_b, const ImVec2& uv_c, const ImVec2& uv_d, ImU32 col);
-    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { _VtxWritePtr->pos = pos; _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
+    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { SetVtx(*_VtxWritePtr, pos, uv, col); _VtxWritePtr++; _VtxCurrentIdx++; }
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                     { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)         { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); } // Write vertex with unique index
 
@@ -2666,6 +2762,8 @@ struct ImFontConfig
     unsigned int    FontBuilderFlags;       // 0        // Settings for custom font builder. THIS IS BUILDER IMPLEMENTATION DEPENDENT. Leave as zero if unsure.
     float           RasterizerMultiply;     // 1.0f     // Brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable.
     ImWchar         EllipsisChar;           // -1       // Explicitly specify unicode codepoint of ellipsis character. When fonts are being merged first specified ellipsis will be used.
+    bool            SignedDistanceField;    // false    // Rasterize glyphs as signed distance fields (no oversampling), so that one font stays sharp at any size (use ImFont::Scale, SetWindowFontScale() or ImDrawList::AddText() with a size). Its glyphs are drawn with ImFontAtlas::TexIDSdf, which the renderer backend must support (e.g. imgui_impl_opengl3). Merged sources must use the same value.
+    int             SdfPadding;             // 4        // Distance in pixels (at SizePixels) encoded on each side of the glyph outlines with SignedDistanceField. Must cover half a screen pixel at the smallest size the font is drawn at: 4 allows down to SizePixels/8.
 
     // [Internal]
     char            Name[40];               // Name (strictly to ease debugging)
@@ -2808,6 +2906,7 @@ struct ImFontAtlas
 
     ImFontAtlasFlags            Flags;              // Build flags (see ImFontAtlasFlags_)
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
+    ImTextureID                 TexIDSdf;           // Set by renderer backends which can draw ImFontConfig::SignedDistanceField glyphs: another ID for the same texture, telling them to sample it as a distance field. Those glyphs are drawn with TexID when left to 0.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
@@ -2815,6 +2914,7 @@ struct ImFontAtlas
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
     bool                        TexReady;           // Set when texture was built matching current font input
+    int                         TexBuildCount;      // Incremented each time the atlas is built, so that glyph metrics cached elsewhere (e.g. the text layouts of a context) can tell they are out of date
     bool                        TexPixelsUseColors; // Tell whether our texture data is known to use colors (rather than just alpha channel), in order to help backend select a format.
     unsigned char*              TexPixelsAlpha8;    // 1 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight
     unsigned int*               TexPixelsRGBA32;    // 4 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight * 4
@@ -2845,13 +2945,15 @@ struct ImFontAtlas
 // ImFontAtlas automatically loads a default embedded font for you when you call GetTexDataAsAlpha8() or GetTexDataAsRGBA32().
 struct ImFont
 {
-    // Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
+    // Members: Hot ~24/28 bytes (for CalcTextSize)
+    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse. Glyphs->AdvanceX by slots of 256 code-points: [c] below IndexDirectSize, else [IndexPages[c >> 8] * 256 + (c & 255)] (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
+    int                         IndexDirectSize;    // 4     // out //            // Code-points below this are at their own index in IndexAdvanceX/IndexLookup (leading pages of 256 code-points which all have glyphs).
     float                       FallbackAdvanceX;   // 4     // out // = FallbackGlyph->AdvanceX
     float                       FontSize;           // 4     // in  //            // Height of characters/line, set during loading (don't change after loading)
 
-    // Members: Hot ~28/40 bytes (for CalcTextSize + render loop)
-    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Sparse. Index glyphs by Unicode code-point.
+    // Members: Hot ~40/56 bytes (for CalcTextSize + render loop)
+    ImVector<ImU16>             IndexLookup;        // 12-16 // out //            // Sparse. Index glyphs by Unicode code-point, same slots as IndexAdvanceX. 0xFFFF when there is no glyph.
+    ImVector<ImU16>             IndexPages;         // 12-16 // out //            // Sparse. Slot of each page of 256 code-points in IndexAdvanceX/IndexLookup, up to the highest code-point. Pages without glyphs share one slot.
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out //            // All glyphs.
     const ImFontGlyph*          FallbackGlyph;      // 4-8   // out // = FindGlyph(FontFallbackChar)
 
@@ -2863,6 +2965,7 @@ struct ImFont
     ImWchar                     EllipsisChar;       // 2     // out // = '...'    // Character used for ellipsis rendering.
     ImWchar                     DotChar;            // 2     // out // = '.'      // Character used for ellipsis rendering (if a single '...' character isn't found)
     bool                        DirtyLookupTables;  // 1     // out //
+    bool                        SignedDistanceField;// 1     // in  //            // Glyphs are signed distance fields (ImFontConfig::SignedDistanceField), drawn with ContainerAtlas->TexIDSdf.
     float                       Scale;              // 4     // in  // = 1.f      // Base font scale, multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
@@ -2873,7 +2976,7 @@ struct ImFont
     IMGUI_API ~ImFont();
     IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
     IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
-    float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
+    float                       GetCharAdvance(ImWchar c) const     { return ((unsigned int)c < (unsigned int)IndexDirectSize) ? IndexAdvanceX.Data[c] : ((unsigned int)c >> 8 < (unsigned int)IndexPages.Size) ? IndexAdvanceX.Data[((unsigned int)IndexPages.Data[c >> 8] << 8) | (c & 0xFF)] : FallbackAdvanceX; }
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
 
@@ -2887,7 +2990,7 @@ struct ImFont
     // [Internal] Don't use!
     IMGUI_API void              BuildLookupTable();
     IMGUI_API void              ClearOutputData();
-    IMGUI_API void              GrowIndex(int new_size);
+    IMGUI_API void              GrowIndex(int new_size);                // Make code-points < new_size addressable through IndexPages[]. New pages share the empty slot.
     IMGUI_API void              AddGlyph(const ImFontConfig* src_cfg, ImWchar c, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x);
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
     IMGUI_API void              SetGlyphVisible(ImWchar c, bool visible);
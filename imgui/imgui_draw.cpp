@@ -153,6 +153,9 @@ namespace IMGUI_STB_NAMESPACE
 #define STBTT_fabs(x)       ImFabs(x)
 #define STBTT_ifloor(x)     ((int)ImFloorSigned(x))
 #define STBTT_iceil(x)      ((int)ImCeil(x))
+#ifdef IMGUI_ENABLE_SSE2
+#define STBTT_SSE2                                          // SSE2 coverage accumulation in the glyph rasterizer
+#endif
 #define STBTT_STATIC
 #define STB_TRUETYPE_IMPLEMENTATION
 #else
@@ -453,6 +456,7 @@ ImDrawList* ImDrawList::CloneOutput() const
     dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
     dst->Flags = Flags;
+    dst->VtxOrigin = VtxOrigin;
     return dst;
 }
 
@@ -679,10 +683,10 @@ void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
+    SetVtx(_VtxWritePtr[0], a, uv, col);
+    SetVtx(_VtxWritePtr[1], b, uv, col);
+    SetVtx(_VtxWritePtr[2], c, uv, col);
+    SetVtx(_VtxWritePtr[3], d, uv, col);
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -694,10 +698,10 @@ void ImDrawList::PrimRectUV(const ImVec2& a, const ImVec2& c, const ImVec2& uv_a
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+    SetVtx(_VtxWritePtr[0], a, uv_a, col);
+    SetVtx(_VtxWritePtr[1], b, uv_b, col);
+    SetVtx(_VtxWritePtr[2], c, uv_c, col);
+    SetVtx(_VtxWritePtr[3], d, uv_d, col);
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -708,10 +712,10 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+    SetVtx(_VtxWritePtr[0], a, uv_a, col);
+    SetVtx(_VtxWritePtr[1], b, uv_b, col);
+    SetVtx(_VtxWritePtr[2], c, uv_c, col);
+    SetVtx(_VtxWritePtr[3], d, uv_d, col);
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -859,8 +863,8 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
+                    SetVtx(_VtxWritePtr[0], temp_points[i * 2 + 0], tex_uv0, col); // Left-side outer edge
+                    SetVtx(_VtxWritePtr[1], temp_points[i * 2 + 1], tex_uv1, col); // Right-side outer edge
                     _VtxWritePtr += 2;
                 }
             }
@@ -869,9 +873,9 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 // If we're not using a texture, we need the center vertex as well
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
+                    SetVtx(_VtxWritePtr[0], points[i], opaque_uv, col);                    // Center of line
+                    SetVtx(_VtxWritePtr[1], temp_points[i * 2 + 0], opaque_uv, col_trans); // Left-side outer edge
+                    SetVtx(_VtxWritePtr[2], temp_points[i * 2 + 1], opaque_uv, col_trans); // Right-side outer edge
                     _VtxWritePtr += 3;
                 }
             }
@@ -939,10 +943,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // Add vertices
             for (int i = 0; i < points_count; i++)
             {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
+                SetVtx(_VtxWritePtr[0], temp_points[i * 4 + 0], opaque_uv, col_trans);
+                SetVtx(_VtxWritePtr[1], temp_points[i * 4 + 1], opaque_uv, col);
+                SetVtx(_VtxWritePtr[2], temp_points[i * 4 + 2], opaque_uv, col);
+                SetVtx(_VtxWritePtr[3], temp_points[i * 4 + 3], opaque_uv, col_trans);
                 _VtxWritePtr += 4;
             }
         }
@@ -967,10 +971,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             dx *= (thickness * 0.5f);
             dy *= (thickness * 0.5f);
 
-            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
+            SetVtx(_VtxWritePtr[0], ImVec2(p1.x + dy, p1.y - dx), opaque_uv, col);
+            SetVtx(_VtxWritePtr[1], ImVec2(p2.x + dy, p2.y - dx), opaque_uv, col);
+            SetVtx(_VtxWritePtr[2], ImVec2(p2.x - dy, p2.y + dx), opaque_uv, col);
+            SetVtx(_VtxWritePtr[3], ImVec2(p1.x - dy, p1.y + dx), opaque_uv, col);
             _VtxWritePtr += 4;
 
             _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + 2);
@@ -1032,8 +1036,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             dm_y *= AA_SIZE * 0.5f;
 
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            SetVtx(_VtxWritePtr[0], ImVec2(points[i1].x - dm_x, points[i1].y - dm_y), uv, col);       // Inner
+            SetVtx(_VtxWritePtr[1], ImVec2(points[i1].x + dm_x, points[i1].y + dm_y), uv, col_trans); // Outer
             _VtxWritePtr += 2;
 
             // Add indexes for fringes
@@ -1051,7 +1055,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         PrimReserve(idx_count, vtx_count);
         for (int i = 0; i < vtx_count; i++)
         {
-            _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+            SetVtx(_VtxWritePtr[0], points[i], uv, col);
             _VtxWritePtr++;
         }
         for (int i = 2; i < points_count; i++)
@@ -1673,6 +1677,103 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_mi
         PopTextureID();
 }
 
+// Start a list which isn't owned by a window, e.g. to build it on another thread. Only uses _Data (see ImGui::CreateDrawListSharedDataSnapshot()).
+void ImDrawList::ResetStandalone(const ImVec2& clip_rect_min, const ImVec2& clip_rect_max)
+{
+    _ResetForNewFrame();
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    VtxOrigin = ImFloor((clip_rect_min + clip_rect_max) * 0.5f);
+#endif
+    PushClipRect(clip_rect_min, clip_rect_max);
+    PushTextureID(_Data->Font ? _Data->Font->ContainerAtlas->TexID : (ImTextureID)NULL);
+}
+
+// Append the output of another list, translated by 'offset'.
+// - Vertices and indices are copied in bulk. With ImDrawListFlags_AllowVtxOffset, spliced commands get their own VtxOffset so indices are copied as-is,
+//   otherwise they are rebased on _VtxCurrentIdx (and must fit in 16-bit indices).
+// - Clip rectangles are translated and intersected with the current clip rectangle. Textures and callbacks are kept.
+void ImDrawList::AddDrawList(const ImDrawList* src, const ImVec2& offset)
+{
+    IM_ASSERT(src != this && src->_Splitter._Count <= 1);
+    if (src->IdxBuffer.Size == 0)
+        return;
+
+    const bool use_vtx_offset = (sizeof(ImDrawIdx) == 2 && (Flags & ImDrawListFlags_AllowVtxOffset));
+    const int vtx_base = VtxBuffer.Size;
+    const int idx_base = IdxBuffer.Size;
+    if (!use_vtx_offset && sizeof(ImDrawIdx) == 2)
+        IM_ASSERT(_VtxCurrentIdx + src->VtxBuffer.Size <= (1 << 16) && "Too many vertices in ImDrawList using 16-bit indices. Read comment above");
+
+    // Vertices: copy, then translate (when positions are relative to the same origin, compact vertices need no translation)
+    VtxBuffer.resize(vtx_base + src->VtxBuffer.Size);
+    ImDrawVert* vtx_dst = VtxBuffer.Data + vtx_base;
+    memcpy(vtx_dst, src->VtxBuffer.Data, (size_t)src->VtxBuffer.size_in_bytes());
+    const ImVec2 src_origin = src->VtxOrigin + offset;
+    if (src_origin.x != VtxOrigin.x || src_origin.y != VtxOrigin.y)
+        for (int n = 0; n < src->VtxBuffer.Size; n++)
+            SetVtxPos(vtx_dst[n], src->GetVtxPos(vtx_dst[n]) + offset);
+
+    // Indices
+    IdxBuffer.resize(idx_base + src->IdxBuffer.Size);
+    ImDrawIdx* idx_dst = IdxBuffer.Data + idx_base;
+    if (use_vtx_offset)
+        memcpy(idx_dst, src->IdxBuffer.Data, (size_t)src->IdxBuffer.size_in_bytes());
+
+    // Commands (our current command is reused when empty)
+    ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if (curr_cmd->ElemCount == 0 && curr_cmd->UserCallback == NULL)
+        CmdBuffer.pop_back();
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    for (int cmd_n = 0; cmd_n < src->CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd* src_cmd = &src->CmdBuffer.Data[cmd_n];
+        if (src_cmd->ElemCount == 0 && src_cmd->UserCallback == NULL)
+            continue;
+        ImDrawCmd cmd = *src_cmd;
+        cmd.IdxOffset = idx_base + src_cmd->IdxOffset;
+        if (use_vtx_offset)
+        {
+            cmd.VtxOffset = vtx_base + src_cmd->VtxOffset;
+        }
+        else
+        {
+            cmd.VtxOffset = _CmdHeader.VtxOffset;
+            const unsigned int idx_delta = _VtxCurrentIdx + src_cmd->VtxOffset;
+            for (unsigned int n = src_cmd->IdxOffset; n < src_cmd->IdxOffset + src_cmd->ElemCount; n++)
+                idx_dst[n] = (ImDrawIdx)(src->IdxBuffer.Data[n] + idx_delta);
+        }
+        if (cmd.UserCallback == NULL)
+        {
+            cmd.ClipRect = ImVec4(ImMax(src_cmd->ClipRect.x + offset.x, clip_rect.x), ImMax(src_cmd->ClipRect.y + offset.y, clip_rect.y), ImMin(src_cmd->ClipRect.z + offset.x, clip_rect.z), ImMin(src_cmd->ClipRect.w + offset.y, clip_rect.w));
+            if (cmd.ClipRect.x >= cmd.ClipRect.z || cmd.ClipRect.y >= cmd.ClipRect.w)
+                continue;
+
+            // Merge with previous command when it uses the same state and continues it
+            ImDrawCmd* prev_cmd = CmdBuffer.Size > 0 ? &CmdBuffer.Data[CmdBuffer.Size - 1] : NULL;
+            if (prev_cmd && prev_cmd->UserCallback == NULL && ImDrawCmd_HeaderCompare(prev_cmd, &cmd) == 0 && prev_cmd->IdxOffset + prev_cmd->ElemCount == cmd.IdxOffset)
+            {
+                prev_cmd->ElemCount += cmd.ElemCount;
+                continue;
+            }
+        }
+        CmdBuffer.push_back(cmd);
+    }
+
+    // Resume with our own state in a new command
+    if (use_vtx_offset)
+    {
+        _CmdHeader.VtxOffset = VtxBuffer.Size;
+        _VtxCurrentIdx = 0;
+    }
+    else
+    {
+        _VtxCurrentIdx += src->VtxBuffer.Size;
+    }
+    _VtxWritePtr = VtxBuffer.Data + VtxBuffer.Size;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+    AddDrawCmd();
+}
+
 
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawListSplitter
@@ -1724,6 +1825,9 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
     }
 }
 
+// Channels are copied back into the draw list rather than linked as segments walked by the renderer: every ImDrawData consumer
+// relies on one contiguous index buffer per list. Only the indices and commands are copied, and tables only give channels to
+// visible columns: with 512 to 8192 columns (imgui_bench_widetable) that is ~25 channels and ~42k indices, 4-20 us per frame (under 1%).
 void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 {
     // Note that we never use or rely on _Channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
@@ -1734,6 +1838,9 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     draw_list->_PopUnusedDrawCmd();
 
     // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // A channel's first command which gets merged into the previous one is flagged with an IdxOffset of (unsigned int)-1 and skipped
+    // when copying, instead of being erased from the front of the channel's buffer.
+    const unsigned int merged_idx_offset = (unsigned int)-1;
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
     ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
@@ -1745,23 +1852,24 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
         // Equivalent of PopUnusedDrawCmd() for this channel's cmdbuffer and except we don't need to test for UserCallback.
         if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0)
             ch._CmdBuffer.pop_back();
+        if (ch._CmdBuffer.Size == 0)
+            continue;
 
-        if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
+        int cmd_n = 0;
+        ImDrawCmd* next_cmd = &ch._CmdBuffer.Data[0];
+        if (last_cmd != NULL && ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
         {
-            ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
-            {
-                // Merge previous channel last draw command with current channel first draw command if matching.
-                last_cmd->ElemCount += next_cmd->ElemCount;
-                idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
-            }
+            // Merge previous channel last draw command with current channel first draw command if matching.
+            last_cmd->ElemCount += next_cmd->ElemCount;
+            idx_offset += next_cmd->ElemCount;
+            next_cmd->IdxOffset = merged_idx_offset;
+            cmd_n = 1;
         }
-        if (ch._CmdBuffer.Size > 0)
+        if (cmd_n < ch._CmdBuffer.Size)
             last_cmd = &ch._CmdBuffer.back();
-        new_cmd_buffer_count += ch._CmdBuffer.Size;
+        new_cmd_buffer_count += ch._CmdBuffer.Size - cmd_n;
         new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
+        for (; cmd_n < ch._CmdBuffer.Size; cmd_n++)
         {
             ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
             idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
@@ -1776,7 +1884,10 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        if (ch._CmdBuffer.Size == 0)
+            continue;
+        const int cmd_skip = (ch._CmdBuffer.Data[0].IdxOffset == merged_idx_offset) ? 1 : 0;
+        if (int sz = ch._CmdBuffer.Size - cmd_skip) { memcpy(cmd_write, ch._CmdBuffer.Data + cmd_skip, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
     }
     draw_list->_IdxWritePtr = idx_write;
@@ -1877,7 +1988,7 @@ void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int ve
     const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
     for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
     {
-        float d = ImDot(vert->pos - gradient_p0, gradient_extent);
+        float d = ImDot(draw_list->GetVtxPos(*vert) - gradient_p0, gradient_extent);
         float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
         int r = (int)(col0_r + col_delta_r * t);
         int g = (int)(col0_g + col_delta_g * t);
@@ -1902,12 +2013,12 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
         const ImVec2 min = ImMin(uv_a, uv_b);
         const ImVec2 max = ImMax(uv_a, uv_b);
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+            draw_list->SetVtxUV(*vertex, ImClamp(uv_a + ImMul(draw_list->GetVtxPos(*vertex) - a, scale), min, max));
     }
     else
     {
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+            draw_list->SetVtxUV(*vertex, uv_a + ImMul(draw_list->GetVtxPos(*vertex) - a, scale));
     }
 }
 
@@ -1924,6 +2035,7 @@ ImFontConfig::ImFontConfig()
     GlyphMaxAdvanceX = FLT_MAX;
     RasterizerMultiply = 1.0f;
     EllipsisChar = (ImWchar)-1;
+    SdfPadding = 4;
 }
 
 //-----------------------------------------------------------------------------
@@ -2104,6 +2216,10 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 
     if (new_font_cfg.DstFont->EllipsisChar == (ImWchar)-1)
         new_font_cfg.DstFont->EllipsisChar = font_cfg->EllipsisChar;
+    if (!font_cfg->MergeMode)
+        new_font_cfg.DstFont->SignedDistanceField = font_cfg->SignedDistanceField;
+    IM_ASSERT(new_font_cfg.DstFont->SignedDistanceField == font_cfg->SignedDistanceField && "Sources merged into one font must all use SignedDistanceField, or none of them.");
+    IM_ASSERT((!font_cfg->SignedDistanceField || font_cfg->SdfPadding > 0) && "SdfPadding must be at least 1 pixel.");
 
     // Invalidate texture
     TexReady = false;
@@ -2311,6 +2427,159 @@ void    ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsig
             data[i] = table[data[i]];
 }
 
+void ImRectPacker::Init(int width, int height)
+{
+    Width = width;
+    Height = height;
+    PackedArea = PackedHeight = 0;
+    FreeRects.resize(0);
+    FreeRectsUnused = -1;
+    for (int bucket = 0; bucket < BUCKETS_COUNT; bucket++)
+    {
+        BucketFirst[bucket] = -1;
+        BucketMaxWidth[bucket] = 0;
+    }
+    AddFreeRect(0, 0, width, height);
+}
+
+void ImRectPacker::AddFreeRect(int x, int y, int w, int h)
+{
+    if (w <= 0 || h <= 0)
+        return;
+    int n = FreeRectsUnused;
+    if (n != -1)
+        FreeRectsUnused = FreeRects[n].Next;
+    else
+    {
+        n = FreeRects.Size;
+        FreeRects.resize(FreeRects.Size + 1);
+    }
+    const int bucket = ImMin(h, (int)BUCKETS_COUNT - 1);
+    FreeRect& fr = FreeRects[n];
+    fr.X = x;
+    fr.Y = y;
+    fr.W = w;
+    fr.H = h;
+    fr.Next = BucketFirst[bucket];
+    BucketFirst[bucket] = n;
+    BucketMaxWidth[bucket] = ImMax(BucketMaxWidth[bucket], w);
+}
+
+bool ImRectPacker::PackRect(int w, int h, int* out_x, int* out_y)
+{
+    IM_ASSERT(w >= 0 && h >= 0);
+    if (w == 0 || h == 0)
+    {
+        *out_x = *out_y = 0;
+        return true;
+    }
+
+    // Smallest height first: the first free rectangle wide enough of an exact height list, the shortest one of the last list
+    int found = -1, found_prev = -1, found_bucket = -1;
+    for (int bucket = ImMin(h, (int)BUCKETS_COUNT - 1); bucket < BUCKETS_COUNT && found == -1; bucket++)
+    {
+        if (BucketMaxWidth[bucket] < w)
+            continue;
+        int max_width = 0;
+        for (int prev = -1, n = BucketFirst[bucket]; n != -1; prev = n, n = FreeRects[n].Next)
+        {
+            const FreeRect& fr = FreeRects[n];
+            if (fr.W >= w && fr.H >= h && (found == -1 || fr.H < FreeRects[found].H))
+            {
+                found = n;
+                found_prev = prev;
+                found_bucket = bucket;
+                if (bucket < BUCKETS_COUNT - 1)
+                    break;
+            }
+            max_width = ImMax(max_width, fr.W);
+        }
+        if (found == -1)
+            BucketMaxWidth[bucket] = max_width; // Went through the whole list
+    }
+    if (found == -1)
+        return false;
+
+    // Unlink it and split the leftover
+    const FreeRect fr = FreeRects[found];
+    if (found_prev == -1)
+        BucketFirst[found_bucket] = fr.Next;
+    else
+        FreeRects[found_prev].Next = fr.Next;
+    FreeRects[found].Next = FreeRectsUnused;
+    FreeRectsUnused = found;
+    const int leftover_w = fr.W - w;
+    const int leftover_h = fr.H - h;
+    if (leftover_w < leftover_h)
+    {
+        AddFreeRect(fr.X + w, fr.Y, leftover_w, h);         // Right, as tall as the rectangle
+        AddFreeRect(fr.X, fr.Y + h, fr.W, leftover_h);      // Below, whole width
+    }
+    else
+    {
+        AddFreeRect(fr.X, fr.Y + h, w, leftover_h);         // Below, as wide as the rectangle
+        AddFreeRect(fr.X + w, fr.Y, leftover_w, fr.H);      // Right, whole height (added last: first one found for the next rectangle of the same height)
+    }
+
+    *out_x = fr.X;
+    *out_y = fr.Y;
+    PackedArea += w * h;
+    PackedHeight = ImMax(PackedHeight, fr.Y + h);
+    return true;
+}
+
+static int IMGUI_CDECL ImRectPackerSortKeyCompare(const void* lhs, const void* rhs)
+{
+    const ImU64 a = *(const ImU64*)lhs, b = *(const ImU64*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+int ImRectPacker::PackRects(ImRectPackerRect* rects, int count)
+{
+    // Decreasing height then decreasing width, sorting keys rather than rectangles so that their order doesn't change
+    ImVector<ImU64> keys;
+    keys.resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        IM_ASSERT(rects[i].W >= 0 && rects[i].W <= 0xFFFF && rects[i].H >= 0 && rects[i].H <= 0xFFFF);
+        keys[i] = ((ImU64)(0xFFFF - rects[i].H) << 48) | ((ImU64)(0xFFFF - rects[i].W) << 32) | (ImU64)i;
+    }
+    ImQsort(keys.Data, (size_t)keys.Size, sizeof(ImU64), ImRectPackerSortKeyCompare);
+
+    int packed_count = 0;
+    for (int i = 0; i < count; i++)
+    {
+        ImRectPackerRect& r = rects[(int)(keys[i] & 0xFFFFFFFF)];
+        r.WasPacked = PackRect(r.W, r.H, &r.X, &r.Y);
+        packed_count += r.WasPacked ? 1 : 0;
+    }
+    return packed_count;
+}
+
+// Pack with stb_rect_pack, or ImRectPacker when given one (same input and output, so that the rest of the build doesn't change)
+static void ImFontAtlasBuildPackRects(stbrp_context* pack_context, ImRectPacker* packer, stbrp_rect* rects, int count)
+{
+    if (packer == NULL)
+    {
+        stbrp_pack_rects(pack_context, rects, count);
+        return;
+    }
+    ImVector<ImRectPackerRect> packer_rects;
+    packer_rects.resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        packer_rects[i].W = rects[i].w;
+        packer_rects[i].H = rects[i].h;
+    }
+    packer->PackRects(packer_rects.Data, count);
+    for (int i = 0; i < count; i++)
+    {
+        rects[i].x = (stbrp_coord)packer_rects[i].X;
+        rects[i].y = (stbrp_coord)packer_rects[i].Y;
+        rects[i].was_packed = packer_rects[i].WasPacked ? 1 : 0;
+    }
+}
+
 #ifdef IMGUI_ENABLE_STB_TRUETYPE
 // Temporary data for one source font (multiple source fonts can be merged into one destination ImFont)
 // (C++03 doesn't allow instancing ImVector<> with function-local types so we declare the type here.)
@@ -2349,6 +2618,48 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+// Rasterize the glyphs of a ImFontConfig::SignedDistanceField source into their packed rectangles, and output the same
+// stbtt_packedchar data as stbtt_PackFontRangesRenderIntoRects(), so that they are registered like other glyphs.
+// Texels hold 128 on the outline, plus/minus 128 * distance / SdfPadding inside/outside (clamped to 0..255).
+static void ImFontAtlasBuildRenderSdfGlyphs(ImFontAtlas* atlas, ImFontBuildSrcData* src_tmp, const ImFontConfig& cfg)
+{
+    const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp->FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp->FontInfo, -cfg.SizePixels);
+    const float pixel_dist_scale = 128.0f / cfg.SdfPadding;
+    const int padding = atlas->TexGlyphPadding;
+    for (int glyph_i = 0; glyph_i < src_tmp->GlyphsCount; glyph_i++)
+    {
+        stbrp_rect& r = src_tmp->Rects[glyph_i];
+        if (!r.was_packed || r.w == 0 || r.h == 0)
+            continue;
+        const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp->FontInfo, src_tmp->GlyphsList[glyph_i]);
+        int advance, lsb;
+        stbtt_GetGlyphHMetrics(&src_tmp->FontInfo, glyph_index_in_font, &advance, &lsb);
+
+        // Pad on left and top, like stb_truetype
+        int w = 0, h = 0, xoff = 0, yoff = 0;
+        const int x = r.x + padding;
+        const int y = r.y + padding;
+        if (unsigned char* sdf = stbtt_GetGlyphSDF(&src_tmp->FontInfo, scale, glyph_index_in_font, cfg.SdfPadding, 128, pixel_dist_scale, &w, &h, &xoff, &yoff))
+        {
+            IM_ASSERT(w == r.w - padding && h == r.h - padding);
+            for (int row = 0; row < h; row++)
+                memcpy(atlas->TexPixelsAlpha8 + (y + row) * atlas->TexWidth + x, sdf + row * w, (size_t)w);
+            stbtt_FreeSDF(sdf, src_tmp->FontInfo.userdata);
+        }
+
+        stbtt_packedchar& pc = src_tmp->PackedChars[glyph_i];
+        pc.x0 = (unsigned short)x;
+        pc.y0 = (unsigned short)y;
+        pc.x1 = (unsigned short)(x + w);
+        pc.y1 = (unsigned short)(y + h);
+        pc.xadvance = scale * advance;
+        pc.xoff = (float)xoff;
+        pc.yoff = (float)yoff;
+        pc.xoff2 = (float)(xoff + w);
+        pc.yoff2 = (float)(yoff + h);
+    }
+}
+
 static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
@@ -2357,6 +2668,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
     // Clear atlas
     atlas->TexID = (ImTextureID)NULL;
+    atlas->TexIDSdf = (ImTextureID)NULL;
     atlas->TexWidth = atlas->TexHeight = 0;
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
@@ -2473,20 +2785,23 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.PackRange.array_of_unicode_codepoints = src_tmp.GlyphsList.Data;
         src_tmp.PackRange.num_chars = src_tmp.GlyphsList.Size;
         src_tmp.PackRange.chardata_for_range = src_tmp.PackedChars;
-        src_tmp.PackRange.h_oversample = (unsigned char)cfg.OversampleH;
-        src_tmp.PackRange.v_oversample = (unsigned char)cfg.OversampleV;
+        src_tmp.PackRange.h_oversample = (unsigned char)(cfg.SignedDistanceField ? 1 : cfg.OversampleH); // Distance fields are magnified/minified by the renderer anyway
+        src_tmp.PackRange.v_oversample = (unsigned char)(cfg.SignedDistanceField ? 1 : cfg.OversampleV);
 
         // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
         const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
         const int padding = atlas->TexGlyphPadding;
+        const int oversample_h = src_tmp.PackRange.h_oversample;
+        const int oversample_v = src_tmp.PackRange.v_oversample;
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
         {
             int x0, y0, x1, y1;
             const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
             IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * oversample_h, scale * oversample_v, 0, 0, &x0, &y0, &x1, &y1);
+            const int sdf_padding = (cfg.SignedDistanceField && x1 != x0 && y1 != y0) ? cfg.SdfPadding : 0; // Same box as stbtt_GetGlyphSDF()
+            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + sdf_padding * 2 + padding + oversample_h - 1);
+            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + sdf_padding * 2 + padding + oversample_v - 1);
             total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
         }
     }
@@ -2506,7 +2821,15 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     const int TEX_HEIGHT_MAX = 1024 * 32;
     stbtt_pack_context spc = {};
     stbtt_PackBegin(&spc, NULL, atlas->TexWidth, TEX_HEIGHT_MAX, 0, atlas->TexGlyphPadding, NULL);
+#ifdef IMGUI_ENABLE_GUILLOTINE_RECT_PACK
+    ImRectPacker packer;
+    packer.Init(atlas->TexWidth - atlas->TexGlyphPadding, TEX_HEIGHT_MAX - atlas->TexGlyphPadding); // Same usable area as stbtt_PackBegin() gives stb_rect_pack
+    ImRectPacker* packer_p = &packer;
+    ImFontAtlasBuildPackCustomRects(atlas, packer_p);
+#else
+    ImRectPacker* packer_p = NULL;
     ImFontAtlasBuildPackCustomRects(atlas, spc.pack_info);
+#endif
 
     // 6. Pack each source font. No rendering yet, we are working with rectangles in an infinitely tall texture at this point.
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
@@ -2515,7 +2838,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         if (src_tmp.GlyphsCount == 0)
             continue;
 
-        stbrp_pack_rects((stbrp_context*)spc.pack_info, src_tmp.Rects, src_tmp.GlyphsCount);
+        ImFontAtlasBuildPackRects((stbrp_context*)spc.pack_info, packer_p, src_tmp.Rects, src_tmp.GlyphsCount);
 
         // Extend texture height and mark missing glyphs as non-packed so we won't render them.
         // FIXME: We are not handling packing failure here (would happen if we got off TEX_HEIGHT_MAX or if a single if larger than TexWidth?)
@@ -2540,10 +2863,13 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         if (src_tmp.GlyphsCount == 0)
             continue;
 
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
+        if (cfg.SignedDistanceField)
+            ImFontAtlasBuildRenderSdfGlyphs(atlas, &src_tmp, cfg);
+        else
+            stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
 
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
+        // Apply multiply operator (not to distances)
+        if (cfg.RasterizerMultiply != 1.0f && !cfg.SignedDistanceField)
         {
             unsigned char multiply_table[256];
             ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
@@ -2603,8 +2929,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
 const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
 {
-    static ImFontBuilderIO io;
-    io.FontBuilder_Build = ImFontAtlasBuildWithStbTruetype;
+    static const ImFontBuilderIO io = { ImFontAtlasBuildWithStbTruetype };
     return &io;
 }
 
@@ -2625,11 +2950,8 @@ void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* f
     font->ConfigDataCount++;
 }
 
-void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque)
+static void ImFontAtlasBuildPackCustomRectsEx(ImFontAtlas* atlas, stbrp_context* pack_context, ImRectPacker* packer)
 {
-    stbrp_context* pack_context = (stbrp_context*)stbrp_context_opaque;
-    IM_ASSERT(pack_context != NULL);
-
     ImVector<ImFontAtlasCustomRect>& user_rects = atlas->CustomRects;
     IM_ASSERT(user_rects.Size >= 1); // We expect at least the default custom rects to be registered, else something went wrong.
 
@@ -2641,7 +2963,7 @@ void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opa
         pack_rects[i].w = user_rects[i].Width;
         pack_rects[i].h = user_rects[i].Height;
     }
-    stbrp_pack_rects(pack_context, &pack_rects[0], pack_rects.Size);
+    ImFontAtlasBuildPackRects(pack_context, packer, &pack_rects[0], pack_rects.Size);
     for (int i = 0; i < pack_rects.Size; i++)
         if (pack_rects[i].was_packed)
         {
@@ -2652,6 +2974,18 @@ void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opa
         }
 }
 
+void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque)
+{
+    IM_ASSERT(stbrp_context_opaque != NULL);
+    ImFontAtlasBuildPackCustomRectsEx(atlas, (stbrp_context*)stbrp_context_opaque, NULL);
+}
+
+void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, ImRectPacker* packer)
+{
+    IM_ASSERT(packer != NULL);
+    ImFontAtlasBuildPackCustomRectsEx(atlas, NULL, packer);
+}
+
 void ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value)
 {
     IM_ASSERT(x >= 0 && x + w <= atlas->TexWidth);
@@ -2812,6 +3146,7 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
             atlas->Fonts[i]->BuildLookupTable();
 
     atlas->TexReady = true;
+    atlas->TexBuildCount++;
 }
 
 // Retrieve list of range (2 int per range, values are inclusive)
@@ -2864,6 +3199,13 @@ static void UnpackAccumulativeOffsetsIntoRanges(int base_codepoint, const short*
     out_ranges[0] = 0;
 }
 
+static bool UnpackBaseAndAccumulativeOffsetsIntoRanges(const ImWchar* base_ranges, int base_ranges_count, int base_codepoint, const short* accumulative_offsets, int accumulative_offsets_count, ImWchar* out_ranges)
+{
+    memcpy(out_ranges, base_ranges, base_ranges_count * sizeof(ImWchar));
+    UnpackAccumulativeOffsetsIntoRanges(base_codepoint, accumulative_offsets, accumulative_offsets_count, out_ranges + base_ranges_count);
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] ImFontAtlas glyph ranges helpers
 //-------------------------------------------------------------------------
@@ -2928,11 +3270,8 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesChineseSimplifiedCommon()
         0xFFFD, 0xFFFD  // Invalid
     };
     static ImWchar full_ranges[IM_ARRAYSIZE(base_ranges) + IM_ARRAYSIZE(accumulative_offsets_from_0x4E00) * 2 + 1] = { 0 };
-    if (!full_ranges[0])
-    {
-        memcpy(full_ranges, base_ranges, sizeof(base_ranges));
-        UnpackAccumulativeOffsetsIntoRanges(0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges + IM_ARRAYSIZE(base_ranges));
-    }
+    static const bool full_ranges_unpacked = UnpackBaseAndAccumulativeOffsetsIntoRanges(base_ranges, IM_ARRAYSIZE(base_ranges), 0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges); // Thread-safe initialization
+    IM_UNUSED(full_ranges_unpacked);
     return &full_ranges[0];
 }
 
@@ -3018,11 +3357,8 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesJapanese()
         0xFFFD, 0xFFFD  // Invalid
     };
     static ImWchar full_ranges[IM_ARRAYSIZE(base_ranges) + IM_ARRAYSIZE(accumulative_offsets_from_0x4E00)*2 + 1] = { 0 };
-    if (!full_ranges[0])
-    {
-        memcpy(full_ranges, base_ranges, sizeof(base_ranges));
-        UnpackAccumulativeOffsetsIntoRanges(0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges + IM_ARRAYSIZE(base_ranges));
-    }
+    static const bool full_ranges_unpacked = UnpackBaseAndAccumulativeOffsetsIntoRanges(base_ranges, IM_ARRAYSIZE(base_ranges), 0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges); // Thread-safe initialization
+    IM_UNUSED(full_ranges_unpacked);
     return &full_ranges[0];
 }
 
@@ -3114,6 +3450,7 @@ ImFont::ImFont()
 {
     FontSize = 0.0f;
     FallbackAdvanceX = 0.0f;
+    IndexDirectSize = 0;
     FallbackChar = (ImWchar)-1;
     EllipsisChar = (ImWchar)-1;
     DotChar = (ImWchar)-1;
@@ -3122,6 +3459,7 @@ ImFont::ImFont()
     ConfigData = NULL;
     ConfigDataCount = 0;
     DirtyLookupTables = false;
+    SignedDistanceField = false;
     Scale = 1.0f;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -3138,6 +3476,8 @@ void    ImFont::ClearOutputData()
     FontSize = 0.0f;
     FallbackAdvanceX = 0.0f;
     Glyphs.clear();
+    IndexDirectSize = 0;
+    IndexPages.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
     FallbackGlyph = NULL;
@@ -3163,16 +3503,33 @@ void ImFont::BuildLookupTable()
 
     // Build lookup table
     IM_ASSERT(Glyphs.Size < 0xFFFF); // -1 is reserved
+    IndexPages.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
-    DirtyLookupTables = false;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
-    GrowIndex(max_codepoint + 1);
+
+    // Give a slot to every page of 256 code-points which has glyphs (see GrowIndex() for the layout)
+    const int pages_count = (max_codepoint >> 8) + 1;
+    IndexPages.resize(pages_count, (ImU16)0xFFFF);
+    for (int i = 0; i < Glyphs.Size; i++)
+        IndexPages[(int)Glyphs[i].Codepoint >> 8] = 0;
+    int direct_pages = 0;
+    while (direct_pages < pages_count && IndexPages[direct_pages] == 0)
+        direct_pages++;
+    IndexDirectSize = direct_pages << 8;
+    int slots_count = (direct_pages < pages_count) ? direct_pages + 1 : direct_pages;
+    for (int page_n = 0; page_n < pages_count; page_n++)
+        IndexPages[page_n] = (ImU16)((page_n < direct_pages) ? page_n : (IndexPages[page_n] == 0) ? slots_count++ : direct_pages);
+    IndexAdvanceX.reserve(slots_count << 8);
+    IndexAdvanceX.resize(slots_count << 8, -1.0f);
+    IndexLookup.reserve(slots_count << 8);
+    IndexLookup.resize(slots_count << 8, (ImU16)0xFFFF);
     for (int i = 0; i < Glyphs.Size; i++)
     {
         int codepoint = (int)Glyphs[i].Codepoint;
-        IndexAdvanceX[codepoint] = Glyphs[i].AdvanceX;
-        IndexLookup[codepoint] = (ImWchar)i;
+        const int index_n = ((int)IndexPages[codepoint >> 8] << 8) | (codepoint & 0xFF);
+        IndexAdvanceX[index_n] = Glyphs[i].AdvanceX;
+        IndexLookup[index_n] = (ImU16)i;
 
         // Mark 4K page as used
         const int page_n = codepoint / 4096;
@@ -3189,8 +3546,8 @@ void ImFont::BuildLookupTable()
         tab_glyph = *FindGlyph((ImWchar)' ');
         tab_glyph.Codepoint = '\t';
         tab_glyph.AdvanceX *= IM_TABSIZE;
-        IndexAdvanceX[(int)tab_glyph.Codepoint] = (float)tab_glyph.AdvanceX;
-        IndexLookup[(int)tab_glyph.Codepoint] = (ImWchar)(Glyphs.Size - 1);
+        IndexAdvanceX[(int)tab_glyph.Codepoint] = (float)tab_glyph.AdvanceX; // Page 0 has glyphs, so it is in slot 0
+        IndexLookup[(int)tab_glyph.Codepoint] = (ImU16)(Glyphs.Size - 1);
     }
 
     // Mark special glyphs as not visible (note that AddGlyph already mark as non-visible glyphs with zero-size polygons)
@@ -3222,9 +3579,10 @@ void ImFont::BuildLookupTable()
     }
 
     FallbackAdvanceX = FallbackGlyph->AdvanceX;
-    for (int i = 0; i < max_codepoint + 1; i++)
+    for (int i = 0; i < IndexAdvanceX.Size; i++)
         if (IndexAdvanceX[i] < 0.0f)
             IndexAdvanceX[i] = FallbackAdvanceX;
+    DirtyLookupTables = false;
 }
 
 // API is designed this way to avoid exposing the 4K page size
@@ -3246,13 +3604,44 @@ void ImFont::SetGlyphVisible(ImWchar c, bool visible)
         glyph->Visible = visible ? 1 : 0;
 }
 
+// IndexAdvanceX[] and IndexLookup[] are made of slots of 256 entries, IndexPages[] gives the slot of each page of 256 code-points, so that
+// fonts with a few high code-points (e.g. emojis with IMGUI_USE_WCHAR32) don't pay for all the code-points below them:
+// - the leading pages which all have glyphs are in slots 0, 1, 2.. in order, so code-points below IndexDirectSize are at their own index.
+// - the next slot (IndexDirectSize / 256) is shared by all the pages without glyphs, until FindOrAddIndexEntry() gives them a slot of their own.
+// - then come the other pages with glyphs.
+// Once the lookup tables are built, code-points without glyph get FallbackAdvanceX.
 void ImFont::GrowIndex(int new_size)
 {
     IM_ASSERT(IndexAdvanceX.Size == IndexLookup.Size);
-    if (new_size <= IndexLookup.Size)
+    const int new_pages = (new_size + 255) >> 8;
+    if (new_pages <= IndexPages.Size)
         return;
-    IndexAdvanceX.resize(new_size, -1.0f);
-    IndexLookup.resize(new_size, (ImWchar)-1);
+    const int shared_slot = IndexDirectSize >> 8;
+    if (IndexAdvanceX.Size == (shared_slot << 8)) // All pages were direct: add the shared slot
+    {
+        IndexAdvanceX.resize((shared_slot + 1) << 8, DirtyLookupTables ? -1.0f : FallbackAdvanceX);
+        IndexLookup.resize((shared_slot + 1) << 8, (ImU16)0xFFFF);
+    }
+    IndexPages.resize(new_pages, (ImU16)shared_slot);
+}
+
+// Return the index of the entry of 'c' in IndexAdvanceX[]/IndexLookup[], giving its page a slot of its own (copied from the shared one) if needed.
+static int FindOrAddIndexEntry(ImFont* font, unsigned int c)
+{
+    IM_ASSERT((int)(c >> 8) < font->IndexPages.Size);
+    const int shared_slot = font->IndexDirectSize >> 8;
+    ImU16& slot = font->IndexPages.Data[c >> 8];
+    if (slot == shared_slot)
+    {
+        const int new_slot = font->IndexAdvanceX.Size >> 8;
+        IM_ASSERT(new_slot <= 0xFFFF);
+        font->IndexAdvanceX.resize((new_slot + 1) << 8);
+        font->IndexLookup.resize((new_slot + 1) << 8);
+        memcpy(font->IndexAdvanceX.Data + (new_slot << 8), font->IndexAdvanceX.Data + (shared_slot << 8), 256 * sizeof(float));
+        memcpy(font->IndexLookup.Data + (new_slot << 8), font->IndexLookup.Data + (shared_slot << 8), 256 * sizeof(ImU16));
+        slot = (ImU16)new_slot;
+    }
+    return ((int)slot << 8) | (int)(c & 0xFF);
 }
 
 // x0/y0/x1/y1 are offset from the character upper-left layout position, in pixels. Therefore x0/y0 are often fairly close to zero.
@@ -3305,34 +3694,44 @@ void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, floa
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
     IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
-    unsigned int index_size = (unsigned int)IndexLookup.Size;
+    unsigned int index_size = (unsigned int)IndexPages.Size << 8;
 
-    if (dst < index_size && IndexLookup.Data[dst] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
+    if (dst < index_size && IndexLookup.Data[((int)IndexPages.Data[dst >> 8] << 8) | (dst & 0xFF)] == 0xFFFF && !overwrite_dst) // 'dst' already exists
         return;
     if (src >= index_size && dst >= index_size) // both 'dst' and 'src' don't exist -> no-op
         return;
 
     GrowIndex(dst + 1);
-    IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
-    IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    const int src_n = (src < index_size) ? ((int)IndexPages.Data[src >> 8] << 8) | (src & 0xFF) : -1;
+    const int dst_n = FindOrAddIndexEntry(this, dst);
+    IndexLookup[dst_n] = (src_n != -1) ? IndexLookup.Data[src_n] : (ImU16)0xFFFF;
+    IndexAdvanceX[dst_n] = (src_n != -1) ? IndexAdvanceX.Data[src_n] : 1.0f;
 }
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 {
-    if (c >= (size_t)IndexLookup.Size)
+    ImU16 i;
+    if ((unsigned int)c < (unsigned int)IndexDirectSize)
+        i = IndexLookup.Data[c];
+    else if ((unsigned int)c >> 8 < (unsigned int)IndexPages.Size)
+        i = IndexLookup.Data[((unsigned int)IndexPages.Data[c >> 8] << 8) | (c & 0xFF)];
+    else
         return FallbackGlyph;
-    const ImWchar i = IndexLookup.Data[c];
-    if (i == (ImWchar)-1)
+    if (i == 0xFFFF)
         return FallbackGlyph;
     return &Glyphs.Data[i];
 }
 
 const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c) const
 {
-    if (c >= (size_t)IndexLookup.Size)
+    ImU16 i;
+    if ((unsigned int)c < (unsigned int)IndexDirectSize)
+        i = IndexLookup.Data[c];
+    else if ((unsigned int)c >> 8 < (unsigned int)IndexPages.Size)
+        i = IndexLookup.Data[((unsigned int)IndexPages.Data[c >> 8] << 8) | (c & 0xFF)];
+    else
         return NULL;
-    const ImWchar i = IndexLookup.Data[c];
-    if (i == (ImWchar)-1)
+    if (i == 0xFFFF)
         return NULL;
     return &Glyphs.Data[i];
 }
@@ -3391,7 +3790,7 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             }
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX);
+        const float char_width = GetCharAdvance((ImWchar)c);
         if (ImCharIsBlankW(c))
         {
             if (inside_word)
@@ -3437,12 +3836,19 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
 }
 
 ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining) const
+{
+    return ImFontCalcTextSizeEx(this, size, max_width, wrap_width, text_begin, text_end, remaining, NULL);
+}
+
+// Same as ImFont::CalcTextSizeA(), also outputting the successive word-wrap positions (offsets from text_begin) to 'out_wrap_eols' if not NULL.
+// Those are the same for ImFont::RenderText() with the same size and wrap_width: see ImFontRenderTextEx() and ImTextLayoutCache.
+ImVec2 ImFontCalcTextSizeEx(const ImFont* font, float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining, ImVector<int>* out_wrap_eols)
 {
     if (!text_end)
         text_end = text_begin + strlen(text_begin); // FIXME-OPT: Need to avoid this.
 
     const float line_height = size;
-    const float scale = size / FontSize;
+    const float scale = size / font->FontSize;
 
     ImVec2 text_size = ImVec2(0, 0);
     float line_width = 0.0f;
@@ -3458,9 +3864,11 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
             // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
             if (!word_wrap_eol)
             {
-                word_wrap_eol = CalcWordWrapPositionA(scale, s, text_end, wrap_width - line_width);
+                word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - line_width);
                 if (word_wrap_eol == s) // Wrap_width is too small to fit anything. Force displaying 1 character to minimize the height discontinuity.
                     word_wrap_eol++;    // +1 may not be a character start point in UTF-8 but it's ok because we use s >= word_wrap_eol below
+                if (out_wrap_eols)
+                    out_wrap_eols->push_back((int)(word_wrap_eol - text_begin));
             }
 
             if (s >= word_wrap_eol)
@@ -3508,7 +3916,7 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 continue;
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX) * scale;
+        const float char_width = font->GetCharAdvance((ImWchar)c) * scale;
         if (line_width + char_width >= max_width)
         {
             s = prev_s;
@@ -3541,12 +3949,24 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     float scale = (size >= 0.0f) ? (size / FontSize) : 1.0f;
     pos.x = IM_FLOOR(pos.x);
     pos.y = IM_FLOOR(pos.y);
+    const bool use_sdf_tex_id = SignedDistanceField && ContainerAtlas->TexIDSdf != (ImTextureID)NULL;
+    if (use_sdf_tex_id)
+        draw_list->PushTextureID(ContainerAtlas->TexIDSdf);
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(pos.x + glyph->X0 * scale, pos.y + glyph->Y0 * scale), ImVec2(pos.x + glyph->X1 * scale, pos.y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
+    if (use_sdf_tex_id)
+        draw_list->PopTextureID();
 }
 
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip) const
+{
+    ImFontRenderTextEx(this, draw_list, size, pos, col, clip_rect, text_begin, text_end, wrap_width, cpu_fine_clip, NULL);
+}
+
+// Same as ImFont::RenderText(), taking the word-wrap positions from 'wrap_eols' (as output by ImFontCalcTextSizeEx() for the same text, size and wrap_width)
+// instead of computing them, when not NULL.
+void ImFontRenderTextEx(const ImFont* font, ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip, const ImVector<int>* wrap_eols)
 {
     if (!text_end)
         text_end = text_begin + strlen(text_begin); // ImGui:: functions generally already provides a valid text_end, so this is merely to handle direct calls.
@@ -3559,10 +3979,11 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     if (y > clip_rect.w)
         return;
 
-    const float scale = size / FontSize;
-    const float line_height = FontSize * scale;
+    const float scale = size / font->FontSize;
+    const float line_height = font->FontSize * scale;
     const bool word_wrap_enabled = (wrap_width > 0.0f);
     const char* word_wrap_eol = NULL;
+    int wrap_eols_n = 0;
 
     // Fast-forward to first visible line
     const char* s = text_begin;
@@ -3591,6 +4012,12 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     if (s == text_end)
         return;
 
+    // Glyphs of signed distance field fonts go to draw commands using the atlas' other texture ID, telling the backend to sample them as distances.
+    // Consecutive texts merge into the same command (see _OnChangedTextureID()), other shapes keep using TexID.
+    const bool use_sdf_tex_id = font->SignedDistanceField && font->ContainerAtlas->TexIDSdf != (ImTextureID)NULL;
+    if (use_sdf_tex_id)
+        draw_list->PushTextureID(font->ContainerAtlas->TexIDSdf);
+
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
     const int vtx_count_max = (int)(text_end - s) * 4;
     const int idx_count_max = (int)(text_end - s) * 6;
@@ -3608,9 +4035,14 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
         if (word_wrap_enabled)
         {
             // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
-            if (!word_wrap_eol)
+            // (falling back to CalcWordWrapPositionA() if 'wrap_eols' runs out, which it only does when it was computed for another text or wrap_width)
+            if (!word_wrap_eol && wrap_eols && wrap_eols_n < wrap_eols->Size && (*wrap_eols)[wrap_eols_n] <= (int)(text_end - text_begin))
+            {
+                word_wrap_eol = text_begin + (*wrap_eols)[wrap_eols_n++];
+            }
+            else if (!word_wrap_eol)
             {
-                word_wrap_eol = CalcWordWrapPositionA(scale, s, text_end, wrap_width - (x - pos.x));
+                word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - (x - pos.x));
                 if (word_wrap_eol == s) // Wrap_width is too small to fit anything. Force displaying 1 character to minimize the height discontinuity.
                     word_wrap_eol++;    // +1 may not be a character start point in UTF-8 but it's ok because we use s >= word_wrap_eol below
             }
@@ -3658,7 +4090,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                 continue;
         }
 
-        const ImFontGlyph* glyph = FindGlyph((ImWchar)c);
+        const ImFontGlyph* glyph = font->FindGlyph((ImWchar)c);
         if (glyph == NULL)
             continue;
 
@@ -3715,10 +4147,10 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                 {
                     idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
                     idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
-                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                    draw_list->SetVtx(vtx_write[0], ImVec2(x1, y1), ImVec2(u1, v1), glyph_col);
+                    draw_list->SetVtx(vtx_write[1], ImVec2(x2, y1), ImVec2(u2, v1), glyph_col);
+                    draw_list->SetVtx(vtx_write[2], ImVec2(x2, y2), ImVec2(u2, v2), glyph_col);
+                    draw_list->SetVtx(vtx_write[3], ImVec2(x1, y2), ImVec2(u1, v2), glyph_col);
                     vtx_write += 4;
                     vtx_current_idx += 4;
                     idx_write += 6;
@@ -3735,6 +4167,8 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     draw_list->_VtxWritePtr = vtx_write;
     draw_list->_IdxWritePtr = idx_write;
     draw_list->_VtxCurrentIdx = vtx_current_idx;
+    if (use_sdf_tex_id)
+        draw_list->PopTextureID();
 }
 
 //-----------------------------------------------------------------------------
@@ -3999,9 +4433,9 @@ static unsigned int stb_decompress_length(const unsigned char *input)
     return (input[8] << 24) + (input[9] << 16) + (input[10] << 8) + input[11];
 }
 
-static unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
-static const unsigned char *stb__barrier_in_b;
-static unsigned char *stb__dout;
+static IM_THREAD_LOCAL unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
+static IM_THREAD_LOCAL const unsigned char *stb__barrier_in_b;
+static IM_THREAD_LOCAL unsigned char *stb__dout;
 static void stb__match(const unsigned char *data, unsigned int length)
 {
     // INVERSE of memmove... write each byte before copying the next...
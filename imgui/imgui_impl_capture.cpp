@@ -0,0 +1,518 @@
+// dear imgui: ImDrawData capture & replay
+// Capture: records the ImDrawData of every frame (plus the font atlas and user textures) into a binary file, e.g. from a production session.
+// Replay: maps such a file in memory and hands back each frame as ImDrawData, to be submitted to any renderer backend
+// (e.g. ImGui_ImplOpenGL3_RenderDrawData()) without running any UI code. Replaying a file always produces the same draw data,
+// which makes renderer and upload changes comparable on identical workloads.
+
+// Implemented features:
+//  [X] Capture: Vertices, indices, draw commands (clip rectangles, texture identifiers, offsets) and display geometry of every frame.
+//  [X] Capture: Font atlas (RGBA32) and user textures registered with ImGui_ImplCaptureWriter_AddTexture().
+//  [X] Replay: The file is memory-mapped, vertex and index buffers of replayed draw lists point directly into the mapping (no copy, no parsing).
+//  [X] Replay: Captured texture identifiers are remapped to textures created by the caller.
+// Issues:
+//  [ ] User callbacks (other than ImDrawCallback_ResetRenderState) are not captured.
+//  [ ] Files are only readable on machines with the same ImDrawVert/ImDrawIdx layout and endianness (checked on opening).
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+// File format:
+// - All values are in host byte order, all records start on 8 bytes boundaries.
+// - [ImGui_ImplCapture_FileHeader]
+//   [texture records and frame records, in capture order]
+//   [index: ImU64 file offset of every texture record, then ImU64 file offset of every frame record]
+// - Texture record: [ImGui_ImplCapture_TextureRecord][RGBA32 pixels]
+// - Frame record: [ImGui_ImplCapture_FrameRecord], then for each draw list:
+//   [ImGui_ImplCapture_DrawListRecord][ImGui_ImplCapture_CmdRecord x CmdCount][ImDrawVert x VtxCount][ImDrawIdx x IdxCount]
+// - The header is written last (by ImGui_ImplCaptureWriter_Close()): files of interrupted captures have a zero IndexOffset and are rejected.
+
+#include "imgui.h"
+#include "imgui_impl_capture.h"
+#include <stdio.h>      // FILE
+#include <string.h>     // memcpy, memset
+#if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
+#include <stddef.h>     // intptr_t
+#else
+#include <stdint.h>     // intptr_t
+#endif
+
+// File mapping
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define IMGUI_IMPL_CAPTURE_VERSION      2
+#define IMGUI_IMPL_CAPTURE_ALIGN(_SIZE) (((_SIZE) + 7) & ~(ImU64)7)
+
+//-----------------------------------------------------------------------------
+// File records
+//-----------------------------------------------------------------------------
+
+static const char ImGui_ImplCapture_Magic[8] = { 'I', 'M', 'D', 'R', 'A', 'W', 'C', 'P' };
+
+struct ImGui_ImplCapture_FileHeader
+{
+    char    Magic[8];
+    ImU32   Version;
+    ImU32   SizeOfDrawVert;
+    ImU32   SizeOfDrawIdx;
+    ImU32   ByteOrderMark;      // 0x01020304
+    ImU32   TexturesCount;
+    ImU32   FramesCount;
+    ImU64   IndexOffset;
+};
+
+struct ImGui_ImplCapture_TextureRecord
+{
+    ImU64   TexId;              // Texture identifier at capture time, as found in ImGui_ImplCapture_CmdRecord::TexId
+    ImU32   Width;
+    ImU32   Height;
+};
+
+struct ImGui_ImplCapture_FrameRecord
+{
+    float   DisplayPos[2];
+    float   DisplaySize[2];
+    float   FramebufferScale[2];
+    ImU32   DrawListsCount;
+    ImU32   TotalVtxCount;
+    ImU32   TotalIdxCount;
+    ImU32   Size;               // Size of the whole frame record
+};
+
+struct ImGui_ImplCapture_DrawListRecord
+{
+    ImU32   CmdCount;
+    ImU32   VtxCount;
+    ImU32   IdxCount;
+    ImU32   Flags;              // Unused
+    float   VtxOrigin[2];       // ImDrawList::VtxOrigin (compact vertices are relative to it)
+};
+
+enum ImGui_ImplCapture_CmdFlags
+{
+    ImGui_ImplCapture_CmdFlags_ResetRenderState = 1 << 0
+};
+
+struct ImGui_ImplCapture_CmdRecord
+{
+    ImU64   TexId;
+    float   ClipRect[4];
+    ImU32   VtxOffset;
+    ImU32   IdxOffset;
+    ImU32   ElemCount;
+    ImU32   Flags;
+};
+
+static ImU64 ImGui_ImplCapture_DrawListSize(ImU32 cmd_count, ImU32 vtx_count, ImU32 idx_count)
+{
+    return sizeof(ImGui_ImplCapture_DrawListRecord) + (ImU64)cmd_count * sizeof(ImGui_ImplCapture_CmdRecord)
+        + IMGUI_IMPL_CAPTURE_ALIGN((ImU64)vtx_count * sizeof(ImDrawVert)) + IMGUI_IMPL_CAPTURE_ALIGN((ImU64)idx_count * sizeof(ImDrawIdx));
+}
+
+//-----------------------------------------------------------------------------
+// Capture
+//-----------------------------------------------------------------------------
+
+struct ImGui_ImplCaptureWriter
+{
+    FILE*                   File;
+    ImU64                   Offset;
+    bool                    Failed;
+    ImVector<ImU64>         TextureOffsets;
+    ImVector<ImU64>         FrameOffsets;
+    ImVector<ImGui_ImplCapture_CmdRecord> Cmds;    // Scratch
+
+    ImGui_ImplCaptureWriter() { File = NULL; Offset = 0; Failed = false; }
+};
+
+static void ImGui_ImplCaptureWriter_Write(ImGui_ImplCaptureWriter* writer, const void* data, ImU64 size)
+{
+    if (size > 0 && fwrite(data, 1, (size_t)size, writer->File) != (size_t)size)
+        writer->Failed = true;
+    writer->Offset += size;
+}
+
+static void ImGui_ImplCaptureWriter_WritePadding(ImGui_ImplCaptureWriter* writer)
+{
+    static const unsigned char zeroes[8] = {};
+    ImGui_ImplCaptureWriter_Write(writer, zeroes, IMGUI_IMPL_CAPTURE_ALIGN(writer->Offset) - writer->Offset);
+}
+
+ImGui_ImplCaptureWriter* ImGui_ImplCaptureWriter_Open(const char* filename, ImFontAtlas* font_atlas)
+{
+    FILE* f = fopen(filename, "wb");
+    if (f == NULL)
+        return NULL;
+    ImGui_ImplCaptureWriter* writer = IM_NEW(ImGui_ImplCaptureWriter)();
+    writer->File = f;
+
+    // Placeholder header, completed by Close()
+    ImGui_ImplCapture_FileHeader header;
+    memset(&header, 0, sizeof(header));
+    ImGui_ImplCaptureWriter_Write(writer, &header, sizeof(header));
+
+    if (font_atlas != NULL)
+    {
+        unsigned char* pixels;
+        int width, height;
+        font_atlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+        ImGui_ImplCaptureWriter_AddTexture(writer, font_atlas->TexID, width, height, pixels);
+    }
+    return writer;
+}
+
+bool ImGui_ImplCaptureWriter_AddTexture(ImGui_ImplCaptureWriter* writer, ImTextureID tex_id, int width, int height, const unsigned char* pixels_rgba32)
+{
+    writer->TextureOffsets.push_back(writer->Offset);
+    ImGui_ImplCapture_TextureRecord record = { (ImU64)(intptr_t)tex_id, (ImU32)width, (ImU32)height };
+    ImGui_ImplCaptureWriter_Write(writer, &record, sizeof(record));
+    ImGui_ImplCaptureWriter_Write(writer, pixels_rgba32, (ImU64)width * height * 4);
+    ImGui_ImplCaptureWriter_WritePadding(writer);
+    return !writer->Failed;
+}
+
+bool ImGui_ImplCaptureWriter_AddFrame(ImGui_ImplCaptureWriter* writer, const ImDrawData* draw_data)
+{
+    IM_ASSERT(draw_data->Valid && "Call ImGui_ImplCaptureWriter_AddFrame() after ImGui::Render()!");
+    writer->FrameOffsets.push_back(writer->Offset);
+
+    ImGui_ImplCapture_FrameRecord frame;
+    frame.DisplayPos[0] = draw_data->DisplayPos.x;
+    frame.DisplayPos[1] = draw_data->DisplayPos.y;
+    frame.DisplaySize[0] = draw_data->DisplaySize.x;
+    frame.DisplaySize[1] = draw_data->DisplaySize.y;
+    frame.FramebufferScale[0] = draw_data->FramebufferScale.x;
+    frame.FramebufferScale[1] = draw_data->FramebufferScale.y;
+    frame.DrawListsCount = (ImU32)draw_data->CmdListsCount;
+    frame.TotalVtxCount = (ImU32)draw_data->TotalVtxCount;
+    frame.TotalIdxCount = (ImU32)draw_data->TotalIdxCount;
+    ImU64 frame_size = sizeof(frame);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        ImU32 cmd_count = 0;
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+            if (cmd_list->CmdBuffer[cmd_i].UserCallback == NULL || cmd_list->CmdBuffer[cmd_i].UserCallback == ImDrawCallback_ResetRenderState)
+                cmd_count++;
+        frame_size += ImGui_ImplCapture_DrawListSize(cmd_count, (ImU32)cmd_list->VtxBuffer.Size, (ImU32)cmd_list->IdxBuffer.Size);
+    }
+    frame.Size = (ImU32)frame_size;
+    ImGui_ImplCaptureWriter_Write(writer, &frame, sizeof(frame));
+
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        writer->Cmds.resize(0);
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL && pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                continue;
+            ImGui_ImplCapture_CmdRecord record;
+            record.TexId = (ImU64)(intptr_t)pcmd->TextureId;
+            record.ClipRect[0] = pcmd->ClipRect.x;
+            record.ClipRect[1] = pcmd->ClipRect.y;
+            record.ClipRect[2] = pcmd->ClipRect.z;
+            record.ClipRect[3] = pcmd->ClipRect.w;
+            record.VtxOffset = pcmd->VtxOffset;
+            record.IdxOffset = pcmd->IdxOffset;
+            record.ElemCount = pcmd->ElemCount;
+            record.Flags = (pcmd->UserCallback == ImDrawCallback_ResetRenderState) ? ImGui_ImplCapture_CmdFlags_ResetRenderState : 0;
+            writer->Cmds.push_back(record);
+        }
+        ImGui_ImplCapture_DrawListRecord record = { (ImU32)writer->Cmds.Size, (ImU32)cmd_list->VtxBuffer.Size, (ImU32)cmd_list->IdxBuffer.Size, 0, { cmd_list->VtxOrigin.x, cmd_list->VtxOrigin.y } };
+        ImGui_ImplCaptureWriter_Write(writer, &record, sizeof(record));
+        ImGui_ImplCaptureWriter_Write(writer, writer->Cmds.Data, (ImU64)writer->Cmds.size_in_bytes());
+        ImGui_ImplCaptureWriter_Write(writer, cmd_list->VtxBuffer.Data, (ImU64)cmd_list->VtxBuffer.size_in_bytes());
+        ImGui_ImplCaptureWriter_WritePadding(writer);
+        ImGui_ImplCaptureWriter_Write(writer, cmd_list->IdxBuffer.Data, (ImU64)cmd_list->IdxBuffer.size_in_bytes());
+        ImGui_ImplCaptureWriter_WritePadding(writer);
+    }
+    return !writer->Failed;
+}
+
+int ImGui_ImplCaptureWriter_GetFramesCount(ImGui_ImplCaptureWriter* writer)
+{
+    return writer->FrameOffsets.Size;
+}
+
+bool ImGui_ImplCaptureWriter_Close(ImGui_ImplCaptureWriter* writer)
+{
+    ImGui_ImplCapture_FileHeader header;
+    memcpy(header.Magic, ImGui_ImplCapture_Magic, sizeof(header.Magic));
+    header.Version = IMGUI_IMPL_CAPTURE_VERSION;
+    header.SizeOfDrawVert = (ImU32)sizeof(ImDrawVert);
+    header.SizeOfDrawIdx = (ImU32)sizeof(ImDrawIdx);
+    header.ByteOrderMark = 0x01020304;
+    header.TexturesCount = (ImU32)writer->TextureOffsets.Size;
+    header.FramesCount = (ImU32)writer->FrameOffsets.Size;
+    header.IndexOffset = writer->Offset;
+    ImGui_ImplCaptureWriter_Write(writer, writer->TextureOffsets.Data, (ImU64)writer->TextureOffsets.size_in_bytes());
+    ImGui_ImplCaptureWriter_Write(writer, writer->FrameOffsets.Data, (ImU64)writer->FrameOffsets.size_in_bytes());
+    if (fseek(writer->File, 0, SEEK_SET) != 0)
+        writer->Failed = true;
+    ImGui_ImplCaptureWriter_Write(writer, &header, sizeof(header));
+    if (fclose(writer->File) != 0)
+        writer->Failed = true;
+    const bool ok = !writer->Failed;
+    IM_DELETE(writer);
+    return ok;
+}
+
+//-----------------------------------------------------------------------------
+// Replay
+//-----------------------------------------------------------------------------
+
+struct ImGui_ImplCaptureReplay_TextureMapping
+{
+    ImU64                   CapturedTexId;
+    ImTextureID             TexId;
+};
+
+struct ImGui_ImplCaptureReplay
+{
+    const unsigned char*    Data;           // Whole file, mapped in memory (copy-on-write: renderers may not write to buffers, but nothing breaks if one does)
+    ImU64                   DataSize;
+#ifdef _WIN32
+    HANDLE                  FileHandle;
+    HANDLE                  MappingHandle;
+#endif
+    ImGui_ImplCapture_FileHeader Header;
+    const ImU64*            FrameOffsets;
+    ImVector<ImGui_ImplCaptureReplay_TextureMapping> Textures;
+    ImVector<ImDrawList*>   DrawLists;      // Reused from one frame to another. Vertex/index buffers point into the mapping.
+    ImDrawData              DrawData;
+    ImVec2                  DisplaySize;
+
+    ImGui_ImplCaptureReplay()
+    {
+        Data = NULL;
+        DataSize = 0;
+#ifdef _WIN32
+        FileHandle = INVALID_HANDLE_VALUE;
+        MappingHandle = NULL;
+#endif
+        memset(&Header, 0, sizeof(Header));
+        FrameOffsets = NULL;
+        DisplaySize = ImVec2(0.0f, 0.0f);
+    }
+};
+
+static bool ImGui_ImplCaptureReplay_MapFile(ImGui_ImplCaptureReplay* replay, const char* filename)
+{
+#ifdef _WIN32
+    replay->FileHandle = ::CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (replay->FileHandle == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(replay->FileHandle, &size) || size.QuadPart == 0)
+        return false;
+    replay->MappingHandle = ::CreateFileMappingA(replay->FileHandle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    if (replay->MappingHandle == NULL)
+        return false;
+    replay->Data = (const unsigned char*)::MapViewOfFile(replay->MappingHandle, FILE_MAP_COPY, 0, 0, 0);
+    replay->DataSize = (ImU64)size.QuadPart;
+#else
+    int fd = ::open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    void* data = ::mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED)
+        return false;
+    replay->Data = (const unsigned char*)data;
+    replay->DataSize = (ImU64)st.st_size;
+#endif
+    return replay->Data != NULL;
+}
+
+static void ImGui_ImplCaptureReplay_UnmapFile(ImGui_ImplCaptureReplay* replay)
+{
+#ifdef _WIN32
+    if (replay->Data)
+        ::UnmapViewOfFile(replay->Data);
+    if (replay->MappingHandle)
+        ::CloseHandle(replay->MappingHandle);
+    if (replay->FileHandle != INVALID_HANDLE_VALUE)
+        ::CloseHandle(replay->FileHandle);
+#else
+    if (replay->Data)
+        ::munmap((void*)replay->Data, (size_t)replay->DataSize);
+#endif
+    replay->Data = NULL;
+}
+
+// Check everything GetFrame() will read, so replaying never needs to validate anything
+static bool ImGui_ImplCaptureReplay_ValidateFrame(ImGui_ImplCaptureReplay* replay, ImU64 offset)
+{
+    ImGui_ImplCapture_FrameRecord frame;
+    if (offset + sizeof(frame) > replay->Header.IndexOffset || (offset & 7) != 0)
+        return false;
+    memcpy(&frame, replay->Data + offset, sizeof(frame));
+    if (offset + frame.Size > replay->Header.IndexOffset)
+        return false;
+    ImU64 list_offset = offset + sizeof(frame);
+    for (ImU32 n = 0; n < frame.DrawListsCount; n++)
+    {
+        ImGui_ImplCapture_DrawListRecord record;
+        if (list_offset + sizeof(record) > offset + frame.Size)
+            return false;
+        memcpy(&record, replay->Data + list_offset, sizeof(record));
+        list_offset += ImGui_ImplCapture_DrawListSize(record.CmdCount, record.VtxCount, record.IdxCount);
+        if (list_offset > offset + frame.Size)
+            return false;
+    }
+    if (replay->DisplaySize.x < frame.DisplaySize[0])
+        replay->DisplaySize.x = frame.DisplaySize[0];
+    if (replay->DisplaySize.y < frame.DisplaySize[1])
+        replay->DisplaySize.y = frame.DisplaySize[1];
+    return list_offset == offset + frame.Size;
+}
+
+ImGui_ImplCaptureReplay* ImGui_ImplCaptureReplay_Open(const char* filename, ImGui_ImplCaptureReplay_CreateTextureFunc create_texture, void* user_data)
+{
+    ImGui_ImplCaptureReplay* replay = IM_NEW(ImGui_ImplCaptureReplay)();
+    bool ok = ImGui_ImplCaptureReplay_MapFile(replay, filename) && replay->DataSize >= sizeof(ImGui_ImplCapture_FileHeader);
+    if (ok)
+    {
+        ImGui_ImplCapture_FileHeader& header = replay->Header;
+        memcpy(&header, replay->Data, sizeof(header));
+        ok = memcmp(header.Magic, ImGui_ImplCapture_Magic, sizeof(header.Magic)) == 0 && header.Version == IMGUI_IMPL_CAPTURE_VERSION
+            && header.SizeOfDrawVert == sizeof(ImDrawVert) && header.SizeOfDrawIdx == sizeof(ImDrawIdx) && header.ByteOrderMark == 0x01020304
+            && header.IndexOffset >= sizeof(header) && (header.IndexOffset & 7) == 0
+            && header.IndexOffset + ((ImU64)header.TexturesCount + header.FramesCount) * sizeof(ImU64) == replay->DataSize;
+    }
+    if (ok)
+    {
+        const ImU64* texture_offsets = (const ImU64*)(const void*)(replay->Data + replay->Header.IndexOffset);
+        replay->FrameOffsets = texture_offsets + replay->Header.TexturesCount;
+        for (ImU32 n = 0; n < replay->Header.FramesCount && ok; n++)
+            ok = ImGui_ImplCaptureReplay_ValidateFrame(replay, replay->FrameOffsets[n]);
+        for (ImU32 n = 0; n < replay->Header.TexturesCount && ok; n++)
+        {
+            ImGui_ImplCapture_TextureRecord record;
+            const ImU64 offset = texture_offsets[n];
+            ok = offset + sizeof(record) <= replay->Header.IndexOffset;
+            if (!ok)
+                break;
+            memcpy(&record, replay->Data + offset, sizeof(record));
+            ok = offset + sizeof(record) + (ImU64)record.Width * record.Height * 4 <= replay->Header.IndexOffset;
+            if (!ok)
+                break;
+            ImGui_ImplCaptureReplay_TextureMapping mapping;
+            mapping.CapturedTexId = record.TexId;
+            mapping.TexId = create_texture ? create_texture((int)record.Width, (int)record.Height, replay->Data + offset + sizeof(record), user_data) : (ImTextureID)(intptr_t)record.TexId;
+            replay->Textures.push_back(mapping);
+        }
+    }
+    if (!ok)
+    {
+        ImGui_ImplCaptureReplay_Close(replay);
+        return NULL;
+    }
+    return replay;
+}
+
+void ImGui_ImplCaptureReplay_Close(ImGui_ImplCaptureReplay* replay)
+{
+    for (int n = 0; n < replay->DrawLists.Size; n++)
+    {
+        // Buffers are not ours: detach them before the draw list tries to free them
+        ImDrawList* draw_list = replay->DrawLists[n];
+        draw_list->VtxBuffer.Data = NULL;
+        draw_list->VtxBuffer.Size = draw_list->VtxBuffer.Capacity = 0;
+        draw_list->IdxBuffer.Data = NULL;
+        draw_list->IdxBuffer.Size = draw_list->IdxBuffer.Capacity = 0;
+        IM_DELETE(draw_list);
+    }
+    ImGui_ImplCaptureReplay_UnmapFile(replay);
+    IM_DELETE(replay);
+}
+
+int ImGui_ImplCaptureReplay_GetFramesCount(ImGui_ImplCaptureReplay* replay)
+{
+    return (int)replay->Header.FramesCount;
+}
+
+ImVec2 ImGui_ImplCaptureReplay_GetDisplaySize(ImGui_ImplCaptureReplay* replay)
+{
+    return replay->DisplaySize;
+}
+
+ImDrawData* ImGui_ImplCaptureReplay_GetFrame(ImGui_ImplCaptureReplay* replay, int frame_index)
+{
+    IM_ASSERT(frame_index >= 0 && frame_index < (int)replay->Header.FramesCount);
+    const unsigned char* p = replay->Data + replay->FrameOffsets[frame_index];
+    ImGui_ImplCapture_FrameRecord frame;
+    memcpy(&frame, p, sizeof(frame));
+    p += sizeof(frame);
+
+    while (replay->DrawLists.Size < (int)frame.DrawListsCount)
+        replay->DrawLists.push_back(IM_NEW(ImDrawList)(NULL));
+    for (ImU32 n = 0; n < frame.DrawListsCount; n++)
+    {
+        ImGui_ImplCapture_DrawListRecord record;
+        memcpy(&record, p, sizeof(record));
+        p += sizeof(record);
+
+        ImDrawList* draw_list = replay->DrawLists[n];
+        draw_list->VtxOrigin = ImVec2(record.VtxOrigin[0], record.VtxOrigin[1]);
+        draw_list->CmdBuffer.resize((int)record.CmdCount);
+        for (ImU32 cmd_n = 0; cmd_n < record.CmdCount; cmd_n++)
+        {
+            ImGui_ImplCapture_CmdRecord cmd_record;
+            memcpy(&cmd_record, p, sizeof(cmd_record));
+            p += sizeof(cmd_record);
+            ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_n];
+            memset((void*)pcmd, 0, sizeof(*pcmd));
+            pcmd->ClipRect = ImVec4(cmd_record.ClipRect[0], cmd_record.ClipRect[1], cmd_record.ClipRect[2], cmd_record.ClipRect[3]);
+            for (int tex_n = 0; tex_n < replay->Textures.Size; tex_n++)
+                if (replay->Textures[tex_n].CapturedTexId == cmd_record.TexId)
+                {
+                    pcmd->TextureId = replay->Textures[tex_n].TexId;
+                    break;
+                }
+            pcmd->VtxOffset = cmd_record.VtxOffset;
+            pcmd->IdxOffset = cmd_record.IdxOffset;
+            pcmd->ElemCount = cmd_record.ElemCount;
+            if (cmd_record.Flags & ImGui_ImplCapture_CmdFlags_ResetRenderState)
+                pcmd->UserCallback = ImDrawCallback_ResetRenderState;
+        }
+
+        // Point vertex/index buffers into the mapping (the draw lists never grow them, so they are never reallocated)
+        draw_list->VtxBuffer.Data = (ImDrawVert*)(void*)p;
+        draw_list->VtxBuffer.Size = draw_list->VtxBuffer.Capacity = (int)record.VtxCount;
+        p += IMGUI_IMPL_CAPTURE_ALIGN((ImU64)record.VtxCount * sizeof(ImDrawVert));
+        draw_list->IdxBuffer.Data = (ImDrawIdx*)(void*)p;
+        draw_list->IdxBuffer.Size = draw_list->IdxBuffer.Capacity = (int)record.IdxCount;
+        p += IMGUI_IMPL_CAPTURE_ALIGN((ImU64)record.IdxCount * sizeof(ImDrawIdx));
+    }
+
+    ImDrawData* draw_data = &replay->DrawData;
+    draw_data->Valid = true;
+    draw_data->CmdLists = replay->DrawLists.Data;
+    draw_data->CmdListsCount = (int)frame.DrawListsCount;
+    draw_data->TotalVtxCount = (int)frame.TotalVtxCount;
+    draw_data->TotalIdxCount = (int)frame.TotalIdxCount;
+    draw_data->DisplayPos = ImVec2(frame.DisplayPos[0], frame.DisplayPos[1]);
+    draw_data->DisplaySize = ImVec2(frame.DisplaySize[0], frame.DisplaySize[1]);
+    draw_data->FramebufferScale = ImVec2(frame.FramebufferScale[0], frame.FramebufferScale[1]);
+    draw_data->OwnerViewport = NULL;
+    return draw_data;
+}
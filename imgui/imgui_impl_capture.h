@@ -0,0 +1,42 @@
+// dear imgui: ImDrawData capture & replay
+// Capture: records the ImDrawData of every frame (plus the font atlas and user textures) into a binary file, e.g. from a production session.
+// Replay: maps such a file in memory and hands back each frame as ImDrawData, to be submitted to any renderer backend
+// (e.g. ImGui_ImplOpenGL3_RenderDrawData()) without running any UI code. Replaying a file always produces the same draw data,
+// which makes renderer and upload changes comparable on identical workloads.
+
+// Implemented features:
+//  [X] Capture: Vertices, indices, draw commands (clip rectangles, texture identifiers, offsets) and display geometry of every frame.
+//  [X] Capture: Font atlas (RGBA32) and user textures registered with ImGui_ImplCaptureWriter_AddTexture().
+//  [X] Replay: The file is memory-mapped, vertex and index buffers of replayed draw lists point directly into the mapping (no copy, no parsing).
+//  [X] Replay: Captured texture identifiers are remapped to textures created by the caller.
+// Issues:
+//  [ ] User callbacks (other than ImDrawCallback_ResetRenderState) are not captured.
+//  [ ] Files are only readable on machines with the same ImDrawVert/ImDrawIdx layout and endianness (checked on opening).
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+
+// Capture
+// - font_atlas: atlas whose RGBA32 texture is stored in the file (under its current TexID), NULL to not store it.
+// - Frames are appended as they are captured. The index allowing random access to frames is written by Close().
+struct ImGui_ImplCaptureWriter;
+IMGUI_IMPL_API ImGui_ImplCaptureWriter* ImGui_ImplCaptureWriter_Open(const char* filename, ImFontAtlas* font_atlas);   // Return NULL on failure
+IMGUI_IMPL_API bool                     ImGui_ImplCaptureWriter_AddTexture(ImGui_ImplCaptureWriter* writer, ImTextureID tex_id, int width, int height, const unsigned char* pixels_rgba32);
+IMGUI_IMPL_API bool                     ImGui_ImplCaptureWriter_AddFrame(ImGui_ImplCaptureWriter* writer, const ImDrawData* draw_data);     // Call after ImGui::Render()
+IMGUI_IMPL_API int                      ImGui_ImplCaptureWriter_GetFramesCount(ImGui_ImplCaptureWriter* writer);
+IMGUI_IMPL_API bool                     ImGui_ImplCaptureWriter_Close(ImGui_ImplCaptureWriter* writer);  // Return false if any write failed
+
+// Replay
+// - create_texture is called once per texture stored in the file when opening it, and returns the ImTextureID to use in replayed frames.
+// - Replay doesn't need a Dear ImGui context, but renderer backends typically do.
+struct ImGui_ImplCaptureReplay;
+typedef ImTextureID (*ImGui_ImplCaptureReplay_CreateTextureFunc)(int width, int height, const unsigned char* pixels_rgba32, void* user_data);
+IMGUI_IMPL_API ImGui_ImplCaptureReplay* ImGui_ImplCaptureReplay_Open(const char* filename, ImGui_ImplCaptureReplay_CreateTextureFunc create_texture, void* user_data);  // Return NULL on failure
+IMGUI_IMPL_API void                     ImGui_ImplCaptureReplay_Close(ImGui_ImplCaptureReplay* replay);
+IMGUI_IMPL_API int                      ImGui_ImplCaptureReplay_GetFramesCount(ImGui_ImplCaptureReplay* replay);
+IMGUI_IMPL_API ImDrawData*              ImGui_ImplCaptureReplay_GetFrame(ImGui_ImplCaptureReplay* replay, int frame_index);  // Valid until the next call. Read-only: vertices/indices live in the file mapping.
+IMGUI_IMPL_API ImVec2                   ImGui_ImplCaptureReplay_GetDisplaySize(ImGui_ImplCaptureReplay* replay);            // Largest display size of all frames
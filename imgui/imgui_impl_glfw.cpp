@@ -9,6 +9,8 @@
 //  [X] Platform: Mouse cursor shape and visibility. Disable with 'io.ConfigFlags |= ImGuiConfigFlags_NoMouseCursorChange' (note: the resizing cursors requires GLFW 3.4+).
 //  [X] Platform: Keyboard arrays indexed using GLFW_KEY_* codes, e.g. ImGui::IsKeyPressed(GLFW_KEY_SPACE).
 //  [X] Platform: Multi-viewport support (multiple windows). Enable with 'io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable'.
+//  [X] Platform: Secondary viewports rendered in parallel, one thread per OpenGL context: call ImGui_ImplGlfw_RenderPlatformWindowsParallel() instead of ImGui::RenderPlatformWindowsDefault().
+//  [X] Platform: Window position/size/focus/minimized state and mouse position cached from GLFW callbacks: no window system queries per frame (each one is a server round-trip on X11).
 
 // Issues:
 //  [ ] Platform: Multi-viewport support: ParentViewportID not honored, and so io.ConfigViewportsNoDefaultParent has no effect (minor).
@@ -20,6 +22,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2022-XX-XX: Inputs: Added ImGui_ImplGlfw_CursorPosCallback(). Mouse position, window positions/sizes, focus and minimized state are cached from callbacks instead of queried every frame. Cursor shape and mouse passthrough are only set when they change.
+//  2022-XX-XX: Platform: Added ImGui_ImplGlfw_RenderPlatformWindowsParallel(): each secondary viewport's OpenGL context is owned by a render thread, contexts are submitted concurrently.
 //  2021-XX-XX: Platform: Added support for multiple windows via the ImGuiPlatformIO interface.
 //  2021-08-17: *BREAKING CHANGE*: Now using glfwSetWindowFocusCallback() to calling io.AddFocusEvent(). If you called ImGui_ImplGlfw_InitXXX() with install_callbacks = false, you MUST install glfwSetWindowFocusCallback() and forward it to the backend via ImGui_ImplGlfw_WindowFocusCallback().
 //  2021-07-29: *BREAKING CHANGE*: Now using glfwSetCursorEnterCallback(). MousePos is correctly reported when the host platform window is hovered but not focused. If you called ImGui_ImplGlfw_InitXXX() with install_callbacks = false, you MUST install glfwSetWindowFocusCallback() callback and forward it to the backend via ImGui_ImplGlfw_CursorEnterCallback().
@@ -48,6 +52,9 @@
 
 #include "imgui.h"
 #include "imgui_impl_glfw.h"
+#include <condition_variable>   // ImGui_ImplGlfw_RenderPlatformWindowsParallel()
+#include <mutex>
+#include <thread>
 
 // GLFW
 #include <GLFW/glfw3.h>
@@ -76,6 +83,19 @@
 #define GLFW_HAS_MOUSE_PASSTHROUGH    (0)
 #endif
 
+// OpenGL functions used by ImGui_ImplGlfw_RenderPlatformWindowsParallel(), loaded with glfwGetProcAddress() since we don't link with OpenGL
+#ifdef _WIN32
+#define IMGUI_IMPL_GLFW_GLAPI __stdcall
+#else
+#define IMGUI_IMPL_GLFW_GLAPI
+#endif
+#define IMGUI_IMPL_GLFW_GL_SYNC_GPU_COMMANDS_COMPLETE   0x9117
+#define IMGUI_IMPL_GLFW_GL_TIMEOUT_IGNORED              0xFFFFFFFFFFFFFFFFull
+typedef void    (IMGUI_IMPL_GLFW_GLAPI *ImGui_ImplGlfw_GlFlushFunc)(void);       // Also glFinish()
+typedef void*   (IMGUI_IMPL_GLFW_GLAPI *ImGui_ImplGlfw_GlFenceSyncFunc)(unsigned int condition, unsigned int flags);
+typedef void    (IMGUI_IMPL_GLFW_GLAPI *ImGui_ImplGlfw_GlWaitSyncFunc)(void* sync, unsigned int flags, unsigned long long timeout);
+typedef void    (IMGUI_IMPL_GLFW_GLAPI *ImGui_ImplGlfw_GlDeleteSyncFunc)(void* sync);
+
 // GLFW data
 enum GlfwClientApi
 {
@@ -84,6 +104,20 @@ enum GlfwClientApi
     GlfwClientApi_Vulkan
 };
 
+// Window state maintained from GLFW callbacks, so that a frame doesn't query it (on X11 each query is a synchronous round-trip to the server).
+// The main window's one is in ImGui_ImplGlfw_Data (polled every frame if our callbacks aren't installed), secondary viewports have theirs in ImGui_ImplGlfw_ViewportData.
+struct ImGui_ImplGlfw_WindowState
+{
+    int                     PosX, PosY;         // Client area position, in screen coordinates
+    int                     Width, Height;
+    int                     FramebufferWidth, FramebufferHeight;
+    double                  MouseX, MouseY;     // Last mouse position reported for this window, relative to its client area
+    bool                    Focused;
+    bool                    Minimized;
+    GLFWcursor*             Cursor;             // Last cursor set with glfwSetCursor()
+    int                     MousePassthrough;   // Last GLFW_MOUSE_PASSTHROUGH value set, -1 if never set
+};
+
 struct ImGui_ImplGlfw_Data
 {
     GLFWwindow*             Window;
@@ -95,10 +129,22 @@ struct ImGui_ImplGlfw_Data
     GLFWwindow*             KeyOwnerWindows[512];
     bool                    InstalledCallbacks;
     bool                    WantUpdateMonitors;
+    ImGui_ImplGlfw_WindowState MainWindowState;
+    void                    (*PrevRendererDestroyWindow)(ImGuiViewport* vp);   // Wrapped by the first ImGui_ImplGlfw_RenderPlatformWindowsParallel() call
+    ImGui_ImplGlfw_GlFlushFunc      GlFlush;        // Loaded by the first ImGui_ImplGlfw_RenderPlatformWindowsParallel() call
+    ImGui_ImplGlfw_GlFlushFunc      GlFinish;
+    ImGui_ImplGlfw_GlFenceSyncFunc  GlFenceSync;    // NULL before OpenGL 3.2 / without ARB_sync: glFinish() is used instead
+    ImGui_ImplGlfw_GlWaitSyncFunc   GlWaitSync;
+    ImGui_ImplGlfw_GlDeleteSyncFunc GlDeleteSync;
 
     // Chain GLFW callbacks: our callbacks will call the user's previously installed callbacks, if any.
     GLFWwindowfocusfun      PrevUserCallbackWindowFocus;
     GLFWcursorenterfun      PrevUserCallbackCursorEnter;
+    GLFWcursorposfun        PrevUserCallbackCursorPos;
+    GLFWwindowposfun        PrevUserCallbackWindowPos;
+    GLFWwindowsizefun       PrevUserCallbackWindowSize;
+    GLFWframebuffersizefun  PrevUserCallbackFramebufferSize;
+    GLFWwindowiconifyfun    PrevUserCallbackWindowIconify;
     GLFWmousebuttonfun      PrevUserCallbackMousebutton;
     GLFWscrollfun           PrevUserCallbackScroll;
     GLFWkeyfun              PrevUserCallbackKey;
@@ -122,6 +168,12 @@ static ImGui_ImplGlfw_Data* ImGui_ImplGlfw_GetBackendData()
 
 // Forward Declarations
 static void ImGui_ImplGlfw_UpdateMonitors();
+static ImGui_ImplGlfw_WindowState* ImGui_ImplGlfw_GetWindowState(GLFWwindow* window);
+static void ImGui_ImplGlfw_RefreshWindowState(GLFWwindow* window, ImGui_ImplGlfw_WindowState* state);
+static void ImGui_ImplGlfw_WindowPosCallback(GLFWwindow* window, int x, int y);
+static void ImGui_ImplGlfw_WindowSizeCallback(GLFWwindow* window, int width, int height);
+static void ImGui_ImplGlfw_FramebufferSizeCallback(GLFWwindow* window, int width, int height);
+static void ImGui_ImplGlfw_WindowIconifyCallback(GLFWwindow* window, int iconified);
 static void ImGui_ImplGlfw_InitPlatformInterface();
 static void ImGui_ImplGlfw_ShutdownPlatformInterface();
 
@@ -195,10 +247,26 @@ void ImGui_ImplGlfw_WindowFocusCallback(GLFWwindow* window, int focused)
     if (bd->PrevUserCallbackWindowFocus != NULL && window == bd->Window)
         bd->PrevUserCallbackWindowFocus(window, focused);
 
+    if (ImGui_ImplGlfw_WindowState* state = ImGui_ImplGlfw_GetWindowState(window))
+        state->Focused = (focused != 0);
+
     ImGuiIO& io = ImGui::GetIO();
     io.AddFocusEvent(focused != 0);
 }
 
+void ImGui_ImplGlfw_CursorPosCallback(GLFWwindow* window, double x, double y)
+{
+    ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
+    if (bd->PrevUserCallbackCursorPos != NULL && window == bd->Window)
+        bd->PrevUserCallbackCursorPos(window, x, y);
+
+    if (ImGui_ImplGlfw_WindowState* state = ImGui_ImplGlfw_GetWindowState(window))
+    {
+        state->MouseX = x;
+        state->MouseY = y;
+    }
+}
+
 void ImGui_ImplGlfw_CursorEnterCallback(GLFWwindow* window, int entered)
 {
     ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
@@ -246,6 +314,8 @@ static bool ImGui_ImplGlfw_Init(GLFWwindow* window, bool install_callbacks, Glfw
     bd->Window = window;
     bd->Time = 0.0;
     bd->WantUpdateMonitors = true;
+    bd->MainWindowState.MousePassthrough = -1;
+    ImGui_ImplGlfw_RefreshWindowState(window, &bd->MainWindowState);
 
     // Keyboard mapping. Dear ImGui will use those indices to peek into the io.KeysDown[] array.
     io.KeyMap[ImGuiKey_Tab] = GLFW_KEY_TAB;
@@ -301,6 +371,11 @@ static bool ImGui_ImplGlfw_Init(GLFWwindow* window, bool install_callbacks, Glfw
     // Chain GLFW callbacks: our callbacks will call the user's previously installed callbacks, if any.
     bd->PrevUserCallbackWindowFocus = NULL;
     bd->PrevUserCallbackCursorEnter = NULL;
+    bd->PrevUserCallbackCursorPos = NULL;
+    bd->PrevUserCallbackWindowPos = NULL;
+    bd->PrevUserCallbackWindowSize = NULL;
+    bd->PrevUserCallbackFramebufferSize = NULL;
+    bd->PrevUserCallbackWindowIconify = NULL;
     bd->PrevUserCallbackMousebutton = NULL;
     bd->PrevUserCallbackScroll = NULL;
     bd->PrevUserCallbackKey = NULL;
@@ -311,6 +386,11 @@ static bool ImGui_ImplGlfw_Init(GLFWwindow* window, bool install_callbacks, Glfw
         bd->InstalledCallbacks = true;
         bd->PrevUserCallbackWindowFocus = glfwSetWindowFocusCallback(window, ImGui_ImplGlfw_WindowFocusCallback);
         bd->PrevUserCallbackCursorEnter = glfwSetCursorEnterCallback(window, ImGui_ImplGlfw_CursorEnterCallback);
+        bd->PrevUserCallbackCursorPos = glfwSetCursorPosCallback(window, ImGui_ImplGlfw_CursorPosCallback);
+        bd->PrevUserCallbackWindowPos = glfwSetWindowPosCallback(window, ImGui_ImplGlfw_WindowPosCallback);
+        bd->PrevUserCallbackWindowSize = glfwSetWindowSizeCallback(window, ImGui_ImplGlfw_WindowSizeCallback);
+        bd->PrevUserCallbackFramebufferSize = glfwSetFramebufferSizeCallback(window, ImGui_ImplGlfw_FramebufferSizeCallback);
+        bd->PrevUserCallbackWindowIconify = glfwSetWindowIconifyCallback(window, ImGui_ImplGlfw_WindowIconifyCallback);
         bd->PrevUserCallbackMousebutton = glfwSetMouseButtonCallback(window, ImGui_ImplGlfw_MouseButtonCallback);
         bd->PrevUserCallbackScroll = glfwSetScrollCallback(window, ImGui_ImplGlfw_ScrollCallback);
         bd->PrevUserCallbackKey = glfwSetKeyCallback(window, ImGui_ImplGlfw_KeyCallback);
@@ -357,11 +437,18 @@ void ImGui_ImplGlfw_Shutdown()
     ImGuiIO& io = ImGui::GetIO();
 
     ImGui_ImplGlfw_ShutdownPlatformInterface();
+    if (bd->PrevRendererDestroyWindow)
+        ImGui::GetPlatformIO().Renderer_DestroyWindow = bd->PrevRendererDestroyWindow;
 
     if (bd->InstalledCallbacks)
     {
         glfwSetWindowFocusCallback(bd->Window, bd->PrevUserCallbackWindowFocus);
         glfwSetCursorEnterCallback(bd->Window, bd->PrevUserCallbackCursorEnter);
+        glfwSetCursorPosCallback(bd->Window, bd->PrevUserCallbackCursorPos);
+        glfwSetWindowPosCallback(bd->Window, bd->PrevUserCallbackWindowPos);
+        glfwSetWindowSizeCallback(bd->Window, bd->PrevUserCallbackWindowSize);
+        glfwSetFramebufferSizeCallback(bd->Window, bd->PrevUserCallbackFramebufferSize);
+        glfwSetWindowIconifyCallback(bd->Window, bd->PrevUserCallbackWindowIconify);
         glfwSetMouseButtonCallback(bd->Window, bd->PrevUserCallbackMousebutton);
         glfwSetScrollCallback(bd->Window, bd->PrevUserCallbackScroll);
         glfwSetKeyCallback(bd->Window, bd->PrevUserCallbackKey);
@@ -389,6 +476,7 @@ static void ImGui_ImplGlfw_UpdateMousePosAndButtons()
 
     // Update mouse buttons
     // (if a mouse press event came, always pass it as "mouse held this frame", so we don't miss click-release events that are shorter than 1 frame)
+    // (glfwGetMouseButton() returns the state GLFW maintains from events, it doesn't query the window system)
     for (int i = 0; i < IM_ARRAYSIZE(io.MouseDown); i++)
     {
         io.MouseDown[i] = bd->MouseJustPressed[i] || glfwGetMouseButton(bd->Window, i) != 0;
@@ -399,40 +487,47 @@ static void ImGui_ImplGlfw_UpdateMousePosAndButtons()
     {
         ImGuiViewport* viewport = platform_io.Viewports[n];
         GLFWwindow* window = (GLFWwindow*)viewport->PlatformHandle;
+        ImGui_ImplGlfw_WindowState* state = ImGui_ImplGlfw_GetWindowState(window);
 
 #ifdef __EMSCRIPTEN__
         const bool focused = true;
 #else
-        const bool focused = glfwGetWindowAttrib(window, GLFW_FOCUSED) != 0;
+        const bool focused = state->Focused;
 #endif
-        GLFWwindow* mouse_window = (bd->MouseWindow == window || focused) ? window : NULL;
 
         // Update mouse buttons
+        bool mouse_down = false;
         if (focused)
             for (int i = 0; i < IM_ARRAYSIZE(io.MouseDown); i++)
                 io.MouseDown[i] |= glfwGetMouseButton(window, i) != 0;
+        for (int i = 0; i < IM_ARRAYSIZE(io.MouseDown); i++)
+            mouse_down |= io.MouseDown[i];
+
+        // Mouse positions come from cursor motion events, which a window receives while hovered, or while it holds the mouse capture (focused + button held).
+        GLFWwindow* mouse_window = (bd->MouseWindow == window || (focused && mouse_down)) ? window : NULL;
 
         // Set OS mouse position from Dear ImGui if requested (rarely used, only when ImGuiConfigFlags_NavEnableSetMousePos is enabled by user)
         // (When multi-viewports are enabled, all Dear ImGui positions are same as OS positions)
         if (io.WantSetMousePos && focused)
-            glfwSetCursorPos(window, (double)(mouse_pos_prev.x - viewport->Pos.x), (double)(mouse_pos_prev.y - viewport->Pos.y));
+        {
+            state->MouseX = (double)(mouse_pos_prev.x - viewport->Pos.x);
+            state->MouseY = (double)(mouse_pos_prev.y - viewport->Pos.y);
+            glfwSetCursorPos(window, state->MouseX, state->MouseY);
+        }
 
         // Set Dear ImGui mouse position from OS position
         if (mouse_window != NULL)
         {
-            double mouse_x, mouse_y;
-            glfwGetCursorPos(mouse_window, &mouse_x, &mouse_y);
             if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
             {
                 // Multi-viewport mode: mouse position in OS absolute coordinates (io.MousePos is (0,0) when the mouse is on the upper-left of the primary monitor)
-                int window_x, window_y;
-                glfwGetWindowPos(window, &window_x, &window_y);
-                io.MousePos = ImVec2((float)mouse_x + window_x, (float)mouse_y + window_y);
+                // (Motion and configure events are processed in the order the server sent them, so both values match the same window position)
+                io.MousePos = ImVec2((float)state->MouseX + state->PosX, (float)state->MouseY + state->PosY);
             }
             else
             {
                 // Single viewport mode: mouse position in client window coordinates (io.MousePos is (0,0) when the mouse is on the upper-left corner of the app window)
-                io.MousePos = ImVec2((float)mouse_x, (float)mouse_y);
+                io.MousePos = ImVec2((float)state->MouseX, (float)state->MouseY);
             }
         }
 
@@ -444,12 +539,19 @@ static void ImGui_ImplGlfw_UpdateMousePosAndButtons()
         // rectangles and last focused time of every viewports it knows about. It will be unaware of other windows that may be sitting between or over your windows.
         // [GLFW] FIXME: This is currently only correct on Win32. See what we do below with the WM_NCHITTEST, missing an equivalent for other systems.
         // See https://github.com/glfw/glfw/issues/1236 if you want to help in making this a GLFW feature.
+        // Enter/leave events are enough, except while a button is held: the window holding the mouse capture is then the only one receiving them,
+        // but we need to know about the viewport under a window being dragged (e.g. to dock into it), so we query the window system then.
 #if GLFW_HAS_MOUSE_PASSTHROUGH || (GLFW_HAS_WINDOW_HOVERED && defined(_WIN32))
         const bool window_no_input = (viewport->Flags & ImGuiViewportFlags_NoInputs) != 0;
 #if GLFW_HAS_MOUSE_PASSTHROUGH
-        glfwSetWindowAttrib(window, GLFW_MOUSE_PASSTHROUGH, window_no_input);
+        if (state->MousePassthrough != (int)window_no_input)
+        {
+            glfwSetWindowAttrib(window, GLFW_MOUSE_PASSTHROUGH, window_no_input);
+            state->MousePassthrough = (int)window_no_input;
+        }
 #endif
-        if (glfwGetWindowAttrib(window, GLFW_HOVERED) && !window_no_input)
+        const bool hovered = mouse_down ? (glfwGetWindowAttrib(window, GLFW_HOVERED) != 0) : (bd->MouseWindow == window);
+        if (hovered && !window_no_input)
             io.MouseHoveredViewport = viewport->ID;
 #endif
     }
@@ -462,22 +564,31 @@ static void ImGui_ImplGlfw_UpdateMouseCursor()
     if ((io.ConfigFlags & ImGuiConfigFlags_NoMouseCursorChange) || glfwGetInputMode(bd->Window, GLFW_CURSOR) == GLFW_CURSOR_DISABLED)
         return;
 
+    // Only call the window system on changes (glfwGetInputMode() returns GLFW's own state, glfwSetCursor() always sends a request and flushes)
     ImGuiMouseCursor imgui_cursor = ImGui::GetMouseCursor();
     ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
     for (int n = 0; n < platform_io.Viewports.Size; n++)
     {
         GLFWwindow* window = (GLFWwindow*)platform_io.Viewports[n]->PlatformHandle;
+        ImGui_ImplGlfw_WindowState* state = ImGui_ImplGlfw_GetWindowState(window);
         if (imgui_cursor == ImGuiMouseCursor_None || io.MouseDrawCursor)
         {
             // Hide OS mouse cursor if imgui is drawing it or if it wants no cursor
-            glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
+            if (glfwGetInputMode(window, GLFW_CURSOR) != GLFW_CURSOR_HIDDEN)
+                glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
         }
         else
         {
             // Show OS mouse cursor
             // FIXME-PLATFORM: Unfocused windows seems to fail changing the mouse cursor with GLFW 3.2, but 3.3 works here.
-            glfwSetCursor(window, bd->MouseCursors[imgui_cursor] ? bd->MouseCursors[imgui_cursor] : bd->MouseCursors[ImGuiMouseCursor_Arrow]);
-            glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
+            GLFWcursor* cursor = bd->MouseCursors[imgui_cursor] ? bd->MouseCursors[imgui_cursor] : bd->MouseCursors[ImGuiMouseCursor_Arrow];
+            if (state->Cursor != cursor)
+            {
+                glfwSetCursor(window, cursor);
+                state->Cursor = cursor;
+            }
+            if (glfwGetInputMode(window, GLFW_CURSOR) != GLFW_CURSOR_NORMAL)
+                glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
         }
     }
 }
@@ -560,11 +671,13 @@ void ImGui_ImplGlfw_NewFrame()
     ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
     IM_ASSERT(bd != NULL && "Did you call ImGui_ImplGlfw_InitForXXX()?");
 
+    // Without our callbacks on the main window, its state is polled
+    if (!bd->InstalledCallbacks)
+        ImGui_ImplGlfw_RefreshWindowState(bd->Window, &bd->MainWindowState);
+
     // Setup display size (every frame to accommodate for window resizing)
-    int w, h;
-    int display_w, display_h;
-    glfwGetWindowSize(bd->Window, &w, &h);
-    glfwGetFramebufferSize(bd->Window, &display_w, &display_h);
+    const int w = bd->MainWindowState.Width, h = bd->MainWindowState.Height;
+    const int display_w = bd->MainWindowState.FramebufferWidth, display_h = bd->MainWindowState.FramebufferHeight;
     io.DisplaySize = ImVec2((float)w, (float)h);
     if (w > 0 && h > 0)
         io.DisplayFramebufferScale = ImVec2((float)display_w / w, (float)display_h / h);
@@ -589,6 +702,8 @@ void ImGui_ImplGlfw_NewFrame()
 // If you are new to dear imgui or creating a new binding for dear imgui, it is recommended that you completely ignore this section first..
 //--------------------------------------------------------------------------------------------------------
 
+struct ImGui_ImplGlfw_RenderThread;
+
 // Helper structure we store in the void* RenderUserData field of each ImGuiViewport to easily retrieve our backend data.
 struct ImGui_ImplGlfw_ViewportData
 {
@@ -596,11 +711,126 @@ struct ImGui_ImplGlfw_ViewportData
     bool        WindowOwned;
     int         IgnoreWindowPosEventFrame;
     int         IgnoreWindowSizeEventFrame;
+    ImGui_ImplGlfw_RenderThread* RenderThread;  // Started by the first ImGui_ImplGlfw_RenderPlatformWindowsParallel() call, owns the window's context
+    ImGui_ImplGlfw_WindowState State;           // Unused for the main viewport (see ImGui_ImplGlfw_Data::MainWindowState)
 
-    ImGui_ImplGlfw_ViewportData()  { Window = NULL; WindowOwned = false; IgnoreWindowSizeEventFrame = IgnoreWindowPosEventFrame = -1; }
-    ~ImGui_ImplGlfw_ViewportData() { IM_ASSERT(Window == NULL); }
+    ImGui_ImplGlfw_ViewportData()  { Window = NULL; WindowOwned = false; IgnoreWindowSizeEventFrame = IgnoreWindowPosEventFrame = -1; RenderThread = NULL; memset(&State, 0, sizeof(State)); State.MousePassthrough = -1; }
+    ~ImGui_ImplGlfw_ViewportData() { IM_ASSERT(Window == NULL && RenderThread == NULL); }
+};
+
+// Render thread of a secondary viewport (see ImGui_ImplGlfw_RenderPlatformWindowsParallel()).
+// Its OpenGL context stays current on it for the lifetime of the window. Each request renders the viewport (and calls Renderer_SwapBuffers,
+// which may read it), signals the main thread, then swaps buffers: the main thread only waits for the rendering of each viewport, not for their swaps.
+struct ImGui_ImplGlfw_RenderThread
+{
+    std::thread                 Thread;
+    std::mutex                  Mutex;
+    std::condition_variable     RequestCond;
+    std::condition_variable     RenderedCond;
+    ImGuiContext*               Context;
+    GLFWwindow*                 Window;
+    ImGuiViewport*              Viewport;
+    void                        (*RenderWindow)(ImGuiViewport* vp, void* render_arg);   // Copied from ImGuiPlatformIO on each request
+    void                        (*SwapBuffers)(ImGuiViewport* vp, void* render_arg);
+    void*                       RenderArg;
+    ImGui_ImplGlfw_GlWaitSyncFunc WaitSync;
+    void*                       Fence;          // Signaled once the main thread's commands of this frame complete (font texture updates etc.)
+    int                         RequestedFrame;
+    int                         RenderedFrame;
+    bool                        QuitRequested;
+
+    ImGui_ImplGlfw_RenderThread()   { Context = NULL; Window = NULL; Viewport = NULL; RenderWindow = SwapBuffers = NULL; RenderArg = NULL; WaitSync = NULL; Fence = NULL; RequestedFrame = RenderedFrame = 0; QuitRequested = false; }
 };
 
+static void ImGui_ImplGlfw_RenderThreadMain(ImGui_ImplGlfw_RenderThread* rt)
+{
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+    ImGui::SetCurrentContext(rt->Context); // Renderer backends retrieve their data from the current context
+#endif
+    glfwMakeContextCurrent(rt->Window);
+    glfwSwapInterval(0);
+    for (;;)
+    {
+        int frame;
+        {
+            std::unique_lock<std::mutex> lock(rt->Mutex);
+            while (!rt->QuitRequested && rt->RequestedFrame == rt->RenderedFrame)
+                rt->RequestCond.wait(lock);
+            if (rt->QuitRequested)
+                break;
+            frame = rt->RequestedFrame;
+        }
+        // Objects modified in another context are only guaranteed to be seen here once the commands modifying them completed
+        if (rt->Fence)
+            rt->WaitSync(rt->Fence, 0, IMGUI_IMPL_GLFW_GL_TIMEOUT_IGNORED);
+        if (rt->RenderWindow)
+            rt->RenderWindow(rt->Viewport, rt->RenderArg);
+        if (rt->SwapBuffers)
+            rt->SwapBuffers(rt->Viewport, rt->RenderArg);
+        {
+            // The viewport and this structure may be modified as soon as we signal: only the swap of the window is left
+            std::unique_lock<std::mutex> lock(rt->Mutex);
+            rt->RenderedFrame = frame;
+            rt->RenderedCond.notify_one();
+        }
+        glfwSwapBuffers(rt->Window);
+    }
+    glfwMakeContextCurrent(NULL);
+}
+
+static void ImGui_ImplGlfw_StopRenderThread(ImGui_ImplGlfw_ViewportData* vd)
+{
+    ImGui_ImplGlfw_RenderThread* rt = vd->RenderThread;
+    {
+        std::unique_lock<std::mutex> lock(rt->Mutex);
+        rt->QuitRequested = true;
+        rt->RequestCond.notify_one();
+    }
+    rt->Thread.join();
+    IM_DELETE(rt);
+    vd->RenderThread = NULL;
+}
+
+// Installed over Renderer_DestroyWindow by ImGui_ImplGlfw_RenderPlatformWindowsParallel(). ImGui::DestroyPlatformWindow() calls the renderer
+// before us, and it frees the viewport's objects (e.g. its buffers) in the viewport's context: stop the thread owning that context first.
+static void ImGui_ImplGlfw_RendererDestroyWindowParallel(ImGuiViewport* viewport)
+{
+    ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
+    ImGui_ImplGlfw_ViewportData* vd = (ImGui_ImplGlfw_ViewportData*)viewport->PlatformUserData;
+    if (vd == NULL || vd->RenderThread == NULL)
+    {
+        bd->PrevRendererDestroyWindow(viewport);
+        return;
+    }
+    ImGui_ImplGlfw_StopRenderThread(vd);
+    GLFWwindow* prev_current_context = glfwGetCurrentContext();
+    glfwMakeContextCurrent(vd->Window);
+    bd->PrevRendererDestroyWindow(viewport);
+    glfwMakeContextCurrent(prev_current_context);
+}
+
+static ImGui_ImplGlfw_WindowState* ImGui_ImplGlfw_GetWindowState(GLFWwindow* window)
+{
+    ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
+    if (window == bd->Window)
+        return &bd->MainWindowState;
+    if (ImGuiViewport* viewport = ImGui::FindViewportByPlatformHandle(window))
+        if (ImGui_ImplGlfw_ViewportData* vd = (ImGui_ImplGlfw_ViewportData*)viewport->PlatformUserData)
+            return &vd->State;
+    return NULL;
+}
+
+// Query everything from the window system: once when a window is created, or every frame for a main window without our callbacks.
+static void ImGui_ImplGlfw_RefreshWindowState(GLFWwindow* window, ImGui_ImplGlfw_WindowState* state)
+{
+    glfwGetWindowPos(window, &state->PosX, &state->PosY);
+    glfwGetWindowSize(window, &state->Width, &state->Height);
+    glfwGetFramebufferSize(window, &state->FramebufferWidth, &state->FramebufferHeight);
+    glfwGetCursorPos(window, &state->MouseX, &state->MouseY);
+    state->Focused = glfwGetWindowAttrib(window, GLFW_FOCUSED) != 0;
+    state->Minimized = glfwGetWindowAttrib(window, GLFW_ICONIFIED) != 0;
+}
+
 static void ImGui_ImplGlfw_WindowCloseCallback(GLFWwindow* window)
 {
     if (ImGuiViewport* viewport = ImGui::FindViewportByPlatformHandle(window))
@@ -613,8 +843,19 @@ static void ImGui_ImplGlfw_WindowCloseCallback(GLFWwindow* window)
 // - on Linux it is queued and invoked during glfwPollEvents()
 // Because the event doesn't always fire on glfwSetWindowXXX() we use a frame counter tag to only
 // ignore recent glfwSetWindowXXX() calls.
-static void ImGui_ImplGlfw_WindowPosCallback(GLFWwindow* window, int, int)
+static void ImGui_ImplGlfw_WindowPosCallback(GLFWwindow* window, int x, int y)
 {
+    ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
+    if (bd->PrevUserCallbackWindowPos != NULL && window == bd->Window)
+        bd->PrevUserCallbackWindowPos(window, x, y);
+
+    if (ImGui_ImplGlfw_WindowState* state = ImGui_ImplGlfw_GetWindowState(window))
+    {
+        state->PosX = x;
+        state->PosY = y;
+    }
+    if (window == bd->Window)
+        return; // The main viewport's position is read every frame
     if (ImGuiViewport* viewport = ImGui::FindViewportByPlatformHandle(window))
     {
         if (ImGui_ImplGlfw_ViewportData* vd = (ImGui_ImplGlfw_ViewportData*)viewport->PlatformUserData)
@@ -628,8 +869,19 @@ static void ImGui_ImplGlfw_WindowPosCallback(GLFWwindow* window, int, int)
     }
 }
 
-static void ImGui_ImplGlfw_WindowSizeCallback(GLFWwindow* window, int, int)
+static void ImGui_ImplGlfw_WindowSizeCallback(GLFWwindow* window, int width, int height)
 {
+    ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
+    if (bd->PrevUserCallbackWindowSize != NULL && window == bd->Window)
+        bd->PrevUserCallbackWindowSize(window, width, height);
+
+    if (ImGui_ImplGlfw_WindowState* state = ImGui_ImplGlfw_GetWindowState(window))
+    {
+        state->Width = width;
+        state->Height = height;
+    }
+    if (window == bd->Window)
+        return; // The main viewport's size is io.DisplaySize
     if (ImGuiViewport* viewport = ImGui::FindViewportByPlatformHandle(window))
     {
         if (ImGui_ImplGlfw_ViewportData* vd = (ImGui_ImplGlfw_ViewportData*)viewport->PlatformUserData)
@@ -643,6 +895,29 @@ static void ImGui_ImplGlfw_WindowSizeCallback(GLFWwindow* window, int, int)
     }
 }
 
+static void ImGui_ImplGlfw_FramebufferSizeCallback(GLFWwindow* window, int width, int height)
+{
+    ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
+    if (bd->PrevUserCallbackFramebufferSize != NULL && window == bd->Window)
+        bd->PrevUserCallbackFramebufferSize(window, width, height);
+
+    if (ImGui_ImplGlfw_WindowState* state = ImGui_ImplGlfw_GetWindowState(window))
+    {
+        state->FramebufferWidth = width;
+        state->FramebufferHeight = height;
+    }
+}
+
+static void ImGui_ImplGlfw_WindowIconifyCallback(GLFWwindow* window, int iconified)
+{
+    ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
+    if (bd->PrevUserCallbackWindowIconify != NULL && window == bd->Window)
+        bd->PrevUserCallbackWindowIconify(window, iconified);
+
+    if (ImGui_ImplGlfw_WindowState* state = ImGui_ImplGlfw_GetWindowState(window))
+        state->Minimized = (iconified != 0);
+}
+
 static void ImGui_ImplGlfw_CreateWindow(ImGuiViewport* viewport)
 {
     ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
@@ -668,10 +943,12 @@ static void ImGui_ImplGlfw_CreateWindow(ImGuiViewport* viewport)
     viewport->PlatformHandleRaw = glfwGetWin32Window(vd->Window);
 #endif
     glfwSetWindowPos(vd->Window, (int)viewport->Pos.x, (int)viewport->Pos.y);
+    ImGui_ImplGlfw_RefreshWindowState(vd->Window, &vd->State);
 
     // Install GLFW callbacks for secondary viewports
     glfwSetWindowFocusCallback(vd->Window, ImGui_ImplGlfw_WindowFocusCallback);
     glfwSetCursorEnterCallback(vd->Window, ImGui_ImplGlfw_CursorEnterCallback);
+    glfwSetCursorPosCallback(vd->Window, ImGui_ImplGlfw_CursorPosCallback);
     glfwSetMouseButtonCallback(vd->Window, ImGui_ImplGlfw_MouseButtonCallback);
     glfwSetScrollCallback(vd->Window, ImGui_ImplGlfw_ScrollCallback);
     glfwSetKeyCallback(vd->Window, ImGui_ImplGlfw_KeyCallback);
@@ -679,6 +956,7 @@ static void ImGui_ImplGlfw_CreateWindow(ImGuiViewport* viewport)
     glfwSetWindowCloseCallback(vd->Window, ImGui_ImplGlfw_WindowCloseCallback);
     glfwSetWindowPosCallback(vd->Window, ImGui_ImplGlfw_WindowPosCallback);
     glfwSetWindowSizeCallback(vd->Window, ImGui_ImplGlfw_WindowSizeCallback);
+    glfwSetWindowIconifyCallback(vd->Window, ImGui_ImplGlfw_WindowIconifyCallback);
     if (bd->ClientApi == GlfwClientApi_OpenGL)
     {
         glfwMakeContextCurrent(vd->Window);
@@ -704,6 +982,9 @@ static void ImGui_ImplGlfw_DestroyWindow(ImGuiViewport* viewport)
                 if (bd->KeyOwnerWindows[i] == vd->Window)
                     ImGui_ImplGlfw_KeyCallback(vd->Window, i, 0, GLFW_RELEASE, 0); // Later params are only used for main viewport, on which this function is never called.
 
+            // The context must not be current on another thread when destroying the window
+            if (vd->RenderThread)
+                ImGui_ImplGlfw_StopRenderThread(vd);
             glfwDestroyWindow(vd->Window);
         }
         vd->Window = NULL;
@@ -774,9 +1055,8 @@ static void ImGui_ImplGlfw_ShowWindow(ImGuiViewport* viewport)
 static ImVec2 ImGui_ImplGlfw_GetWindowPos(ImGuiViewport* viewport)
 {
     ImGui_ImplGlfw_ViewportData* vd = (ImGui_ImplGlfw_ViewportData*)viewport->PlatformUserData;
-    int x = 0, y = 0;
-    glfwGetWindowPos(vd->Window, &x, &y);
-    return ImVec2((float)x, (float)y);
+    const ImGui_ImplGlfw_WindowState* state = ImGui_ImplGlfw_GetWindowState(vd->Window);
+    return ImVec2((float)state->PosX, (float)state->PosY);
 }
 
 static void ImGui_ImplGlfw_SetWindowPos(ImGuiViewport* viewport, ImVec2 pos)
@@ -784,14 +1064,21 @@ static void ImGui_ImplGlfw_SetWindowPos(ImGuiViewport* viewport, ImVec2 pos)
     ImGui_ImplGlfw_ViewportData* vd = (ImGui_ImplGlfw_ViewportData*)viewport->PlatformUserData;
     vd->IgnoreWindowPosEventFrame = ImGui::GetFrameCount();
     glfwSetWindowPos(vd->Window, (int)pos.x, (int)pos.y);
+
+    // Don't wait for the position callback (queued until glfwPollEvents() on X11, and not always fired): the cursor didn't move,
+    // so its position relative to the window moves the other way and the absolute mouse position (PosX + MouseX) is unchanged.
+    ImGui_ImplGlfw_WindowState* state = ImGui_ImplGlfw_GetWindowState(vd->Window);
+    state->MouseX -= (int)pos.x - state->PosX;
+    state->MouseY -= (int)pos.y - state->PosY;
+    state->PosX = (int)pos.x;
+    state->PosY = (int)pos.y;
 }
 
 static ImVec2 ImGui_ImplGlfw_GetWindowSize(ImGuiViewport* viewport)
 {
     ImGui_ImplGlfw_ViewportData* vd = (ImGui_ImplGlfw_ViewportData*)viewport->PlatformUserData;
-    int w = 0, h = 0;
-    glfwGetWindowSize(vd->Window, &w, &h);
-    return ImVec2((float)w, (float)h);
+    const ImGui_ImplGlfw_WindowState* state = ImGui_ImplGlfw_GetWindowState(vd->Window);
+    return ImVec2((float)state->Width, (float)state->Height);
 }
 
 static void ImGui_ImplGlfw_SetWindowSize(ImGuiViewport* viewport, ImVec2 size)
@@ -809,6 +1096,11 @@ static void ImGui_ImplGlfw_SetWindowSize(ImGuiViewport* viewport, ImVec2 size)
 #endif
     vd->IgnoreWindowSizeEventFrame = ImGui::GetFrameCount();
     glfwSetWindowSize(vd->Window, (int)size.x, (int)size.y);
+
+    // Same as ImGui_ImplGlfw_SetWindowPos(): don't wait for the size callback
+    ImGui_ImplGlfw_WindowState* state = ImGui_ImplGlfw_GetWindowState(vd->Window);
+    state->Width = (int)size.x;
+    state->Height = (int)size.y;
 }
 
 static void ImGui_ImplGlfw_SetWindowTitle(ImGuiViewport* viewport, const char* title)
@@ -831,13 +1123,13 @@ static void ImGui_ImplGlfw_SetWindowFocus(ImGuiViewport* viewport)
 static bool ImGui_ImplGlfw_GetWindowFocus(ImGuiViewport* viewport)
 {
     ImGui_ImplGlfw_ViewportData* vd = (ImGui_ImplGlfw_ViewportData*)viewport->PlatformUserData;
-    return glfwGetWindowAttrib(vd->Window, GLFW_FOCUSED) != 0;
+    return ImGui_ImplGlfw_GetWindowState(vd->Window)->Focused;
 }
 
 static bool ImGui_ImplGlfw_GetWindowMinimized(ImGuiViewport* viewport)
 {
     ImGui_ImplGlfw_ViewportData* vd = (ImGui_ImplGlfw_ViewportData*)viewport->PlatformUserData;
-    return glfwGetWindowAttrib(vd->Window, GLFW_ICONIFIED) != 0;
+    return ImGui_ImplGlfw_GetWindowState(vd->Window)->Minimized;
 }
 
 #if GLFW_HAS_WINDOW_ALPHA
@@ -867,6 +1159,95 @@ static void ImGui_ImplGlfw_SwapBuffers(ImGuiViewport* viewport, void*)
     }
 }
 
+// Replacement for ImGui::RenderPlatformWindowsDefault(), to call after ImGui::UpdatePlatformWindows().
+// Secondary viewports are rendered concurrently by their render threads, and their buffers are swapped there without waiting for vsync
+// (swap interval 0, as set by ImGui_ImplGlfw_CreateWindow()): the application's swap of the main window is the only one per frame which waits.
+// - The renderer's Renderer_RenderWindow must support being called from several threads at once (imgui_impl_opengl3 does: each viewport has its own buffers and programs).
+// - Once called, don't use ImGui::RenderPlatformWindowsDefault(): the contexts of secondary viewports are current on their threads.
+// - Renderer_DestroyWindow is wrapped to stop the render thread and make the window's context current first (restored by ImGui_ImplGlfw_Shutdown()).
+// - The main window's context is current on the calling thread when returning.
+void ImGui_ImplGlfw_RenderPlatformWindowsParallel(void* renderer_render_arg)
+{
+    ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
+    if (bd->ClientApi != GlfwClientApi_OpenGL)
+    {
+        ImGui::RenderPlatformWindowsDefault(NULL, renderer_render_arg);
+        return;
+    }
+
+    // Windows created by ImGui::UpdatePlatformWindows() are left with their context current on this thread
+    glfwMakeContextCurrent(bd->Window);
+
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+    if (platform_io.Renderer_DestroyWindow != NULL && platform_io.Renderer_DestroyWindow != ImGui_ImplGlfw_RendererDestroyWindowParallel)
+    {
+        bd->PrevRendererDestroyWindow = platform_io.Renderer_DestroyWindow;
+        platform_io.Renderer_DestroyWindow = ImGui_ImplGlfw_RendererDestroyWindowParallel;
+    }
+    if (bd->GlFlush == NULL)
+    {
+        bd->GlFlush = (ImGui_ImplGlfw_GlFlushFunc)glfwGetProcAddress("glFlush");
+        bd->GlFinish = (ImGui_ImplGlfw_GlFlushFunc)glfwGetProcAddress("glFinish");
+        bd->GlFenceSync = (ImGui_ImplGlfw_GlFenceSyncFunc)glfwGetProcAddress("glFenceSync");
+        bd->GlWaitSync = (ImGui_ImplGlfw_GlWaitSyncFunc)glfwGetProcAddress("glWaitSync");
+        bd->GlDeleteSync = (ImGui_ImplGlfw_GlDeleteSyncFunc)glfwGetProcAddress("glDeleteSync");
+        if (bd->GlWaitSync == NULL || bd->GlDeleteSync == NULL)
+            bd->GlFenceSync = NULL;
+    }
+
+    // The renderer may have created or updated shared objects on this context (e.g. the font texture): make the render threads wait for them
+    void* fence = NULL;
+    if (platform_io.Viewports.Size > 1)
+    {
+        if (bd->GlFenceSync)
+            fence = bd->GlFenceSync(IMGUI_IMPL_GLFW_GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        if (fence)
+            bd->GlFlush(); // Or other contexts may wait forever
+        else
+            bd->GlFinish();
+    }
+    for (int i = 1; i < platform_io.Viewports.Size; i++)
+    {
+        ImGuiViewport* viewport = platform_io.Viewports[i];
+        if (viewport->Flags & ImGuiViewportFlags_Minimized)
+            continue;
+        ImGui_ImplGlfw_ViewportData* vd = (ImGui_ImplGlfw_ViewportData*)viewport->PlatformUserData;
+        if (vd->RenderThread == NULL)
+        {
+            ImGui_ImplGlfw_RenderThread* rt = IM_NEW(ImGui_ImplGlfw_RenderThread)();
+            rt->Context = ImGui::GetCurrentContext();
+            rt->Window = vd->Window;
+            rt->Viewport = viewport;
+            rt->Thread = std::thread(ImGui_ImplGlfw_RenderThreadMain, rt);
+            vd->RenderThread = rt;
+        }
+        ImGui_ImplGlfw_RenderThread* rt = vd->RenderThread;
+        std::unique_lock<std::mutex> lock(rt->Mutex);
+        rt->RenderWindow = platform_io.Renderer_RenderWindow;
+        rt->SwapBuffers = platform_io.Renderer_SwapBuffers;
+        rt->RenderArg = renderer_render_arg;
+        rt->WaitSync = bd->GlWaitSync;
+        rt->Fence = fence;
+        rt->RequestedFrame++;
+        rt->RequestCond.notify_one();
+    }
+
+    // Wait for all of them before the draw data is modified again by the next ImGui::NewFrame()
+    for (int i = 1; i < platform_io.Viewports.Size; i++)
+    {
+        ImGuiViewport* viewport = platform_io.Viewports[i];
+        ImGui_ImplGlfw_ViewportData* vd = (ImGui_ImplGlfw_ViewportData*)viewport->PlatformUserData;
+        if ((viewport->Flags & ImGuiViewportFlags_Minimized) || vd->RenderThread == NULL)
+            continue;
+        ImGui_ImplGlfw_RenderThread* rt = vd->RenderThread;
+        std::unique_lock<std::mutex> lock(rt->Mutex);
+        while (rt->RenderedFrame != rt->RequestedFrame)
+            rt->RenderedCond.wait(lock);
+    }
+    if (fence)
+        bd->GlDeleteSync(fence); // Their glWaitSync() calls are issued by now
+}
+
 //--------------------------------------------------------------------------------------------------------
 // IME (Input Method Editor) basic support for e.g. Asian language users
 //--------------------------------------------------------------------------------------------------------
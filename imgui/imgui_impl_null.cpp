@@ -0,0 +1,322 @@
+// dear imgui: Null Platform + Renderer Backends (headless)
+// This needs no window, no graphics context and no GPU: it is meant for benchmarking and testing UI code on headless machines.
+// - Platform: fixed display size, fixed time step, scripted synthetic inputs replayed at given frame numbers.
+// - Renderer: consumes ImDrawData (walks every command and touches vertex/index data as an upload would) and records statistics.
+
+// Implemented features:
+//  [X] Platform: Fixed display size and fixed delta time, so runs are reproducible.
+//  [X] Platform: Scripted mouse/keyboard/text inputs. Keyboard arrays are indexed using ImGuiKey_XXX values directly.
+//  [X] Renderer: Font atlas is built (as RGBA32, same as the OpenGL3 backend) and bound to a dummy texture identifier.
+//  [ ] Platform/Renderer: Multi-viewport support.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+#include "imgui.h"
+#include "imgui_impl_null.h"
+#include <string.h>     // memset
+#if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
+#include <stddef.h>     // intptr_t
+#else
+#include <stdint.h>     // intptr_t
+#endif
+
+//-----------------------------------------------------------------------------
+// Platform
+//-----------------------------------------------------------------------------
+
+enum ImGui_ImplNull_InputEventType
+{
+    ImGui_ImplNull_InputEventType_MousePos,
+    ImGui_ImplNull_InputEventType_MouseButton,
+    ImGui_ImplNull_InputEventType_MouseWheel,
+    ImGui_ImplNull_InputEventType_Key,
+    ImGui_ImplNull_InputEventType_Char
+};
+
+struct ImGui_ImplNull_InputEvent
+{
+    int                             Frame;
+    ImGui_ImplNull_InputEventType   Type;
+    ImVec2                          Value;      // MousePos: position, MouseWheel: (x, y)
+    int                             Index;      // MouseButton: button, Key: ImGuiKey_XXX, Char: codepoint
+    bool                            Down;
+};
+
+struct ImGui_ImplNull_Data
+{
+    ImVec2                              DisplaySize;
+    float                               DeltaTime;
+    int                                 FrameCount;
+    int                                 NextEvent;
+    ImVector<ImGui_ImplNull_InputEvent> Events;     // Sorted by Frame
+
+    ImGui_ImplNull_Data()   { DisplaySize = ImVec2(0.0f, 0.0f); DeltaTime = 0.0f; FrameCount = NextEvent = 0; }
+};
+
+// Backend data stored in io.BackendPlatformUserData to allow support for multiple Dear ImGui contexts
+static ImGui_ImplNull_Data* ImGui_ImplNull_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplNull_Data*)ImGui::GetIO().BackendPlatformUserData : NULL;
+}
+
+bool ImGui_ImplNull_Init(const ImVec2& display_size, float delta_time)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_ASSERT(io.BackendPlatformUserData == NULL && "Already initialized a platform backend!");
+    IM_ASSERT(display_size.x > 0.0f && display_size.y > 0.0f && delta_time > 0.0f);
+
+    // Setup backend capabilities flags
+    ImGui_ImplNull_Data* bd = IM_NEW(ImGui_ImplNull_Data)();
+    bd->DisplaySize = display_size;
+    bd->DeltaTime = delta_time;
+    io.BackendPlatformUserData = (void*)bd;
+    io.BackendPlatformName = "imgui_impl_null";
+
+    // Keyboard mapping: scripted keys are ImGuiKey_XXX values, used directly as indices into io.KeysDown[]
+    for (int key = 0; key < ImGuiKey_COUNT; key++)
+        io.KeyMap[key] = key;
+
+    // Register a single monitor matching the display, so code relying on monitor data behaves as with a real platform backend
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+    ImGuiPlatformMonitor monitor;
+    monitor.MainPos = monitor.WorkPos = ImVec2(0.0f, 0.0f);
+    monitor.MainSize = monitor.WorkSize = display_size;
+    monitor.DpiScale = 1.0f;
+    platform_io.Monitors.resize(0);
+    platform_io.Monitors.push_back(monitor);
+
+    return true;
+}
+
+void ImGui_ImplNull_Shutdown()
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    IM_ASSERT(bd != NULL && "No platform backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendPlatformName = NULL;
+    io.BackendPlatformUserData = NULL;
+    IM_DELETE(bd);
+}
+
+static void ImGui_ImplNull_ApplyEvent(ImGuiIO& io, const ImGui_ImplNull_InputEvent& e)
+{
+    switch (e.Type)
+    {
+    case ImGui_ImplNull_InputEventType_MousePos:    io.MousePos = e.Value; break;
+    case ImGui_ImplNull_InputEventType_MouseButton: io.MouseDown[e.Index] = e.Down; break;
+    case ImGui_ImplNull_InputEventType_MouseWheel:  io.MouseWheelH += e.Value.x; io.MouseWheel += e.Value.y; break;
+    case ImGui_ImplNull_InputEventType_Key:
+        io.KeysDown[e.Index] = e.Down;
+        io.KeyCtrl = io.KeysDown[ImGuiKey_COUNT + 0];   // Modifiers are scripted with keys ImGuiKey_COUNT + 0..3, see ImGui_ImplNull_ScriptKey()
+        io.KeyShift = io.KeysDown[ImGuiKey_COUNT + 1];
+        io.KeyAlt = io.KeysDown[ImGuiKey_COUNT + 2];
+        io.KeySuper = io.KeysDown[ImGuiKey_COUNT + 3];
+        break;
+    case ImGui_ImplNull_InputEventType_Char:        io.AddInputCharacter((unsigned int)e.Index); break;
+    }
+}
+
+void ImGui_ImplNull_NewFrame()
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplNull_Init()?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Setup display size and time step (fixed, for reproducibility)
+    io.DisplaySize = bd->DisplaySize;
+    io.DisplayFramebufferScale = ImVec2(1.0f, 1.0f);
+    io.DeltaTime = bd->DeltaTime;
+
+    // Apply scripted inputs for this frame. Mouse position persists until changed, like with a real mouse.
+    while (bd->NextEvent < bd->Events.Size && bd->Events[bd->NextEvent].Frame <= bd->FrameCount)
+        ImGui_ImplNull_ApplyEvent(io, bd->Events[bd->NextEvent++]);
+    bd->FrameCount++;
+}
+
+int ImGui_ImplNull_GetFrameCount()
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    return bd ? bd->FrameCount : 0;
+}
+
+static void ImGui_ImplNull_AddEvent(const ImGui_ImplNull_InputEvent& e)
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplNull_Init()?");
+    IM_ASSERT(e.Frame >= bd->FrameCount && "Cannot script an event for a frame which already started!");
+
+    // Insert after all events of same or earlier frame, so same-frame events keep their submission order
+    int insert_n = bd->Events.Size;
+    while (insert_n > bd->NextEvent && bd->Events[insert_n - 1].Frame > e.Frame)
+        insert_n--;
+    bd->Events.insert(bd->Events.Data + insert_n, e);
+}
+
+void ImGui_ImplNull_ScriptMousePos(int frame, const ImVec2& pos)
+{
+    ImGui_ImplNull_InputEvent e = { frame, ImGui_ImplNull_InputEventType_MousePos, pos, 0, false };
+    ImGui_ImplNull_AddEvent(e);
+}
+
+void ImGui_ImplNull_ScriptMouseButton(int frame, int button, bool down)
+{
+    IM_ASSERT(button >= 0 && button < ImGuiMouseButton_COUNT);
+    ImGui_ImplNull_InputEvent e = { frame, ImGui_ImplNull_InputEventType_MouseButton, ImVec2(0.0f, 0.0f), button, down };
+    ImGui_ImplNull_AddEvent(e);
+}
+
+void ImGui_ImplNull_ScriptMouseWheel(int frame, float wheel_x, float wheel_y)
+{
+    ImGui_ImplNull_InputEvent e = { frame, ImGui_ImplNull_InputEventType_MouseWheel, ImVec2(wheel_x, wheel_y), 0, false };
+    ImGui_ImplNull_AddEvent(e);
+}
+
+// Use ImGuiKey_XXX values. Modifiers can be scripted with ImGuiKey_COUNT + 0 (Ctrl), + 1 (Shift), + 2 (Alt), + 3 (Super).
+void ImGui_ImplNull_ScriptKey(int frame, int key, bool down)
+{
+    IM_ASSERT(key >= 0 && key < IM_ARRAYSIZE(ImGui::GetIO().KeysDown));
+    ImGui_ImplNull_InputEvent e = { frame, ImGui_ImplNull_InputEventType_Key, ImVec2(0.0f, 0.0f), key, down };
+    ImGui_ImplNull_AddEvent(e);
+}
+
+void ImGui_ImplNull_ScriptChar(int frame, unsigned int c)
+{
+    ImGui_ImplNull_InputEvent e = { frame, ImGui_ImplNull_InputEventType_Char, ImVec2(0.0f, 0.0f), (int)c, false };
+    ImGui_ImplNull_AddEvent(e);
+}
+
+void ImGui_ImplNull_ScriptClear()
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplNull_Init()?");
+    bd->Events.clear();
+    bd->NextEvent = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Renderer
+//-----------------------------------------------------------------------------
+
+struct ImGui_ImplNullRender_Data
+{
+    ImGui_ImplNull_RenderStats  Stats;
+    bool                        FontTextureCreated;
+
+    ImGui_ImplNullRender_Data() { memset((void*)this, 0, sizeof(*this)); }
+};
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+static ImGui_ImplNullRender_Data* ImGui_ImplNullRender_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplNullRender_Data*)ImGui::GetIO().BackendRendererUserData : NULL;
+}
+
+bool ImGui_ImplNullRender_Init()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_ASSERT(io.BackendRendererUserData == NULL && "Already initialized a renderer backend!");
+
+    ImGui_ImplNullRender_Data* bd = IM_NEW(ImGui_ImplNullRender_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_null_render";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    return true;
+}
+
+void ImGui_ImplNullRender_Shutdown()
+{
+    ImGui_ImplNullRender_Data* bd = ImGui_ImplNullRender_GetBackendData();
+    IM_ASSERT(bd != NULL && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+    if (!io.Fonts->Locked)  // Shared atlas locked by its owner: see ImGui_ImplNullRender_NewFrame()
+        io.Fonts->SetTexID(0);
+    io.BackendRendererName = NULL;
+    io.BackendRendererUserData = NULL;
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplNullRender_NewFrame()
+{
+    ImGui_ImplNullRender_Data* bd = ImGui_ImplNullRender_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplNullRender_Init()?");
+
+    // Build texture atlas the same way the OpenGL3 backend does, so atlas building cost is part of the first frame
+    // (A font atlas shared between contexts is built and given our texture identifier up-front: leave it alone as other threads may read it.)
+    ImGuiIO& io = ImGui::GetIO();
+    if (!bd->FontTextureCreated && io.Fonts->TexID == (ImTextureID)(intptr_t)1)
+        bd->FontTextureCreated = true;
+    if (!bd->FontTextureCreated)
+    {
+        unsigned char* pixels;
+        int width, height;
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+        io.Fonts->SetTexID((ImTextureID)(intptr_t)1);
+        bd->FontTextureCreated = true;
+    }
+}
+
+void ImGui_ImplNullRender_RenderDrawData(ImDrawData* draw_data)
+{
+    ImGui_ImplNullRender_Data* bd = ImGui_ImplNullRender_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplNullRender_Init()?");
+
+    // Walk all commands the way a renderer would, reading every index and the vertices they reference.
+    // The checksum keeps the compiler from optimizing the reads away and allows comparing output between runs.
+    ImU32 checksum = 0;
+    int cmd_count = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        const ImDrawVert* vtx_buffer = cmd_list->VtxBuffer.Data;
+        const ImDrawIdx* idx_buffer = cmd_list->IdxBuffer.Data;
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                    pcmd->UserCallback(cmd_list, pcmd);
+                continue;
+            }
+            cmd_count++;
+            for (unsigned int i = 0; i < pcmd->ElemCount; i++)
+            {
+                const ImDrawVert& v = vtx_buffer[pcmd->VtxOffset + idx_buffer[pcmd->IdxOffset + i]];
+#ifndef IMGUI_USE_COMPACT_DRAWVERT
+                checksum = checksum * 31 + v.col + (ImU32)(v.pos.x * 16.0f) * 7 + (ImU32)(v.pos.y * 16.0f);
+#else
+                checksum = checksum * 31 + v.col + (ImU32)(ImU16)v.pos[0] * 7 + (ImU32)(ImU16)v.pos[1];  // Compact positions are not decoded (an upload wouldn't)
+#endif
+            }
+        }
+    }
+
+    ImGui_ImplNull_RenderStats& stats = bd->Stats;
+    stats.Frames++;
+    stats.TotalVtxCount += (ImU64)draw_data->TotalVtxCount;
+    stats.TotalIdxCount += (ImU64)draw_data->TotalIdxCount;
+    stats.TotalCmdCount += (ImU64)cmd_count;
+    stats.TotalDrawListCount += (ImU64)draw_data->CmdListsCount;
+    stats.LastVtxCount = draw_data->TotalVtxCount;
+    stats.LastIdxCount = draw_data->TotalIdxCount;
+    stats.LastCmdCount = cmd_count;
+    stats.LastChecksum = checksum;
+}
+
+const ImGui_ImplNull_RenderStats* ImGui_ImplNullRender_GetStats()
+{
+    ImGui_ImplNullRender_Data* bd = ImGui_ImplNullRender_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplNullRender_Init()?");
+    return &bd->Stats;
+}
+
+void ImGui_ImplNullRender_ResetStats()
+{
+    ImGui_ImplNullRender_Data* bd = ImGui_ImplNullRender_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplNullRender_Init()?");
+    memset((void*)&bd->Stats, 0, sizeof(bd->Stats));
+}
@@ -0,0 +1,54 @@
+// dear imgui: Null Platform + Renderer Backends (headless)
+// This needs no window, no graphics context and no GPU: it is meant for benchmarking and testing UI code on headless machines.
+// - Platform: fixed display size, fixed time step, scripted synthetic inputs replayed at given frame numbers.
+// - Renderer: consumes ImDrawData (walks every command and touches vertex/index data as an upload would) and records statistics.
+
+// Implemented features:
+//  [X] Platform: Fixed display size and fixed delta time, so runs are reproducible.
+//  [X] Platform: Scripted mouse/keyboard/text inputs. Keyboard arrays are indexed using ImGuiKey_XXX values directly.
+//  [X] Renderer: Font atlas is built (as RGBA32, same as the OpenGL3 backend) and bound to a dummy texture identifier.
+//  [ ] Platform/Renderer: Multi-viewport support.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+
+// Statistics accumulated by ImGui_ImplNull_RenderDrawData()
+struct ImGui_ImplNull_RenderStats
+{
+    int     Frames;
+    ImU64   TotalVtxCount;
+    ImU64   TotalIdxCount;
+    ImU64   TotalCmdCount;
+    ImU64   TotalDrawListCount;
+    int     LastVtxCount;
+    int     LastIdxCount;
+    int     LastCmdCount;
+    ImU32   LastChecksum;       // Cheap checksum of the last frame geometry, allow spotting output differences between runs
+};
+
+// Platform Backend API
+IMGUI_IMPL_API bool     ImGui_ImplNull_Init(const ImVec2& display_size, float delta_time = 1.0f / 60.0f);
+IMGUI_IMPL_API void     ImGui_ImplNull_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplNull_NewFrame();
+IMGUI_IMPL_API int      ImGui_ImplNull_GetFrameCount();     // Number of ImGui_ImplNull_NewFrame() calls since Init
+
+// Scripted inputs: events are applied at the beginning of the ImGui_ImplNull_NewFrame() call of the given frame number (0 == first frame).
+// Events for a same frame are applied in submission order. Keys are ImGuiKey_XXX values (io.KeyMap[] is setup as identity).
+IMGUI_IMPL_API void     ImGui_ImplNull_ScriptMousePos(int frame, const ImVec2& pos);
+IMGUI_IMPL_API void     ImGui_ImplNull_ScriptMouseButton(int frame, int button, bool down);
+IMGUI_IMPL_API void     ImGui_ImplNull_ScriptMouseWheel(int frame, float wheel_x, float wheel_y);
+IMGUI_IMPL_API void     ImGui_ImplNull_ScriptKey(int frame, int key, bool down);
+IMGUI_IMPL_API void     ImGui_ImplNull_ScriptChar(int frame, unsigned int c);
+IMGUI_IMPL_API void     ImGui_ImplNull_ScriptClear();
+
+// Renderer Backend API
+IMGUI_IMPL_API bool     ImGui_ImplNullRender_Init();
+IMGUI_IMPL_API void     ImGui_ImplNullRender_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplNullRender_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplNullRender_RenderDrawData(ImDrawData* draw_data);
+IMGUI_IMPL_API const ImGui_ImplNull_RenderStats* ImGui_ImplNullRender_GetStats();
+IMGUI_IMPL_API void     ImGui_ImplNullRender_ResetStats();
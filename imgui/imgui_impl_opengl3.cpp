@@ -7,6 +7,9 @@
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [X] Renderer: Multi-viewport support. Enable with 'io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable'.
 //  [x] Renderer: Desktop GL only: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Compact 12-bytes vertices (IMGUI_USE_COMPACT_DRAWVERT in imconfig.h).
+//  [X] Renderer: Secondary viewports have their own streaming buffers and programs, and may be rendered in parallel from different threads/contexts (see ImGui_ImplGlfw_RenderPlatformWindowsParallel()).
+//  [X] Renderer: Signed distance field fonts (ImFontConfig::SignedDistanceField), drawn at any size by a second shader program.
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -15,6 +18,9 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2022-XX-XX: OpenGL: Upload the font atlas as a single channel texture read through swizzles on GL 3.3+/ES 3.0. Draw commands using io.Fonts->TexIDSdf sample it as signed distance fields.
+//  2022-XX-XX: OpenGL: Secondary viewports own their vertex/index buffers and projection (viewport->RendererUserData), so they can be rendered concurrently on different contexts.
+//  2022-XX-XX: OpenGL: Support IMGUI_USE_COMPACT_DRAWVERT: 16-bit positions/UV attributes, the origin and scale of positions are folded into a per draw list projection matrix.
 //  2021-XX-XX: Platform: Added support for multiple windows via the ImGuiPlatformIO interface.
 //  2021-12-15: OpenGL: Using buffer orphaning + glBufferSubData(), seems to fix leaks with multi-viewports with some Intel HD drivers.
 //  2021-08-23: OpenGL: Fixed ES 3.0 shader ("#version 300 es") use normal precision floats to avoid wobbly rendering at HD resolutions.
@@ -159,27 +165,49 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
 #endif
 
+// Desktop GL 3.3+ and GL ES 3.0 have texture swizzles
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && defined(GL_TEXTURE_SWIZZLE_A)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+#endif
+
 // Desktop GL use extension detection
 #if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_ES3)
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_EXTENSIONS
 #endif
 
+// Streaming vertex/index buffers and projection, written while rendering.
+// The main viewport uses the instance in ImGui_ImplOpenGL3_Data, secondary viewports own one (in viewport->RendererUserData):
+// buffer objects are shared by all contexts, so viewports rendered concurrently from different threads must not write to the same ones.
+struct ImGui_ImplOpenGL3_ViewportData
+{
+    unsigned int    VboHandle, ElementsHandle;
+    GLsizeiptr      VertexBufferSize;
+    GLsizeiptr      IndexBufferSize;
+    GLuint          ShaderHandle;            // Uniform values live in the program, which is shared between contexts: each viewport links its own so that
+    GLint           AttribLocationTex;       // viewports rendered concurrently (ImGui_ImplGlfw_RenderPlatformWindowsParallel()) don't overwrite each other's ProjMtx
+    GLint           AttribLocationProjMtx;
+    GLuint          SdfShaderHandle;         // Turns distances into coverage. 0 if it failed to compile.
+    GLint           SdfAttribLocationTex;
+    GLint           SdfAttribLocationProjMtx;
+    float           ProjMtx[4][4];           // Orthographic projection of the draw data being rendered
+};
+
 // OpenGL Data
 struct ImGui_ImplOpenGL3_Data
 {
     GLuint          GlVersion;               // Extracted at runtime using GL_MAJOR_VERSION, GL_MINOR_VERSION queries (e.g. 320 for GL 3.2)
     char            GlslVersionString[32];   // Specified by user or detected based on compile time GL settings.
     GLuint          FontTexture;
-    GLuint          ShaderHandle;
-    GLint           AttribLocationTex;       // Uniforms location
-    GLint           AttribLocationProjMtx;
-    GLuint          AttribLocationVtxPos;    // Vertex attributes location
+    GLuint          FontTextureSdf;          // Texture name reserved as io.Fonts->TexIDSdf, never bound: commands using it draw FontTexture with SdfShaderHandle
+    GLuint          VertHandle;              // Shaders linked into the programs of each viewport (see ImGui_ImplOpenGL3_CreatePrograms())
+    GLuint          FragHandle;
+    GLuint          SdfFragHandle;           // 0 if the signed distance field program failed to compile or link
+    GLuint          AttribLocationVtxPos;    // Vertex attributes location, the same in all programs
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
-    unsigned int    VboHandle, ElementsHandle;
-    GLsizeiptr      VertexBufferSize;
-    GLsizeiptr      IndexBufferSize;
+    ImGui_ImplOpenGL3_ViewportData MainViewportData;
     bool            HasClipOrigin;
+    bool            HasTextureSwizzle;
 
     ImGui_ImplOpenGL3_Data() { memset(this, 0, sizeof(*this)); }
 };
@@ -192,6 +220,7 @@ static ImGui_ImplOpenGL3_Data* ImGui_ImplOpenGL3_GetBackendData()
 }
 
 // Forward Declarations
+static void ImGui_ImplOpenGL3_CreatePrograms(ImGui_ImplOpenGL3_ViewportData* vd);
 static void ImGui_ImplOpenGL3_InitPlatformInterface();
 static void ImGui_ImplOpenGL3_ShutdownPlatformInterface();
 
@@ -263,6 +292,11 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
 
     // Detect extensions we support
     bd->HasClipOrigin = (bd->GlVersion >= 450);
+#if defined(IMGUI_IMPL_OPENGL_ES3)
+    bd->HasTextureSwizzle = true;
+#elif defined(IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE)
+    bd->HasTextureSwizzle = (bd->GlVersion >= 330);
+#endif
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_EXTENSIONS
     GLint num_extensions = 0;
     glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
@@ -298,13 +332,23 @@ void    ImGui_ImplOpenGL3_NewFrame()
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
     IM_ASSERT(bd != NULL && "Did you call ImGui_ImplOpenGL3_Init()?");
 
-    if (!bd->ShaderHandle)
+    if (!bd->MainViewportData.ShaderHandle)
         ImGui_ImplOpenGL3_CreateDeviceObjects();
 }
 
+// Render functions only read ImGui_ImplOpenGL3_Data: everything they write lives in the viewport data.
+static ImGui_ImplOpenGL3_ViewportData* ImGui_ImplOpenGL3_GetViewportData(ImDrawData* draw_data)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (draw_data->OwnerViewport != NULL && draw_data->OwnerViewport->RendererUserData != NULL)
+        return (ImGui_ImplOpenGL3_ViewportData*)draw_data->OwnerViewport->RendererUserData;
+    return &bd->MainViewportData;
+}
+
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImGui_ImplOpenGL3_ViewportData* vd = ImGui_ImplOpenGL3_GetViewportData(draw_data);
 
     // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled, polygon fill
     glEnable(GL_BLEND);
@@ -350,9 +394,10 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
-    glUseProgram(bd->ShaderHandle);
-    glUniform1i(bd->AttribLocationTex, 0);
-    glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    memcpy(vd->ProjMtx, ortho_projection, sizeof(ortho_projection));
+    glUseProgram(vd->ShaderHandle);
+    glUniform1i(vd->AttribLocationTex, 0);
+    glUniformMatrix4fv(vd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     if (bd->GlVersion >= 330)
@@ -365,16 +410,55 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
 #endif
 
     // Bind vertex/index buffers and setup attributes for ImDrawVert
-    glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->ElementsHandle);
+    glBindBuffer(GL_ARRAY_BUFFER, vd->VboHandle);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vd->ElementsHandle);
     glEnableVertexAttribArray(bd->AttribLocationVtxPos);
     glEnableVertexAttribArray(bd->AttribLocationVtxUV);
     glEnableVertexAttribArray(bd->AttribLocationVtxColor);
+#ifndef IMGUI_USE_COMPACT_DRAWVERT
     glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
     glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#else
+    glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_SHORT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
+    glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#endif
     glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col));
 }
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+// Compact vertex positions are fixed point values relative to ImDrawList::VtxOrigin (see ImDrawVert in imgui.h).
+// Rather than decoding them in the vertex shader, we fold the origin and the scale into the projection matrix of each draw list.
+static void ImGui_ImplOpenGL3_SetupDrawListProjection(ImGui_ImplOpenGL3_ViewportData* vd, const ImDrawList* cmd_list, GLint location_proj_mtx)
+{
+    const float (*ortho)[4] = vd->ProjMtx;
+    const float s = 1.0f / IM_DRAWVERT_POS_SCALE;
+    const float ox = cmd_list->VtxOrigin.x;
+    const float oy = cmd_list->VtxOrigin.y;
+    const float projection[4][4] =
+    {
+        { ortho[0][0] * s, ortho[0][1] * s, ortho[0][2] * s, ortho[0][3] * s },
+        { ortho[1][0] * s, ortho[1][1] * s, ortho[1][2] * s, ortho[1][3] * s },
+        { ortho[2][0],     ortho[2][1],     ortho[2][2],     ortho[2][3]     },
+        { ortho[3][0] + ortho[0][0] * ox + ortho[1][0] * oy, ortho[3][1] + ortho[0][1] * ox + ortho[1][1] * oy, ortho[3][2], ortho[3][3] },
+    };
+    glUniformMatrix4fv(location_proj_mtx, 1, GL_FALSE, &projection[0][0]);
+}
+#endif
+
+// Switch between the main program and the one drawing signed distance field glyphs (commands using io.Fonts->TexIDSdf), with the same uniforms.
+static void ImGui_ImplOpenGL3_SetupProgram(ImGui_ImplOpenGL3_ViewportData* vd, const ImDrawList* cmd_list, bool sdf)
+{
+    const GLint location_proj_mtx = sdf ? vd->SdfAttribLocationProjMtx : vd->AttribLocationProjMtx;
+    glUseProgram(sdf ? vd->SdfShaderHandle : vd->ShaderHandle);
+    glUniform1i(sdf ? vd->SdfAttribLocationTex : vd->AttribLocationTex, 0);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    ImGui_ImplOpenGL3_SetupDrawListProjection(vd, cmd_list, location_proj_mtx);
+#else
+    glUniformMatrix4fv(location_proj_mtx, 1, GL_FALSE, &vd->ProjMtx[0][0]);
+    IM_UNUSED(cmd_list);
+#endif
+}
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
@@ -387,6 +471,13 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         return;
 
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImGui_ImplOpenGL3_ViewportData* vd = ImGui_ImplOpenGL3_GetViewportData(draw_data);
+    if (vd->VboHandle == 0)
+    {
+        // Secondary viewport: buffers are created on first use, by the thread rendering it
+        glGenBuffers(1, &vd->VboHandle);
+        glGenBuffers(1, &vd->ElementsHandle);
+    }
 
     // Backup GL state
     GLenum last_active_texture; glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&last_active_texture);
@@ -428,6 +519,7 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     glGenVertexArrays(1, &vertex_array_object);
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+    bool sdf_program = false;
 
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
@@ -441,18 +533,21 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         // Upload vertex/index buffers
         GLsizeiptr vtx_buffer_size = (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
         GLsizeiptr idx_buffer_size = (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
-        if (bd->VertexBufferSize < vtx_buffer_size)
+        if (vd->VertexBufferSize < vtx_buffer_size)
         {
-            bd->VertexBufferSize = vtx_buffer_size;
-            glBufferData(GL_ARRAY_BUFFER, bd->VertexBufferSize, NULL, GL_STREAM_DRAW);
+            vd->VertexBufferSize = vtx_buffer_size;
+            glBufferData(GL_ARRAY_BUFFER, vd->VertexBufferSize, NULL, GL_STREAM_DRAW);
         }
-        if (bd->IndexBufferSize < idx_buffer_size)
+        if (vd->IndexBufferSize < idx_buffer_size)
         {
-            bd->IndexBufferSize = idx_buffer_size;
-            glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, NULL, GL_STREAM_DRAW);
+            vd->IndexBufferSize = idx_buffer_size;
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, vd->IndexBufferSize, NULL, GL_STREAM_DRAW);
         }
         glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, (const GLvoid*)cmd_list->VtxBuffer.Data);
         glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, (const GLvoid*)cmd_list->IdxBuffer.Data);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        ImGui_ImplOpenGL3_SetupDrawListProjection(vd, cmd_list, sdf_program ? vd->SdfAttribLocationProjMtx : vd->AttribLocationProjMtx);
+#endif
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
@@ -462,7 +557,13 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    sdf_program = false;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+                    ImGui_ImplOpenGL3_SetupDrawListProjection(vd, cmd_list, vd->AttribLocationProjMtx);
+#endif
+                }
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
             }
@@ -477,8 +578,16 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
                 glScissor((int)clip_min.x, (int)(fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y));
 
-                // Bind texture, Draw
-                glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID());
+                // Bind texture, Draw. Signed distance field glyphs use the font texture with the other program.
+                const ImTextureID tex_id = pcmd->GetTexID();
+                const bool sdf_texture = (bd->FontTextureSdf != 0 && tex_id == (ImTextureID)(intptr_t)bd->FontTextureSdf);
+                const bool sdf = sdf_texture && vd->SdfShaderHandle != 0;
+                if (sdf != sdf_program)
+                {
+                    ImGui_ImplOpenGL3_SetupProgram(vd, cmd_list, sdf);
+                    sdf_program = sdf;
+                }
+                glBindTexture(GL_TEXTURE_2D, sdf_texture ? bd->FontTexture : (GLuint)(intptr_t)tex_id);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
                     glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset);
@@ -531,9 +640,15 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
     // Build texture atlas
+    // With texture swizzles, load as a single channel texture read as (1,1,1,alpha), unless the atlas is known to use colors.
+    // Otherwise load as RGBA 32-bit (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders.
     unsigned char* pixels;
     int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);   // Load as RGBA 32-bit (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders. If your ImTextureId represent a higher-level concept than just a GL texture id, consider calling GetTexDataAsAlpha8() instead to save on GPU memory.
+    const bool single_channel = bd->HasTextureSwizzle && !io.Fonts->TexPixelsUseColors;
+    if (single_channel)
+        io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height);
+    else
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
 
     // Upload texture to graphics system
     GLint last_texture;
@@ -544,11 +659,31 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 #ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+    if (single_channel)
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_ONE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_ONE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_ONE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED);
+        GLint last_unpack_alignment;
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &last_unpack_alignment);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, pixels);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, last_unpack_alignment);
+    }
+    else
 #endif
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
+    if (bd->SdfFragHandle != 0)
+    {
+        glGenTextures(1, &bd->FontTextureSdf);
+        io.Fonts->TexIDSdf = (ImTextureID)(intptr_t)bd->FontTextureSdf;
+    }
 
     // Restore state
     glBindTexture(GL_TEXTURE_2D, last_texture);
@@ -566,6 +701,12 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
         io.Fonts->SetTexID(0);
         bd->FontTexture = 0;
     }
+    if (bd->FontTextureSdf)
+    {
+        glDeleteTextures(1, &bd->FontTextureSdf);
+        io.Fonts->TexIDSdf = 0;
+        bd->FontTextureSdf = 0;
+    }
 }
 
 // If you get an error please report on github. You may try different GL context version or GLSL version. See GL<>GLSL version table at the top of this file.
@@ -606,6 +747,65 @@ static bool CheckProgram(GLuint handle, const char* desc)
     return (GLboolean)status == GL_TRUE;
 }
 
+// Link the programs of a viewport from the shaders compiled by ImGui_ImplOpenGL3_CreateDeviceObjects().
+// The first ones (main viewport) choose the vertex attributes location, the others bind theirs there so that they all share the vertex setup.
+static void ImGui_ImplOpenGL3_CreatePrograms(ImGui_ImplOpenGL3_ViewportData* vd)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const bool main_viewport = (vd == &bd->MainViewportData);
+    vd->ShaderHandle = glCreateProgram();
+    glAttachShader(vd->ShaderHandle, bd->VertHandle);
+    glAttachShader(vd->ShaderHandle, bd->FragHandle);
+    if (!main_viewport)
+    {
+        glBindAttribLocation(vd->ShaderHandle, bd->AttribLocationVtxPos, "Position");
+        glBindAttribLocation(vd->ShaderHandle, bd->AttribLocationVtxUV, "UV");
+        glBindAttribLocation(vd->ShaderHandle, bd->AttribLocationVtxColor, "Color");
+    }
+    glLinkProgram(vd->ShaderHandle);
+    CheckProgram(vd->ShaderHandle, "shader program");
+    glDetachShader(vd->ShaderHandle, bd->VertHandle);
+    glDetachShader(vd->ShaderHandle, bd->FragHandle);
+
+    vd->AttribLocationTex = glGetUniformLocation(vd->ShaderHandle, "Texture");
+    vd->AttribLocationProjMtx = glGetUniformLocation(vd->ShaderHandle, "ProjMtx");
+    if (main_viewport)
+    {
+        bd->AttribLocationVtxPos = (GLuint)glGetAttribLocation(vd->ShaderHandle, "Position");
+        bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(vd->ShaderHandle, "UV");
+        bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(vd->ShaderHandle, "Color");
+    }
+
+    // Signed distance field program. Optional: when it fails for the main viewport, its fragment shader is released and no viewport creates it.
+    if (bd->SdfFragHandle == 0)
+        return;
+    vd->SdfShaderHandle = glCreateProgram();
+    glAttachShader(vd->SdfShaderHandle, bd->VertHandle);
+    glAttachShader(vd->SdfShaderHandle, bd->SdfFragHandle);
+    glBindAttribLocation(vd->SdfShaderHandle, bd->AttribLocationVtxPos, "Position");
+    glBindAttribLocation(vd->SdfShaderHandle, bd->AttribLocationVtxUV, "UV");
+    glBindAttribLocation(vd->SdfShaderHandle, bd->AttribLocationVtxColor, "Color");
+    glLinkProgram(vd->SdfShaderHandle);
+    const bool sdf_program_linked = CheckProgram(vd->SdfShaderHandle, "signed distance field shader program");
+    glDetachShader(vd->SdfShaderHandle, bd->VertHandle);
+    glDetachShader(vd->SdfShaderHandle, bd->SdfFragHandle);
+    if (sdf_program_linked)
+    {
+        vd->SdfAttribLocationTex = glGetUniformLocation(vd->SdfShaderHandle, "Texture");
+        vd->SdfAttribLocationProjMtx = glGetUniformLocation(vd->SdfShaderHandle, "ProjMtx");
+    }
+    else
+    {
+        glDeleteProgram(vd->SdfShaderHandle);
+        vd->SdfShaderHandle = 0;
+        if (main_viewport)
+        {
+            glDeleteShader(bd->SdfFragHandle);
+            bd->SdfFragHandle = 0;
+        }
+    }
+}
+
 bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
@@ -723,64 +923,119 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
         "}\n";
 
+    // Signed distance field glyphs: the texture holds 0.5 on the outlines, fwidth() gives the distance covered by one pixel.
+    const GLchar* fragment_shader_sdf_glsl_120 =
+        "#ifdef GL_ES\n"
+        "    #extension GL_OES_standard_derivatives : enable\n"
+        "    precision mediump float;\n"
+        "#endif\n"
+        "uniform sampler2D Texture;\n"
+        "varying vec2 Frag_UV;\n"
+        "varying vec4 Frag_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture2D(Texture, Frag_UV.st).a;\n"
+        "    float alpha = clamp((d - 0.5) / max(fwidth(d), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    gl_FragColor = vec4(Frag_Color.rgb, Frag_Color.a * alpha);\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_130 =
+        "uniform sampler2D Texture;\n"
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture(Texture, Frag_UV.st).a;\n"
+        "    float alpha = clamp((d - 0.5) / max(fwidth(d), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * alpha);\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_300_es =
+        "precision mediump float;\n"
+        "uniform sampler2D Texture;\n"
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "layout (location = 0) out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture(Texture, Frag_UV.st).a;\n"
+        "    float alpha = clamp((d - 0.5) / max(fwidth(d), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * alpha);\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_410_core =
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "uniform sampler2D Texture;\n"
+        "layout (location = 0) out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture(Texture, Frag_UV.st).a;\n"
+        "    float alpha = clamp((d - 0.5) / max(fwidth(d), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * alpha);\n"
+        "}\n";
+
     // Select shaders matching our GLSL versions
     const GLchar* vertex_shader = NULL;
     const GLchar* fragment_shader = NULL;
+    const GLchar* fragment_shader_sdf = NULL;
     if (glsl_version < 130)
     {
         vertex_shader = vertex_shader_glsl_120;
         fragment_shader = fragment_shader_glsl_120;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_120;
     }
     else if (glsl_version >= 410)
     {
         vertex_shader = vertex_shader_glsl_410_core;
         fragment_shader = fragment_shader_glsl_410_core;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_410_core;
     }
     else if (glsl_version == 300)
     {
         vertex_shader = vertex_shader_glsl_300_es;
         fragment_shader = fragment_shader_glsl_300_es;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_300_es;
     }
     else
     {
         vertex_shader = vertex_shader_glsl_130;
         fragment_shader = fragment_shader_glsl_130;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_130;
     }
 
-    // Create shaders
+    // Create shaders, kept until ImGui_ImplOpenGL3_DestroyDeviceObjects() to link the programs of secondary viewports
     const GLchar* vertex_shader_with_version[2] = { bd->GlslVersionString, vertex_shader };
-    GLuint vert_handle = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vert_handle, 2, vertex_shader_with_version, NULL);
-    glCompileShader(vert_handle);
-    CheckShader(vert_handle, "vertex shader");
+    bd->VertHandle = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(bd->VertHandle, 2, vertex_shader_with_version, NULL);
+    glCompileShader(bd->VertHandle);
+    CheckShader(bd->VertHandle, "vertex shader");
 
     const GLchar* fragment_shader_with_version[2] = { bd->GlslVersionString, fragment_shader };
-    GLuint frag_handle = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(frag_handle, 2, fragment_shader_with_version, NULL);
-    glCompileShader(frag_handle);
-    CheckShader(frag_handle, "fragment shader");
+    bd->FragHandle = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(bd->FragHandle, 2, fragment_shader_with_version, NULL);
+    glCompileShader(bd->FragHandle);
+    CheckShader(bd->FragHandle, "fragment shader");
+
+    // Signed distance field fragment shader, using the same vertex shader.
+    // Optional: when it fails (e.g. GLSL ES 1.00 without OES_standard_derivatives), io.Fonts->TexIDSdf is left to 0 and those glyphs are drawn as coverage.
+    const GLchar* fragment_shader_sdf_with_version[2] = { bd->GlslVersionString, fragment_shader_sdf };
+    bd->SdfFragHandle = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(bd->SdfFragHandle, 2, fragment_shader_sdf_with_version, NULL);
+    glCompileShader(bd->SdfFragHandle);
+    if (!CheckShader(bd->SdfFragHandle, "signed distance field fragment shader"))
+    {
+        glDeleteShader(bd->SdfFragHandle);
+        bd->SdfFragHandle = 0;
+    }
 
     // Link
-    bd->ShaderHandle = glCreateProgram();
-    glAttachShader(bd->ShaderHandle, vert_handle);
-    glAttachShader(bd->ShaderHandle, frag_handle);
-    glLinkProgram(bd->ShaderHandle);
-    CheckProgram(bd->ShaderHandle, "shader program");
-
-    glDetachShader(bd->ShaderHandle, vert_handle);
-    glDetachShader(bd->ShaderHandle, frag_handle);
-    glDeleteShader(vert_handle);
-    glDeleteShader(frag_handle);
-
-    bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
-    bd->AttribLocationProjMtx = glGetUniformLocation(bd->ShaderHandle, "ProjMtx");
-    bd->AttribLocationVtxPos = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Position");
-    bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
-    bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
+    ImGui_ImplOpenGL3_CreatePrograms(&bd->MainViewportData);
 
     // Create buffers
-    glGenBuffers(1, &bd->VboHandle);
-    glGenBuffers(1, &bd->ElementsHandle);
+    glGenBuffers(1, &bd->MainViewportData.VboHandle);
+    glGenBuffers(1, &bd->MainViewportData.ElementsHandle);
 
     ImGui_ImplOpenGL3_CreateFontsTexture();
 
@@ -797,9 +1052,14 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
-    if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
-    if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
-    if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+    ImGui_ImplOpenGL3_ViewportData* vd = &bd->MainViewportData;
+    if (vd->VboHandle)      { glDeleteBuffers(1, &vd->VboHandle); vd->VboHandle = 0; vd->VertexBufferSize = 0; }
+    if (vd->ElementsHandle) { glDeleteBuffers(1, &vd->ElementsHandle); vd->ElementsHandle = 0; vd->IndexBufferSize = 0; }
+    if (vd->ShaderHandle)   { glDeleteProgram(vd->ShaderHandle); vd->ShaderHandle = 0; }
+    if (vd->SdfShaderHandle){ glDeleteProgram(vd->SdfShaderHandle); vd->SdfShaderHandle = 0; }
+    if (bd->VertHandle)     { glDeleteShader(bd->VertHandle); bd->VertHandle = 0; }
+    if (bd->FragHandle)     { glDeleteShader(bd->FragHandle); bd->FragHandle = 0; }
+    if (bd->SdfFragHandle)  { glDeleteShader(bd->SdfFragHandle); bd->SdfFragHandle = 0; }
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
 
@@ -809,6 +1069,28 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
 // If you are new to dear imgui or creating a new binding for dear imgui, it is recommended that you completely ignore this section first..
 //--------------------------------------------------------------------------------------------------------
 
+static void ImGui_ImplOpenGL3_CreateWindow(ImGuiViewport* viewport)
+{
+    // Programs are linked here on the main thread (Mesa may compile the shared shaders again when linking: don't do it from several threads at once)
+    ImGui_ImplOpenGL3_ViewportData* vd = IM_NEW(ImGui_ImplOpenGL3_ViewportData)();
+    ImGui_ImplOpenGL3_CreatePrograms(vd);
+    viewport->RendererUserData = vd;
+}
+
+static void ImGui_ImplOpenGL3_DestroyWindow(ImGuiViewport* viewport)
+{
+    // The main viewport (owned by the application) uses ImGui_ImplOpenGL3_Data::MainViewportData
+    if (ImGui_ImplOpenGL3_ViewportData* vd = (ImGui_ImplOpenGL3_ViewportData*)viewport->RendererUserData)
+    {
+        if (vd->VboHandle)      { glDeleteBuffers(1, &vd->VboHandle); }
+        if (vd->ElementsHandle) { glDeleteBuffers(1, &vd->ElementsHandle); }
+        if (vd->ShaderHandle)   { glDeleteProgram(vd->ShaderHandle); }
+        if (vd->SdfShaderHandle){ glDeleteProgram(vd->SdfShaderHandle); }
+        IM_DELETE(vd);
+    }
+    viewport->RendererUserData = NULL;
+}
+
 static void ImGui_ImplOpenGL3_RenderWindow(ImGuiViewport* viewport, void*)
 {
     if (!(viewport->Flags & ImGuiViewportFlags_NoRendererClear))
@@ -823,6 +1105,8 @@ static void ImGui_ImplOpenGL3_RenderWindow(ImGuiViewport* viewport, void*)
 static void ImGui_ImplOpenGL3_InitPlatformInterface()
 {
     ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+    platform_io.Renderer_CreateWindow = ImGui_ImplOpenGL3_CreateWindow;
+    platform_io.Renderer_DestroyWindow = ImGui_ImplOpenGL3_DestroyWindow;
     platform_io.Renderer_RenderWindow = ImGui_ImplOpenGL3_RenderWindow;
 }
 
@@ -0,0 +1,253 @@
+// dear imgui: Pipelined rendering helper
+// Lets a UI thread build frame N while a render thread submits frame N-1 to any renderer backend (e.g. ImGui_ImplOpenGL3_RenderDrawData()),
+// so that vsync waits and driver work no longer block widget logic.
+// Frames are handed over without deep copies: the buffers of the draw lists output by ImGui::Render() are swapped with the ones of a
+// pipeline frame (ImVector::swap()), and the draw lists get the buffers of an older frame back, keeping their capacity.
+
+// Implemented features:
+//  [X] Two frames in flight: ImGui_ImplPipeline_PushFrame() only blocks when the render thread is still busy with both.
+//  [X] Texture creation requests queued to the render thread, run before the first frame pushed after them.
+// Issues:
+//  [ ] Only one ImDrawData per frame (no multi-viewport support: platform windows need their own threads/contexts).
+//  [ ] User callbacks (ImDrawCmd::UserCallback) are called on the render thread.
+//  [ ] Queued textures are not destroyed by the pipeline: the caller owns them.
+//  [ ] The context's draw lists are left empty after ImGui_ImplPipeline_PushFrame(): the Metrics window shows empty lists for windows not submitted yet in the current frame.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+// Threading:
+// - Every allocation made here (frame draw lists, texture request pixels) is made and freed on the UI thread.
+// - A single mutex protects the frame states and texture requests. It is never held while swapping buffers or creating textures.
+
+#include "imgui.h"
+#include "imgui_impl_pipeline.h"
+#include <string.h>     // memcpy
+#include <condition_variable>
+#include <mutex>
+
+#define IMGUI_IMPL_PIPELINE_FRAMES  2
+
+enum ImGui_ImplPipeline_FrameState
+{
+    ImGui_ImplPipeline_FrameState_Free,         // Owned by the UI thread
+    ImGui_ImplPipeline_FrameState_Pending,      // Pushed, waiting for the render thread
+    ImGui_ImplPipeline_FrameState_Rendering     // Owned by the render thread
+};
+
+struct ImGui_ImplPipeline_Frame
+{
+    ImGui_ImplPipeline_FrameState   State;
+    ImU64                           Sequence;       // Push order
+    ImDrawData                      DrawData;       // CmdLists points to DrawLists.Data
+    ImVector<ImDrawList*>           DrawLists;      // Owned. Their buffers are swapped with the ones of the context's draw lists.
+
+    ImGui_ImplPipeline_Frame()      { State = ImGui_ImplPipeline_FrameState_Free; Sequence = 0; }
+};
+
+struct ImGui_ImplPipeline_TextureRequest
+{
+    int                             Id;
+    int                             Width;
+    int                             Height;
+    unsigned char*                  Pixels;         // Allocated on the UI thread, freed by the render thread once the texture is created
+    ImTextureID                     TexId;
+    bool                            Created;
+};
+
+struct ImGui_ImplPipeline
+{
+    ImGui_ImplPipeline_CreateTextureFunc        CreateTexture;
+    void*                                       CreateTextureUserData;
+    std::mutex                                  Mutex;
+    std::condition_variable                     FrameFreeCond;
+    std::condition_variable                     FramePendingCond;
+    ImGui_ImplPipeline_Frame                    Frames[IMGUI_IMPL_PIPELINE_FRAMES];
+    ImU64                                       NextSequence;
+    ImGui_ImplPipeline_Frame*                   RenderingFrame;
+    ImVector<ImGui_ImplPipeline_TextureRequest> TextureRequests;
+    int                                         NextTextureRequestId;
+    bool                                        QuitRequested;
+
+    ImGui_ImplPipeline()            { CreateTexture = NULL; CreateTextureUserData = NULL; NextSequence = 1; RenderingFrame = NULL; NextTextureRequestId = 1; QuitRequested = false; }
+};
+
+//-----------------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------------
+
+ImGui_ImplPipeline* ImGui_ImplPipeline_Create(ImGui_ImplPipeline_CreateTextureFunc create_texture, void* user_data)
+{
+    ImGui_ImplPipeline* pipeline = IM_NEW(ImGui_ImplPipeline)();
+    pipeline->CreateTexture = create_texture;
+    pipeline->CreateTextureUserData = user_data;
+    return pipeline;
+}
+
+void ImGui_ImplPipeline_Destroy(ImGui_ImplPipeline* pipeline)
+{
+    IM_ASSERT(pipeline->RenderingFrame == NULL && "Render thread still owns a frame!");
+    for (int frame_n = 0; frame_n < IMGUI_IMPL_PIPELINE_FRAMES; frame_n++)
+        for (int n = 0; n < pipeline->Frames[frame_n].DrawLists.Size; n++)
+            IM_DELETE(pipeline->Frames[frame_n].DrawLists[n]);
+    for (int n = 0; n < pipeline->TextureRequests.Size; n++)
+        IM_FREE(pipeline->TextureRequests[n].Pixels);
+    IM_DELETE(pipeline);
+}
+
+// Hand over the buffers of 'src' to 'dst', and give 'src' the (cleared) buffers of an older frame so their capacity is reused.
+static void ImGui_ImplPipeline_SwapDrawList(ImDrawList* dst, ImDrawList* src)
+{
+    dst->CmdBuffer.swap(src->CmdBuffer);
+    dst->IdxBuffer.swap(src->IdxBuffer);
+    dst->VtxBuffer.swap(src->VtxBuffer);
+    dst->Flags = src->Flags;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    dst->VtxOrigin = src->VtxOrigin;
+#endif
+    src->CmdBuffer.resize(0);
+    src->IdxBuffer.resize(0);
+    src->VtxBuffer.resize(0);
+}
+
+void ImGui_ImplPipeline_PushFrame(ImGui_ImplPipeline* pipeline, ImDrawData* draw_data)
+{
+    IM_ASSERT(draw_data->Valid && "Call after ImGui::Render()");
+
+    // Wait for a free frame
+    ImGui_ImplPipeline_Frame* frame = NULL;
+    {
+        std::unique_lock<std::mutex> lock(pipeline->Mutex);
+        for (;;)
+        {
+            for (int frame_n = 0; frame_n < IMGUI_IMPL_PIPELINE_FRAMES && frame == NULL; frame_n++)
+                if (pipeline->Frames[frame_n].State == ImGui_ImplPipeline_FrameState_Free)
+                    frame = &pipeline->Frames[frame_n];
+            if (frame != NULL || pipeline->QuitRequested)
+                break;
+            pipeline->FrameFreeCond.wait(lock);
+        }
+    }
+    if (frame == NULL)
+        return;
+
+    // Take over the buffers (the frame is ours until it is marked as pending)
+    while (frame->DrawLists.Size < draw_data->CmdListsCount)
+        frame->DrawLists.push_back(IM_NEW(ImDrawList)(draw_data->CmdLists[frame->DrawLists.Size]->_Data));
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+        ImGui_ImplPipeline_SwapDrawList(frame->DrawLists[n], draw_data->CmdLists[n]);
+    frame->DrawData = *draw_data;
+    frame->DrawData.CmdLists = frame->DrawLists.Data;
+    draw_data->Valid = false;   // The context's draw lists are empty until the next ImGui::Render()
+
+    std::unique_lock<std::mutex> lock(pipeline->Mutex);
+    frame->State = ImGui_ImplPipeline_FrameState_Pending;
+    frame->Sequence = pipeline->NextSequence++;
+    pipeline->FramePendingCond.notify_one();
+}
+
+int ImGui_ImplPipeline_QueueTexture(ImGui_ImplPipeline* pipeline, int width, int height, const unsigned char* pixels_rgba32)
+{
+    ImGui_ImplPipeline_TextureRequest request;
+    request.Width = width;
+    request.Height = height;
+    request.Pixels = (unsigned char*)IM_ALLOC((size_t)width * height * 4);
+    memcpy(request.Pixels, pixels_rgba32, (size_t)width * height * 4);
+    request.TexId = (ImTextureID)NULL;
+    request.Created = false;
+
+    std::unique_lock<std::mutex> lock(pipeline->Mutex);
+    request.Id = pipeline->NextTextureRequestId++;
+    pipeline->TextureRequests.push_back(request);
+    return request.Id;
+}
+
+bool ImGui_ImplPipeline_GetTexture(ImGui_ImplPipeline* pipeline, int request_id, ImTextureID* out_tex_id)
+{
+    std::unique_lock<std::mutex> lock(pipeline->Mutex);
+    for (int n = 0; n < pipeline->TextureRequests.Size; n++)
+    {
+        ImGui_ImplPipeline_TextureRequest& request = pipeline->TextureRequests[n];
+        if (request.Id != request_id)
+            continue;
+        if (!request.Created)
+            return false;
+        *out_tex_id = request.TexId;
+        pipeline->TextureRequests.erase(&request);
+        return true;
+    }
+    return false;
+}
+
+void ImGui_ImplPipeline_Quit(ImGui_ImplPipeline* pipeline)
+{
+    std::unique_lock<std::mutex> lock(pipeline->Mutex);
+    pipeline->QuitRequested = true;
+    pipeline->FramePendingCond.notify_all();
+    pipeline->FrameFreeCond.notify_all();
+}
+
+ImDrawData* ImGui_ImplPipeline_AcquireFrame(ImGui_ImplPipeline* pipeline)
+{
+    IM_ASSERT(pipeline->RenderingFrame == NULL && "Call ImGui_ImplPipeline_ReleaseFrame() first!");
+    ImGui_ImplPipeline_Frame* frame = NULL;
+    {
+        std::unique_lock<std::mutex> lock(pipeline->Mutex);
+        for (;;)
+        {
+            for (int frame_n = 0; frame_n < IMGUI_IMPL_PIPELINE_FRAMES; frame_n++)
+                if (pipeline->Frames[frame_n].State == ImGui_ImplPipeline_FrameState_Pending && (frame == NULL || pipeline->Frames[frame_n].Sequence < frame->Sequence))
+                    frame = &pipeline->Frames[frame_n];
+            if (frame != NULL)
+                break;
+            if (pipeline->QuitRequested)
+                return NULL;
+            pipeline->FramePendingCond.wait(lock);
+        }
+        frame->State = ImGui_ImplPipeline_FrameState_Rendering;
+        pipeline->RenderingFrame = frame;
+    }
+
+    // Create queued textures, one at a time so the lock isn't held while calling the renderer
+    // (Pixels pointers stay valid: requests are only removed by ImGui_ImplPipeline_GetTexture() once Created is set)
+    for (;;)
+    {
+        int request_id = 0, width = 0, height = 0;
+        const unsigned char* pixels = NULL;
+        {
+            std::unique_lock<std::mutex> lock(pipeline->Mutex);
+            for (int n = 0; n < pipeline->TextureRequests.Size && request_id == 0; n++)
+                if (!pipeline->TextureRequests[n].Created)
+                {
+                    const ImGui_ImplPipeline_TextureRequest& request = pipeline->TextureRequests[n];
+                    request_id = request.Id;
+                    width = request.Width;
+                    height = request.Height;
+                    pixels = request.Pixels;
+                }
+        }
+        if (request_id == 0)
+            break;
+        ImTextureID tex_id = pipeline->CreateTexture ? pipeline->CreateTexture(width, height, pixels, pipeline->CreateTextureUserData) : (ImTextureID)NULL;
+        std::unique_lock<std::mutex> lock(pipeline->Mutex);
+        for (int n = 0; n < pipeline->TextureRequests.Size; n++)
+            if (pipeline->TextureRequests[n].Id == request_id)
+            {
+                pipeline->TextureRequests[n].TexId = tex_id;
+                pipeline->TextureRequests[n].Created = true;
+                IM_FREE(pipeline->TextureRequests[n].Pixels);
+                pipeline->TextureRequests[n].Pixels = NULL;
+            }
+    }
+    return &frame->DrawData;
+}
+
+void ImGui_ImplPipeline_ReleaseFrame(ImGui_ImplPipeline* pipeline)
+{
+    IM_ASSERT(pipeline->RenderingFrame != NULL);
+    std::unique_lock<std::mutex> lock(pipeline->Mutex);
+    pipeline->RenderingFrame->State = ImGui_ImplPipeline_FrameState_Free;
+    pipeline->RenderingFrame = NULL;
+    pipeline->FrameFreeCond.notify_one();
+}
@@ -0,0 +1,44 @@
+// dear imgui: Pipelined rendering helper
+// Lets a UI thread build frame N while a render thread submits frame N-1 to any renderer backend (e.g. ImGui_ImplOpenGL3_RenderDrawData()),
+// so that vsync waits and driver work no longer block widget logic.
+// Frames are handed over without deep copies: the buffers of the draw lists output by ImGui::Render() are swapped with the ones of a
+// pipeline frame (ImVector::swap()), and the draw lists get the buffers of an older frame back, keeping their capacity.
+
+// Implemented features:
+//  [X] Two frames in flight: ImGui_ImplPipeline_PushFrame() only blocks when the render thread is still busy with both.
+//  [X] Texture creation requests queued to the render thread, run before the first frame pushed after them.
+// Issues:
+//  [ ] Only one ImDrawData per frame (no multi-viewport support: platform windows need their own threads/contexts).
+//  [ ] User callbacks (ImDrawCmd::UserCallback) are called on the render thread.
+//  [ ] Queued textures are not destroyed by the pipeline: the caller owns them.
+//  [ ] The context's draw lists are left empty after ImGui_ImplPipeline_PushFrame(): the Metrics window shows empty lists for windows not submitted yet in the current frame.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+// Typical usage:
+//   UI thread:     ImGui::NewFrame(); [...] ImGui::Render(); ImGui_ImplPipeline_PushFrame(pipeline, ImGui::GetDrawData());
+//   Render thread: while (ImDrawData* draw_data = ImGui_ImplPipeline_AcquireFrame(pipeline)) { [render draw_data]; ImGui_ImplPipeline_ReleaseFrame(pipeline); [swap buffers]; }
+// - The renderer backend must have created its device objects (font texture...) before the first frame is pushed,
+//   e.g. by calling its NewFrame function once on the UI thread while it owns the graphics context.
+// - The render thread must not call functions which modify the Dear ImGui context.
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+
+struct ImGui_ImplPipeline;
+typedef ImTextureID (*ImGui_ImplPipeline_CreateTextureFunc)(int width, int height, const unsigned char* pixels_rgba32, void* user_data);
+
+IMGUI_IMPL_API ImGui_ImplPipeline*  ImGui_ImplPipeline_Create(ImGui_ImplPipeline_CreateTextureFunc create_texture, void* user_data);  // create_texture is called on the render thread
+IMGUI_IMPL_API void                 ImGui_ImplPipeline_Destroy(ImGui_ImplPipeline* pipeline);  // Call once the render thread has returned
+
+// UI thread
+IMGUI_IMPL_API void                 ImGui_ImplPipeline_PushFrame(ImGui_ImplPipeline* pipeline, ImDrawData* draw_data);    // Call after ImGui::Render(). Takes over the buffers of draw_data's lists.
+IMGUI_IMPL_API int                  ImGui_ImplPipeline_QueueTexture(ImGui_ImplPipeline* pipeline, int width, int height, const unsigned char* pixels_rgba32); // Pixels are copied. Return a request identifier.
+IMGUI_IMPL_API bool                 ImGui_ImplPipeline_GetTexture(ImGui_ImplPipeline* pipeline, int request_id, ImTextureID* out_tex_id);  // Return false until the render thread has created it, then true once (the request is then forgotten)
+IMGUI_IMPL_API void                 ImGui_ImplPipeline_Quit(ImGui_ImplPipeline* pipeline);     // Frames pushed so far are still rendered, then ImGui_ImplPipeline_AcquireFrame() returns NULL
+
+// Render thread
+IMGUI_IMPL_API ImDrawData*          ImGui_ImplPipeline_AcquireFrame(ImGui_ImplPipeline* pipeline);    // Block until a frame is pushed (oldest first), after creating queued textures. NULL once quitting and all pushed frames were acquired.
+IMGUI_IMPL_API void                 ImGui_ImplPipeline_ReleaseFrame(ImGui_ImplPipeline* pipeline);    // Call as soon as the renderer is done with the draw data (before swapping buffers).
@@ -0,0 +1,1234 @@
+// dear imgui: Remote Platform + Renderer Backends (UI streaming over TCP)
+// The application side (e.g. a headless render node) uses this as its platform + renderer backend: every frame's ImDrawData is
+// serialized, delta-encoded against the previous frame and sent to a viewer. The viewer side decodes the stream back into ImDrawData
+// (to be rendered with any renderer backend, e.g. ImGui_ImplOpenGL3_RenderDrawData()) and sends its inputs back.
+
+// Implemented features:
+//  [X] Platform: Display size, mouse, keyboard and text inputs are received from the viewer. Keyboard arrays are indexed using ImGuiKey_XXX values.
+//  [X] Renderer: Draw lists are delta-encoded against the previous frame (per draw list, matched by owner window) then run-length compressed.
+//  [X] Renderer: Font atlas and user textures registered with ImGui_ImplRemote_AddTexture() are sent to the viewer when it connects.
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Back-pressure: frames are dropped (not queued) while the viewer hasn't received the previous one.
+//  [X] Bandwidth per frame and input-to-display latency statistics.
+// Issues:
+//  [ ] Renderer: User callbacks (other than ImDrawCallback_ResetRenderState) are not sent.
+//  [ ] Platform/Renderer: Multi-viewport support.
+//  [ ] Both sides must be built with the same ImDrawVert/ImDrawIdx layout and endianness (checked on connection).
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+// Stream format:
+// - Messages: [ImU32 type][ImU32 payload size][payload]. Values are written in host byte order (checked by the Hello message).
+// - Hello (application -> viewer): protocol version, sizeof(ImDrawVert), sizeof(ImDrawIdx).
+// - Texture (application -> viewer): texture identifier on the application side, size, RGBA32 pixels.
+// - Frame (application -> viewer): frame header, then for each draw list a header and its encoded 'blob'.
+//   A blob is [commands][vertices][indices], commands being stored as ImGui_ImplRemote_CmdRecord.
+//   The blob is XOR-ed with the blob sent for the same draw list in the previous frame (draw lists are matched by a key
+//   derived from their owner window name), so unchanged bytes become zeroes. The result is encoded as a sequence of
+//   [varint unchanged bytes count][varint literal bytes count][literal bytes]. UI output is mostly static from one frame
+//   to the next, so this typically shrinks frames by one or two orders of magnitude.
+// - Input (viewer -> application): a snapshot of the viewer inputs (ImGui_ImplRemote_InputRecord) followed by input characters.
+//   Each snapshot carries a viewer timestamp which the application echoes in the next frame it sends, to measure latency.
+
+#include "imgui.h"
+#include "imgui_internal.h"     // ImHashStr, ImTimeGetMicroseconds
+#include "imgui_impl_remote.h"
+#include <stdio.h>      // snprintf
+#include <string.h>     // memcpy, memset
+#if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
+#include <stddef.h>     // intptr_t
+#else
+#include <stdint.h>     // intptr_t
+#endif
+
+// Sockets
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "ws2_32")
+#endif
+typedef SOCKET ImGui_ImplRemote_Socket;
+#define IMGUI_IMPL_REMOTE_INVALID_SOCKET    INVALID_SOCKET
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+typedef int ImGui_ImplRemote_Socket;
+#define IMGUI_IMPL_REMOTE_INVALID_SOCKET    (-1)
+#endif
+
+#define IMGUI_IMPL_REMOTE_PROTOCOL_VERSION  2
+#define IMGUI_IMPL_REMOTE_RECV_CHUNK        (64 * 1024)
+#define IMGUI_IMPL_REMOTE_SLOT_MAX_AGE      120     // Draw list delta bases unused for this many sent frames are discarded
+#define IMGUI_IMPL_REMOTE_MAX_FRAME_SIZE    (256 * 1024 * 1024) // The viewer rejects frames whose decoded draw lists are larger than this
+
+//-----------------------------------------------------------------------------
+// Stream records
+//-----------------------------------------------------------------------------
+
+enum ImGui_ImplRemote_MessageType
+{
+    ImGui_ImplRemote_MessageType_Hello = 0x494D4801,
+    ImGui_ImplRemote_MessageType_Texture,
+    ImGui_ImplRemote_MessageType_Frame,
+    ImGui_ImplRemote_MessageType_Input
+};
+
+struct ImGui_ImplRemote_MessageHeader
+{
+    ImU32   Type;
+    ImU32   Size;
+};
+
+struct ImGui_ImplRemote_HelloRecord
+{
+    ImU32   Version;
+    ImU32   SizeOfDrawVert;
+    ImU32   SizeOfDrawIdx;
+    ImU32   ByteOrderMark;      // 0x01020304
+};
+
+struct ImGui_ImplRemote_TextureRecord
+{
+    ImU64   TexId;
+    ImU32   Width;
+    ImU32   Height;
+};
+
+struct ImGui_ImplRemote_FrameRecord
+{
+    ImU64   InputTimestamp;     // Viewer timestamp of the last input snapshot processed by this frame (0: none)
+    ImU32   FrameIndex;
+    ImU32   DrawListsCount;
+    float   DisplayPos[2];
+    float   DisplaySize[2];
+    float   FramebufferScale[2];
+};
+
+enum ImGui_ImplRemote_DrawListFlags
+{
+    ImGui_ImplRemote_DrawListFlags_Delta = 1 << 0   // Blob is encoded against the previous blob of the same key (otherwise against nothing)
+};
+
+struct ImGui_ImplRemote_DrawListRecord
+{
+    ImGuiID Key;
+    ImU32   Flags;
+    ImU32   CmdCount;
+    ImU32   VtxCount;
+    ImU32   IdxCount;
+    ImU32   EncodedSize;
+    float   VtxOrigin[2];   // ImDrawList::VtxOrigin (compact vertices are relative to it)
+};
+
+enum ImGui_ImplRemote_CmdFlags
+{
+    ImGui_ImplRemote_CmdFlags_ResetRenderState = 1 << 0
+};
+
+struct ImGui_ImplRemote_CmdRecord
+{
+    ImU64   TexId;
+    float   ClipRect[4];
+    ImU32   VtxOffset;
+    ImU32   IdxOffset;
+    ImU32   ElemCount;
+    ImU32   Flags;
+};
+
+enum ImGui_ImplRemote_ModFlags
+{
+    ImGui_ImplRemote_ModFlags_Ctrl  = 1 << 0,
+    ImGui_ImplRemote_ModFlags_Shift = 1 << 1,
+    ImGui_ImplRemote_ModFlags_Alt   = 1 << 2,
+    ImGui_ImplRemote_ModFlags_Super = 1 << 3
+};
+
+struct ImGui_ImplRemote_InputRecord
+{
+    ImU64   Timestamp;          // Viewer clock, in microseconds
+    float   DisplaySize[2];
+    float   FramebufferScale[2];
+    float   MousePos[2];
+    float   MouseWheel[2];      // Horizontal, vertical
+    ImU32   MouseDown;          // One bit per button
+    ImU32   ModFlags;
+    ImU32   KeysDown[(ImGuiKey_COUNT + 31) / 32];   // One bit per ImGuiKey_XXX
+    ImU32   CharsCount;         // Followed by as many ImU32 codepoints
+};
+
+//-----------------------------------------------------------------------------
+// Delta encoding
+//-----------------------------------------------------------------------------
+
+static void ImGui_ImplRemote_WriteVarint(ImVector<unsigned char>& out, ImU32 v)
+{
+    while (v >= 0x80)
+    {
+        out.push_back((unsigned char)(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back((unsigned char)v);
+}
+
+static bool ImGui_ImplRemote_ReadVarint(const unsigned char** p, const unsigned char* p_end, ImU32* out_v)
+{
+    ImU32 v = 0;
+    for (int shift = 0; shift < 35; shift += 7)
+    {
+        if (*p >= p_end)
+            return false;
+        const unsigned char c = *(*p)++;
+        v |= (ImU32)(c & 0x7F) << shift;
+        if ((c & 0x80) == 0)
+        {
+            *out_v = v;
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline unsigned char ImGui_ImplRemote_DeltaByte(const unsigned char* cur, const unsigned char* prev, int prev_size, int n)
+{
+    return (n < prev_size) ? (unsigned char)(cur[n] ^ prev[n]) : cur[n];
+}
+
+// Append 'cur' encoded against 'prev' (bytes past the end of 'prev' are compared to zero)
+static void ImGui_ImplRemote_EncodeDelta(const unsigned char* cur, int cur_size, const unsigned char* prev, int prev_size, ImVector<unsigned char>& out)
+{
+    const int min_unchanged_run = 8;    // Shorter runs of unchanged bytes are kept inside literals: each run costs at least 2 bytes
+    const int common_size = ImMin(cur_size, prev_size);
+    int pos = 0;
+    while (pos < cur_size)
+    {
+        // Unchanged bytes (8 at a time while possible)
+        const int run_start = pos;
+        while (pos + 8 <= common_size && memcmp(cur + pos, prev + pos, 8) == 0)
+            pos += 8;
+        while (pos < cur_size && ImGui_ImplRemote_DeltaByte(cur, prev, prev_size, pos) == 0)
+            pos++;
+        const int run_size = pos - run_start;
+
+        // Changed bytes, until the next long enough run of unchanged bytes
+        const int literal_start = pos;
+        int unchanged_count = 0;
+        while (pos < cur_size)
+        {
+            if (ImGui_ImplRemote_DeltaByte(cur, prev, prev_size, pos) != 0)
+                unchanged_count = 0;
+            else if (++unchanged_count == min_unchanged_run)
+            {
+                pos -= min_unchanged_run - 1;
+                break;
+            }
+            pos++;
+        }
+        const int literal_size = pos - literal_start;
+
+        ImGui_ImplRemote_WriteVarint(out, (ImU32)run_size);
+        ImGui_ImplRemote_WriteVarint(out, (ImU32)literal_size);
+        const int out_offset = out.Size;
+        out.resize(out.Size + literal_size);
+        for (int n = 0; n < literal_size; n++)
+            out.Data[out_offset + n] = ImGui_ImplRemote_DeltaByte(cur, prev, prev_size, literal_start + n);
+    }
+}
+
+// Decode in place: 'blob' holds the previous blob on input and 'size' bytes of the new one on output
+static bool ImGui_ImplRemote_DecodeDelta(const unsigned char* in, int in_size, ImVector<unsigned char>& blob, int size)
+{
+    const int prev_size = blob.Size;
+    blob.resize(size);
+    if (size > prev_size)
+        memset(blob.Data + prev_size, 0, (size_t)(size - prev_size));
+    const unsigned char* in_end = in + in_size;
+    int pos = 0;
+    while (pos < size)
+    {
+        ImU32 run_size, literal_size;
+        if (!ImGui_ImplRemote_ReadVarint(&in, in_end, &run_size) || !ImGui_ImplRemote_ReadVarint(&in, in_end, &literal_size))
+            return false;
+        if (run_size > (ImU32)(size - pos))
+            return false;
+        pos += (int)run_size;
+        if (literal_size > (ImU32)(size - pos) || literal_size > (ImU32)(in_end - in))
+            return false;
+        for (ImU32 n = 0; n < literal_size; n++)
+            blob.Data[pos + n] ^= in[n];
+        in += literal_size;
+        pos += (int)literal_size;
+    }
+    return in == in_end;
+}
+
+//-----------------------------------------------------------------------------
+// Sockets helpers
+//-----------------------------------------------------------------------------
+
+static bool ImGui_ImplRemote_SocketsInit()
+{
+#ifdef _WIN32
+    WSADATA wsa_data;
+    return ::WSAStartup(MAKEWORD(2, 2), &wsa_data) == 0;
+#else
+    return true;
+#endif
+}
+
+static void ImGui_ImplRemote_SocketsShutdown()
+{
+#ifdef _WIN32
+    ::WSACleanup();
+#endif
+}
+
+static void ImGui_ImplRemote_CloseSocket(ImGui_ImplRemote_Socket* s)
+{
+    if (*s == IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+        return;
+#ifdef _WIN32
+    ::closesocket(*s);
+#else
+    ::close(*s);
+#endif
+    *s = IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+}
+
+// Non-blocking, no Nagle delay (we always send whole messages), no SIGPIPE
+static void ImGui_ImplRemote_SetupSocket(ImGui_ImplRemote_Socket s)
+{
+    int one = 1;
+    ::setsockopt(s, IPPROTO_TCP, TCP_NODELAY, (const char*)&one, sizeof(one));
+#ifdef _WIN32
+    u_long non_blocking = 1;
+    ::ioctlsocket(s, FIONBIO, &non_blocking);
+#else
+    ::fcntl(s, F_SETFL, ::fcntl(s, F_GETFL, 0) | O_NONBLOCK);
+#ifdef SO_NOSIGPIPE
+    ::setsockopt(s, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+#endif
+}
+
+static bool ImGui_ImplRemote_WouldBlock()
+{
+#ifdef _WIN32
+    return ::WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+#endif
+}
+
+// Send as much of 'buf' as possible. Return false if the connection is lost.
+static bool ImGui_ImplRemote_SendPending(ImGui_ImplRemote_Socket s, ImVector<unsigned char>& buf, int* offset)
+{
+    while (*offset < buf.Size)
+    {
+#if defined(MSG_NOSIGNAL)
+        const int sent = (int)::send(s, (const char*)buf.Data + *offset, (size_t)(buf.Size - *offset), MSG_NOSIGNAL);
+#else
+        const int sent = (int)::send(s, (const char*)buf.Data + *offset, buf.Size - *offset, 0);
+#endif
+        if (sent > 0)
+            *offset += sent;
+        else if (sent < 0 && ImGui_ImplRemote_WouldBlock())
+            return true;
+        else
+            return false;
+    }
+    buf.resize(0);
+    *offset = 0;
+    return true;
+}
+
+// Append all available bytes to 'buf'. Return false if the connection is lost.
+static bool ImGui_ImplRemote_ReceiveAvailable(ImGui_ImplRemote_Socket s, ImVector<unsigned char>& buf)
+{
+    for (;;)
+    {
+        const int offset = buf.Size;
+        buf.resize(offset + IMGUI_IMPL_REMOTE_RECV_CHUNK);
+        const int received = (int)::recv(s, (char*)buf.Data + offset, IMGUI_IMPL_REMOTE_RECV_CHUNK, 0);
+        buf.resize(offset + ImMax(received, 0));
+        if (received > 0)
+            continue;
+        if (received < 0 && ImGui_ImplRemote_WouldBlock())
+            return true;
+        return false;   // Closed or error
+    }
+}
+
+// Return the next complete message in 'buf' starting at '*offset', or NULL
+static const unsigned char* ImGui_ImplRemote_NextMessage(const ImVector<unsigned char>& buf, int* offset, ImGui_ImplRemote_MessageHeader* out_header)
+{
+    if (buf.Size - *offset < (int)sizeof(ImGui_ImplRemote_MessageHeader))
+        return NULL;
+    memcpy(out_header, buf.Data + *offset, sizeof(ImGui_ImplRemote_MessageHeader));
+    if ((ImU32)(buf.Size - *offset - (int)sizeof(ImGui_ImplRemote_MessageHeader)) < out_header->Size)
+        return NULL;
+    const unsigned char* payload = buf.Data + *offset + sizeof(ImGui_ImplRemote_MessageHeader);
+    *offset += (int)sizeof(ImGui_ImplRemote_MessageHeader) + (int)out_header->Size;
+    return payload;
+}
+
+// Drop the first 'offset' bytes of 'buf'
+static void ImGui_ImplRemote_ConsumeBytes(ImVector<unsigned char>& buf, int offset)
+{
+    if (offset == 0)
+        return;
+    if (offset < buf.Size)
+        memmove(buf.Data, buf.Data + offset, (size_t)(buf.Size - offset));
+    buf.resize(buf.Size - offset);
+}
+
+static void ImGui_ImplRemote_AppendBytes(ImVector<unsigned char>& buf, const void* data, int size)
+{
+    const int offset = buf.Size;
+    buf.resize(offset + size);
+    memcpy(buf.Data + offset, data, (size_t)size);
+}
+
+// Reserve a message header, to be completed by ImGui_ImplRemote_EndMessage() once the payload is written
+static int ImGui_ImplRemote_BeginMessage(ImVector<unsigned char>& buf, ImGui_ImplRemote_MessageType type)
+{
+    ImGui_ImplRemote_MessageHeader header = { (ImU32)type, 0 };
+    const int offset = buf.Size;
+    ImGui_ImplRemote_AppendBytes(buf, &header, sizeof(header));
+    return offset;
+}
+
+static int ImGui_ImplRemote_EndMessage(ImVector<unsigned char>& buf, int header_offset)
+{
+    const ImU32 size = (ImU32)(buf.Size - header_offset - (int)sizeof(ImGui_ImplRemote_MessageHeader));
+    memcpy(buf.Data + header_offset + offsetof(ImGui_ImplRemote_MessageHeader, Size), &size, sizeof(size));
+    return buf.Size - header_offset;
+}
+
+//-----------------------------------------------------------------------------
+// Application side
+//-----------------------------------------------------------------------------
+
+// Previous blob sent for a draw list
+struct ImGui_ImplRemote_DrawListSlot
+{
+    ImGuiID                 Key;
+    ImU32                   LastFrame;
+    ImVector<unsigned char> Blob;
+};
+
+struct ImGui_ImplRemote_TextureDesc
+{
+    ImTextureID             TexId;
+    int                     Width;
+    int                     Height;
+    const unsigned char*    Pixels;
+};
+
+struct ImGui_ImplRemote_Data
+{
+    ImGui_ImplRemote_Socket                     ListenSocket;
+    ImGui_ImplRemote_Socket                     ViewerSocket;
+    int                                         Port;
+    ImVector<unsigned char>                     SendBuffer;
+    int                                         SendOffset;
+    ImVector<unsigned char>                     RecvBuffer;
+
+    ImVec2                                      DefaultDisplaySize;
+    ImVec2                                      DisplaySize;
+    ImVec2                                      FramebufferScale;
+    ImU64                                       Time;
+    ImU64                                       LastInputTimestamp;
+    ImU32                                       MouseReleasePending;    // Buttons pressed and released between two frames: reported down for one frame, released on the next one
+
+    ImU32                                       FrameIndex;
+    ImVector<ImGui_ImplRemote_DrawListSlot*>    Slots;
+    ImGuiStorage                                SlotsMap;               // Key -> index in Slots[] + 1
+    ImGuiStorage                                KeyOccurrences;         // Scratch: owner name hash -> count, to build unique keys
+    ImVector<unsigned char>                     Blob;                   // Scratch: blob being encoded
+    ImVector<ImGui_ImplRemote_TextureDesc>      Textures;
+    ImGui_ImplRemote_Stats                      Stats;
+
+    ImGui_ImplRemote_Data()
+    {
+        ListenSocket = ViewerSocket = IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+        Port = 0;
+        SendOffset = 0;
+        DefaultDisplaySize = DisplaySize = ImVec2(0.0f, 0.0f);
+        FramebufferScale = ImVec2(1.0f, 1.0f);
+        Time = LastInputTimestamp = 0;
+        MouseReleasePending = 0;
+        FrameIndex = 0;
+        memset((void*)&Stats, 0, sizeof(Stats));
+    }
+};
+
+// Backend data stored in io.BackendPlatformUserData (and io.BackendRendererUserData) to allow support for multiple Dear ImGui contexts
+static ImGui_ImplRemote_Data* ImGui_ImplRemote_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplRemote_Data*)ImGui::GetIO().BackendPlatformUserData : NULL;
+}
+
+static void ImGui_ImplRemote_ClearSlots(ImGui_ImplRemote_Data* bd)
+{
+    for (int n = 0; n < bd->Slots.Size; n++)
+        IM_DELETE(bd->Slots[n]);
+    bd->Slots.clear();
+    bd->SlotsMap.Clear();
+}
+
+static void ImGui_ImplRemote_DisconnectViewer(ImGui_ImplRemote_Data* bd)
+{
+    ImGui_ImplRemote_CloseSocket(&bd->ViewerSocket);
+    bd->SendBuffer.resize(0);
+    bd->SendOffset = 0;
+    bd->RecvBuffer.resize(0);
+    bd->DisplaySize = bd->DefaultDisplaySize;
+    bd->FramebufferScale = ImVec2(1.0f, 1.0f);
+    bd->LastInputTimestamp = 0;
+    bd->MouseReleasePending = 0;
+    ImGui_ImplRemote_ClearSlots(bd);
+}
+
+static void ImGui_ImplRemote_QueueTexture(ImGui_ImplRemote_Data* bd, const ImGui_ImplRemote_TextureDesc& tex)
+{
+    const int header_offset = ImGui_ImplRemote_BeginMessage(bd->SendBuffer, ImGui_ImplRemote_MessageType_Texture);
+    ImGui_ImplRemote_TextureRecord record = { (ImU64)(intptr_t)tex.TexId, (ImU32)tex.Width, (ImU32)tex.Height };
+    ImGui_ImplRemote_AppendBytes(bd->SendBuffer, &record, sizeof(record));
+    ImGui_ImplRemote_AppendBytes(bd->SendBuffer, tex.Pixels, tex.Width * tex.Height * 4);
+    bd->Stats.BytesSent += ImGui_ImplRemote_EndMessage(bd->SendBuffer, header_offset);
+}
+
+static void ImGui_ImplRemote_AcceptViewer(ImGui_ImplRemote_Data* bd)
+{
+    ImGui_ImplRemote_Socket s = ::accept(bd->ListenSocket, NULL, NULL);
+    if (s == IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+        return;
+    ImGui_ImplRemote_DisconnectViewer(bd);
+    ImGui_ImplRemote_SetupSocket(s);
+    bd->ViewerSocket = s;
+
+    // Hello + textures. The viewer has no previous frame: all draw lists will be sent without delta base.
+    const int header_offset = ImGui_ImplRemote_BeginMessage(bd->SendBuffer, ImGui_ImplRemote_MessageType_Hello);
+    ImGui_ImplRemote_HelloRecord hello = { IMGUI_IMPL_REMOTE_PROTOCOL_VERSION, (ImU32)sizeof(ImDrawVert), (ImU32)sizeof(ImDrawIdx), 0x01020304 };
+    ImGui_ImplRemote_AppendBytes(bd->SendBuffer, &hello, sizeof(hello));
+    bd->Stats.BytesSent += ImGui_ImplRemote_EndMessage(bd->SendBuffer, header_offset);
+
+    ImGuiIO& io = ImGui::GetIO();
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    ImGui_ImplRemote_TextureDesc font_tex = { io.Fonts->TexID, width, height, pixels };
+    ImGui_ImplRemote_QueueTexture(bd, font_tex);
+    for (int n = 0; n < bd->Textures.Size; n++)
+        ImGui_ImplRemote_QueueTexture(bd, bd->Textures[n]);
+}
+
+static void ImGui_ImplRemote_ApplyInput(ImGui_ImplRemote_Data* bd, const ImGui_ImplRemote_InputRecord& input, const unsigned char* chars, bool first_of_frame)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    bd->DisplaySize = ImVec2(input.DisplaySize[0], input.DisplaySize[1]);
+    bd->FramebufferScale = ImVec2(input.FramebufferScale[0], input.FramebufferScale[1]);
+    bd->LastInputTimestamp = input.Timestamp;
+    io.MousePos = ImVec2(input.MousePos[0], input.MousePos[1]);
+    for (int button = 0; button < IM_ARRAYSIZE(io.MouseDown); button++)
+    {
+        const ImU32 mask = 1u << button;
+        const bool down = (input.MouseDown & mask) != 0;
+        if (down)
+        {
+            io.MouseDown[button] = true;
+            bd->MouseReleasePending &= ~mask;
+        }
+        else if (io.MouseDown[button] && !first_of_frame)
+            bd->MouseReleasePending |= mask;    // Pressed by an earlier snapshot of this frame: keep it down for this frame
+        else
+            io.MouseDown[button] = false;
+    }
+    io.MouseWheelH += input.MouseWheel[0];
+    io.MouseWheel += input.MouseWheel[1];
+    io.KeyCtrl = (input.ModFlags & ImGui_ImplRemote_ModFlags_Ctrl) != 0;
+    io.KeyShift = (input.ModFlags & ImGui_ImplRemote_ModFlags_Shift) != 0;
+    io.KeyAlt = (input.ModFlags & ImGui_ImplRemote_ModFlags_Alt) != 0;
+    io.KeySuper = (input.ModFlags & ImGui_ImplRemote_ModFlags_Super) != 0;
+    for (int key = 0; key < ImGuiKey_COUNT; key++)
+        io.KeysDown[key] = (input.KeysDown[key >> 5] & (1u << (key & 31))) != 0;
+    for (ImU32 n = 0; n < input.CharsCount; n++)
+    {
+        ImU32 c;
+        memcpy(&c, chars + n * sizeof(ImU32), sizeof(ImU32));
+        io.AddInputCharacter(c);
+    }
+}
+
+bool ImGui_ImplRemote_Init(const char* bind_address, int port, const ImVec2& default_display_size)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_ASSERT(io.BackendPlatformUserData == NULL && "Already initialized a platform backend!");
+    IM_ASSERT(io.BackendRendererUserData == NULL && "Already initialized a renderer backend!");
+    if (!ImGui_ImplRemote_SocketsInit())
+        return false;
+
+    // Listen
+    ImGui_ImplRemote_Socket s = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (s == IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+    {
+        ImGui_ImplRemote_SocketsShutdown();
+        return false;
+    }
+    int one = 1;
+    ::setsockopt(s, SOL_SOCKET, SO_REUSEADDR, (const char*)&one, sizeof(one));
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((unsigned short)port);
+    if (::inet_pton(AF_INET, bind_address, &addr.sin_addr) != 1 || ::bind(s, (const sockaddr*)&addr, sizeof(addr)) != 0 || ::listen(s, 1) != 0)
+    {
+        ImGui_ImplRemote_CloseSocket(&s);
+        ImGui_ImplRemote_SocketsShutdown();
+        return false;
+    }
+    socklen_t addr_len = sizeof(addr);
+    ::getsockname(s, (sockaddr*)&addr, &addr_len);
+    ImGui_ImplRemote_SetupSocket(s);
+
+    // Setup backend capabilities flags
+    ImGui_ImplRemote_Data* bd = IM_NEW(ImGui_ImplRemote_Data)();
+    io.BackendPlatformUserData = (void*)bd;
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendPlatformName = "imgui_impl_remote";
+    io.BackendRendererName = "imgui_impl_remote";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    bd->ListenSocket = s;
+    bd->Port = ntohs(addr.sin_port);
+    bd->DefaultDisplaySize = bd->DisplaySize = default_display_size;
+    bd->Time = ImTimeGetMicroseconds();
+
+    // Keyboard mapping: the viewer sends ImGuiKey_XXX values
+    for (int key = 0; key < ImGuiKey_COUNT; key++)
+        io.KeyMap[key] = key;
+
+    // Build the font atlas now (it is sent to viewers as they connect). It needs a non-zero identifier to be told apart from missing textures.
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    if (io.Fonts->TexID == (ImTextureID)0)
+        io.Fonts->SetTexID((ImTextureID)(intptr_t)1);
+    return true;
+}
+
+void ImGui_ImplRemote_Shutdown()
+{
+    ImGui_ImplRemote_Data* bd = ImGui_ImplRemote_GetBackendData();
+    IM_ASSERT(bd != NULL && "No platform backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    ImGui_ImplRemote_DisconnectViewer(bd);
+    ImGui_ImplRemote_CloseSocket(&bd->ListenSocket);
+    ImGui_ImplRemote_SocketsShutdown();
+    io.BackendPlatformName = io.BackendRendererName = NULL;
+    io.BackendPlatformUserData = io.BackendRendererUserData = NULL;
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplRemote_NewFrame()
+{
+    ImGui_ImplRemote_Data* bd = ImGui_ImplRemote_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplRemote_Init()?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Setup time step
+    const ImU64 current_time = ImTimeGetMicroseconds();
+    io.DeltaTime = (current_time > bd->Time) ? (float)(current_time - bd->Time) / 1000000.0f : 1.0f / 60.0f;
+    bd->Time = current_time;
+
+    // Buttons pressed and released during the previous frame
+    for (int button = 0; button < IM_ARRAYSIZE(io.MouseDown); button++)
+        if (bd->MouseReleasePending & (1u << button))
+            io.MouseDown[button] = false;
+    bd->MouseReleasePending = 0;
+
+    // Accept a new viewer (replacing the current one) and receive its inputs
+    ImGui_ImplRemote_AcceptViewer(bd);
+    ImGui_ImplRemote_Flush();
+    if (bd->ViewerSocket != IMGUI_IMPL_REMOTE_INVALID_SOCKET && !ImGui_ImplRemote_ReceiveAvailable(bd->ViewerSocket, bd->RecvBuffer))
+        ImGui_ImplRemote_DisconnectViewer(bd);
+    int offset = 0;
+    bool first_of_frame = true;
+    ImGui_ImplRemote_MessageHeader header;
+    while (const unsigned char* payload = ImGui_ImplRemote_NextMessage(bd->RecvBuffer, &offset, &header))
+    {
+        if (header.Type != ImGui_ImplRemote_MessageType_Input || header.Size < sizeof(ImGui_ImplRemote_InputRecord))
+            continue;
+        ImGui_ImplRemote_InputRecord input;
+        memcpy(&input, payload, sizeof(input));
+        if (header.Size < sizeof(input) + input.CharsCount * sizeof(ImU32))
+            continue;
+        ImGui_ImplRemote_ApplyInput(bd, input, payload + sizeof(input), first_of_frame);
+        first_of_frame = false;
+    }
+    ImGui_ImplRemote_ConsumeBytes(bd->RecvBuffer, offset);
+
+    io.DisplaySize = bd->DisplaySize;
+    io.DisplayFramebufferScale = bd->FramebufferScale;
+}
+
+void ImGui_ImplRemote_RenderDrawData(ImDrawData* draw_data)
+{
+    ImGui_ImplRemote_Data* bd = ImGui_ImplRemote_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplRemote_Init()?");
+    if (bd->ViewerSocket == IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+        return;
+
+    // Back-pressure: don't queue frames behind a frame the viewer hasn't received yet.
+    ImGui_ImplRemote_Flush();
+    if (bd->SendBuffer.Size > 0)
+    {
+        bd->Stats.FramesDropped++;
+        return;
+    }
+
+    const ImU64 encode_start_time = ImTimeGetMicroseconds();
+    const int header_offset = ImGui_ImplRemote_BeginMessage(bd->SendBuffer, ImGui_ImplRemote_MessageType_Frame);
+    ImGui_ImplRemote_FrameRecord frame;
+    frame.InputTimestamp = bd->LastInputTimestamp;
+    frame.FrameIndex = bd->FrameIndex;
+    frame.DrawListsCount = (ImU32)draw_data->CmdListsCount;
+    frame.DisplayPos[0] = draw_data->DisplayPos.x;
+    frame.DisplayPos[1] = draw_data->DisplayPos.y;
+    frame.DisplaySize[0] = draw_data->DisplaySize.x;
+    frame.DisplaySize[1] = draw_data->DisplaySize.y;
+    frame.FramebufferScale[0] = draw_data->FramebufferScale.x;
+    frame.FramebufferScale[1] = draw_data->FramebufferScale.y;
+    ImGui_ImplRemote_AppendBytes(bd->SendBuffer, &frame, sizeof(frame));
+    int raw_size = (int)(sizeof(ImGui_ImplRemote_MessageHeader) + sizeof(frame));
+
+    bd->KeyOccurrences.Clear();
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+
+        // Build blob: [commands][vertices][indices]
+        int cmd_count = 0;
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+            if (cmd_list->CmdBuffer[cmd_i].UserCallback == NULL || cmd_list->CmdBuffer[cmd_i].UserCallback == ImDrawCallback_ResetRenderState)
+                cmd_count++;
+        const int cmds_size = cmd_count * (int)sizeof(ImGui_ImplRemote_CmdRecord);
+        const int vtx_size = cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
+        const int idx_size = cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
+        bd->Blob.resize(cmds_size + vtx_size + idx_size);
+        unsigned char* blob_cmds = bd->Blob.Data;
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL && pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                continue;
+            ImGui_ImplRemote_CmdRecord record;
+            record.TexId = (ImU64)(intptr_t)pcmd->TextureId;
+            record.ClipRect[0] = pcmd->ClipRect.x;
+            record.ClipRect[1] = pcmd->ClipRect.y;
+            record.ClipRect[2] = pcmd->ClipRect.z;
+            record.ClipRect[3] = pcmd->ClipRect.w;
+            record.VtxOffset = pcmd->VtxOffset;
+            record.IdxOffset = pcmd->IdxOffset;
+            record.ElemCount = pcmd->ElemCount;
+            record.Flags = (pcmd->UserCallback == ImDrawCallback_ResetRenderState) ? ImGui_ImplRemote_CmdFlags_ResetRenderState : 0;
+            memcpy(blob_cmds, &record, sizeof(record));
+            blob_cmds += sizeof(record);
+        }
+        if (vtx_size > 0)
+            memcpy(bd->Blob.Data + cmds_size, cmd_list->VtxBuffer.Data, (size_t)vtx_size);
+        if (idx_size > 0)
+            memcpy(bd->Blob.Data + cmds_size + vtx_size, cmd_list->IdxBuffer.Data, (size_t)idx_size);
+
+        // Match with the previous frame by owner window name (+ occurrence count, in case of duplicates)
+        const ImGuiID name_hash = ImHashStr(cmd_list->_OwnerName ? cmd_list->_OwnerName : "");
+        int* occurrences = bd->KeyOccurrences.GetIntRef(name_hash, 0);
+        const ImGuiID key = ImHashData(occurrences, sizeof(int), name_hash);
+        (*occurrences)++;
+        int slot_idx = bd->SlotsMap.GetInt(key, 0) - 1;
+        ImU32 flags = ImGui_ImplRemote_DrawListFlags_Delta;
+        if (slot_idx < 0)
+        {
+            ImGui_ImplRemote_DrawListSlot* new_slot = IM_NEW(ImGui_ImplRemote_DrawListSlot)();
+            new_slot->Key = key;
+            slot_idx = bd->Slots.Size;
+            bd->Slots.push_back(new_slot);
+            bd->SlotsMap.SetInt(key, slot_idx + 1);
+            flags = 0;
+        }
+        ImGui_ImplRemote_DrawListSlot* slot = bd->Slots[slot_idx];
+        slot->LastFrame = bd->FrameIndex;
+
+        // Encode
+        const int record_offset = bd->SendBuffer.Size;
+        ImGui_ImplRemote_DrawListRecord record = { key, flags, (ImU32)cmd_count, (ImU32)cmd_list->VtxBuffer.Size, (ImU32)cmd_list->IdxBuffer.Size, 0, { cmd_list->VtxOrigin.x, cmd_list->VtxOrigin.y } };
+        ImGui_ImplRemote_AppendBytes(bd->SendBuffer, &record, sizeof(record));
+        const int encoded_start = bd->SendBuffer.Size;
+        ImGui_ImplRemote_EncodeDelta(bd->Blob.Data, bd->Blob.Size, slot->Blob.Data, slot->Blob.Size, bd->SendBuffer);
+        record.EncodedSize = (ImU32)(bd->SendBuffer.Size - encoded_start);
+        memcpy(bd->SendBuffer.Data + record_offset, &record, sizeof(record));
+        slot->Blob.swap(bd->Blob);  // Becomes the delta base, previous base is recycled as scratch
+        raw_size += (int)sizeof(record) + slot->Blob.Size;
+    }
+
+    // Forget delta bases of draw lists gone for a while (the viewer applies the same rule)
+    int slots_alive = 0;
+    for (int n = 0; n < bd->Slots.Size; n++)
+    {
+        if (bd->FrameIndex - bd->Slots[n]->LastFrame > IMGUI_IMPL_REMOTE_SLOT_MAX_AGE)
+            IM_DELETE(bd->Slots[n]);
+        else
+            bd->Slots[slots_alive++] = bd->Slots[n];
+    }
+    if (slots_alive < bd->Slots.Size)
+    {
+        bd->Slots.resize(slots_alive);
+        bd->SlotsMap.Clear();
+        for (int n = 0; n < bd->Slots.Size; n++)
+            bd->SlotsMap.SetInt(bd->Slots[n]->Key, n + 1);
+    }
+
+    const int frame_size = ImGui_ImplRemote_EndMessage(bd->SendBuffer, header_offset);
+    bd->FrameIndex++;
+    bd->Stats.FramesSent++;
+    bd->Stats.BytesSent += frame_size;
+    bd->Stats.FrameBytesSent += frame_size;
+    bd->Stats.FrameBytesRaw += raw_size;
+    bd->Stats.LastFrameBytes = frame_size;
+    bd->Stats.LastFrameBytesRaw = raw_size;
+    bd->Stats.LastEncodeTime = (float)(ImTimeGetMicroseconds() - encode_start_time) / 1000.0f;
+    ImGui_ImplRemote_Flush();
+}
+
+void ImGui_ImplRemote_Flush()
+{
+    ImGui_ImplRemote_Data* bd = ImGui_ImplRemote_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplRemote_Init()?");
+    if (bd->ViewerSocket != IMGUI_IMPL_REMOTE_INVALID_SOCKET && !ImGui_ImplRemote_SendPending(bd->ViewerSocket, bd->SendBuffer, &bd->SendOffset))
+        ImGui_ImplRemote_DisconnectViewer(bd);
+}
+
+bool ImGui_ImplRemote_IsViewerConnected()
+{
+    ImGui_ImplRemote_Data* bd = ImGui_ImplRemote_GetBackendData();
+    return bd && bd->ViewerSocket != IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+}
+
+int ImGui_ImplRemote_GetPort()
+{
+    ImGui_ImplRemote_Data* bd = ImGui_ImplRemote_GetBackendData();
+    return bd ? bd->Port : 0;
+}
+
+void ImGui_ImplRemote_AddTexture(ImTextureID tex_id, int width, int height, const unsigned char* pixels_rgba32)
+{
+    ImGui_ImplRemote_Data* bd = ImGui_ImplRemote_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplRemote_Init()?");
+    ImGui_ImplRemote_TextureDesc tex = { tex_id, width, height, pixels_rgba32 };
+    bd->Textures.push_back(tex);
+    if (bd->ViewerSocket != IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+        ImGui_ImplRemote_QueueTexture(bd, tex);
+}
+
+const ImGui_ImplRemote_Stats* ImGui_ImplRemote_GetStats()
+{
+    ImGui_ImplRemote_Data* bd = ImGui_ImplRemote_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplRemote_Init()?");
+    return &bd->Stats;
+}
+
+//-----------------------------------------------------------------------------
+// Viewer side
+//-----------------------------------------------------------------------------
+
+struct ImGui_ImplRemoteViewer_DrawListSlot
+{
+    ImGuiID                 Key;
+    ImU32                   LastFrame;
+    ImVector<unsigned char> Blob;
+    ImDrawList*             DrawList;
+};
+
+struct ImGui_ImplRemoteViewer_TextureMapping
+{
+    ImU64                   RemoteTexId;
+    ImTextureID             LocalTexId;
+};
+
+struct ImGui_ImplRemoteViewer
+{
+    ImGui_ImplRemote_Socket                             Socket;
+    ImVector<unsigned char>                             SendBuffer;
+    int                                                 SendOffset;
+    ImVector<unsigned char>                             RecvBuffer;
+    bool                                                HelloReceived;
+    ImGui_ImplRemoteViewer_CreateTextureFunc            CreateTexture;
+    void*                                               CreateTextureUserData;
+    ImVector<ImGui_ImplRemoteViewer_TextureMapping>     Textures;
+    ImVector<ImGui_ImplRemoteViewer_DrawListSlot*>      Slots;
+    ImGuiStorage                                        SlotsMap;       // Key -> index in Slots[] + 1
+    ImVector<ImDrawList*>                               DrawLists;      // Draw lists of the last decoded frame, pointing into Slots[]
+    ImDrawData                                          DrawData;
+    bool                                                HasFrame;
+    ImU64                                               LastEchoedInputTimestamp;
+    ImGui_ImplRemoteViewer_Stats                        Stats;
+
+    ImGui_ImplRemoteViewer()
+    {
+        Socket = IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+        SendOffset = 0;
+        HelloReceived = false;
+        CreateTexture = NULL;
+        CreateTextureUserData = NULL;
+        HasFrame = false;
+        LastEchoedInputTimestamp = 0;
+        memset((void*)&Stats, 0, sizeof(Stats));
+    }
+};
+
+static ImTextureID ImGui_ImplRemoteViewer_FindTexture(ImGui_ImplRemoteViewer* viewer, ImU64 remote_tex_id)
+{
+    for (int n = 0; n < viewer->Textures.Size; n++)
+        if (viewer->Textures[n].RemoteTexId == remote_tex_id)
+            return viewer->Textures[n].LocalTexId;
+    return (ImTextureID)0;
+}
+
+static ImGui_ImplRemoteViewer_DrawListSlot* ImGui_ImplRemoteViewer_GetSlot(ImGui_ImplRemoteViewer* viewer, ImGuiID key)
+{
+    const int slot_idx = viewer->SlotsMap.GetInt(key, 0) - 1;
+    if (slot_idx >= 0)
+        return viewer->Slots[slot_idx];
+    ImGui_ImplRemoteViewer_DrawListSlot* slot = IM_NEW(ImGui_ImplRemoteViewer_DrawListSlot)();
+    slot->Key = key;
+    slot->LastFrame = 0;
+    slot->DrawList = IM_NEW(ImDrawList)(NULL);
+    viewer->SlotsMap.SetInt(key, viewer->Slots.Size + 1);
+    viewer->Slots.push_back(slot);
+    return slot;
+}
+
+static bool ImGui_ImplRemoteViewer_DecodeFrame(ImGui_ImplRemoteViewer* viewer, const unsigned char* payload, ImU32 payload_size)
+{
+    const unsigned char* p = payload;
+    const unsigned char* p_end = payload + payload_size;
+    ImGui_ImplRemote_FrameRecord frame;
+    if ((size_t)(p_end - p) < sizeof(frame))
+        return false;
+    memcpy(&frame, p, sizeof(frame));
+    p += sizeof(frame);
+
+    // Everything below comes from the network: sizes are checked in 64-bit against IMGUI_IMPL_REMOTE_MAX_FRAME_SIZE,
+    // and commands against the vertex/index counts, before anything reaches the renderer. Until then there is no frame.
+    viewer->HasFrame = false;
+    viewer->DrawLists.resize(0);
+    int total_vtx_count = 0, total_idx_count = 0, raw_size = (int)(sizeof(ImGui_ImplRemote_MessageHeader) + sizeof(frame));
+    ImU64 frame_size = 0;
+    for (ImU32 list_n = 0; list_n < frame.DrawListsCount; list_n++)
+    {
+        ImGui_ImplRemote_DrawListRecord record;
+        if ((size_t)(p_end - p) < sizeof(record))
+            return false;
+        memcpy(&record, p, sizeof(record));
+        p += sizeof(record);
+        if (record.EncodedSize > (ImU32)(p_end - p))
+            return false;
+
+        ImGui_ImplRemoteViewer_DrawListSlot* slot = ImGui_ImplRemoteViewer_GetSlot(viewer, record.Key);
+        slot->LastFrame = frame.FrameIndex;
+        if ((record.Flags & ImGui_ImplRemote_DrawListFlags_Delta) == 0)
+            slot->Blob.resize(0);
+        const ImU64 cmds_size64 = (ImU64)record.CmdCount * sizeof(ImGui_ImplRemote_CmdRecord);
+        const ImU64 vtx_size64 = (ImU64)record.VtxCount * sizeof(ImDrawVert);
+        const ImU64 idx_size64 = (ImU64)record.IdxCount * sizeof(ImDrawIdx);
+        frame_size += cmds_size64 + vtx_size64 + idx_size64;
+        if (frame_size > IMGUI_IMPL_REMOTE_MAX_FRAME_SIZE)
+            return false;
+        const int cmds_size = (int)cmds_size64;
+        const int vtx_size = (int)vtx_size64;
+        const int idx_size = (int)idx_size64;
+        if (!ImGui_ImplRemote_DecodeDelta(p, (int)record.EncodedSize, slot->Blob, cmds_size + vtx_size + idx_size))
+            return false;
+        p += record.EncodedSize;
+        raw_size += (int)sizeof(record) + slot->Blob.Size;
+
+        // Rebuild draw list
+        ImDrawList* draw_list = slot->DrawList;
+        draw_list->VtxOrigin = ImVec2(record.VtxOrigin[0], record.VtxOrigin[1]);
+        draw_list->VtxBuffer.resize((int)record.VtxCount);
+        draw_list->IdxBuffer.resize((int)record.IdxCount);
+        if (vtx_size > 0)
+            memcpy(draw_list->VtxBuffer.Data, slot->Blob.Data + cmds_size, (size_t)vtx_size);
+        if (idx_size > 0)
+            memcpy(draw_list->IdxBuffer.Data, slot->Blob.Data + cmds_size + vtx_size, (size_t)idx_size);
+        draw_list->CmdBuffer.resize((int)record.CmdCount);
+        for (ImU32 cmd_n = 0; cmd_n < record.CmdCount; cmd_n++)
+        {
+            ImGui_ImplRemote_CmdRecord cmd_record;
+            memcpy(&cmd_record, slot->Blob.Data + cmd_n * sizeof(cmd_record), sizeof(cmd_record));
+
+            // Reject commands reading outside of the buffers, including through their indices
+            if ((ImU64)cmd_record.IdxOffset + cmd_record.ElemCount > record.IdxCount || cmd_record.VtxOffset > record.VtxCount)
+                return false;
+            if (cmd_record.ElemCount > 0)
+            {
+                if (cmd_record.VtxOffset >= record.VtxCount)
+                    return false;
+                const ImU32 vtx_available = record.VtxCount - cmd_record.VtxOffset;
+                const ImDrawIdx* idx_end = draw_list->IdxBuffer.Data + cmd_record.IdxOffset + cmd_record.ElemCount;
+                for (const ImDrawIdx* idx = draw_list->IdxBuffer.Data + cmd_record.IdxOffset; idx < idx_end; idx++)
+                    if ((ImU32)*idx >= vtx_available)
+                        return false;
+            }
+
+            ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_n];
+            memset((void*)pcmd, 0, sizeof(*pcmd));
+            pcmd->ClipRect = ImVec4(cmd_record.ClipRect[0], cmd_record.ClipRect[1], cmd_record.ClipRect[2], cmd_record.ClipRect[3]);
+            pcmd->TextureId = ImGui_ImplRemoteViewer_FindTexture(viewer, cmd_record.TexId);
+            pcmd->VtxOffset = cmd_record.VtxOffset;
+            pcmd->IdxOffset = cmd_record.IdxOffset;
+            pcmd->ElemCount = cmd_record.ElemCount;
+            if (cmd_record.Flags & ImGui_ImplRemote_CmdFlags_ResetRenderState)
+                pcmd->UserCallback = ImDrawCallback_ResetRenderState;
+        }
+        viewer->DrawLists.push_back(draw_list);
+        total_vtx_count += (int)record.VtxCount;
+        total_idx_count += (int)record.IdxCount;
+    }
+    if (p != p_end)
+        return false;
+
+    // Same rule as the application side: forget delta bases unused for a while
+    int slots_alive = 0;
+    for (int n = 0; n < viewer->Slots.Size; n++)
+    {
+        ImGui_ImplRemoteViewer_DrawListSlot* slot = viewer->Slots[n];
+        if (frame.FrameIndex - slot->LastFrame > IMGUI_IMPL_REMOTE_SLOT_MAX_AGE)
+        {
+            IM_DELETE(slot->DrawList);
+            IM_DELETE(slot);
+        }
+        else
+            viewer->Slots[slots_alive++] = slot;
+    }
+    if (slots_alive < viewer->Slots.Size)
+    {
+        viewer->Slots.resize(slots_alive);
+        viewer->SlotsMap.Clear();
+        for (int n = 0; n < viewer->Slots.Size; n++)
+            viewer->SlotsMap.SetInt(viewer->Slots[n]->Key, n + 1);
+    }
+
+    ImDrawData* draw_data = &viewer->DrawData;
+    draw_data->Valid = true;
+    draw_data->CmdLists = viewer->DrawLists.Data;
+    draw_data->CmdListsCount = viewer->DrawLists.Size;
+    draw_data->TotalVtxCount = total_vtx_count;
+    draw_data->TotalIdxCount = total_idx_count;
+    draw_data->DisplayPos = ImVec2(frame.DisplayPos[0], frame.DisplayPos[1]);
+    draw_data->DisplaySize = ImVec2(frame.DisplaySize[0], frame.DisplaySize[1]);
+    draw_data->FramebufferScale = ImVec2(frame.FramebufferScale[0], frame.FramebufferScale[1]);
+    draw_data->OwnerViewport = NULL;
+    viewer->HasFrame = true;
+
+    // Latency: first frame which processed a new input snapshot
+    if (frame.InputTimestamp != 0 && frame.InputTimestamp != viewer->LastEchoedInputTimestamp)
+    {
+        viewer->LastEchoedInputTimestamp = frame.InputTimestamp;
+        const float latency = (float)(ImTimeGetMicroseconds() - frame.InputTimestamp) / 1000.0f;
+        viewer->Stats.LastLatency = latency;
+        viewer->Stats.MaxLatency = ImMax(viewer->Stats.MaxLatency, latency);
+        viewer->Stats.TotalLatency += latency;
+        viewer->Stats.LatencySamples++;
+    }
+    viewer->Stats.FramesReceived++;
+    viewer->Stats.FrameBytesReceived += sizeof(ImGui_ImplRemote_MessageHeader) + payload_size;
+    viewer->Stats.FrameBytesRaw += raw_size;
+    viewer->Stats.LastFrameBytes = (int)(sizeof(ImGui_ImplRemote_MessageHeader) + payload_size);
+    viewer->Stats.LastFrameBytesRaw = raw_size;
+    return true;
+}
+
+ImGui_ImplRemoteViewer* ImGui_ImplRemoteViewer_Connect(const char* host, int port, ImGui_ImplRemoteViewer_CreateTextureFunc create_texture, void* user_data)
+{
+    if (!ImGui_ImplRemote_SocketsInit())
+        return NULL;
+    char port_str[16];
+    snprintf(port_str, sizeof(port_str), "%d", port);
+    addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+    addrinfo* addresses = NULL;
+    if (::getaddrinfo(host, port_str, &hints, &addresses) != 0)
+    {
+        ImGui_ImplRemote_SocketsShutdown();
+        return NULL;
+    }
+    ImGui_ImplRemote_Socket s = IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+    for (addrinfo* addr = addresses; addr != NULL && s == IMGUI_IMPL_REMOTE_INVALID_SOCKET; addr = addr->ai_next)
+    {
+        s = ::socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
+        if (s != IMGUI_IMPL_REMOTE_INVALID_SOCKET && ::connect(s, addr->ai_addr, (int)addr->ai_addrlen) != 0)
+            ImGui_ImplRemote_CloseSocket(&s);
+    }
+    ::freeaddrinfo(addresses);
+    if (s == IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+    {
+        ImGui_ImplRemote_SocketsShutdown();
+        return NULL;
+    }
+    ImGui_ImplRemote_SetupSocket(s);
+
+    ImGui_ImplRemoteViewer* viewer = IM_NEW(ImGui_ImplRemoteViewer)();
+    viewer->Socket = s;
+    viewer->CreateTexture = create_texture;
+    viewer->CreateTextureUserData = user_data;
+    return viewer;
+}
+
+void ImGui_ImplRemoteViewer_Disconnect(ImGui_ImplRemoteViewer* viewer)
+{
+    ImGui_ImplRemote_CloseSocket(&viewer->Socket);
+    for (int n = 0; n < viewer->Slots.Size; n++)
+    {
+        IM_DELETE(viewer->Slots[n]->DrawList);
+        IM_DELETE(viewer->Slots[n]);
+    }
+    IM_DELETE(viewer);
+    ImGui_ImplRemote_SocketsShutdown();
+}
+
+bool ImGui_ImplRemoteViewer_IsConnected(ImGui_ImplRemoteViewer* viewer)
+{
+    return viewer->Socket != IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+}
+
+void ImGui_ImplRemoteViewer_SendInput(ImGui_ImplRemoteViewer* viewer, const ImGuiIO& io)
+{
+    if (viewer->Socket == IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+        return;
+    ImGui_ImplRemote_InputRecord input;
+    memset(&input, 0, sizeof(input));
+    input.Timestamp = ImTimeGetMicroseconds();
+    input.DisplaySize[0] = io.DisplaySize.x;
+    input.DisplaySize[1] = io.DisplaySize.y;
+    input.FramebufferScale[0] = io.DisplayFramebufferScale.x;
+    input.FramebufferScale[1] = io.DisplayFramebufferScale.y;
+    input.MousePos[0] = io.MousePos.x;
+    input.MousePos[1] = io.MousePos.y;
+    input.MouseWheel[0] = io.MouseWheelH;
+    input.MouseWheel[1] = io.MouseWheel;
+    for (int button = 0; button < IM_ARRAYSIZE(io.MouseDown); button++)
+        if (io.MouseDown[button])
+            input.MouseDown |= 1u << button;
+    input.ModFlags = (io.KeyCtrl ? ImGui_ImplRemote_ModFlags_Ctrl : 0) | (io.KeyShift ? ImGui_ImplRemote_ModFlags_Shift : 0) | (io.KeyAlt ? ImGui_ImplRemote_ModFlags_Alt : 0) | (io.KeySuper ? ImGui_ImplRemote_ModFlags_Super : 0);
+    for (int key = 0; key < ImGuiKey_COUNT; key++)
+    {
+        const int key_index = io.KeyMap[key];
+        if (key_index >= 0 && key_index < IM_ARRAYSIZE(io.KeysDown) && io.KeysDown[key_index])
+            input.KeysDown[key >> 5] |= 1u << (key & 31);
+    }
+    input.CharsCount = (ImU32)io.InputQueueCharacters.Size;
+
+    const int header_offset = ImGui_ImplRemote_BeginMessage(viewer->SendBuffer, ImGui_ImplRemote_MessageType_Input);
+    ImGui_ImplRemote_AppendBytes(viewer->SendBuffer, &input, sizeof(input));
+    for (int n = 0; n < io.InputQueueCharacters.Size; n++)
+    {
+        const ImU32 c = io.InputQueueCharacters[n];
+        ImGui_ImplRemote_AppendBytes(viewer->SendBuffer, &c, sizeof(c));
+    }
+    ImGui_ImplRemote_EndMessage(viewer->SendBuffer, header_offset);
+    if (!ImGui_ImplRemote_SendPending(viewer->Socket, viewer->SendBuffer, &viewer->SendOffset))
+        ImGui_ImplRemote_CloseSocket(&viewer->Socket);
+}
+
+bool ImGui_ImplRemoteViewer_Update(ImGui_ImplRemoteViewer* viewer)
+{
+    if (viewer->Socket == IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+        return false;
+    if (!ImGui_ImplRemote_SendPending(viewer->Socket, viewer->SendBuffer, &viewer->SendOffset))
+    {
+        ImGui_ImplRemote_CloseSocket(&viewer->Socket);
+        return false;
+    }
+    const int received_before = viewer->RecvBuffer.Size;
+    const bool connected = ImGui_ImplRemote_ReceiveAvailable(viewer->Socket, viewer->RecvBuffer);
+    viewer->Stats.BytesReceived += viewer->RecvBuffer.Size - received_before;
+
+    bool new_frame = false;
+    bool protocol_error = false;
+    int offset = 0;
+    ImGui_ImplRemote_MessageHeader header;
+    while (!protocol_error)
+    {
+        const unsigned char* payload = ImGui_ImplRemote_NextMessage(viewer->RecvBuffer, &offset, &header);
+        if (payload == NULL)
+            break;
+        if (header.Type == ImGui_ImplRemote_MessageType_Hello)
+        {
+            ImGui_ImplRemote_HelloRecord hello;
+            protocol_error = header.Size < sizeof(hello);
+            if (!protocol_error)
+            {
+                memcpy(&hello, payload, sizeof(hello));
+                protocol_error = hello.Version != IMGUI_IMPL_REMOTE_PROTOCOL_VERSION || hello.SizeOfDrawVert != sizeof(ImDrawVert) || hello.SizeOfDrawIdx != sizeof(ImDrawIdx) || hello.ByteOrderMark != 0x01020304;
+            }
+            viewer->HelloReceived = true;
+        }
+        else if (!viewer->HelloReceived)
+        {
+            protocol_error = true;
+        }
+        else if (header.Type == ImGui_ImplRemote_MessageType_Texture)
+        {
+            ImGui_ImplRemote_TextureRecord record;
+            protocol_error = header.Size < sizeof(record);
+            if (!protocol_error)
+            {
+                memcpy(&record, payload, sizeof(record));
+                protocol_error = header.Size != sizeof(record) + (ImU64)record.Width * record.Height * 4;
+            }
+            if (!protocol_error)
+            {
+                ImGui_ImplRemoteViewer_TextureMapping mapping;
+                mapping.RemoteTexId = record.TexId;
+                mapping.LocalTexId = viewer->CreateTexture ? viewer->CreateTexture((int)record.Width, (int)record.Height, payload + sizeof(record), viewer->CreateTextureUserData) : (ImTextureID)(intptr_t)record.TexId;
+                viewer->Textures.push_back(mapping);
+            }
+        }
+        else if (header.Type == ImGui_ImplRemote_MessageType_Frame)
+        {
+            protocol_error = !ImGui_ImplRemoteViewer_DecodeFrame(viewer, payload, header.Size);
+            new_frame |= !protocol_error;
+        }
+    }
+    ImGui_ImplRemote_ConsumeBytes(viewer->RecvBuffer, offset);
+    if (!connected || protocol_error)
+        ImGui_ImplRemote_CloseSocket(&viewer->Socket);
+    return new_frame;
+}
+
+ImDrawData* ImGui_ImplRemoteViewer_GetDrawData(ImGui_ImplRemoteViewer* viewer)
+{
+    return viewer->HasFrame ? &viewer->DrawData : NULL;
+}
+
+const ImGui_ImplRemoteViewer_Stats* ImGui_ImplRemoteViewer_GetStats(ImGui_ImplRemoteViewer* viewer)
+{
+    return &viewer->Stats;
+}
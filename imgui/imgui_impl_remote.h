@@ -0,0 +1,76 @@
+// dear imgui: Remote Platform + Renderer Backends (UI streaming over TCP)
+// The application side (e.g. a headless render node) uses this as its platform + renderer backend: every frame's ImDrawData is
+// serialized, delta-encoded against the previous frame and sent to a viewer. The viewer side decodes the stream back into ImDrawData
+// (to be rendered with any renderer backend, e.g. ImGui_ImplOpenGL3_RenderDrawData()) and sends its inputs back.
+
+// Implemented features:
+//  [X] Platform: Display size, mouse, keyboard and text inputs are received from the viewer. Keyboard arrays are indexed using ImGuiKey_XXX values.
+//  [X] Renderer: Draw lists are delta-encoded against the previous frame (per draw list, matched by owner window) then run-length compressed.
+//  [X] Renderer: Font atlas and user textures registered with ImGui_ImplRemote_AddTexture() are sent to the viewer when it connects.
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Back-pressure: frames are dropped (not queued) while the viewer hasn't received the previous one.
+//  [X] Bandwidth per frame and input-to-display latency statistics.
+// Issues:
+//  [ ] Renderer: User callbacks (other than ImDrawCallback_ResetRenderState) are not sent.
+//  [ ] Platform/Renderer: Multi-viewport support.
+//  [ ] Both sides must be built with the same ImDrawVert/ImDrawIdx layout and endianness (checked on connection).
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+
+// Statistics of the application side
+struct ImGui_ImplRemote_Stats
+{
+    int     FramesSent;
+    int     FramesDropped;          // Frames not sent because the viewer was still receiving a previous one
+    ImU64   BytesSent;              // All messages, including textures
+    ImU64   FrameBytesSent;         // Frame messages only
+    ImU64   FrameBytesRaw;          // Size the frame messages would have without delta encoding/compression
+    int     LastFrameBytes;
+    int     LastFrameBytesRaw;
+    float   LastEncodeTime;         // In milliseconds
+};
+
+// Statistics of the viewer side
+struct ImGui_ImplRemoteViewer_Stats
+{
+    int     FramesReceived;
+    ImU64   BytesReceived;
+    ImU64   FrameBytesReceived;
+    ImU64   FrameBytesRaw;
+    int     LastFrameBytes;
+    int     LastFrameBytesRaw;
+    float   LastLatency;            // In milliseconds: time from sending an input snapshot to receiving the first frame that processed it
+    float   MaxLatency;
+    double  TotalLatency;           // Sum of all latency samples, in milliseconds
+    int     LatencySamples;
+};
+
+// Application side (Platform + Renderer Backend API)
+// - bind_address: "127.0.0.1" to only accept local viewers, "0.0.0.0" to accept viewers from other machines. port: 0 to pick any free port.
+IMGUI_IMPL_API bool     ImGui_ImplRemote_Init(const char* bind_address, int port, const ImVec2& default_display_size = ImVec2(1280.0f, 720.0f));
+IMGUI_IMPL_API void     ImGui_ImplRemote_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplRemote_NewFrame();                                // Accept a viewer, apply its inputs and display size
+IMGUI_IMPL_API void     ImGui_ImplRemote_RenderDrawData(ImDrawData* draw_data);     // Encode and send the frame (dropped while the previous one is being sent)
+IMGUI_IMPL_API void     ImGui_ImplRemote_Flush();                                   // Send pending bytes (called by NewFrame() and RenderDrawData())
+IMGUI_IMPL_API bool     ImGui_ImplRemote_IsViewerConnected();
+IMGUI_IMPL_API int      ImGui_ImplRemote_GetPort();                                 // Listening port, useful when Init() was given port 0
+IMGUI_IMPL_API void     ImGui_ImplRemote_AddTexture(ImTextureID tex_id, int width, int height, const unsigned char* pixels_rgba32);  // Pixels must stay valid until Shutdown()
+IMGUI_IMPL_API const ImGui_ImplRemote_Stats* ImGui_ImplRemote_GetStats();
+
+// Viewer side
+// - The viewer doesn't need (nor use) a Dear ImGui context for decoding, but typically has its own to run a platform/renderer backend.
+// - create_texture is called for every texture received, and returns the ImTextureID to use in the decoded ImDrawData.
+struct ImGui_ImplRemoteViewer;
+typedef ImTextureID (*ImGui_ImplRemoteViewer_CreateTextureFunc)(int width, int height, const unsigned char* pixels_rgba32, void* user_data);
+IMGUI_IMPL_API ImGui_ImplRemoteViewer*  ImGui_ImplRemoteViewer_Connect(const char* host, int port, ImGui_ImplRemoteViewer_CreateTextureFunc create_texture, void* user_data);  // Return NULL on failure
+IMGUI_IMPL_API void                     ImGui_ImplRemoteViewer_Disconnect(ImGui_ImplRemoteViewer* viewer);
+IMGUI_IMPL_API bool                     ImGui_ImplRemoteViewer_IsConnected(ImGui_ImplRemoteViewer* viewer);
+IMGUI_IMPL_API void                     ImGui_ImplRemoteViewer_SendInput(ImGui_ImplRemoteViewer* viewer, const ImGuiIO& io);   // Snapshot of display size and inputs, call after ImGui::NewFrame() on the viewer
+IMGUI_IMPL_API bool                     ImGui_ImplRemoteViewer_Update(ImGui_ImplRemoteViewer* viewer);  // Receive and decode pending messages. Return true when a new frame was decoded.
+IMGUI_IMPL_API ImDrawData*              ImGui_ImplRemoteViewer_GetDrawData(ImGui_ImplRemoteViewer* viewer);  // Latest decoded frame, NULL before the first one
+IMGUI_IMPL_API const ImGui_ImplRemoteViewer_Stats* ImGui_ImplRemoteViewer_GetStats(ImGui_ImplRemoteViewer* viewer);
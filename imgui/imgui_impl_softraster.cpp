@@ -0,0 +1,543 @@
+// dear imgui: Renderer Backend for CPU software rasterization
+// This needs to be used along with a Platform Backend (e.g. GLFW, or imgui_impl_null for headless usage)
+// Renders ImDrawData into a user provided RGBA32 framebuffer, without any GPU or graphics API.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Textured/colored triangles, clip rectangles, alpha blending identical to the OpenGL3 backend blend state.
+//  [X] Renderer: Framebuffer split in horizontal bands rasterized by a pool of worker threads.
+//  [X] Renderer: Compact 12-bytes vertices (IMGUI_USE_COMPACT_DRAWVERT in imconfig.h).
+// Issues:
+//  [ ] Renderer: Texture sampling is nearest-neighbor (Dear ImGui output is pixel aligned so this only matters for scaled user textures).
+//  [ ] Renderer: Multi-viewport support.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+// Overview:
+// - RenderDrawData() first bins every triangle into the horizontal bands it overlaps (after clipping its bounding box
+//   with the command clip rectangle). User callbacks are called during this pass, on the calling thread.
+// - Bands are then rasterized in parallel: each band processes its triangles in submission order, so blending order is preserved.
+// - Triangles are scan-converted row by row with a top-left style fill convention (pixel centers, left/top inclusive),
+//   so the two triangles of a quad never touch the same pixel twice. Colors and UVs are interpolated with plane equations.
+// - Pixel math is done on 4 lanes (RGBA) at once, using SSE2 when available. Opaque solid spans (the vast majority of
+//   Dear ImGui pixels: frames, backgrounds, buttons) are written directly without blending.
+
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include <string.h>     // memset
+#include <float.h>      // FLT_MAX
+#include <math.h>       // ceilf
+#if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
+#include <stddef.h>     // intptr_t
+#else
+#include <stdint.h>     // intptr_t
+#endif
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Enable SSE2 intrinsics if available (same condition as imgui_internal.h)
+#if (defined __SSE__ || defined __x86_64__ || defined _M_X64) && !defined(IMGUI_DISABLE_SSE)
+#define IMGUI_IMPL_SOFTRASTER_SSE
+#include <emmintrin.h>
+#endif
+
+// Height of a band of rows processed by one worker at a time
+#define IMGUI_IMPL_SOFTRASTER_BAND_HEIGHT   32
+
+template<typename T> static inline T ImSoftMin(T lhs, T rhs) { return lhs < rhs ? lhs : rhs; }
+template<typename T> static inline T ImSoftMax(T lhs, T rhs) { return lhs >= rhs ? lhs : rhs; }
+
+//-----------------------------------------------------------------------------
+// 4 lanes float vector, holding one RGBA pixel
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_IMPL_SOFTRASTER_SSE
+typedef __m128 ImSoftVec4;
+static inline ImSoftVec4    ImSoftVec4_Set(float x, float y, float z, float w)      { return _mm_setr_ps(x, y, z, w); }
+static inline ImSoftVec4    ImSoftVec4_Splat(float v)                               { return _mm_set1_ps(v); }
+static inline ImSoftVec4    ImSoftVec4_Add(ImSoftVec4 a, ImSoftVec4 b)              { return _mm_add_ps(a, b); }
+static inline ImSoftVec4    ImSoftVec4_Sub(ImSoftVec4 a, ImSoftVec4 b)              { return _mm_sub_ps(a, b); }
+static inline ImSoftVec4    ImSoftVec4_Mul(ImSoftVec4 a, ImSoftVec4 b)              { return _mm_mul_ps(a, b); }
+static inline float         ImSoftVec4_GetW(ImSoftVec4 a)                           { return _mm_cvtss_f32(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3))); }
+static inline ImSoftVec4    ImSoftVec4_Unpack(ImU32 c)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v = _mm_cvtsi32_si128((int)c);
+    v = _mm_unpacklo_epi8(v, zero);
+    v = _mm_unpacklo_epi16(v, zero);
+    return _mm_cvtepi32_ps(v);
+}
+static inline ImU32         ImSoftVec4_Pack(ImSoftVec4 v)   // Round to nearest and saturate to [0,255]
+{
+    __m128i i = _mm_cvtps_epi32(v);
+    i = _mm_packs_epi32(i, i);
+    i = _mm_packus_epi16(i, i);
+    return (ImU32)_mm_cvtsi128_si32(i);
+}
+#else
+struct ImSoftVec4 { float x, y, z, w; };
+static inline ImSoftVec4    ImSoftVec4_Set(float x, float y, float z, float w)      { ImSoftVec4 r = { x, y, z, w }; return r; }
+static inline ImSoftVec4    ImSoftVec4_Splat(float v)                               { ImSoftVec4 r = { v, v, v, v }; return r; }
+static inline ImSoftVec4    ImSoftVec4_Add(ImSoftVec4 a, ImSoftVec4 b)              { ImSoftVec4 r = { a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w }; return r; }
+static inline ImSoftVec4    ImSoftVec4_Sub(ImSoftVec4 a, ImSoftVec4 b)              { ImSoftVec4 r = { a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w }; return r; }
+static inline ImSoftVec4    ImSoftVec4_Mul(ImSoftVec4 a, ImSoftVec4 b)              { ImSoftVec4 r = { a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w }; return r; }
+static inline float         ImSoftVec4_GetW(ImSoftVec4 a)                           { return a.w; }
+static inline ImSoftVec4    ImSoftVec4_Unpack(ImU32 c)                              { return ImSoftVec4_Set((float)(c & 0xFF), (float)((c >> 8) & 0xFF), (float)((c >> 16) & 0xFF), (float)(c >> 24)); }
+static inline ImU32         ImSoftVec4_PackChannel(float v)                         { int i = (int)(v + 0.5f); return (ImU32)(i < 0 ? 0 : i > 255 ? 255 : i); }
+static inline ImU32         ImSoftVec4_Pack(ImSoftVec4 v)                           { return ImSoftVec4_PackChannel(v.x) | (ImSoftVec4_PackChannel(v.y) << 8) | (ImSoftVec4_PackChannel(v.z) << 16) | (ImSoftVec4_PackChannel(v.w) << 24); }
+#endif
+
+// Blend 'src' (0..255 per channel, not premultiplied) over 'dst', matching the OpenGL3 backend state:
+// glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA)
+static inline ImU32 ImGui_ImplSoftRaster_Blend(ImSoftVec4 src, ImU32 dst)
+{
+    const float src_a = ImSoftVec4_GetW(src) * (1.0f / 255.0f);
+    const ImSoftVec4 src_factor = ImSoftVec4_Set(src_a, src_a, src_a, 1.0f);
+    const ImSoftVec4 dst_factor = ImSoftVec4_Splat(1.0f - src_a);
+    return ImSoftVec4_Pack(ImSoftVec4_Add(ImSoftVec4_Mul(src, src_factor), ImSoftVec4_Mul(ImSoftVec4_Unpack(dst), dst_factor)));
+}
+
+//-----------------------------------------------------------------------------
+// Backend data
+//-----------------------------------------------------------------------------
+
+// One draw command, pre-processed for rasterization
+struct ImGui_ImplSoftRaster_Cmd
+{
+    const ImDrawList*                       DrawList;       // Owner list, decodes vertex positions/UV (see ImDrawList::GetVtxPos())
+    const ImDrawVert*                       VtxBuffer;      // Already offset by VtxOffset
+    const ImDrawIdx*                        IdxBuffer;      // Already offset by IdxOffset
+    const ImGui_ImplSoftRaster_Texture*     Texture;        // NULL: sample opaque white
+    int                                     ClipX0, ClipY0, ClipX1, ClipY1; // In framebuffer pixels, already clamped to framebuffer
+};
+
+// One triangle binned into a band
+struct ImGui_ImplSoftRaster_TriRef
+{
+    int             CmdIdx;
+    unsigned int    FirstIdx;
+};
+
+struct ImGui_ImplSoftRaster_Data
+{
+    ImGui_ImplSoftRaster_Texture                    FontTexture;
+    ImU64                                           TrianglesRasterized;
+
+    // Current frame
+    ImVec2                                          DisplayPos;
+    ImVec2                                          FramebufferScale;
+    ImGui_ImplSoftRaster_Framebuffer                Framebuffer;
+    ImVector<ImGui_ImplSoftRaster_Cmd>              Cmds;
+    ImVector<ImVector<ImGui_ImplSoftRaster_TriRef> > Bands;
+    int                                             BandsCount;
+
+    // Worker threads (the calling thread also processes bands)
+    std::thread*                                    Workers;
+    int                                             WorkersCount;
+    std::mutex                                      Mutex;
+    std::condition_variable                         WakeCond;
+    std::condition_variable                         DoneCond;
+    int                                             JobGeneration;
+    int                                             WorkersBusy;
+    bool                                            WorkersQuit;
+    std::atomic<int>                                NextBand;
+
+    ImGui_ImplSoftRaster_Data() : NextBand(0)
+    {
+        memset((void*)&FontTexture, 0, sizeof(FontTexture));
+        memset((void*)&Framebuffer, 0, sizeof(Framebuffer));
+        TrianglesRasterized = 0;
+        BandsCount = 0;
+        Workers = NULL;
+        WorkersCount = JobGeneration = WorkersBusy = 0;
+        WorkersQuit = false;
+    }
+};
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+// Worker threads only access this structure and the draw data, never the Dear ImGui context.
+static ImGui_ImplSoftRaster_Data* ImGui_ImplSoftRaster_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplSoftRaster_Data*)ImGui::GetIO().BackendRendererUserData : NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Rasterization
+//-----------------------------------------------------------------------------
+
+static inline ImU32 ImGui_ImplSoftRaster_SampleNearest(const ImGui_ImplSoftRaster_Texture* tex, float u, float v)
+{
+    int x = (int)(u * tex->Width);
+    int y = (int)(v * tex->Height);
+    x = (x < 0) ? 0 : (x >= tex->Width) ? tex->Width - 1 : x;
+    y = (y < 0) ? 0 : (y >= tex->Height) ? tex->Height - 1 : y;
+    return tex->Pixels[y * tex->Width + x];
+}
+
+// Rasterize one triangle, restricted to rows [band_y0, band_y1) and to the command clip rectangle.
+static void ImGui_ImplSoftRaster_RasterTriangle(ImGui_ImplSoftRaster_Data* bd, const ImGui_ImplSoftRaster_Cmd& cmd, unsigned int first_idx, int band_y0, int band_y1)
+{
+    const ImDrawVert* v[3] = { &cmd.VtxBuffer[cmd.IdxBuffer[first_idx]], &cmd.VtxBuffer[cmd.IdxBuffer[first_idx + 1]], &cmd.VtxBuffer[cmd.IdxBuffer[first_idx + 2]] };
+    ImVec2 p[3], uv[3];
+    for (int n = 0; n < 3; n++)
+    {
+        const ImVec2 pos = cmd.DrawList->GetVtxPos(*v[n]);
+        p[n] = ImVec2((pos.x - bd->DisplayPos.x) * bd->FramebufferScale.x, (pos.y - bd->DisplayPos.y) * bd->FramebufferScale.y);
+        uv[n] = cmd.DrawList->GetVtxUV(*v[n]);
+    }
+
+    // Orient counter-clockwise (in y-down space: positive area) so inside == all edge functions >= 0
+    float area = (p[1].x - p[0].x) * (p[2].y - p[0].y) - (p[1].y - p[0].y) * (p[2].x - p[0].x);
+    if (area == 0.0f)
+        return;
+    if (area < 0.0f)
+    {
+        const ImDrawVert* tmp_v = v[1]; v[1] = v[2]; v[2] = tmp_v;
+        ImVec2 tmp_p = p[1]; p[1] = p[2]; p[2] = tmp_p;
+        ImVec2 tmp_uv = uv[1]; uv[1] = uv[2]; uv[2] = tmp_uv;
+        area = -area;
+    }
+
+    // Rows covered: pixel centers within [min_y, max_y), clipped
+    const float min_y = ImSoftMin(p[0].y, ImSoftMin(p[1].y, p[2].y));
+    const float max_y = ImSoftMax(p[0].y, ImSoftMax(p[1].y, p[2].y));
+    int y0 = (int)ceilf(min_y - 0.5f);
+    int y1 = (int)ceilf(max_y - 0.5f);
+    y0 = ImSoftMax(y0, ImSoftMax(band_y0, cmd.ClipY0));
+    y1 = ImSoftMin(y1, ImSoftMin(band_y1, cmd.ClipY1));
+    if (y0 >= y1)
+        return;
+
+    // Plane equations for interpolated attributes: a(x,y) = a0 + dadx * (x - p0.x) + dady * (y - p0.y)
+    const float inv_area = 1.0f / area;
+    const float e1x = p[1].x - p[0].x, e1y = p[1].y - p[0].y;
+    const float e2x = p[2].x - p[0].x, e2y = p[2].y - p[0].y;
+    const bool col_is_constant = (v[0]->col == v[1]->col && v[0]->col == v[2]->col);
+    const bool uv_is_constant = (uv[0].x == uv[1].x && uv[0].x == uv[2].x && uv[0].y == uv[1].y && uv[0].y == uv[2].y);
+
+    const ImSoftVec4 c0 = ImSoftVec4_Unpack(v[0]->col);
+    const ImSoftVec4 c1 = ImSoftVec4_Unpack(v[1]->col);
+    const ImSoftVec4 c2 = ImSoftVec4_Unpack(v[2]->col);
+    const ImSoftVec4 dc1 = ImSoftVec4_Sub(c1, c0);
+    const ImSoftVec4 dc2 = ImSoftVec4_Sub(c2, c0);
+    const ImSoftVec4 col_dx = ImSoftVec4_Mul(ImSoftVec4_Sub(ImSoftVec4_Mul(dc1, ImSoftVec4_Splat(e2y)), ImSoftVec4_Mul(dc2, ImSoftVec4_Splat(e1y))), ImSoftVec4_Splat(inv_area));
+    const ImSoftVec4 col_dy = ImSoftVec4_Mul(ImSoftVec4_Sub(ImSoftVec4_Mul(dc2, ImSoftVec4_Splat(e1x)), ImSoftVec4_Mul(dc1, ImSoftVec4_Splat(e2x))), ImSoftVec4_Splat(inv_area));
+    const float du1 = uv[1].x - uv[0].x, du2 = uv[2].x - uv[0].x;
+    const float dv1 = uv[1].y - uv[0].y, dv2 = uv[2].y - uv[0].y;
+    const float u_dx = (du1 * e2y - du2 * e1y) * inv_area, u_dy = (du2 * e1x - du1 * e2x) * inv_area;
+    const float v_dx = (dv1 * e2y - dv2 * e1y) * inv_area, v_dy = (dv2 * e1x - dv1 * e2x) * inv_area;
+
+    // Constant source color (solid fill, the most common case): resolve texture and color once
+    const ImGui_ImplSoftRaster_Texture* tex = cmd.Texture;
+    const float inv_255 = 1.0f / 255.0f;
+    ImSoftVec4 src_constant = ImSoftVec4_Splat(0.0f);
+    ImU32 src_constant_packed = 0;
+    bool src_constant_opaque = false;
+    if (col_is_constant && uv_is_constant)
+    {
+        const ImU32 texel = tex ? ImGui_ImplSoftRaster_SampleNearest(tex, uv[0].x, uv[0].y) : 0xFFFFFFFF;
+        src_constant = ImSoftVec4_Mul(ImSoftVec4_Mul(c0, ImSoftVec4_Unpack(texel)), ImSoftVec4_Splat(inv_255));
+        src_constant_packed = ImSoftVec4_Pack(src_constant);
+        src_constant_opaque = (src_constant_packed >> 24) == 0xFF;
+        if ((src_constant_packed >> 24) == 0)
+            return;
+    }
+
+    // Edges (0->1, 1->2, 2->0). Inside when A*x + B(y) >= 0, with A = -(pb.y - pa.y) and B(y) = (pb.x - pa.x) * (y - pa.y) + (pb.y - pa.y) * pa.x
+    const ImGui_ImplSoftRaster_Framebuffer& fb = bd->Framebuffer;
+    const int clip_x0 = cmd.ClipX0, clip_x1 = cmd.ClipX1;
+    for (int y = y0; y < y1; y++)
+    {
+        const float yc = (float)y + 0.5f;
+        float span_x0 = -FLT_MAX, span_x1 = FLT_MAX;
+        bool empty = false;
+        for (int edge_n = 0; edge_n < 3; edge_n++)
+        {
+            const ImVec2& pa = p[edge_n];
+            const ImVec2& pb = p[(edge_n + 1) % 3];
+            const float a = -(pb.y - pa.y);
+            const float b = (pb.x - pa.x) * (yc - pa.y) + (pb.y - pa.y) * pa.x;
+            if (a > 0.0f)
+                span_x0 = ImSoftMax(span_x0, -b / a);
+            else if (a < 0.0f)
+                span_x1 = ImSoftMin(span_x1, -b / a);
+            else if (b < 0.0f)
+                empty = true;
+        }
+        if (empty || span_x0 >= span_x1)
+            continue;
+        const int x0 = ImSoftMax((int)ceilf(span_x0 - 0.5f), clip_x0);
+        const int x1 = ImSoftMin((int)ceilf(span_x1 - 0.5f), clip_x1);
+        if (x0 >= x1)
+            continue;
+
+        ImU32* dst = fb.Pixels + (size_t)y * (size_t)fb.Stride;
+        if (col_is_constant && uv_is_constant)
+        {
+            if (src_constant_opaque)
+                for (int x = x0; x < x1; x++)
+                    dst[x] = src_constant_packed;
+            else
+                for (int x = x0; x < x1; x++)
+                    dst[x] = ImGui_ImplSoftRaster_Blend(src_constant, dst[x]);
+            continue;
+        }
+
+        // Interpolated path: evaluate plane equations at the first pixel center, then step along x
+        const float dx0 = (float)x0 + 0.5f - p[0].x;
+        const float dy0 = yc - p[0].y;
+        ImSoftVec4 col = ImSoftVec4_Add(c0, ImSoftVec4_Add(ImSoftVec4_Mul(col_dx, ImSoftVec4_Splat(dx0)), ImSoftVec4_Mul(col_dy, ImSoftVec4_Splat(dy0))));
+        float u = uv[0].x + u_dx * dx0 + u_dy * dy0;
+        float uv_v = uv[0].y + v_dx * dx0 + v_dy * dy0;
+        for (int x = x0; x < x1; x++)
+        {
+            const ImU32 texel = tex ? ImGui_ImplSoftRaster_SampleNearest(tex, u, uv_v) : 0xFFFFFFFF;
+            const ImSoftVec4 src = ImSoftVec4_Mul(ImSoftVec4_Mul(col, ImSoftVec4_Unpack(texel)), ImSoftVec4_Splat(inv_255));
+            if (ImSoftVec4_GetW(src) >= 254.5f)
+                dst[x] = ImSoftVec4_Pack(src);
+            else if (ImSoftVec4_GetW(src) >= 0.5f)
+                dst[x] = ImGui_ImplSoftRaster_Blend(src, dst[x]);
+            col = ImSoftVec4_Add(col, col_dx);
+            u += u_dx;
+            uv_v += v_dx;
+        }
+    }
+}
+
+static void ImGui_ImplSoftRaster_ProcessBands(ImGui_ImplSoftRaster_Data* bd)
+{
+    for (;;)
+    {
+        const int band_n = bd->NextBand.fetch_add(1);
+        if (band_n >= bd->BandsCount)
+            return;
+        const int band_y0 = band_n * IMGUI_IMPL_SOFTRASTER_BAND_HEIGHT;
+        const int band_y1 = ImSoftMin(band_y0 + IMGUI_IMPL_SOFTRASTER_BAND_HEIGHT, bd->Framebuffer.Height);
+        const ImVector<ImGui_ImplSoftRaster_TriRef>& tris = bd->Bands[band_n];
+        for (int tri_n = 0; tri_n < tris.Size; tri_n++)
+            ImGui_ImplSoftRaster_RasterTriangle(bd, bd->Cmds[tris[tri_n].CmdIdx], tris[tri_n].FirstIdx, band_y0, band_y1);
+    }
+}
+
+static void ImGui_ImplSoftRaster_WorkerThread(ImGui_ImplSoftRaster_Data* bd)
+{
+    int job_generation = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(bd->Mutex);
+            bd->WakeCond.wait(lock, [&]() { return bd->WorkersQuit || bd->JobGeneration != job_generation; });
+            if (bd->WorkersQuit)
+                return;
+            job_generation = bd->JobGeneration;
+        }
+        ImGui_ImplSoftRaster_ProcessBands(bd);
+        {
+            std::unique_lock<std::mutex> lock(bd->Mutex);
+            if (--bd->WorkersBusy == 0)
+                bd->DoneCond.notify_one();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------------
+
+bool ImGui_ImplSoftRaster_Init(int threads_count)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_ASSERT(io.BackendRendererUserData == NULL && "Already initialized a renderer backend!");
+
+    // Setup backend capabilities flags
+    ImGui_ImplSoftRaster_Data* bd = IM_NEW(ImGui_ImplSoftRaster_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_softraster";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+
+    if (threads_count <= 0)
+        threads_count = (int)std::thread::hardware_concurrency();
+    bd->WorkersCount = ImSoftMax(threads_count, 1) - 1;
+    if (bd->WorkersCount > 0)
+    {
+        bd->Workers = (std::thread*)IM_ALLOC(sizeof(std::thread) * bd->WorkersCount);
+        for (int n = 0; n < bd->WorkersCount; n++)
+            IM_PLACEMENT_NEW(&bd->Workers[n]) std::thread(ImGui_ImplSoftRaster_WorkerThread, bd);
+    }
+    return true;
+}
+
+void ImGui_ImplSoftRaster_Shutdown()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != NULL && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    if (bd->Workers)
+    {
+        {
+            std::unique_lock<std::mutex> lock(bd->Mutex);
+            bd->WorkersQuit = true;
+        }
+        bd->WakeCond.notify_all();
+        for (int n = 0; n < bd->WorkersCount; n++)
+        {
+            bd->Workers[n].join();
+            bd->Workers[n].~thread();
+        }
+        IM_FREE(bd->Workers);
+    }
+    ImGui_ImplSoftRaster_DestroyFontsTexture();
+    for (int n = 0; n < bd->Bands.Size; n++)
+        bd->Bands[n].clear();
+    io.BackendRendererName = NULL;
+    io.BackendRendererUserData = NULL;
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplSoftRaster_NewFrame()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplSoftRaster_Init()?");
+    if (bd->FontTexture.Pixels == NULL)
+        ImGui_ImplSoftRaster_CreateFontsTexture();
+}
+
+void ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, const ImGui_ImplSoftRaster_Framebuffer& framebuffer)
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplSoftRaster_Init()?");
+    IM_ASSERT(framebuffer.Pixels != NULL && framebuffer.Stride >= framebuffer.Width);
+    if (framebuffer.Width <= 0 || framebuffer.Height <= 0)
+        return;
+
+    bd->DisplayPos = draw_data->DisplayPos;
+    bd->FramebufferScale = draw_data->FramebufferScale;
+    bd->Framebuffer = framebuffer;
+    bd->BandsCount = (framebuffer.Height + IMGUI_IMPL_SOFTRASTER_BAND_HEIGHT - 1) / IMGUI_IMPL_SOFTRASTER_BAND_HEIGHT;
+    if (bd->Bands.Size < bd->BandsCount)
+    {
+        const int old_size = bd->Bands.Size;
+        bd->Bands.resize(bd->BandsCount);
+        for (int n = old_size; n < bd->Bands.Size; n++)
+            IM_PLACEMENT_NEW(&bd->Bands[n]) ImVector<ImGui_ImplSoftRaster_TriRef>();
+    }
+    for (int n = 0; n < bd->BandsCount; n++)
+        bd->Bands[n].resize(0);
+    bd->Cmds.resize(0);
+
+    // Pass 1: flatten commands, clip, and bin triangles into bands (on this thread, in submission order)
+    const ImVec2 clip_off = draw_data->DisplayPos;
+    const ImVec2 clip_scale = draw_data->FramebufferScale;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                // Note that callbacks are called before any rasterization happens for this frame.
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                    pcmd->UserCallback(cmd_list, pcmd);
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space (same rounding as glScissor() in the OpenGL3 backend)
+            ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                continue;
+            ImGui_ImplSoftRaster_Cmd cmd;
+            cmd.DrawList = cmd_list;
+            cmd.VtxBuffer = cmd_list->VtxBuffer.Data + pcmd->VtxOffset;
+            cmd.IdxBuffer = cmd_list->IdxBuffer.Data + pcmd->IdxOffset;
+            cmd.Texture = (const ImGui_ImplSoftRaster_Texture*)(intptr_t)pcmd->GetTexID();
+            cmd.ClipX0 = ImSoftMax((int)clip_min.x, 0);
+            cmd.ClipY0 = ImSoftMax((int)clip_min.y, 0);
+            cmd.ClipX1 = ImSoftMin((int)clip_min.x + (int)(clip_max.x - clip_min.x), framebuffer.Width);
+            cmd.ClipY1 = ImSoftMin((int)clip_min.y + (int)(clip_max.y - clip_min.y), framebuffer.Height);
+            if (cmd.ClipX0 >= cmd.ClipX1 || cmd.ClipY0 >= cmd.ClipY1)
+                continue;
+            const int cmd_idx = bd->Cmds.Size;
+            bd->Cmds.push_back(cmd);
+
+            for (unsigned int idx = 0; idx + 2 < pcmd->ElemCount; idx += 3)
+            {
+                const float y_a = cmd_list->GetVtxPos(cmd.VtxBuffer[cmd.IdxBuffer[idx]]).y;
+                const float y_b = cmd_list->GetVtxPos(cmd.VtxBuffer[cmd.IdxBuffer[idx + 1]]).y;
+                const float y_c = cmd_list->GetVtxPos(cmd.VtxBuffer[cmd.IdxBuffer[idx + 2]]).y;
+                const float tri_y0 = (ImSoftMin(y_a, ImSoftMin(y_b, y_c)) - clip_off.y) * clip_scale.y;
+                const float tri_y1 = (ImSoftMax(y_a, ImSoftMax(y_b, y_c)) - clip_off.y) * clip_scale.y;
+                const int row0 = ImSoftMax((int)ceilf(tri_y0 - 0.5f), cmd.ClipY0);
+                const int row1 = ImSoftMin((int)ceilf(tri_y1 - 0.5f), cmd.ClipY1);
+                if (row0 >= row1)
+                    continue;
+                ImGui_ImplSoftRaster_TriRef tri = { cmd_idx, idx };
+                for (int band_n = row0 / IMGUI_IMPL_SOFTRASTER_BAND_HEIGHT; band_n <= (row1 - 1) / IMGUI_IMPL_SOFTRASTER_BAND_HEIGHT; band_n++)
+                    bd->Bands[band_n].push_back(tri);
+                bd->TrianglesRasterized++;
+            }
+        }
+    }
+
+    // Pass 2: rasterize bands in parallel
+    bd->NextBand = 0;
+    if (bd->WorkersCount > 0)
+    {
+        {
+            std::unique_lock<std::mutex> lock(bd->Mutex);
+            bd->JobGeneration++;
+            bd->WorkersBusy = bd->WorkersCount;
+        }
+        bd->WakeCond.notify_all();
+    }
+    ImGui_ImplSoftRaster_ProcessBands(bd);
+    if (bd->WorkersCount > 0)
+    {
+        std::unique_lock<std::mutex> lock(bd->Mutex);
+        bd->DoneCond.wait(lock, [&]() { return bd->WorkersBusy == 0; });
+    }
+}
+
+ImU64 ImGui_ImplSoftRaster_GetTrianglesRasterized()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    return bd ? bd->TrianglesRasterized : 0;
+}
+
+bool ImGui_ImplSoftRaster_CreateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+
+    // Build texture atlas. The pixels stay owned by the atlas.
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    bd->FontTexture.Pixels = (const ImU32*)(const void*)pixels;
+    bd->FontTexture.Width = width;
+    bd->FontTexture.Height = height;
+
+    // Store our identifier
+    io.Fonts->SetTexID((ImTextureID)(intptr_t)&bd->FontTexture);
+    return true;
+}
+
+void ImGui_ImplSoftRaster_DestroyFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    if (bd->FontTexture.Pixels)
+    {
+        memset((void*)&bd->FontTexture, 0, sizeof(bd->FontTexture));
+        io.Fonts->SetTexID(0);
+    }
+}
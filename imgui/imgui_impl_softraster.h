@@ -0,0 +1,48 @@
+// dear imgui: Renderer Backend for CPU software rasterization
+// This needs to be used along with a Platform Backend (e.g. GLFW, or imgui_impl_null for headless usage)
+// Renders ImDrawData into a user provided RGBA32 framebuffer, without any GPU or graphics API.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Textured/colored triangles, clip rectangles, alpha blending identical to the OpenGL3 backend blend state.
+//  [X] Renderer: Framebuffer split in horizontal bands rasterized by a pool of worker threads.
+// Issues:
+//  [ ] Renderer: Texture sampling is nearest-neighbor (Dear ImGui output is pixel aligned so this only matters for scaled user textures).
+//  [ ] Renderer: Multi-viewport support.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+
+// Texture as seen by the rasterizer. Pixels are RGBA32 in IM_COL32() layout, not owned by this structure.
+struct ImGui_ImplSoftRaster_Texture
+{
+    const ImU32*    Pixels;
+    int             Width;
+    int             Height;
+};
+
+// Destination framebuffer. Pixels are RGBA32 in IM_COL32() layout. Stride is in pixels.
+// The framebuffer is not cleared by ImGui_ImplSoftRaster_RenderDrawData(): clear it yourself if needed.
+struct ImGui_ImplSoftRaster_Framebuffer
+{
+    ImU32*          Pixels;
+    int             Width;
+    int             Height;
+    int             Stride;
+};
+
+// Backend API
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_Init(int threads_count = 0);     // 0: use all hardware threads. 1: rasterize on the calling thread only.
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, const ImGui_ImplSoftRaster_Framebuffer& framebuffer);
+IMGUI_IMPL_API ImU64    ImGui_ImplSoftRaster_GetTrianglesRasterized();     // Accumulated since Init, for throughput measurements
+
+// (Optional) Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_CreateFontsTexture();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_DestroyFontsTexture();
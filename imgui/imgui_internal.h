@@ -58,6 +58,9 @@ Index of this file:
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
 #endif
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64) && !defined(IMGUI_DISABLE_SSE)
+#define IMGUI_ENABLE_SSE2   // Integer intrinsics: UTF-8 <-> ImWchar conversions, stb_truetype glyph rasterizer (STBTT_SSE2)
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -145,6 +148,8 @@ struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
 struct ImGuiWindow;                 // Storage for one window
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame, in practice we currently keep it for each window)
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
+struct ImGuiWindowSettingsIniText;  // Text written for a window .ini settings entry by the last save
+struct ImGuiSettingsIniWriter;      // Background thread writing .ini files (IMGUI_ENABLE_ASYNC_INI_SAVING)
 
 // Use your programming IDE "Go to definition" facility on the names of the center columns to find the actual flags/enum lists.
 typedef int ImGuiDataAuthority;         // -> enum ImGuiDataAuthority_      // Enum: for storing the source authority (dock node vs window) of a field
@@ -171,8 +176,19 @@ typedef void (*ImGuiErrorLogCallback)(void* user_data, const char* fmt, ...);
 //-----------------------------------------------------------------------------
 
 #ifndef GImGui
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+extern thread_local ImGuiContext* GImGui;   // Current implicit context pointer, one per thread
+#else
 extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
+#endif
+
+// Storage class for the few remaining globals that are written to while building a context or a font atlas
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+#define IM_THREAD_LOCAL     thread_local
+#else
+#define IM_THREAD_LOCAL
+#endif
 
 //-------------------------------------------------------------------------
 // [SECTION] STB libraries includes
@@ -294,6 +310,7 @@ namespace ImStb
 // - Helpers: String, Formatting
 // - Helpers: UTF-8 <> wchar conversions
 // - Helpers: ImVec2/ImVec4 operators
+// - Helpers: Time
 // - Helpers: Maths
 // - Helpers: Geometry
 // - Helper: ImVec1
@@ -304,6 +321,9 @@ namespace ImStb
 // - Helper: ImSpan<>, ImSpanAllocator<>
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
+// - Helper: ImRectGrid
+// - Helper: ImRectPacker
+// - Helper: ImTextLayoutCache
 //-----------------------------------------------------------------------------
 
 // Helpers: Hashing
@@ -341,6 +361,7 @@ IMGUI_API void          ImStrTrimBlanks(char* str);
 IMGUI_API const char*   ImStrSkipBlank(const char* str);
 IMGUI_API int           ImFormatString(char* buf, size_t buf_size, const char* fmt, ...) IM_FMTARGS(3);
 IMGUI_API int           ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args) IM_FMTLIST(3);
+IMGUI_API void          ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end, const char* fmt, va_list args) IM_FMTLIST(3);
 IMGUI_API const char*   ImParseFormatFindStart(const char* format);
 IMGUI_API const char*   ImParseFormatFindEnd(const char* format);
 IMGUI_API const char*   ImParseFormatTrimDecorations(const char* format, char* buf, size_t buf_size);
@@ -402,6 +423,9 @@ IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 coun
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
 
+// Helpers: Time
+IMGUI_API ImU64             ImTimeGetMicroseconds();    // Monotonic high resolution timer, for profiling purpose. Origin is unspecified.
+
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
 // - Wrapper for standard libs functions. (Note that imgui_demo.cpp does _not_ use them to keep the code easy to copy)
@@ -534,6 +558,9 @@ struct IMGUI_API ImRect
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 // Helper: ImBitArray
+typedef ImU32* ImBitArrayPtr; // Name for use in structs
+inline size_t   ImBitArrayGetStorageSizeInBytes(int bitcount)  { return (size_t)((bitcount + 31) >> 5) << 2; }
+inline void     ImBitArrayClearAllBits(ImU32* arr, int bitcount){ memset(arr, 0, ImBitArrayGetStorageSizeInBytes(bitcount)); }
 inline bool     ImBitArrayTestBit(const ImU32* arr, int n)      { ImU32 mask = (ImU32)1 << (n & 31); return (arr[n >> 5] & mask) != 0; }
 inline void     ImBitArrayClearBit(ImU32* arr, int n)           { ImU32 mask = (ImU32)1 << (n & 31); arr[n >> 5] &= ~mask; }
 inline void     ImBitArraySetBit(ImU32* arr, int n)             { ImU32 mask = (ImU32)1 << (n & 31); arr[n >> 5] |= mask; }
@@ -549,6 +576,25 @@ inline void     ImBitArraySetBitRange(ImU32* arr, int n, int n2) // Works on ran
         n = (n + 32) & ~31;
     }
 }
+inline int      ImBitArrayFindNextSetBit(const ImU32* arr, int n, int bitcount) // Return first set bit in [n..bitcount), or bitcount. Skips 32 clear bits at a time.
+{
+    while (n < bitcount)
+    {
+        ImU32 word = arr[n >> 5] >> (n & 31);
+        if (word == 0)
+        {
+            n = (n + 32) & ~31;
+            continue;
+        }
+        while ((word & 1) == 0)
+        {
+            word >>= 1;
+            n++;
+        }
+        return ImMin(n, bitcount);
+    }
+    return bitcount;
+}
 
 // Helper: ImBitArray class (wrapper over ImBitArray functions)
 // Store 1-bit per value.
@@ -688,6 +734,102 @@ struct IMGUI_API ImChunkStream
 
 };
 
+// Helper: ImRectGrid
+// Sparse uniform grid of rectangles, to find which rectangles may contain a point without testing all of them.
+// Each rectangle is linked into every cell it overlaps. Cells are keyed in an ImGuiStorage, and Clear() keeps the keys
+// (typically the same cells are used again on the next frame) so Add() rarely has to insert into it.
+// Rectangles overlapping more than LARGE_RECT_MAX_CELLS cells are stored once in LargeValues, to be tested for every point.
+struct IMGUI_API ImRectGrid
+{
+    struct Entry { int Value; int Next; int Count; }; // Next: index of the next entry in the same cell, -1 for the last one. Count: number of entries from this one to the last one.
+
+    float           CellSize;
+    ImGuiStorage    Cells;                      // Cell key -> index+1 of the first entry of the cell in Entries[] (0: empty)
+    ImVector<Entry> Entries;
+    ImVector<int>   LargeValues;
+
+    ImRectGrid()                { CellSize = 128.0f; }
+    void    Clear();
+    void    Add(const ImRect& r, int value);
+    int     GetFirstEntry(const ImVec2& p) const; // Return index of the first entry of the cell containing 'p', or -1. Follow with Entries[n].Next, Entries[n].Count is the number of entries in the cell.
+    bool    empty() const       { return Entries.Size == 0 && LargeValues.Size == 0; }
+};
+
+// Helper: ImRectPacker
+// Guillotine packer of rectangles into a texture, used by ImFontAtlas::Build() instead of stb_rect_pack's skyline packer when IMGUI_ENABLE_GUILLOTINE_RECT_PACK is defined.
+// A rectangle goes to the top-left corner of the free rectangle with the smallest height it fits in, which is then split along its shorter leftover axis.
+// Free rectangles are linked into one list per height (the last list has all the taller ones), and lists without a free rectangle wide enough are skipped,
+// so that finding one doesn't go through all of them. Rectangles can be added at any time (e.g. to a dynamic atlas): PackRects() sorts them by decreasing
+// height first, which packs tighter than adding them one at a time in any order.
+struct ImRectPackerRect
+{
+    int     W, H;                           // Input: size (0 for an empty rectangle, packed at 0,0)
+    int     X, Y;                           // Output: position
+    bool    WasPacked;                      // Output: false if it didn't fit
+};
+
+struct IMGUI_API ImRectPacker
+{
+    enum { BUCKETS_COUNT = 256 };
+    struct FreeRect { int X, Y, W, H; int Next; }; // Next: index of the next free rectangle of the same list (or of the unused ones), -1 for the last one.
+
+    int                 Width, Height;                  // Canvas size
+    int                 PackedArea;                     // Sum of the areas of the packed rectangles
+    int                 PackedHeight;                   // Bottom of the lowest packed rectangle
+    ImVector<FreeRect>  FreeRects;
+    int                 FreeRectsUnused;                // First unused entry of FreeRects[], -1 for none
+    int                 BucketFirst[BUCKETS_COUNT];     // First free rectangle of each height in FreeRects[] (taller ones in the last bucket), -1 for none
+    int                 BucketMaxWidth[BUCKETS_COUNT];  // No free rectangle of the list is wider (only lowered when a lookup goes through the whole list)
+
+    ImRectPacker()      { Init(0, 0); }
+    void    Init(int width, int height);
+    bool    PackRect(int w, int h, int* out_x, int* out_y);     // Return false if the rectangle doesn't fit anywhere
+    int     PackRects(ImRectPackerRect* rects, int count);      // Return the number of rectangles packed
+    void    AddFreeRect(int x, int y, int w, int h);
+    float   GetEfficiency() const   { return PackedHeight > 0 ? (float)PackedArea / ((float)Width * (float)PackedHeight) : 0.0f; } // Packed area over the area of the canvas used so far
+};
+
+// Helper: ImTextLayoutCache
+// Results of ImFont::CalcTextSizeA() for texts of MIN_TEXT_LEN bytes or more, along with their word-wrap positions, keyed by a hash of the text and of
+// (font, size, max_width, wrap_width). Entries keep a copy of their text, compared on every hit: a 32-bit hash alone would eventually collide. CalcTextSize(), RenderTextWrapped() and RenderTextEllipsis() go through it (see ImGui::GetTextLayout()), so that
+// a long wrapped paragraph is laid out once instead of twice per frame (size, then render), and again only when it changes.
+// When the entries go over the budget, the least recently used ones are evicted, down to 3/4 of the budget. Entries used during the current frame
+// are never evicted (pointers to them stay valid until the next lookup): when they alone go over the budget, new texts are not cached until the next frame.
+struct ImTextLayout
+{
+    ImGuiID         Key;
+    int             TextLen;
+    const ImFont*   Font;
+    float           Size, MaxWidth, WrapWidth;
+    int             LastFrameUsed;
+    ImVec2          TextSize;                   // As returned by ImFont::CalcTextSizeA() (not rounded)
+    int             RemainingOffset;            // 'remaining' of ImFont::CalcTextSizeA(), as an offset from the start of the text
+    ImVector<int>   WrapEols;                   // Successive word-wrap positions as offsets from the start of the text (see ImFontCalcTextSizeEx()), empty when not wrapping
+    ImVector<char>  Text;                       // Copy of the text (TextLen bytes, not zero-terminated)
+
+    ImTextLayout()  { memset(this, 0, sizeof(*this)); }
+};
+
+struct IMGUI_API ImTextLayoutCache
+{
+    enum { MIN_TEXT_LEN = 64 };
+
+    ImVector<ImTextLayout>  Layouts;
+    ImGuiStorage            Map;                // Key -> index+1 in Layouts[]
+    size_t                  Bytes;              // Estimated memory of the entries, compared to the budget
+    const ImFontAtlas*      FontAtlas;          // Atlas of the cached fonts, and its TexBuildCount when they were cached: the cache is cleared when it is built again
+    int                     FontAtlasBuildCount;
+    int                     FrameCount;         // Frame of the last lookup
+    int                     FrameCountTrimmed;  // Frame of the last Trim() when entries used during that frame alone were over the budget
+    int                     FrameHits, FrameMisses; // Lookups during the frame of the last lookup
+
+    ImTextLayoutCache()         { Bytes = 0; FontAtlas = NULL; FontAtlasBuildCount = 0; FrameCount = FrameCountTrimmed = -1; FrameHits = FrameMisses = 0; }
+    ~ImTextLayoutCache()        { Clear(); }
+    void    Clear();
+    const ImTextLayout* GetLayout(const ImFont* font, float size, float max_width, float wrap_width, const char* text, const char* text_end, int frame_count, size_t budget); // Return NULL for texts shorter than MIN_TEXT_LEN, or when over budget
+    void    Trim(size_t max_bytes, int frame_count);        // Evict least recently used entries not used during 'frame_count' until under 'max_bytes'
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -1174,6 +1316,8 @@ struct ImGuiWindowStackData
     ImGuiWindow*            Window;
     ImGuiLastItemData       ParentLastItemDataBackup;
     ImGuiStackSizes         StackSizesOnBegin;      // Store size of various stacks for asserting
+    ImU64                   PerfBeginTime;          // ImTimeGetMicroseconds() at Begin(), when g.DebugMetricsConfig.ShowWindowsPerf is set
+    ImU64                   PerfChildTime;          // Time spent in windows submitted within this Begin()/End() pair, subtracted from our self time
 };
 
 struct ImGuiShrinkWidthItem
@@ -1504,6 +1648,7 @@ struct ImGuiDockContext
     ImGuiStorage                    Nodes;          // Map ID -> ImGuiDockNode*: Active nodes
     ImVector<ImGuiDockRequest>      Requests;
     ImVector<ImGuiDockNodeSettings> NodesSettings;
+    ImGuiStorage                    NodesSettingsById;  // Map ID -> index+1 in NodesSettings
     bool                            WantFullRebuild;
     ImGuiDockContext()              { memset(this, 0, sizeof(*this)); }
 };
@@ -1579,6 +1724,15 @@ struct ImGuiWindowSettings
     char* GetName()             { return (char*)(this + 1); }
 };
 
+// Text written by the last SaveIniSettingsToMemory() for the n-th entry of g.SettingsWindows, along with the values it was written from.
+// Saving copies the text of entries whose values are unchanged instead of formatting it again.
+struct ImGuiWindowSettingsIniText
+{
+    ImGuiWindowSettings Values;
+    int                 TextOffset;     // In g.SettingsWindowsIniText
+    int                 TextLen;
+};
+
 struct ImGuiSettingsHandler
 {
     const char* TypeName;       // Short description stored in .ini file. Disallowed characters: '[' ']'
@@ -1607,6 +1761,9 @@ struct ImGuiMetricsConfig
     bool        ShowDrawCmdMesh;
     bool        ShowDrawCmdBoundingBoxes;
     bool        ShowDockingNodes;
+    bool        ShowWindowsPerf;                // Record per-window CPU time and geometry (adds two timer queries per Begin()/End() pair)
+    bool        DisableSpatialIndex;            // Test every window in FindHoveredWindow() and score every nav candidate (to compare results and timings)
+    bool        ShowDockingRootNodesOnly;
     int         ShowWindowsRectsType;
     int         ShowTablesRectsType;
 
@@ -1619,11 +1776,42 @@ struct ImGuiMetricsConfig
         ShowDrawCmdMesh = true;
         ShowDrawCmdBoundingBoxes = true;
         ShowDockingNodes = false;
+        ShowWindowsPerf = false;
+        DisableSpatialIndex = false;
+        ShowDockingRootNodesOnly = true;
         ShowWindowsRectsType = -1;
         ShowTablesRectsType = -1;
     }
 };
 
+// Rolling per-window history of CPU cost and output geometry, displayed in 'Metrics->Windows Perf'
+// CPU time is "self" time: time spent in child windows/popups submitted between Begin()/End() is attributed to them instead.
+#define IMGUI_WINDOW_PERF_HISTORY_SIZE      120
+
+struct ImGuiWindowPerfStats
+{
+    float       CpuTime[IMGUI_WINDOW_PERF_HISTORY_SIZE];    // Microseconds
+    int         VtxCount[IMGUI_WINDOW_PERF_HISTORY_SIZE];
+    int         IdxCount[IMGUI_WINDOW_PERF_HISTORY_SIZE];
+    int         CmdCount[IMGUI_WINDOW_PERF_HISTORY_SIZE];
+    int         HistoryOffset;                              // Next slot to write to
+    int         HistoryCount;                               // Number of valid slots (<= IMGUI_WINDOW_PERF_HISTORY_SIZE)
+    ImU64       FrameCpuTime;                               // Accumulated during the current frame (sum of all Begin()/End() pairs)
+
+    ImGuiWindowPerfStats()  { memset(this, 0, sizeof(*this)); }
+    void        Clear()     { memset(this, 0, sizeof(*this)); }
+    void        AddSample(float cpu_time, int vtx_count, int idx_count, int cmd_count)
+    {
+        CpuTime[HistoryOffset] = cpu_time;
+        VtxCount[HistoryOffset] = vtx_count;
+        IdxCount[HistoryOffset] = idx_count;
+        CmdCount[HistoryOffset] = cmd_count;
+        HistoryOffset = (HistoryOffset + 1) % IMGUI_WINDOW_PERF_HISTORY_SIZE;
+        if (HistoryCount < IMGUI_WINDOW_PERF_HISTORY_SIZE)
+            HistoryCount++;
+    }
+};
+
 struct ImGuiStackLevelInfo
 {
     ImGuiID                 ID;
@@ -1680,6 +1868,7 @@ struct ImGuiContext
     float                   FontSize;                           // (Shortcut) == FontBaseSize * g.CurrentWindow->FontWindowScale == window->FontSize(). Text height for current window.
     float                   FontBaseSize;                       // (Shortcut) == IO.FontGlobalScale * Font->Scale * Font->FontSize. Base text height.
     ImDrawListSharedData    DrawListSharedData;
+    ImTextLayoutCache       TextLayoutCache;                    // Sizes and word-wrap positions of long texts, see GetTextLayout()
     double                  Time;
     int                     FrameCount;
     int                     FrameCountEnded;
@@ -1700,6 +1889,11 @@ struct ImGuiContext
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
     ImVec2                  WindowsHoverPadding;                // Padding around resizable windows for which hovering on counts as hovering the window == ImMax(style.TouchExtraPadding, WINDOWS_HOVER_PADDING)
+    ImRectGrid              WindowsHitGrid;                     // Windows submitted during the frame, by OuterRectClipped expanded by WindowsHitGridPadding. Used by FindHoveredWindow() in the next frame.
+    ImVector<ImGuiWindow*>  WindowsHitGridWindows;              // Values of WindowsHitGrid
+    ImVec2                  WindowsHitGridPadding;              // Largest hovering padding when WindowsHitGrid was built
+    bool                    WindowsHitGridDirty;                // A window moved after being added to WindowsHitGrid (e.g. TranslateWindow()): FindHoveredWindow() tests all windows.
+    bool                    WindowsDisplayIndexDirty;           // Windows[] order changed since ImGuiWindow::DisplayIndex were updated
     ImGuiWindow*            CurrentWindow;                      // Window being drawn into
     ImGuiWindow*            HoveredWindow;                      // Window the mouse is hovering. Will typically catch mouse inputs.
     ImGuiWindow*            HoveredWindowUnderMovingWindow;     // Hovered window ignoring MovingWindow. Only set if MovingWindow is set.
@@ -1858,6 +2052,7 @@ struct ImGuiContext
     ImPool<ImGuiTable>              Tables;                     // Persistent table data
     ImVector<float>                 TablesLastTimeActive;       // Last used timestamp of each tables (SOA, for efficient GC)
     ImVector<ImDrawChannel>         DrawChannelsTempMergeBuffer;
+    ImVector<ImU32>                 DrawChannelsTempMergeMasks; // Bit arrays of TableMergeDrawChannels(), sized to the number of draw channels
 
     // Tab bars
     ImGuiTabBar*                    CurrentTabBar;
@@ -1906,6 +2101,12 @@ struct ImGuiContext
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImGuiStorage                        SettingsWindowsById;    // Map ID -> offset+1 in SettingsWindows
+    ImGuiStorage                        SettingsTablesById;     // Map ID -> offset+1 in SettingsTables
+    ImVector<ImGuiWindowSettingsIniText> SettingsWindowsIniCache; // Text of each SettingsWindows entry written by the last save (same order)
+    ImGuiTextBuffer                     SettingsWindowsIniText;
+    ImGuiTextBuffer                     SettingsTablesIniText;  // Text of the SettingsTables entries written by the last save (see ImGuiTableSettings::IniTextOffset)
+    ImGuiSettingsIniWriter*             SettingsIniWriter;      // Background .ini writer (IMGUI_ENABLE_ASYNC_INI_SAVING), created by the first SaveIniSettingsToDisk()
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -1955,6 +2156,7 @@ struct ImGuiContext
         TestEngine = NULL;
 
         WindowsActiveCount = 0;
+        WindowsHitGridDirty = WindowsDisplayIndexDirty = true;
         CurrentWindow = NULL;
         HoveredWindow = NULL;
         HoveredWindowUnderMovingWindow = NULL;
@@ -2074,6 +2276,7 @@ struct ImGuiContext
 
         SettingsLoaded = false;
         SettingsDirtyTimer = 0.0f;
+        SettingsIniWriter = NULL;
         HookIdNext = 0;
 
         LogEnabled = false;
@@ -2196,6 +2399,7 @@ struct IMGUI_API ImGuiWindow
     short                   BeginOrderWithinParent;             // Begin() order within immediate parent window, if we are a child window. Otherwise 0.
     short                   BeginOrderWithinContext;            // Begin() order within entire imgui context. This is mostly used for debugging submission order related issues.
     short                   FocusOrder;                         // Order within WindowsFocusOrder[], altered when windows are focused.
+    int                     DisplayIndex;                       // Index in g.Windows[] (display order). Updated on demand by FindHoveredWindow(), see g.WindowsDisplayIndexDirty.
     ImGuiID                 PopupId;                            // ID in the popup stack when this window is used as a popup/menu (because we use generic Name/ID for recycling)
     ImS8                    AutoFitFramesX, AutoFitFramesY;
     ImS8                    AutoFitChildAxises;
@@ -2268,6 +2472,9 @@ struct IMGUI_API ImGuiWindow
     ImGuiItemStatusFlags    DockTabItemStatusFlags;
     ImRect                  DockTabItemRect;
 
+    // Debug
+    ImGuiWindowPerfStats*   PerfStats;                          // Allocated on demand when g.DebugMetricsConfig.ShowWindowsPerf is enabled
+
 public:
     ImGuiWindow(ImGuiContext* context, const char* name);
     ~ImGuiWindow();
@@ -2381,12 +2588,12 @@ struct IMGUI_API ImGuiTabBar
 //-----------------------------------------------------------------------------
 
 #define IM_COL32_DISABLE                IM_COL32(0,0,0,1)   // Special sentinel code which cannot be used as a regular color.
-#define IMGUI_TABLE_MAX_COLUMNS         64                  // sizeof(ImU64) * 8. This is solely because we frequently encode columns set in a ImU64.
-#define IMGUI_TABLE_MAX_DRAW_CHANNELS   (4 + 64 * 2)        // See TableSetupDrawChannels()
+#define IMGUI_TABLE_MAX_COLUMNS         8192                // Columns sets are dynamically sized bit arrays (see ImGuiTable::EnabledMaskByIndex), this is only bound by ImGuiTableColumnIdx.
+#define IMGUI_TABLE_MAX_DRAW_CHANNELS   (4 + IMGUI_TABLE_MAX_COLUMNS * 2) // See TableSetupDrawChannels(). Only visible columns get channels, so actual counts stay small.
 
-// Our current column maximum is 64 but we may raise that in the future.
-typedef ImS8 ImGuiTableColumnIdx;
-typedef ImU8 ImGuiTableDrawChannelIdx;
+// Our current column maximum is 8192 but we may raise that in the future (up to 32767 with 16-bit indices).
+typedef ImS16 ImGuiTableColumnIdx;
+typedef ImU16 ImGuiTableDrawChannelIdx;
 
 // [Internal] sizeof() ~ 104
 // We use the terminology "Enabled" to refer to a column that is not Hidden by user/api.
@@ -2411,7 +2618,9 @@ struct ImGuiTableColumn
     float                   ContentMaxXUnfrozen;
     float                   ContentMaxXHeadersUsed;         // Contents maximum position for headers rows (regardless of freezing). TableHeader() automatically softclip itself + report ideal desired size, to avoid creating extraneous draw calls
     float                   ContentMaxXHeadersIdeal;
-    ImS16                   NameOffset;                     // Offset into parent ColumnsNames[]
+    ImS32                   NameOffset;                     // Offset into parent ColumnsNames[]
+    int                     DrawChannelIdxSize;             // Largest index count of the column's draw channels at the last EndTable(), TableSetupDrawChannels() reserves them to it
+    int                     DrawChannelCmdSize;             // Largest command count of the column's draw channels at the last EndTable()
     ImGuiTableColumnIdx     DisplayOrder;                   // Index within Table's IndexToDisplayOrder[] (column may be reordered by users)
     ImGuiTableColumnIdx     IndexWithinEnabledSet;          // Index within enabled/visible set (<= IndexToDisplayOrder)
     ImGuiTableColumnIdx     PrevEnabledColumn;              // Index of prev enabled/visible column within Columns[], -1 if first enabled/visible column
@@ -2445,7 +2654,7 @@ struct ImGuiTableColumn
         PrevEnabledColumn = NextEnabledColumn = -1;
         SortOrder = -1;
         SortDirection = ImGuiSortDirection_None;
-        DrawChannelCurrent = DrawChannelFrozen = DrawChannelUnfrozen = (ImU8)-1;
+        DrawChannelCurrent = DrawChannelFrozen = DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)-1;
     }
 };
 
@@ -2462,16 +2671,21 @@ struct IMGUI_API ImGuiTable
 {
     ImGuiID                     ID;
     ImGuiTableFlags             Flags;
-    void*                       RawData;                    // Single allocation to hold Columns[], DisplayOrderToIndex[] and RowCellData[]
+    void*                       RawData;                    // Single allocation to hold Columns[], DisplayOrderToIndex[], RowCellData[] and the columns masks
     ImGuiTableTempData*         TempData;                   // Transient data while table is active. Point within g.CurrentTableStack[]
     ImSpan<ImGuiTableColumn>    Columns;                    // Point within RawData[]
     ImSpan<ImGuiTableColumnIdx> DisplayOrderToIndex;        // Point within RawData[]. Store display order of columns (when not reordered, the values are 0...Count-1)
     ImSpan<ImGuiTableCellData>  RowCellData;                // Point within RawData[]. Store cells background requests for current row.
-    ImU64                       EnabledMaskByDisplayOrder;  // Column DisplayOrder -> IsEnabled map
-    ImU64                       EnabledMaskByIndex;         // Column Index -> IsEnabled map (== not hidden by user/api) in a format adequate for iterating column without touching cold data
-    ImU64                       VisibleMaskByIndex;         // Column Index -> IsVisibleX|IsVisibleY map (== not hidden by user/api && not hidden by scrolling/cliprect)
-    ImU64                       RequestOutputMaskByIndex;   // Column Index -> IsVisible || AutoFit (== expect user to submit items)
+    ImBitArrayPtr               EnabledMaskByDisplayOrder;  // Point within RawData[]. Column DisplayOrder -> IsEnabled map
+    ImBitArrayPtr               EnabledMaskByIndex;         // Point within RawData[]. Column Index -> IsEnabled map (== not hidden by user/api) in a format adequate for iterating column without touching cold data
+    ImBitArrayPtr               VisibleMaskByIndex;         // Point within RawData[]. Column Index -> IsVisibleX|IsVisibleY map (== not hidden by user/api && not hidden by scrolling/cliprect)
+    ImBitArrayPtr               RequestOutputMaskByIndex;   // Point within RawData[]. Column Index -> IsVisible || AutoFit (== expect user to submit items)
+    ImBitArrayPtr               VisibleMaskByDisplayOrder;  // Point within RawData[]. Column DisplayOrder -> IsVisibleX map, to iterate visible columns from left to right
+    ImBitArrayPtr               LaidOutMaskByIndex;         // Point within RawData[]. Column Index -> laid out this frame, by TableUpdateLayout() or on demand by TableBeginCell() (see IsLayoutPartial)
+    ImSpan<float>               OffsetsByDisplayOrder;      // Point within RawData[]. ColumnsCount+1 start positions of each display order relative to the first column, kept by virtualized tables
+    ImSpan<ImGuiTableColumnIdx> OutputColumns;              // Point within RawData[]. Index of the columns requesting output this frame, in index order (see TableGetOutputColumnIndex())
     ImGuiTableFlags             SettingsLoadedFlags;        // Which data were loaded from the .ini file (e.g. when order is not altered we won't save order)
+    ImGuiID                     LayoutReuseKey;             // Hash of the table parameters column widths were last calculated with (see IsLayoutReusable)
     int                         SettingsOffset;             // Offset in g.SettingsTables
     int                         LastFrameActive;
     int                         ColumnsCount;               // Number of columns declared in BeginTable()
@@ -2507,6 +2721,7 @@ struct IMGUI_API ImGuiTable
     float                       ResizedColumnNextWidth;
     float                       ResizeLockMinContentsX2;    // Lock minimum contents width while resizing down in order to not create feedback loops. But we allow growing the table.
     float                       RefScale;                   // Reference scale to be able to rescale columns on font/dpi changes.
+    float                       UnfrozenColumnsOffsetX;     // Start position of the columns, used after the frozen ones. OffsetsByDisplayOrder[] are relative to it.
     ImRect                      OuterRect;                  // Note: for non-scrolling table, OuterRect.Max.y is often FLT_MAX until EndTable(), unless a height has been specified in BeginTable().
     ImRect                      InnerRect;                  // InnerRect but without decoration. As with OuterRect, for non-scrolling tables, InnerRect.Max.y is
     ImRect                      WorkRect;
@@ -2516,6 +2731,7 @@ struct IMGUI_API ImGuiTable
     ImRect                      Bg2ClipRectForDrawCmd;      // Actual ImDrawCmd clip rect for BG2 channel. This tends to be a correct, tight-fit, because output to BG2 are done by widgets relying on regular ClipRect.
     ImRect                      HostClipRect;               // This is used to check if we can eventually merge our columns draw calls into the current draw call of the current window.
     ImRect                      HostBackupInnerClipRect;    // Backup of InnerWindow->ClipRect during PushTableBackground()/PopTableBackground()
+    ImRect                      UnfrozenColumnsClipRect;    // Clipping rectangle of the columns after the frozen ones, for columns laid out on demand
     ImGuiWindow*                OuterWindow;                // Parent window for the table
     ImGuiWindow*                InnerWindow;                // Window holding the table data (== OuterWindow or a child window)
     ImGuiTextBuffer             ColumnsNames;               // Contiguous buffer holding columns names
@@ -2526,6 +2742,8 @@ struct IMGUI_API ImGuiTable
     ImGuiTableColumnIdx         SortSpecsCount;
     ImGuiTableColumnIdx         ColumnsEnabledCount;        // Number of enabled columns (<= ColumnsCount)
     ImGuiTableColumnIdx         ColumnsEnabledFixedCount;   // Number of enabled columns (<= ColumnsCount)
+    ImGuiTableColumnIdx         ColumnsVisibleCount;        // Number of visible columns (<= ColumnsEnabledCount), only those get their own draw channels
+    ImGuiTableColumnIdx         ColumnsOutputCount;         // Number of columns requesting output (<= ColumnsCount), see OutputColumns[]
     ImGuiTableColumnIdx         DeclColumnsCount;           // Count calls to TableSetupColumn()
     ImGuiTableColumnIdx         HoveredColumnBody;          // Index of column whose visible region is being hovered. Important: == ColumnsCount when hovering empty region after the right-most column!
     ImGuiTableColumnIdx         HoveredColumnBorder;        // Index of column whose right-border is being hovered (for resizing).
@@ -2561,6 +2779,11 @@ struct IMGUI_API ImGuiTable
     bool                        IsResetDisplayOrderRequest;
     bool                        IsUnfrozenRows;             // Set when we got past the frozen row.
     bool                        IsDefaultSizingPolicy;      // Set if user didn't explicitly set a sizing policy in BeginTable()
+    bool                        IsVirtualized;              // Set on tables with ImGuiTableFlags_ScrollX and at least io.ConfigTablesVirtualizeColumnsMin columns. Positions are derived from OffsetsByDisplayOrder[].
+    bool                        IsLayoutReusable;           // Set when the column widths of a virtualized table don't depend on contents, so they can be kept until something invalidates them.
+    bool                        IsLayoutWidthsReused;       // Set when TableUpdateLayout() kept the column widths of the previous frame.
+    bool                        IsLayoutPartial;            // Set when TableUpdateLayout() only laid out the frozen columns and the columns in view. Other columns are laid out on demand.
+    bool                        IsAnyColumnResizable;       // Set when at least one enabled column can be resized (otherwise ImGuiTableFlags_Resizable is cleared)
     bool                        MemoryCompacted;
     bool                        HostSkipItems;              // Backup of InnerWindow->SkipItem at the end of BeginTable(), because we will overwrite InnerWindow->SkipItem on a per-column basis
 
@@ -2575,6 +2798,7 @@ struct IMGUI_API ImGuiTableTempData
 {
     int                         TableIndex;                 // Index in g.Tables.Buf[] pool
     float                       LastTimeActive;             // Last timestamp this structure was used
+    int                         LastFrameActive;            // Last frame number this structure was used
 
     ImVec2                      UserOuterSize;              // outer_size.x passed to BeginTable()
     ImDrawListSplitter          DrawSplitter;
@@ -2588,7 +2812,7 @@ struct IMGUI_API ImGuiTableTempData
     float                       HostBackupItemWidth;        // Backup of OuterWindow->DC.ItemWidth at the end of BeginTable()
     int                         HostBackupItemWidthStackSize;//Backup of OuterWindow->DC.ItemWidthStack.Size at the end of BeginTable()
 
-    ImGuiTableTempData()        { memset(this, 0, sizeof(*this)); LastTimeActive = -1.0f; }
+    ImGuiTableTempData()        { memset(this, 0, sizeof(*this)); LastTimeActive = -1.0f; LastFrameActive = -1; }
 };
 
 // sizeof() ~ 12
@@ -2624,6 +2848,8 @@ struct ImGuiTableSettings
     ImGuiTableColumnIdx         ColumnsCount;
     ImGuiTableColumnIdx         ColumnsCountMax;        // Maximum number of columns this settings instance can store, we can recycle a settings instance with lower number of columns but not higher
     bool                        WantApply;              // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    int                         IniTextOffset;          // Text written for this entry by the last SaveIniSettingsToMemory(), in g.SettingsTablesIniText
+    int                         IniTextLen;             // 0 when the entry was modified since then (TableSaveSettings(), loading): text will be formatted again
 
     ImGuiTableSettings()        { memset(this, 0, sizeof(*this)); }
     ImGuiTableColumnSettings*   GetColumnSettings()     { return (ImGuiTableColumnSettings*)(this + 1); }
@@ -2931,6 +3157,7 @@ namespace ImGui
     IMGUI_API void          TableBeginRow(ImGuiTable* table);
     IMGUI_API void          TableEndRow(ImGuiTable* table);
     IMGUI_API void          TableBeginCell(ImGuiTable* table, int column_n);
+    IMGUI_API void          TableLayoutColumnOnDemand(ImGuiTable* table, int column_n);
     IMGUI_API void          TableEndCell(ImGuiTable* table);
     IMGUI_API ImRect        TableGetCellBgRect(const ImGuiTable* table, int column_n);
     IMGUI_API const char*   TableGetColumnName(const ImGuiTable* table, int column_n);
@@ -2975,6 +3202,7 @@ namespace ImGui
     IMGUI_API void          RenderTextClipped(const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align = ImVec2(0, 0), const ImRect* clip_rect = NULL);
     IMGUI_API void          RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align = ImVec2(0, 0), const ImRect* clip_rect = NULL);
     IMGUI_API void          RenderTextEllipsis(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, float clip_max_x, float ellipsis_max_x, const char* text, const char* text_end, const ImVec2* text_size_if_known);
+    IMGUI_API const ImTextLayout* GetTextLayout(const ImFont* font, float size, float max_width, float wrap_width, const char* text, const char* text_end); // Cached ImFont::CalcTextSizeA() + word-wrap positions, valid until the next call. NULL for short texts or when io.ConfigTextLayoutCacheBudget is 0.
     IMGUI_API void          RenderFrame(ImVec2 p_min, ImVec2 p_max, ImU32 fill_col, bool border = true, float rounding = 0.0f);
     IMGUI_API void          RenderFrameBorder(ImVec2 p_min, ImVec2 p_max, float rounding = 0.0f);
     IMGUI_API void          RenderColorRectWithAlphaCheckerboard(ImDrawList* draw_list, ImVec2 p_min, ImVec2 p_max, ImU32 fill_col, float grid_step, ImVec2 grid_off, float rounding = 0.0f, ImDrawFlags flags = 0);
@@ -3065,6 +3293,7 @@ namespace ImGui
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API void          GcCompactLeastRecentlyUsed(size_t bytes_to_free);
 
     // Debug Tools
     IMGUI_API void          ErrorCheckEndFrameRecover(ImGuiErrorLogCallback log_callback, void* user_data = NULL);
@@ -3087,6 +3316,7 @@ namespace ImGui
     IMGUI_API void          DebugNodeWindowSettings(ImGuiWindowSettings* settings);
     IMGUI_API void          DebugNodeWindowsList(ImVector<ImGuiWindow*>* windows, const char* label);
     IMGUI_API void          DebugNodeWindowsListByBeginStackParent(ImGuiWindow** windows, int windows_size, ImGuiWindow* parent_in_begin_stack);
+    IMGUI_API void          DebugNodeWindowsPerf();
     IMGUI_API void          DebugNodeViewport(ImGuiViewportP* viewport);
     IMGUI_API void          DebugRenderViewportThumbnail(ImDrawList* draw_list, ImGuiViewportP* viewport, const ImRect& bb);
 
@@ -3108,12 +3338,17 @@ IMGUI_API const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype();
 IMGUI_API void      ImFontAtlasBuildInit(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent);
 IMGUI_API void      ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque);
+IMGUI_API void      ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, ImRectPacker* packer);
 IMGUI_API void      ImFontAtlasBuildFinish(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned int in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
 
+// Helpers for ImTextLayoutCache: ImFont::CalcTextSizeA() also outputting the word-wrap positions, and ImFont::RenderText() taking them instead of computing them
+IMGUI_API ImVec2    ImFontCalcTextSizeEx(const ImFont* font, float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining, ImVector<int>* out_wrap_eols);
+IMGUI_API void      ImFontRenderTextEx(const ImFont* font, ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip, const ImVector<int>* wrap_eols);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
 //-----------------------------------------------------------------------------
@@ -315,7 +315,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         return false;
 
     // Sanity checks
-    IM_ASSERT(columns_count > 0 && columns_count <= IMGUI_TABLE_MAX_COLUMNS && "Only 1..64 columns allowed!");
+    IM_ASSERT(columns_count > 0 && columns_count <= IMGUI_TABLE_MAX_COLUMNS && "Only 1..8192 columns allowed!");
     if (flags & ImGuiTableFlags_ScrollX)
         IM_ASSERT(inner_width >= 0.0f);
 
@@ -472,6 +472,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         g.TablesLastTimeActive.resize(table_idx + 1, -1.0f);
     g.TablesLastTimeActive[table_idx] = (float)g.Time;
     temp_data->LastTimeActive = (float)g.Time;
+    temp_data->LastFrameActive = g.FrameCount;
     table->MemoryCompacted = false;
 
     // Setup memory buffer (clear data if columns count changed)
@@ -540,6 +541,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         //IMGUI_DEBUG_LOG("[table] %08X RefScaleUnit %.3f -> %.3f, scaling width by %.3f\n", table->ID, table->RefScaleUnit, new_ref_scale_unit, scale_factor);
         for (int n = 0; n < columns_count; n++)
             table->Columns[n].WidthRequest = table->Columns[n].WidthRequest * scale_factor;
+        table->IsLayoutReusable = false;
     }
     table->RefScale = new_ref_scale_unit;
 
@@ -571,16 +573,31 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
 void ImGui::TableBeginInitMemory(ImGuiTable* table, int columns_count)
 {
     // Allocate single buffer for our arrays
-    ImSpanAllocator<3> span_allocator;
+    const int columns_bit_array_size = (int)ImBitArrayGetStorageSizeInBytes(columns_count);
+    ImSpanAllocator<11> span_allocator;
     span_allocator.Reserve(0, columns_count * sizeof(ImGuiTableColumn));
     span_allocator.Reserve(1, columns_count * sizeof(ImGuiTableColumnIdx));
     span_allocator.Reserve(2, columns_count * sizeof(ImGuiTableCellData), 4);
+    for (int n = 3; n < 9; n++)
+        span_allocator.Reserve(n, columns_bit_array_size);
+    span_allocator.Reserve(9, (columns_count + 1) * sizeof(float));
+    span_allocator.Reserve(10, columns_count * sizeof(ImGuiTableColumnIdx));
     table->RawData = IM_ALLOC(span_allocator.GetArenaSizeInBytes());
     memset(table->RawData, 0, span_allocator.GetArenaSizeInBytes());
     span_allocator.SetArenaBasePtr(table->RawData);
     span_allocator.GetSpan(0, &table->Columns);
     span_allocator.GetSpan(1, &table->DisplayOrderToIndex);
     span_allocator.GetSpan(2, &table->RowCellData);
+    table->EnabledMaskByDisplayOrder = (ImU32*)span_allocator.GetSpanPtrBegin(3);
+    table->EnabledMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(4);
+    table->VisibleMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(5);
+    table->RequestOutputMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(6);
+    table->VisibleMaskByDisplayOrder = (ImU32*)span_allocator.GetSpanPtrBegin(7);
+    table->LaidOutMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(8);
+    span_allocator.GetSpan(9, &table->OffsetsByDisplayOrder);
+    span_allocator.GetSpan(10, &table->OutputColumns);
+    table->ColumnsVisibleCount = table->ColumnsOutputCount = 0;
+    table->IsLayoutReusable = false;
 }
 
 // Apply queued resizing/reordering/hiding requests
@@ -638,6 +655,7 @@ void ImGui::TableBeginApplyRequests(ImGuiTable* table)
                 table->DisplayOrderToIndex[table->Columns[column_n].DisplayOrder] = (ImGuiTableColumnIdx)column_n;
             table->ReorderColumnDir = 0;
             table->IsSettingsDirty = true;
+            table->IsLayoutReusable = false;
         }
     }
 
@@ -648,6 +666,7 @@ void ImGui::TableBeginApplyRequests(ImGuiTable* table)
             table->DisplayOrderToIndex[n] = table->Columns[n].DisplayOrder = (ImGuiTableColumnIdx)n;
         table->IsResetDisplayOrderRequest = false;
         table->IsSettingsDirty = true;
+        table->IsLayoutReusable = false;
     }
 }
 
@@ -707,22 +726,31 @@ static void TableSetupColumnFlags(ImGuiTable* table, ImGuiTableColumn* column, I
     }
 }
 
-// Layout columns for the frame. This is in essence the followup to BeginTable().
-// Runs on the first call to TableNextRow(), to give a chance for TableSetupColumn() to be called first.
-// FIXME-TABLE: Our width (and therefore our WorkRect) will be minimal in the first frame for _WidthAuto columns.
-// Increase feedback side-effect with widgets relying on WorkRect.Max.x... Maybe provide a default distribution for _WidthAuto columns?
-void ImGui::TableUpdateLayout(ImGuiTable* table)
+// Hash the table parameters which column widths are calculated from, so a virtualized table can keep them over frames (see IsLayoutReusable)
+static ImGuiID TableGetLayoutReuseKey(const ImGuiTable* table)
 {
-    ImGuiContext& g = *GImGui;
-    IM_ASSERT(table->IsLayoutLocked == false);
+    struct { ImGuiTableFlags Flags; int ColumnsCount, DeclColumnsCount, FreezeColumnsRequest; float MinColumnWidth, OuterPaddingX, CellPaddingX, CellSpacingX1, CellSpacingX2; } key;
+    key.Flags = table->Flags;
+    key.ColumnsCount = table->ColumnsCount;
+    key.DeclColumnsCount = table->DeclColumnsCount;
+    key.FreezeColumnsRequest = table->FreezeColumnsRequest;
+    key.MinColumnWidth = table->MinColumnWidth;
+    key.OuterPaddingX = table->OuterPaddingX;
+    key.CellPaddingX = table->CellPaddingX;
+    key.CellSpacingX1 = table->CellSpacingX1;
+    key.CellSpacingX2 = table->CellSpacingX2;
+    return ImHashData(&key, sizeof(key));
+}
 
+// [Part 1..5] of TableUpdateLayout(): lock Enabled and Order states, calculate the width of every column.
+static void TableUpdateLayoutWidths(ImGuiTable* table)
+{
     const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
     table->IsDefaultDisplayOrder = true;
     table->ColumnsEnabledCount = 0;
-    table->EnabledMaskByIndex = 0x00;
-    table->EnabledMaskByDisplayOrder = 0x00;
+    ImBitArrayClearAllBits(table->EnabledMaskByIndex, table->ColumnsCount);
+    ImBitArrayClearAllBits(table->EnabledMaskByDisplayOrder, table->ColumnsCount);
     table->LeftMostEnabledColumn = -1;
-    table->MinColumnWidth = ImMax(1.0f, g.Style.FramePadding.x * 1.0f); // g.Style.ColumnsMinSpacing; // FIXME-TABLE
 
     // [Part 1] Apply/lock Enabled and Order states. Calculate auto/ideal width for columns. Count fixed/stretch columns.
     // Process columns in their visible orders as we are building the Prev/Next indices.
@@ -785,15 +813,15 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         else
             table->LeftMostEnabledColumn = (ImGuiTableColumnIdx)column_n;
         column->IndexWithinEnabledSet = table->ColumnsEnabledCount++;
-        table->EnabledMaskByIndex |= (ImU64)1 << column_n;
-        table->EnabledMaskByDisplayOrder |= (ImU64)1 << column->DisplayOrder;
+        ImBitArraySetBit(table->EnabledMaskByIndex, column_n);
+        ImBitArraySetBit(table->EnabledMaskByDisplayOrder, column->DisplayOrder);
         prev_visible_column_idx = column_n;
         IM_ASSERT(column->IndexWithinEnabledSet <= column->DisplayOrder);
 
         // Calculate ideal/auto column width (that's the width required for all contents to be visible without clipping)
         // Combine width from regular rows + width from headers unless requested not to.
         if (!column->IsPreserveWidthAuto)
-            column->WidthAuto = TableGetColumnWidthAuto(table, column);
+            column->WidthAuto = ImGui::TableGetColumnWidthAuto(table, column);
 
         // Non-resizable columns keep their requested width (apply user value regardless of IsPreserveWidthAuto)
         const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
@@ -830,11 +858,12 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
 
     // [Part 3] Fix column flags and record a few extra information.
     float sum_width_requests = 0.0f;        // Sum of all width for fixed and auto-resize columns, excluding width contributed by Stretch columns but including spacing/padding.
+    bool has_content_sized_column = false;
     float stretch_sum_weights = 0.0f;       // Sum of all weights for stretch columns.
     table->LeftMostStretchedColumn = table->RightMostStretchedColumn = -1;
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
     {
-        if (!(table->EnabledMaskByIndex & ((ImU64)1 << column_n)))
+        if (!ImBitArrayTestBit(table->EnabledMaskByIndex, column_n))
             continue;
         ImGuiTableColumn* column = &table->Columns[column_n];
 
@@ -850,7 +879,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             // Latch initial size for fixed columns and update it constantly for auto-resizing column (unless clipped!)
             if (column->AutoFitQueue != 0x00)
                 column->WidthRequest = width_auto;
-            else if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !column_is_resizable && (table->RequestOutputMaskByIndex & ((ImU64)1 << column_n)))
+            else if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !column_is_resizable && ImBitArrayTestBit(table->RequestOutputMaskByIndex, column_n))
                 column->WidthRequest = width_auto;
 
             // FIXME-TABLE: Increase minimum size during init frame to avoid biasing auto-fitting widgets
@@ -862,6 +891,10 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             if (column->AutoFitQueue > 0x01 && table->IsInitializing && !column->IsPreserveWidthAuto)
                 column->WidthRequest = ImMax(column->WidthRequest, table->MinColumnWidth * 4.0f); // FIXME-TABLE: Another constant/scale?
             sum_width_requests += column->WidthRequest;
+
+            // Fixed non-resizable columns without an explicit width follow their contents
+            if (!column_is_resizable && (column->InitStretchWeightOrWidth <= 0.0f || table_sizing_policy == ImGuiTableFlags_SizingFixedSame))
+                has_content_sized_column = true;
         }
         else
         {
@@ -896,7 +929,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     table->ColumnsGivenWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount;
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
     {
-        if (!(table->EnabledMaskByIndex & ((ImU64)1 << column_n)))
+        if (!ImBitArrayTestBit(table->EnabledMaskByIndex, column_n))
             continue;
         ImGuiTableColumn* column = &table->Columns[column_n];
 
@@ -923,7 +956,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     if (width_remaining_for_stretched_columns >= 1.0f && !(table->Flags & ImGuiTableFlags_PreciseWidths))
         for (int order_n = table->ColumnsCount - 1; stretch_sum_weights > 0.0f && width_remaining_for_stretched_columns >= 1.0f && order_n >= 0; order_n--)
         {
-            if (!(table->EnabledMaskByDisplayOrder & ((ImU64)1 << order_n)))
+            if (!ImBitArrayTestBit(table->EnabledMaskByDisplayOrder, order_n))
                 continue;
             ImGuiTableColumn* column = &table->Columns[table->DisplayOrderToIndex[order_n]];
             if (!(column->Flags & ImGuiTableColumnFlags_WidthStretch))
@@ -933,137 +966,307 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             width_remaining_for_stretched_columns -= 1.0f;
         }
 
+    table->IsAnyColumnResizable = has_resizable;
+
+    // Widths of a virtualized table can be kept over the next frames when they don't depend on contents or on the host size.
+    // TableUpdateLayout() also checks that no auto-fit is still pending after [Part 6].
+    table->IsLayoutReusable = table->IsVirtualized && !table->IsInitializing && !has_auto_fit_request && !has_content_sized_column && table->LeftMostStretchedColumn == -1;
+}
+
+// [Part 6] of TableUpdateLayout(): lock position, width, clipping rectangle and visibility of one column starting at 'offset_x'.
+// Also called for the columns a partial layout didn't reach, see TableLayoutColumnOnDemand().
+static void TableLayoutColumn(ImGuiTable* table, int column_n, float offset_x, const ImRect& host_clip_rect, bool is_hovering_table)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTableColumn* column = &table->Columns[column_n];
+
+    column->NavLayerCurrent = (ImS8)((table->FreezeRowsCount > 0 || column_n < table->FreezeColumnsCount) ? ImGuiNavLayer_Menu : ImGuiNavLayer_Main);
+    ImBitArraySetBit(table->LaidOutMaskByIndex, column_n);
+
+    // Clear status flags
+    column->Flags &= ~ImGuiTableColumnFlags_StatusMask_;
+
+    // Clear visibility masks, keeping whether the column was visible in its previous layout
+    const bool was_visible = ImBitArrayTestBit(table->VisibleMaskByIndex, column_n);
+    ImBitArrayClearBit(table->VisibleMaskByIndex, column_n);
+    ImBitArrayClearBit(table->VisibleMaskByDisplayOrder, column->DisplayOrder);
+    ImBitArrayClearBit(table->RequestOutputMaskByIndex, column_n);
+
+    if (!ImBitArrayTestBit(table->EnabledMaskByIndex, column_n))
+    {
+        // Hidden column: clear a few fields and we are done with it for the remainder of the function.
+        // We set a zero-width clip rect but set Min.y/Max.y properly to not interfere with the clipper.
+        column->MinX = column->MaxX = column->WorkMinX = column->ClipRect.Min.x = column->ClipRect.Max.x = offset_x;
+        column->WidthGiven = 0.0f;
+        column->ClipRect.Min.y = table->WorkRect.Min.y;
+        column->ClipRect.Max.y = FLT_MAX;
+        column->ClipRect.ClipWithFull(host_clip_rect);
+        column->IsVisibleX = column->IsVisibleY = column->IsRequestOutput = false;
+        column->IsSkipItems = true;
+        column->ItemWidth = 1.0f;
+        return;
+    }
+
+    // Detect hovered column
+    // (ClipRect is still the one of the previous layout, only columns visible then have a non-empty one)
+    if (is_hovering_table && was_visible && g.IO.MousePos.x >= column->ClipRect.Min.x && g.IO.MousePos.x < column->ClipRect.Max.x)
+        table->HoveredColumnBody = (ImGuiTableColumnIdx)column_n;
+
+    // Lock start position
+    column->MinX = offset_x;
+
+    // Lock width based on start position and minimum/maximum width for this position
+    float max_width = ImGui::TableGetMaxColumnWidth(table, column_n);
+    column->WidthGiven = ImMin(column->WidthGiven, max_width);
+    column->WidthGiven = ImMax(column->WidthGiven, ImMin(column->WidthRequest, table->MinColumnWidth));
+    column->MaxX = offset_x + column->WidthGiven + table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
+
+    // Lock other positions
+    // - ClipRect.Min.x: Because merging draw commands doesn't compare min boundaries, we make ClipRect.Min.x match left bounds to be consistent regardless of merging.
+    // - ClipRect.Max.x: using WorkMaxX instead of MaxX (aka including padding) makes things more consistent when resizing down, tho slightly detrimental to visibility in very-small column.
+    // - ClipRect.Max.x: using MaxX makes it easier for header to receive hover highlight with no discontinuity and display sorting arrow.
+    // - FIXME-TABLE: We want equal width columns to have equal (ClipRect.Max.x - WorkMinX) width, which means ClipRect.max.x cannot stray off host_clip_rect.Max.x else right-most column may appear shorter.
+    column->WorkMinX = column->MinX + table->CellPaddingX + table->CellSpacingX1;
+    column->WorkMaxX = column->MaxX - table->CellPaddingX - table->CellSpacingX2; // Expected max
+    column->ItemWidth = ImFloor(column->WidthGiven * 0.65f);
+    column->ClipRect.Min.x = column->MinX;
+    column->ClipRect.Min.y = table->WorkRect.Min.y;
+    column->ClipRect.Max.x = column->MaxX; //column->WorkMaxX;
+    column->ClipRect.Max.y = FLT_MAX;
+    column->ClipRect.ClipWithFull(host_clip_rect);
+
+    // Mark column as Clipped (not in sight)
+    // Note that scrolling tables (where inner_window != outer_window) handle Y clipped earlier in BeginTable() so IsVisibleY really only applies to non-scrolling tables.
+    // FIXME-TABLE: Because InnerClipRect.Max.y is conservatively ==outer_window->ClipRect.Max.y, we never can mark columns _Above_ the scroll line as not IsVisibleY.
+    // Taking advantage of LastOuterHeight would yield good results there...
+    // FIXME-TABLE: Y clipping is disabled because it effectively means not submitting will reduce contents width which is fed to outer_window->DC.CursorMaxPos.x,
+    // and this may be used (e.g. typically by outer_window using AlwaysAutoResize or outer_window's horizontal scrollbar, but could be something else).
+    // Possible solution to preserve last known content width for clipped column. Test 'table_reported_size' fails when enabling Y clipping and window is resized small.
+    column->IsVisibleX = (column->ClipRect.Max.x > column->ClipRect.Min.x);
+    column->IsVisibleY = true; // (column->ClipRect.Max.y > column->ClipRect.Min.y);
+    const bool is_visible = column->IsVisibleX; //&& column->IsVisibleY;
+    if (is_visible)
+    {
+        ImBitArraySetBit(table->VisibleMaskByIndex, column_n);
+        ImBitArraySetBit(table->VisibleMaskByDisplayOrder, column->DisplayOrder);
+        table->ColumnsVisibleCount++;
+    }
+
+    // Mark column as requesting output from user. Note that fixed + non-resizable sets are auto-fitting at all times and therefore always request output.
+    column->IsRequestOutput = is_visible || column->AutoFitQueue != 0 || column->CannotSkipItemsQueue != 0;
+    if (column->IsRequestOutput)
+        ImBitArraySetBit(table->RequestOutputMaskByIndex, column_n);
+
+    // Mark column as SkipItems (ignoring all items/layout)
+    column->IsSkipItems = !column->IsEnabled || table->HostSkipItems;
+    if (column->IsSkipItems)
+        IM_ASSERT(!is_visible);
+
+    // Update status flags
+    column->Flags |= ImGuiTableColumnFlags_IsEnabled;
+    if (is_visible)
+        column->Flags |= ImGuiTableColumnFlags_IsVisible;
+    if (column->SortOrder != -1)
+        column->Flags |= ImGuiTableColumnFlags_IsSorted;
+    if (table->HoveredColumnBody == column_n)
+        column->Flags |= ImGuiTableColumnFlags_IsHovered;
+
+    // Alignment
+    // FIXME-TABLE: This align based on the whole column width, not per-cell, and therefore isn't useful in
+    // many cases (to be able to honor this we might be able to store a log of cells width, per row, for
+    // visible rows, but nav/programmatic scroll would have visible artifacts.)
+    //if (column->Flags & ImGuiTableColumnFlags_AlignRight)
+    //    column->WorkMinX = ImMax(column->WorkMinX, column->MaxX - column->ContentWidthRowsUnfrozen);
+    //else if (column->Flags & ImGuiTableColumnFlags_AlignCenter)
+    //    column->WorkMinX = ImLerp(column->WorkMinX, ImMax(column->StartX, column->MaxX - column->ContentWidthRowsUnfrozen), 0.5f);
+
+    // Reset content width variables
+    column->ContentMaxXFrozen = column->ContentMaxXUnfrozen = column->WorkMinX;
+    column->ContentMaxXHeadersUsed = column->ContentMaxXHeadersIdeal = column->WorkMinX;
+
+    // Don't decrement auto-fit counters until container window got a chance to submit its items
+    if (table->HostSkipItems == false)
+    {
+        column->AutoFitQueue >>= 1;
+        column->CannotSkipItemsQueue >>= 1;
+    }
+}
+
+// Return the first n in [n_begin, n_end) for which OffsetsByDisplayOrder[n] > x, or n_end. Offsets never decrease with n.
+static int TableFindOffsetAbove(const ImGuiTable* table, int n_begin, int n_end, float x)
+{
+    while (n_begin < n_end)
+    {
+        const int n_mid = n_begin + ((n_end - n_begin) >> 1);
+        if (table->OffsetsByDisplayOrder[n_mid] > x)
+            n_end = n_mid;
+        else
+            n_begin = n_mid + 1;
+    }
+    return n_begin;
+}
+
+// Lay out a column of a virtualized table from its recorded offset, after the frozen columns.
+static void TableLayoutColumnFromOffset(ImGuiTable* table, int column_n, bool is_hovering_table)
+{
+    const float offset_x = table->UnfrozenColumnsOffsetX + table->OffsetsByDisplayOrder[table->Columns[column_n].DisplayOrder];
+    TableLayoutColumn(table, column_n, offset_x, table->UnfrozenColumnsClipRect, is_hovering_table);
+}
+
+// Layout columns for the frame. This is in essence the followup to BeginTable().
+// Runs on the first call to TableNextRow(), to give a chance for TableSetupColumn() to be called first.
+// FIXME-TABLE: Our width (and therefore our WorkRect) will be minimal in the first frame for _WidthAuto columns.
+// Increase feedback side-effect with widgets relying on WorkRect.Max.x... Maybe provide a default distribution for _WidthAuto columns?
+void ImGui::TableUpdateLayout(ImGuiTable* table)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(table->IsLayoutLocked == false);
+
+    table->MinColumnWidth = ImMax(1.0f, g.Style.FramePadding.x * 1.0f); // g.Style.ColumnsMinSpacing; // FIXME-TABLE
+
+    // [Part 0] Horizontal virtualization: wide scrolling tables only lay out the columns they need (see io.ConfigTablesVirtualizeColumnsMin).
+    // When their widths don't depend on contents, they are kept from the previous frame until something may change them.
+    const ImGuiID layout_reuse_key = TableGetLayoutReuseKey(table);
+    table->IsVirtualized = (table->Flags & ImGuiTableFlags_ScrollX) && g.IO.ConfigTablesVirtualizeColumnsMin > 0 && table->ColumnsCount >= g.IO.ConfigTablesVirtualizeColumnsMin;
+    table->IsLayoutWidthsReused = table->IsVirtualized && table->IsLayoutReusable && table->LayoutReuseKey == layout_reuse_key && table->LastResizedColumn == -1 && table->ResizedColumn == -1;
+    table->LayoutReuseKey = layout_reuse_key;
+    if (table->IsLayoutWidthsReused)
+    {
+        // Only the columns laid out in the previous frame may have received contents: update their ideal width for auto-fit requests.
+        for (int column_n = ImBitArrayFindNextSetBit(table->LaidOutMaskByIndex, 0, table->ColumnsCount); column_n < table->ColumnsCount; column_n = ImBitArrayFindNextSetBit(table->LaidOutMaskByIndex, column_n + 1, table->ColumnsCount))
+            if (table->Columns[column_n].IsEnabled && !table->Columns[column_n].IsPreserveWidthAuto)
+                table->Columns[column_n].WidthAuto = TableGetColumnWidthAuto(table, &table->Columns[column_n]);
+        if ((table->Flags & ImGuiTableFlags_Sortable) && table->SortSpecsCount == 0 && !(table->Flags & ImGuiTableFlags_SortTristate))
+            table->IsSortSpecsDirty = true;
+    }
+    else
+    {
+        TableUpdateLayoutWidths(table);
+    }
+
     table->HoveredColumnBody = -1;
     table->HoveredColumnBorder = -1;
+    const ImRect work_rect = table->WorkRect;
     const ImRect mouse_hit_rect(table->OuterRect.Min.x, table->OuterRect.Min.y, table->OuterRect.Max.x, ImMax(table->OuterRect.Max.y, table->OuterRect.Min.y + table->LastOuterHeight));
     const bool is_hovering_table = ItemHoverable(mouse_hit_rect, 0);
 
     // [Part 6] Setup final position, offset, skip/clip states and clipping rectangles, detect hovered column
     // Process columns in their visible orders as we are comparing the visible order and adjusting host_clip_rect while looping.
     int visible_n = 0;
-    bool offset_x_frozen = (table->FreezeColumnsCount > 0);
-    float offset_x = ((table->FreezeColumnsCount > 0) ? table->OuterRect.Min.x : work_rect.Min.x) + table->OuterPaddingX - table->CellSpacingX1;
     ImRect host_clip_rect = table->InnerClipRect;
     //host_clip_rect.Max.x += table->CellPaddingX + table->CellSpacingX2;
-    table->VisibleMaskByIndex = 0x00;
-    table->RequestOutputMaskByIndex = 0x00;
-    for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
+    table->ColumnsVisibleCount = 0;
+    ImBitArrayClearAllBits(table->LaidOutMaskByIndex, table->ColumnsCount);
+    if (!table->IsVirtualized)
     {
-        const int column_n = table->DisplayOrderToIndex[order_n];
-        ImGuiTableColumn* column = &table->Columns[column_n];
+        bool offset_x_frozen = (table->FreezeColumnsCount > 0);
+        float offset_x = ((table->FreezeColumnsCount > 0) ? table->OuterRect.Min.x : work_rect.Min.x) + table->OuterPaddingX - table->CellSpacingX1;
+        for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
+        {
+            const int column_n = table->DisplayOrderToIndex[order_n];
+            if (offset_x_frozen && table->FreezeColumnsCount == visible_n)
+            {
+                offset_x += work_rect.Min.x - table->OuterRect.Min.x;
+                offset_x_frozen = false;
+            }
+
+            TableLayoutColumn(table, column_n, offset_x, host_clip_rect, is_hovering_table);
+            if (!ImBitArrayTestBit(table->EnabledMaskByDisplayOrder, order_n))
+                continue;
 
-        column->NavLayerCurrent = (ImS8)((table->FreezeRowsCount > 0 || column_n < table->FreezeColumnsCount) ? ImGuiNavLayer_Menu : ImGuiNavLayer_Main);
+            ImGuiTableColumn* column = &table->Columns[column_n];
+            if (visible_n < table->FreezeColumnsCount)
+                host_clip_rect.Min.x = ImClamp(column->MaxX + TABLE_BORDER_SIZE, host_clip_rect.Min.x, host_clip_rect.Max.x);
 
-        if (offset_x_frozen && table->FreezeColumnsCount == visible_n)
-        {
-            offset_x += work_rect.Min.x - table->OuterRect.Min.x;
-            offset_x_frozen = false;
+            offset_x += column->WidthGiven + table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
+            visible_n++;
         }
+        table->IsLayoutPartial = false;
+    }
+    else
+    {
+        // Virtualized tables: same as above, with positions taken relative to the first column and recorded in OffsetsByDisplayOrder[].
+        // - Frozen columns are always laid out, their width may depend on the host size.
+        // - When widths were kept and frozen columns still end at the same offset, the recorded offsets are valid: only lay out the columns
+        //   in view, the first and right-most columns (used by TableNextRow() and EndTable()) and the columns which were visible or requested
+        //   output last frame (so their state is cleared). Other columns keep their last state until TableBeginCell() needs them.
+        table->UnfrozenColumnsOffsetX = work_rect.Min.x + table->OuterPaddingX - table->CellSpacingX1;
+        const float offset_x_start = (table->FreezeColumnsCount > 0) ? table->OuterRect.Min.x + table->OuterPaddingX - table->CellSpacingX1 : table->UnfrozenColumnsOffsetX;
+        float offset_rel = 0.0f;
+        int order_n = 0;
+        for (; order_n < table->ColumnsCount && visible_n < table->FreezeColumnsRequest; order_n++)
+        {
+            const int column_n = table->DisplayOrderToIndex[order_n];
+            ImGuiTableColumn* column = &table->Columns[column_n];
+            if (table->IsLayoutWidthsReused && column->IsEnabled)
+                column->WidthGiven = ImFloor(ImMax(column->WidthRequest, table->MinColumnWidth)); // Same as [Part 4]
+            table->OffsetsByDisplayOrder[order_n] = offset_rel;
 
-        // Clear status flags
-        column->Flags &= ~ImGuiTableColumnFlags_StatusMask_;
+            TableLayoutColumn(table, column_n, offset_x_start + offset_rel, host_clip_rect, is_hovering_table);
+            if (!ImBitArrayTestBit(table->EnabledMaskByDisplayOrder, order_n))
+                continue;
 
-        if ((table->EnabledMaskByDisplayOrder & ((ImU64)1 << order_n)) == 0)
-        {
-            // Hidden column: clear a few fields and we are done with it for the remainder of the function.
-            // We set a zero-width clip rect but set Min.y/Max.y properly to not interfere with the clipper.
-            column->MinX = column->MaxX = column->WorkMinX = column->ClipRect.Min.x = column->ClipRect.Max.x = offset_x;
-            column->WidthGiven = 0.0f;
-            column->ClipRect.Min.y = work_rect.Min.y;
-            column->ClipRect.Max.y = FLT_MAX;
-            column->ClipRect.ClipWithFull(host_clip_rect);
-            column->IsVisibleX = column->IsVisibleY = column->IsRequestOutput = false;
-            column->IsSkipItems = true;
-            column->ItemWidth = 1.0f;
-            continue;
-        }
+            if (column->AutoFitQueue != 0x00 || column->CannotSkipItemsQueue != 0x00)
+                table->IsLayoutReusable = false;
+            if (visible_n < table->FreezeColumnsCount)
+                host_clip_rect.Min.x = ImClamp(column->MaxX + TABLE_BORDER_SIZE, host_clip_rect.Min.x, host_clip_rect.Max.x);
 
-        // Detect hovered column
-        if (is_hovering_table && g.IO.MousePos.x >= column->ClipRect.Min.x && g.IO.MousePos.x < column->ClipRect.Max.x)
-            table->HoveredColumnBody = (ImGuiTableColumnIdx)column_n;
-
-        // Lock start position
-        column->MinX = offset_x;
-
-        // Lock width based on start position and minimum/maximum width for this position
-        float max_width = TableGetMaxColumnWidth(table, column_n);
-        column->WidthGiven = ImMin(column->WidthGiven, max_width);
-        column->WidthGiven = ImMax(column->WidthGiven, ImMin(column->WidthRequest, table->MinColumnWidth));
-        column->MaxX = offset_x + column->WidthGiven + table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
-
-        // Lock other positions
-        // - ClipRect.Min.x: Because merging draw commands doesn't compare min boundaries, we make ClipRect.Min.x match left bounds to be consistent regardless of merging.
-        // - ClipRect.Max.x: using WorkMaxX instead of MaxX (aka including padding) makes things more consistent when resizing down, tho slightly detrimental to visibility in very-small column.
-        // - ClipRect.Max.x: using MaxX makes it easier for header to receive hover highlight with no discontinuity and display sorting arrow.
-        // - FIXME-TABLE: We want equal width columns to have equal (ClipRect.Max.x - WorkMinX) width, which means ClipRect.max.x cannot stray off host_clip_rect.Max.x else right-most column may appear shorter.
-        column->WorkMinX = column->MinX + table->CellPaddingX + table->CellSpacingX1;
-        column->WorkMaxX = column->MaxX - table->CellPaddingX - table->CellSpacingX2; // Expected max
-        column->ItemWidth = ImFloor(column->WidthGiven * 0.65f);
-        column->ClipRect.Min.x = column->MinX;
-        column->ClipRect.Min.y = work_rect.Min.y;
-        column->ClipRect.Max.x = column->MaxX; //column->WorkMaxX;
-        column->ClipRect.Max.y = FLT_MAX;
-        column->ClipRect.ClipWithFull(host_clip_rect);
+            offset_rel += column->WidthGiven + table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
+            visible_n++;
+        }
+        table->UnfrozenColumnsClipRect = host_clip_rect;
+        table->IsLayoutPartial = table->IsLayoutWidthsReused && table->OffsetsByDisplayOrder[order_n] == offset_rel;
 
-        // Mark column as Clipped (not in sight)
-        // Note that scrolling tables (where inner_window != outer_window) handle Y clipped earlier in BeginTable() so IsVisibleY really only applies to non-scrolling tables.
-        // FIXME-TABLE: Because InnerClipRect.Max.y is conservatively ==outer_window->ClipRect.Max.y, we never can mark columns _Above_ the scroll line as not IsVisibleY.
-        // Taking advantage of LastOuterHeight would yield good results there...
-        // FIXME-TABLE: Y clipping is disabled because it effectively means not submitting will reduce contents width which is fed to outer_window->DC.CursorMaxPos.x,
-        // and this may be used (e.g. typically by outer_window using AlwaysAutoResize or outer_window's horizontal scrollbar, but could be something else).
-        // Possible solution to preserve last known content width for clipped column. Test 'table_reported_size' fails when enabling Y clipping and window is resized small.
-        column->IsVisibleX = (column->ClipRect.Max.x > column->ClipRect.Min.x);
-        column->IsVisibleY = true; // (column->ClipRect.Max.y > column->ClipRect.Min.y);
-        const bool is_visible = column->IsVisibleX; //&& column->IsVisibleY;
-        if (is_visible)
-            table->VisibleMaskByIndex |= ((ImU64)1 << column_n);
-
-        // Mark column as requesting output from user. Note that fixed + non-resizable sets are auto-fitting at all times and therefore always request output.
-        column->IsRequestOutput = is_visible || column->AutoFitQueue != 0 || column->CannotSkipItemsQueue != 0;
-        if (column->IsRequestOutput)
-            table->RequestOutputMaskByIndex |= ((ImU64)1 << column_n);
-
-        // Mark column as SkipItems (ignoring all items/layout)
-        column->IsSkipItems = !column->IsEnabled || table->HostSkipItems;
-        if (column->IsSkipItems)
-            IM_ASSERT(!is_visible);
-
-        // Update status flags
-        column->Flags |= ImGuiTableColumnFlags_IsEnabled;
-        if (is_visible)
-            column->Flags |= ImGuiTableColumnFlags_IsVisible;
-        if (column->SortOrder != -1)
-            column->Flags |= ImGuiTableColumnFlags_IsSorted;
-        if (table->HoveredColumnBody == column_n)
-            column->Flags |= ImGuiTableColumnFlags_IsHovered;
-
-        // Alignment
-        // FIXME-TABLE: This align based on the whole column width, not per-cell, and therefore isn't useful in
-        // many cases (to be able to honor this we might be able to store a log of cells width, per row, for
-        // visible rows, but nav/programmatic scroll would have visible artifacts.)
-        //if (column->Flags & ImGuiTableColumnFlags_AlignRight)
-        //    column->WorkMinX = ImMax(column->WorkMinX, column->MaxX - column->ContentWidthRowsUnfrozen);
-        //else if (column->Flags & ImGuiTableColumnFlags_AlignCenter)
-        //    column->WorkMinX = ImLerp(column->WorkMinX, ImMax(column->StartX, column->MaxX - column->ContentWidthRowsUnfrozen), 0.5f);
-
-        // Reset content width variables
-        column->ContentMaxXFrozen = column->ContentMaxXUnfrozen = column->WorkMinX;
-        column->ContentMaxXHeadersUsed = column->ContentMaxXHeadersIdeal = column->WorkMinX;
-
-        // Don't decrement auto-fit counters until container window got a chance to submit its items
-        if (table->HostSkipItems == false)
+        if (!table->IsLayoutPartial)
         {
-            column->AutoFitQueue >>= 1;
-            column->CannotSkipItemsQueue >>= 1;
-        }
+            for (; order_n < table->ColumnsCount; order_n++)
+            {
+                const int column_n = table->DisplayOrderToIndex[order_n];
+                ImGuiTableColumn* column = &table->Columns[column_n];
+                table->OffsetsByDisplayOrder[order_n] = offset_rel;
 
-        if (visible_n < table->FreezeColumnsCount)
-            host_clip_rect.Min.x = ImClamp(column->MaxX + TABLE_BORDER_SIZE, host_clip_rect.Min.x, host_clip_rect.Max.x);
+                TableLayoutColumn(table, column_n, table->UnfrozenColumnsOffsetX + offset_rel, host_clip_rect, is_hovering_table);
+                if (!ImBitArrayTestBit(table->EnabledMaskByDisplayOrder, order_n))
+                    continue;
 
-        offset_x += column->WidthGiven + table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
-        visible_n++;
+                if (column->AutoFitQueue != 0x00 || column->CannotSkipItemsQueue != 0x00)
+                    table->IsLayoutReusable = false;
+                offset_rel += column->WidthGiven + table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
+            }
+            table->OffsetsByDisplayOrder[table->ColumnsCount] = offset_rel;
+        }
+        else
+        {
+            // Find columns overlapping host_clip_rect, with one pixel and one column of margin to be safe from rounding.
+            // Hidden columns have the offset of the next column so they are found along.
+            const float x1 = host_clip_rect.Min.x - table->UnfrozenColumnsOffsetX - 1.0f;
+            const float x2 = host_clip_rect.Max.x - table->UnfrozenColumnsOffsetX + 1.0f;
+            int order_min = TableFindOffsetAbove(table, order_n + 1, table->ColumnsCount + 1, x1) - 1;  // First column ending after x1
+            int order_max = TableFindOffsetAbove(table, order_min, table->ColumnsCount, x2);            // First column starting after x2
+            order_min = ImMax(order_min - 1, order_n);
+            order_max = ImMin(order_max + 1, table->ColumnsCount);
+            for (int order_view_n = order_min; order_view_n < order_max; order_view_n++)
+                TableLayoutColumnFromOffset(table, table->DisplayOrderToIndex[order_view_n], is_hovering_table);
+
+            if (!ImBitArrayTestBit(table->LaidOutMaskByIndex, 0))
+                TableLayoutColumnFromOffset(table, 0, is_hovering_table);
+            if (!ImBitArrayTestBit(table->LaidOutMaskByIndex, table->RightMostEnabledColumn))
+                TableLayoutColumnFromOffset(table, table->RightMostEnabledColumn, is_hovering_table);
+            for (int column_n = 0; column_n < table->ColumnsCount; column_n += 32)
+            {
+                ImU32 pending_mask = (table->VisibleMaskByIndex[column_n >> 5] | table->RequestOutputMaskByIndex[column_n >> 5]) & ~table->LaidOutMaskByIndex[column_n >> 5];
+                for (int bit_n = 0; pending_mask != 0; bit_n++, pending_mask >>= 1)
+                    if (pending_mask & 1)
+                        TableLayoutColumnFromOffset(table, column_n + bit_n, is_hovering_table);
+            }
+        }
     }
 
+    // List columns requesting output, for TableGetOutputColumnIndex() and TableHeadersRow()
+    table->ColumnsOutputCount = 0;
+    for (int column_n = ImBitArrayFindNextSetBit(table->RequestOutputMaskByIndex, 0, table->ColumnsCount); column_n < table->ColumnsCount; column_n = ImBitArrayFindNextSetBit(table->RequestOutputMaskByIndex, column_n + 1, table->ColumnsCount))
+        table->OutputColumns[table->ColumnsOutputCount++] = (ImGuiTableColumnIdx)column_n;
+
     // [Part 7] Detect/store when we are hovering the unused space after the right-most column (so e.g. context menus can react on it)
     // Clear Resizable flag if none of our column are actually resizable (either via an explicit _NoResize flag, either
     // because of using _WidthAuto/_WidthStretch). This will hide the resizing option from the context menu.
@@ -1073,7 +1276,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         if (g.IO.MousePos.x >= unused_x1)
             table->HoveredColumnBody = (ImGuiTableColumnIdx)table->ColumnsCount;
     }
-    if (has_resizable == false && (table->Flags & ImGuiTableFlags_Resizable))
+    if (table->IsAnyColumnResizable == false && (table->Flags & ImGuiTableFlags_Resizable))
         table->Flags &= ~ImGuiTableFlags_Resizable;
 
     // [Part 8] Lock actual OuterRect/WorkRect right-most position.
@@ -1146,11 +1349,10 @@ void ImGui::TableUpdateBorders(ImGuiTable* table)
     const float hit_y2_body = ImMax(table->OuterRect.Max.y, hit_y1 + table->LastOuterHeight);
     const float hit_y2_head = hit_y1 + table->LastFirstRowHeight;
 
-    for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
+    // A partial layout only laid out the columns in view, the others can't be hit.
+    ImBitArrayPtr order_mask = table->IsLayoutPartial ? table->VisibleMaskByDisplayOrder : table->EnabledMaskByDisplayOrder;
+    for (int order_n = ImBitArrayFindNextSetBit(order_mask, 0, table->ColumnsCount); order_n < table->ColumnsCount; order_n = ImBitArrayFindNextSetBit(order_mask, order_n + 1, table->ColumnsCount))
     {
-        if (!(table->EnabledMaskByDisplayOrder & ((ImU64)1 << order_n)))
-            continue;
-
         const int column_n = table->DisplayOrderToIndex[order_n];
         ImGuiTableColumn* column = &table->Columns[column_n];
         if (column->Flags & (ImGuiTableColumnFlags_NoResize | ImGuiTableColumnFlags_NoDirectResize_))
@@ -1274,15 +1476,27 @@ void    ImGui::EndTable()
     // Flatten channels and merge draw calls
     ImDrawListSplitter* splitter = table->DrawSplitter;
     splitter->SetCurrentChannel(inner_window->DrawList, 0);
+    for (int column_n = ImBitArrayFindNextSetBit(table->VisibleMaskByIndex, 0, table->ColumnsCount); column_n < table->ColumnsCount; column_n = ImBitArrayFindNextSetBit(table->VisibleMaskByIndex, column_n + 1, table->ColumnsCount))
+    {
+        ImGuiTableColumn* column = &table->Columns[column_n];
+        if (column->DrawChannelFrozen == table->DummyDrawChannel)
+            continue;
+        const ImDrawChannel* channel_frozen = &splitter->_Channels[column->DrawChannelFrozen];
+        const ImDrawChannel* channel_unfrozen = &splitter->_Channels[column->DrawChannelUnfrozen];
+        column->DrawChannelIdxSize = ImMax(channel_frozen->_IdxBuffer.Size, channel_unfrozen->_IdxBuffer.Size);
+        column->DrawChannelCmdSize = ImMax(channel_frozen->_CmdBuffer.Size, channel_unfrozen->_CmdBuffer.Size);
+    }
     if ((table->Flags & ImGuiTableFlags_NoClip) == 0)
         TableMergeDrawChannels(table);
     splitter->Merge(inner_window->DrawList);
 
     // Update ColumnsAutoFitWidth to get us ahead for host using our size to auto-resize without waiting for next BeginTable()
-    const float width_spacings = (table->OuterPaddingX * 2.0f) + (table->CellSpacingX1 + table->CellSpacingX2) * (table->ColumnsEnabledCount - 1);
-    table->ColumnsAutoFitWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-        if (table->EnabledMaskByIndex & ((ImU64)1 << column_n))
+    // (unchanged when widths were kept, they don't depend on contents)
+    if (!table->IsLayoutWidthsReused)
+    {
+        const float width_spacings = (table->OuterPaddingX * 2.0f) + (table->CellSpacingX1 + table->CellSpacingX2) * (table->ColumnsEnabledCount - 1);
+        table->ColumnsAutoFitWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount;
+        for (int column_n = ImBitArrayFindNextSetBit(table->EnabledMaskByIndex, 0, table->ColumnsCount); column_n < table->ColumnsCount; column_n = ImBitArrayFindNextSetBit(table->EnabledMaskByIndex, column_n + 1, table->ColumnsCount))
         {
             ImGuiTableColumn* column = &table->Columns[column_n];
             if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !(column->Flags & ImGuiTableColumnFlags_NoResize))
@@ -1290,6 +1504,7 @@ void    ImGui::EndTable()
             else
                 table->ColumnsAutoFitWidth += TableGetColumnWidthAuto(table, column);
         }
+    }
 
     // Update scroll
     if ((table->Flags & ImGuiTableFlags_ScrollX) == 0 && inner_window != outer_window)
@@ -1421,10 +1636,15 @@ void ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags, flo
         if ((table->Flags & ImGuiTableFlags_SizingMask_) == ImGuiTableFlags_SizingFixedFit || (table->Flags & ImGuiTableFlags_SizingMask_) == ImGuiTableFlags_SizingFixedSame)
             flags |= ImGuiTableColumnFlags_WidthFixed;
 
+    const ImGuiTableColumnFlags prev_flags = column->Flags;
     TableSetupColumnFlags(table, column, flags);
     column->UserID = user_id;
     flags = column->Flags;
 
+    // Widths kept by a virtualized table depend on these
+    if (((prev_flags ^ flags) & ~(ImGuiTableColumnFlags_StatusMask_ | ImGuiTableColumnFlags_NoDirectResize_)) != 0 || column->InitStretchWeightOrWidth != init_width_or_weight)
+        table->IsLayoutReusable = false;
+
     // Initialize defaults
     column->InitStretchWeightOrWidth = init_width_or_weight;
     if (table->IsInitializing)
@@ -1456,7 +1676,7 @@ void ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags, flo
     column->NameOffset = -1;
     if (label != NULL && label[0] != 0)
     {
-        column->NameOffset = (ImS16)table->ColumnsNames.size();
+        column->NameOffset = (ImS32)table->ColumnsNames.size();
         table->ColumnsNames.append(label, label + strlen(label) + 1);
     }
 }
@@ -1486,6 +1706,7 @@ void ImGui::TableSetupScrollFreeze(int columns, int rows)
         {
             ImSwap(table->Columns[table->DisplayOrderToIndex[order_n]].DisplayOrder, table->Columns[table->DisplayOrderToIndex[column_n]].DisplayOrder);
             ImSwap(table->DisplayOrderToIndex[order_n], table->DisplayOrderToIndex[column_n]);
+            table->IsLayoutReusable = false;
         }
     }
 }
@@ -1494,6 +1715,8 @@ void ImGui::TableSetupScrollFreeze(int columns, int rows)
 // [SECTION] Tables: Simple accessors
 //-----------------------------------------------------------------------------
 // - TableGetColumnCount()
+// - TableGetOutputColumnCount()
+// - TableGetOutputColumnIndex()
 // - TableGetColumnName()
 // - TableGetColumnName() [Internal]
 // - TableSetColumnEnabled()
@@ -1511,6 +1734,22 @@ int ImGui::TableGetColumnCount()
     return table ? table->ColumnsCount : 0;
 }
 
+int ImGui::TableGetOutputColumnCount()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    return table ? table->ColumnsOutputCount : 0;
+}
+
+int ImGui::TableGetOutputColumnIndex(int n)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && table->IsLayoutLocked && "Need to call TableGetOutputColumnIndex() after the first TableNextRow()!");
+    IM_ASSERT(n >= 0 && n < table->ColumnsOutputCount);
+    return table->OutputColumns[n];
+}
+
 const char* ImGui::TableGetColumnName(int column_n)
 {
     ImGuiContext& g = *GImGui;
@@ -1550,6 +1789,8 @@ void ImGui::TableSetColumnEnabled(int column_n, bool enabled)
         column_n = table->CurrentColumn;
     IM_ASSERT(column_n >= 0 && column_n < table->ColumnsCount);
     ImGuiTableColumn* column = &table->Columns[column_n];
+    if (column->IsUserEnabledNextFrame != enabled)
+        table->IsLayoutReusable = false;
     column->IsUserEnabledNextFrame = enabled;
 }
 
@@ -1564,7 +1805,18 @@ ImGuiTableColumnFlags ImGui::TableGetColumnFlags(int column_n)
         column_n = table->CurrentColumn;
     if (column_n == table->ColumnsCount)
         return (table->HoveredColumnBody == column_n) ? ImGuiTableColumnFlags_IsHovered : ImGuiTableColumnFlags_None;
-    return table->Columns[column_n].Flags;
+    const ImGuiTableColumn* column = &table->Columns[column_n];
+    if (table->IsLayoutPartial && !ImBitArrayTestBit(table->LaidOutMaskByIndex, column_n))
+    {
+        // Status flags of a column out of view are from its last layout, but sorting may have changed since
+        ImGuiTableColumnFlags flags = column->Flags & ~ImGuiTableColumnFlags_StatusMask_;
+        if (column->IsEnabled)
+            flags |= ImGuiTableColumnFlags_IsEnabled;
+        if (column->SortOrder != -1)
+            flags |= ImGuiTableColumnFlags_IsSorted;
+        return flags;
+    }
+    return column->Flags;
 }
 
 // Return the cell rectangle based on currently known height.
@@ -1620,7 +1872,7 @@ void ImGui::TableSetBgColor(ImGuiTableBgTarget target, ImU32 color, int column_n
             return;
         if (column_n == -1)
             column_n = table->CurrentColumn;
-        if ((table->VisibleMaskByIndex & ((ImU64)1 << column_n)) == 0)
+        if (!ImBitArrayTestBit(table->VisibleMaskByIndex, column_n))
             return;
         if (table->RowCellDataCurrent < 0 || table->RowCellData[table->RowCellDataCurrent].Column != column_n)
             table->RowCellDataCurrent++;
@@ -1818,8 +2070,9 @@ void ImGui::TableEndRow(ImGuiTable* table)
     // End frozen rows (when we are past the last frozen row line, teleport cursor and alter clipping rectangle)
     // We need to do that in TableEndRow() instead of TableBeginRow() so the list clipper can mark end of row and
     // get the new cursor position.
+    // Columns not laid out yet are updated by TableLayoutColumnOnDemand().
     if (unfreeze_rows_request)
-        for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+        for (int column_n = ImBitArrayFindNextSetBit(table->LaidOutMaskByIndex, 0, table->ColumnsCount); column_n < table->ColumnsCount; column_n = ImBitArrayFindNextSetBit(table->LaidOutMaskByIndex, column_n + 1, table->ColumnsCount))
         {
             ImGuiTableColumn* column = &table->Columns[column_n];
             column->NavLayerCurrent = (ImS8)((column_n < table->FreezeColumnsCount) ? ImGuiNavLayer_Menu : ImGuiNavLayer_Main);
@@ -1839,7 +2092,7 @@ void ImGui::TableEndRow(ImGuiTable* table)
         float row_height = table->RowPosY2 - table->RowPosY1;
         table->RowPosY2 = window->DC.CursorPos.y = table->WorkRect.Min.y + table->RowPosY2 - table->OuterRect.Min.y;
         table->RowPosY1 = table->RowPosY2 - row_height;
-        for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+        for (int column_n = ImBitArrayFindNextSetBit(table->LaidOutMaskByIndex, 0, table->ColumnsCount); column_n < table->ColumnsCount; column_n = ImBitArrayFindNextSetBit(table->LaidOutMaskByIndex, column_n + 1, table->ColumnsCount))
         {
             ImGuiTableColumn* column = &table->Columns[column_n];
             column->DrawChannelCurrent = column->DrawChannelUnfrozen;
@@ -1893,7 +2146,7 @@ bool ImGui::TableSetColumnIndex(int column_n)
 
     // Return whether the column is visible. User may choose to skip submitting items based on this return value,
     // however they shouldn't skip submitting for columns that may have the tallest contribution to row height.
-    return (table->RequestOutputMaskByIndex & ((ImU64)1 << column_n)) != 0;
+    return ImBitArrayTestBit(table->RequestOutputMaskByIndex, column_n);
 }
 
 // [Public] Append into the next column, wrap and create a new row when already on last column
@@ -1919,15 +2172,35 @@ bool ImGui::TableNextColumn()
     // Return whether the column is visible. User may choose to skip submitting items based on this return value,
     // however they shouldn't skip submitting for columns that may have the tallest contribution to row height.
     int column_n = table->CurrentColumn;
-    return (table->RequestOutputMaskByIndex & ((ImU64)1 << column_n)) != 0;
+    return ImBitArrayTestBit(table->RequestOutputMaskByIndex, column_n);
 }
 
 
 // [Internal] Called by TableSetColumnIndex()/TableNextColumn()
+// [Internal] Lay out a column skipped by a partial layout of a virtualized table, when a cell gets submitted to it anyway.
+// It is out of view: like other hidden columns, it outputs to the dummy draw channel.
+void ImGui::TableLayoutColumnOnDemand(ImGuiTable* table, int column_n)
+{
+    IM_ASSERT(table->IsLayoutPartial && !ImBitArrayTestBit(table->LaidOutMaskByIndex, column_n));
+    TableLayoutColumnFromOffset(table, column_n, false);
+
+    // Catch up with what TableSetupDrawChannels() and TableEndRow() did to the other columns
+    ImGuiTableColumn* column = &table->Columns[column_n];
+    IM_ASSERT(!column->IsVisibleX && table->DummyDrawChannel != (ImGuiTableDrawChannelIdx)-1);
+    column->DrawChannelCurrent = column->DrawChannelFrozen = column->DrawChannelUnfrozen = table->DummyDrawChannel;
+    if (table->FreezeRowsRequest > 0 && table->CurrentRow >= table->FreezeRowsRequest)
+        column->NavLayerCurrent = (ImS8)((column_n < table->FreezeColumnsCount) ? ImGuiNavLayer_Menu : ImGuiNavLayer_Main);
+    if (table->FreezeRowsCount > 0 && table->IsUnfrozenRows)
+        column->ClipRect.Min.y = table->Bg2ClipRectForDrawCmd.Min.y;
+}
+
 // This is called very frequently, so we need to be mindful of unnecessary overhead.
 // FIXME-TABLE FIXME-OPT: Could probably shortcut some things for non-active or clipped columns.
 void ImGui::TableBeginCell(ImGuiTable* table, int column_n)
 {
+    if (!ImBitArrayTestBit(table->LaidOutMaskByIndex, column_n))
+        TableLayoutColumnOnDemand(table, column_n);
+
     ImGuiTableColumn* column = &table->Columns[column_n];
     ImGuiWindow* window = table->InnerWindow;
     table->CurrentColumn = column_n;
@@ -2073,6 +2346,7 @@ void ImGui::TableSetColumnWidth(int column_n, float width)
     IM_ASSERT(column_n >= 0 && column_n < table->ColumnsCount);
     ImGuiTableColumn* column_0 = &table->Columns[column_n];
     float column_0_width = width;
+    table->IsLayoutReusable = false;
 
     // Apply constraints early
     // Compare both requested and actual given width to avoid overwriting requested width when column is stuck (minimum size, bounded)
@@ -2156,6 +2430,7 @@ void ImGui::TableSetColumnWidthAutoSingle(ImGuiTable* table, int column_n)
         return;
     column->CannotSkipItemsQueue = (1 << 0);
     table->AutoFitSingleColumn = (ImGuiTableColumnIdx)column_n;
+    table->IsLayoutReusable = false;
 }
 
 void ImGui::TableSetColumnWidthAutoAll(ImGuiTable* table)
@@ -2168,6 +2443,7 @@ void ImGui::TableSetColumnWidthAutoAll(ImGuiTable* table)
         column->CannotSkipItemsQueue = (1 << 0);
         column->AutoFitQueue = (1 << 1);
     }
+    table->IsLayoutReusable = false;
 }
 
 void ImGui::TableUpdateColumnsWeightFromWidth(ImGuiTable* table)
@@ -2250,27 +2526,35 @@ void ImGui::TablePopBackgroundChannel()
 // - Clip                         --> 2+D+N channels
 // - FreezeRows                   --> 2+D+N*2 (unless scrolling value is zero)
 // - FreezeRows || FreezeColunns  --> 3+D+N*2 (unless scrolling value is zero)
-// Where D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
+// Where N is the number of visible columns and D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
 void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 {
     const int freeze_row_multiplier = (table->FreezeRowsCount > 0) ? 2 : 1;
-    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsEnabledCount;
+    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsVisibleCount;
     const int channels_for_bg = 1 + 1 * freeze_row_multiplier;
-    const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || table->VisibleMaskByIndex != table->EnabledMaskByIndex) ? +1 : 0;
+    const int channels_for_dummy = (table->ColumnsVisibleCount < table->ColumnsCount) ? +1 : 0;
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
     table->DrawSplitter->Split(table->InnerWindow->DrawList, channels_total);
     table->DummyDrawChannel = (ImGuiTableDrawChannelIdx)((channels_for_dummy > 0) ? channels_total - 1 : -1);
     table->Bg2DrawChannelCurrent = TABLE_DRAW_CHANNEL_BG2_FROZEN;
     table->Bg2DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)((table->FreezeRowsCount > 0) ? 2 + channels_for_row : TABLE_DRAW_CHANNEL_BG2_FROZEN);
 
+    // Columns not laid out yet get the dummy channel in TableLayoutColumnOnDemand()
+    // Visible columns get their channels reserved to what they used in the previous frame. TableMergeDrawChannels() hands over
+    // channel buffers from one column to another, so without this they would keep growing one column at a time.
     int draw_channel_current = 2;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    for (int column_n = ImBitArrayFindNextSetBit(table->LaidOutMaskByIndex, 0, table->ColumnsCount); column_n < table->ColumnsCount; column_n = ImBitArrayFindNextSetBit(table->LaidOutMaskByIndex, column_n + 1, table->ColumnsCount))
     {
         ImGuiTableColumn* column = &table->Columns[column_n];
         if (column->IsVisibleX && column->IsVisibleY)
         {
             column->DrawChannelFrozen = (ImGuiTableDrawChannelIdx)(draw_channel_current);
             column->DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)(draw_channel_current + (table->FreezeRowsCount > 0 ? channels_for_row + 1 : 0));
+            ImDrawChannel* channels = table->DrawSplitter->_Channels.Data;
+            channels[column->DrawChannelFrozen]._IdxBuffer.reserve(column->DrawChannelIdxSize);
+            channels[column->DrawChannelFrozen]._CmdBuffer.reserve(column->DrawChannelCmdSize);
+            channels[column->DrawChannelUnfrozen]._IdxBuffer.reserve(column->DrawChannelIdxSize);
+            channels[column->DrawChannelUnfrozen]._CmdBuffer.reserve(column->DrawChannelCmdSize);
             if (!(table->Flags & ImGuiTableFlags_NoClip))
                 draw_channel_current++;
         }
@@ -2330,20 +2614,26 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     // Track which groups we are going to attempt to merge, and which channels goes into each group.
     struct MergeGroup
     {
-        ImRect  ClipRect;
-        int     ChannelsCount;
-        ImBitArray<IMGUI_TABLE_MAX_DRAW_CHANNELS> ChannelsMask;
+        ImRect          ClipRect;
+        int             ChannelsCount;
+        ImBitArrayPtr   ChannelsMask;
 
-        MergeGroup() { ChannelsCount = 0; }
+        MergeGroup() { ChannelsCount = 0; ChannelsMask = NULL; }
     };
     int merge_group_mask = 0x00;
     MergeGroup merge_groups[4];
 
+    // Use shared temporary storage for the masks, as they are sized to the number of draw channels (only visible columns have their own)
+    const int mask_words = (splitter->_Count + 31) >> 5;
+    g.DrawChannelsTempMergeMasks.resize(mask_words * 5);
+    ImBitArrayClearAllBits(g.DrawChannelsTempMergeMasks.Data, mask_words * 5 * 32);
+    for (int merge_group_n = 0; merge_group_n < IM_ARRAYSIZE(merge_groups); merge_group_n++)
+        merge_groups[merge_group_n].ChannelsMask = g.DrawChannelsTempMergeMasks.Data + mask_words * merge_group_n;
+    ImBitArrayPtr remaining_mask = g.DrawChannelsTempMergeMasks.Data + mask_words * 4;
+
     // 1. Scan channels and take note of those which can be merged
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    for (int column_n = ImBitArrayFindNextSetBit(table->VisibleMaskByIndex, 0, table->ColumnsCount); column_n < table->ColumnsCount; column_n = ImBitArrayFindNextSetBit(table->VisibleMaskByIndex, column_n + 1, table->ColumnsCount))
     {
-        if ((table->VisibleMaskByIndex & ((ImU64)1 << column_n)) == 0)
-            continue;
         ImGuiTableColumn* column = &table->Columns[column_n];
 
         const int merge_group_sub_count = has_freeze_v ? 2 : 1;
@@ -2374,11 +2664,11 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
             }
 
             const int merge_group_n = (has_freeze_h && column_n < table->FreezeColumnsCount ? 0 : 1) + (has_freeze_v && merge_group_sub_n == 0 ? 0 : 2);
-            IM_ASSERT(channel_no < IMGUI_TABLE_MAX_DRAW_CHANNELS);
+            IM_ASSERT(channel_no < splitter->_Count);
             MergeGroup* merge_group = &merge_groups[merge_group_n];
             if (merge_group->ChannelsCount == 0)
                 merge_group->ClipRect = ImRect(+FLT_MAX, +FLT_MAX, -FLT_MAX, -FLT_MAX);
-            merge_group->ChannelsMask.SetBit(channel_no);
+            ImBitArraySetBit(merge_group->ChannelsMask, channel_no);
             merge_group->ChannelsCount++;
             merge_group->ClipRect.Add(src_channel->_CmdBuffer[0].ClipRect);
             merge_group_mask |= (1 << merge_group_n);
@@ -2414,9 +2704,8 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
         const int LEADING_DRAW_CHANNELS = 2;
         g.DrawChannelsTempMergeBuffer.resize(splitter->_Count - LEADING_DRAW_CHANNELS); // Use shared temporary storage so the allocation gets amortized
         ImDrawChannel* dst_tmp = g.DrawChannelsTempMergeBuffer.Data;
-        ImBitArray<IMGUI_TABLE_MAX_DRAW_CHANNELS> remaining_mask;                       // We need 132-bit of storage
-        remaining_mask.SetBitRange(LEADING_DRAW_CHANNELS, splitter->_Count);
-        remaining_mask.ClearBit(table->Bg2DrawChannelUnfrozen);
+        ImBitArraySetBitRange(remaining_mask, LEADING_DRAW_CHANNELS, splitter->_Count);
+        ImBitArrayClearBit(remaining_mask, table->Bg2DrawChannelUnfrozen);
         IM_ASSERT(has_freeze_v == false || table->Bg2DrawChannelUnfrozen != TABLE_DRAW_CHANNEL_BG2_FROZEN);
         int remaining_count = splitter->_Count - (has_freeze_v ? LEADING_DRAW_CHANNELS + 1 : LEADING_DRAW_CHANNELS);
         //ImRect host_rect = (table->InnerWindow == table->OuterWindow) ? table->InnerClipRect : table->HostClipRect;
@@ -2449,14 +2738,14 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
                 GetOverlayDrawList()->AddLine(merge_group->ClipRect.Max, merge_clip_rect.Max, IM_COL32(255, 100, 0, 200));
 #endif
                 remaining_count -= merge_group->ChannelsCount;
-                for (int n = 0; n < IM_ARRAYSIZE(remaining_mask.Storage); n++)
-                    remaining_mask.Storage[n] &= ~merge_group->ChannelsMask.Storage[n];
+                for (int n = 0; n < mask_words; n++)
+                    remaining_mask[n] &= ~merge_group->ChannelsMask[n];
                 for (int n = 0; n < splitter->_Count && merge_channels_count != 0; n++)
                 {
                     // Copy + overwrite new clip rect
-                    if (!merge_group->ChannelsMask.TestBit(n))
+                    if (!ImBitArrayTestBit(merge_group->ChannelsMask, n))
                         continue;
-                    merge_group->ChannelsMask.ClearBit(n);
+                    ImBitArrayClearBit(merge_group->ChannelsMask, n);
                     merge_channels_count--;
 
                     ImDrawChannel* channel = &splitter->_Channels[n];
@@ -2474,7 +2763,7 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
         // Append unmergeable channels that we didn't reorder at the end of the list
         for (int n = 0; n < splitter->_Count && remaining_count != 0; n++)
         {
-            if (!remaining_mask.TestBit(n))
+            if (!ImBitArrayTestBit(remaining_mask, n))
                 continue;
             ImDrawChannel* channel = &splitter->_Channels[n];
             memcpy(dst_tmp++, channel, sizeof(ImDrawChannel));
@@ -2503,11 +2792,10 @@ void ImGui::TableDrawBorders(ImGuiTable* table)
     const float draw_y2_head = table->IsUsingHeaders ? ImMin(table->InnerRect.Max.y, (table->FreezeRowsCount >= 1 ? table->InnerRect.Min.y : table->WorkRect.Min.y) + table->LastFirstRowHeight) : draw_y1;
     if (table->Flags & ImGuiTableFlags_BordersInnerV)
     {
-        for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
+        // Borders of columns out of view are skipped below, a partial layout only laid out the columns in view.
+        ImBitArrayPtr order_mask = table->IsLayoutPartial ? table->VisibleMaskByDisplayOrder : table->EnabledMaskByDisplayOrder;
+        for (int order_n = ImBitArrayFindNextSetBit(order_mask, 0, table->ColumnsCount); order_n < table->ColumnsCount; order_n = ImBitArrayFindNextSetBit(order_mask, order_n + 1, table->ColumnsCount))
         {
-            if (!(table->EnabledMaskByDisplayOrder & ((ImU64)1 << order_n)))
-                continue;
-
             const int column_n = table->DisplayOrderToIndex[order_n];
             ImGuiTableColumn* column = &table->Columns[column_n];
             const bool is_hovered = (table->HoveredColumnBorder == column_n);
@@ -2685,8 +2973,11 @@ void ImGui::TableSortSpecsSanitize(ImGuiTable* table)
     IM_ASSERT(table->Flags & ImGuiTableFlags_Sortable);
 
     // Clear SortOrder from hidden column and verify that there's no gap or duplicate.
+    // (SortOrder values are linear when there is no duplicate and none is >= the number of sorted columns)
     int sort_order_count = 0;
-    ImU64 sort_order_mask = 0x00;
+    int sort_order_max = -1;
+    bool sort_order_has_duplicate = false;
+    ImBitArray<IMGUI_TABLE_MAX_COLUMNS> sort_order_mask;
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
     {
         ImGuiTableColumn* column = &table->Columns[column_n];
@@ -2695,26 +2986,29 @@ void ImGui::TableSortSpecsSanitize(ImGuiTable* table)
         if (column->SortOrder == -1)
             continue;
         sort_order_count++;
-        sort_order_mask |= ((ImU64)1 << column->SortOrder);
-        IM_ASSERT(sort_order_count < (int)sizeof(sort_order_mask) * 8);
+        sort_order_max = ImMax(sort_order_max, (int)column->SortOrder);
+        if (column->SortOrder < 0 || column->SortOrder >= IMGUI_TABLE_MAX_COLUMNS || sort_order_mask.TestBit(column->SortOrder))
+            sort_order_has_duplicate = true;
+        else
+            sort_order_mask.SetBit(column->SortOrder);
     }
 
-    const bool need_fix_linearize = ((ImU64)1 << sort_order_count) != (sort_order_mask + 1);
+    const bool need_fix_linearize = sort_order_has_duplicate || sort_order_max >= sort_order_count;
     const bool need_fix_single_sort_order = (sort_order_count > 1) && !(table->Flags & ImGuiTableFlags_SortMulti);
     if (need_fix_linearize || need_fix_single_sort_order)
     {
-        ImU64 fixed_mask = 0x00;
+        ImBitArray<IMGUI_TABLE_MAX_COLUMNS> fixed_mask;
         for (int sort_n = 0; sort_n < sort_order_count; sort_n++)
         {
             // Fix: Rewrite sort order fields if needed so they have no gap or duplicate.
             // (e.g. SortOrder 0 disappeared, SortOrder 1..2 exists --> rewrite then as SortOrder 0..1)
             int column_with_smallest_sort_order = -1;
             for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-                if ((fixed_mask & ((ImU64)1 << (ImU64)column_n)) == 0 && table->Columns[column_n].SortOrder != -1)
+                if (!fixed_mask.TestBit(column_n) && table->Columns[column_n].SortOrder != -1)
                     if (column_with_smallest_sort_order == -1 || table->Columns[column_n].SortOrder < table->Columns[column_with_smallest_sort_order].SortOrder)
                         column_with_smallest_sort_order = column_n;
             IM_ASSERT(column_with_smallest_sort_order != -1);
-            fixed_mask |= ((ImU64)1 << column_with_smallest_sort_order);
+            fixed_mask.SetBit(column_with_smallest_sort_order);
             table->Columns[column_with_smallest_sort_order].SortOrder = (ImGuiTableColumnIdx)sort_n;
 
             // Fix: Make sure only one column has a SortOrder if ImGuiTableFlags_MultiSortable is not set.
@@ -2791,8 +3085,15 @@ float ImGui::TableGetHeaderRowHeight()
     // Calculate row height, for the unlikely case that some labels may be taller than others.
     // If we didn't do that, uneven header height would highlight but smaller one before the tallest wouldn't catch input for all height.
     // In your custom header row you may omit this all together and just call TableNextRow() without a height...
+    // Labels without a line break are all one line high: skip measuring them, which matters on wide tables.
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && "Need to call TableGetHeaderRowHeight() after BeginTable()!");
     float row_height = GetTextLineHeight();
     int columns_count = TableGetColumnCount();
+    const ImGuiTextBuffer& names = table->ColumnsNames;
+    if (memchr(names.begin(), '\n', (size_t)names.size()) == NULL)
+        columns_count = 0;
     for (int column_n = 0; column_n < columns_count; column_n++)
     {
         ImGuiTableColumnFlags flags = TableGetColumnFlags(column_n);
@@ -2826,9 +3127,12 @@ void ImGui::TableHeadersRow()
     if (table->HostSkipItems) // Merely an optimization, you may skip in your own code.
         return;
 
+    // Only submit the columns requesting output (on wide tables most columns are out of view)
     const int columns_count = TableGetColumnCount();
-    for (int column_n = 0; column_n < columns_count; column_n++)
+    const int output_columns_count = TableGetOutputColumnCount();
+    for (int output_n = 0; output_n < output_columns_count; output_n++)
     {
+        const int column_n = TableGetOutputColumnIndex(output_n);
         if (!TableSetColumnIndex(column_n))
             continue;
 
@@ -3102,7 +3406,10 @@ void ImGui::TableDrawContextMenu(ImGuiTable* table)
             if (other_column->IsUserEnabled && table->ColumnsEnabledCount <= 1)
                 menu_item_active = false;
             if (MenuItem(name, NULL, other_column->IsUserEnabled, menu_item_active))
+            {
                 other_column->IsUserEnabledNextFrame = !other_column->IsUserEnabled;
+                table->IsLayoutReusable = false;
+            }
         }
         PopItemFlag();
     }
@@ -3157,18 +3464,20 @@ ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiID id, int columns_count)
     ImGuiContext& g = *GImGui;
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
     TableSettingsInit(settings, id, columns_count, columns_count);
+    if (TableSettingsFindByID(id) == NULL) // Previous entry, if any, was invalidated
+        g.SettingsTablesById.SetInt(id, g.SettingsTables.offset_from_ptr(settings) + 1);
     return settings;
 }
 
 // Find existing settings
 ImGuiTableSettings* ImGui::TableSettingsFindByID(ImGuiID id)
 {
-    // FIXME-OPT: Might want to store a lookup map for this?
     ImGuiContext& g = *GImGui;
-    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
-        if (settings->ID == id)
-            return settings;
-    return NULL;
+    const int offset_plus_1 = g.SettingsTablesById.GetInt(id);
+    if (offset_plus_1 == 0)
+        return NULL;
+    ImGuiTableSettings* settings = g.SettingsTables.ptr_from_offset(offset_plus_1 - 1);
+    return (settings->ID == id) ? settings : NULL;
 }
 
 // Get settings for a given table, NULL if none
@@ -3190,6 +3499,7 @@ ImGuiTableSettings* ImGui::TableGetBoundSettings(ImGuiTable* table)
 void ImGui::TableResetSettings(ImGuiTable* table)
 {
     table->IsInitializing = table->IsSettingsDirty = true;
+    table->IsLayoutReusable = false;
     table->IsResetAllRequest = false;
     table->IsSettingsRequestLoad = false;                   // Don't reload from ini
     table->SettingsLoadedFlags = ImGuiTableFlags_None;      // Mark as nothing loaded so our initialized data becomes authoritative
@@ -3246,6 +3556,7 @@ void ImGui::TableSaveSettings(ImGuiTable* table)
     }
     settings->SaveFlags &= table->Flags;
     settings->RefScale = save_ref_scale ? table->RefScale : 0.0f;
+    settings->IniTextLen = 0;
 
     MarkIniSettingsDirty();
 }
@@ -3275,10 +3586,12 @@ void ImGui::TableLoadSettings(ImGuiTable* table)
 
     table->SettingsLoadedFlags = settings->SaveFlags;
     table->RefScale = settings->RefScale;
+    table->IsLayoutReusable = false;
 
     // Serialize ImGuiTableSettings/ImGuiTableColumnSettings into ImGuiTable/ImGuiTableColumn
     ImGuiTableColumnSettings* column_settings = settings->GetColumnSettings();
-    ImU64 display_order_mask = 0;
+    ImBitArray<IMGUI_TABLE_MAX_COLUMNS> display_order_mask;
+    int display_order_count = 0;
     for (int data_n = 0; data_n < settings->ColumnsCount; data_n++, column_settings++)
     {
         int column_n = column_settings->Index;
@@ -3298,15 +3611,18 @@ void ImGui::TableLoadSettings(ImGuiTable* table)
             column->DisplayOrder = column_settings->DisplayOrder;
         else
             column->DisplayOrder = (ImGuiTableColumnIdx)column_n;
-        display_order_mask |= (ImU64)1 << column->DisplayOrder;
+        if (column->DisplayOrder >= 0 && column->DisplayOrder < settings->ColumnsCount && !display_order_mask.TestBit(column->DisplayOrder))
+        {
+            display_order_mask.SetBit(column->DisplayOrder);
+            display_order_count++;
+        }
         column->IsUserEnabled = column->IsUserEnabledNextFrame = column_settings->IsEnabled;
         column->SortOrder = column_settings->SortOrder;
         column->SortDirection = column_settings->SortDirection;
     }
 
     // Validate and fix invalid display order data
-    const ImU64 expected_display_order_mask = (settings->ColumnsCount == 64) ? ~0 : ((ImU64)1 << settings->ColumnsCount) - 1;
-    if (display_order_mask != expected_display_order_mask)
+    if (display_order_count != settings->ColumnsCount)
         for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
             table->Columns[column_n].DisplayOrder = (ImGuiTableColumnIdx)column_n;
 
@@ -3322,6 +3638,8 @@ static void TableSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandle
         if (ImGuiTable* table = g.Tables.TryGetMapData(i))
             table->SettingsOffset = -1;
     g.SettingsTables.clear();
+    g.SettingsTablesById.Clear();
+    g.SettingsTablesIniText.clear();
 }
 
 // Apply to existing windows (if any)
@@ -3383,12 +3701,23 @@ static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*,
 
 static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
 {
+    // Entries unchanged since the last save (see TableSaveSettings()) reuse the text written then, only the others are formatted again.
     ImGuiContext& g = *ctx;
+    const int section_start = buf->size();
     for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
     {
         if (settings->ID == 0) // Skip ditched settings
             continue;
 
+        const int text_offset = buf->size() - section_start;
+        if (settings->IniTextLen > 0)
+        {
+            const char* text = g.SettingsTablesIniText.begin() + settings->IniTextOffset;
+            buf->append(text, text + settings->IniTextLen);
+            settings->IniTextOffset = text_offset;
+            continue;
+        }
+
         // TableSaveSettings() may clear some of those flags when we establish that the data can be stripped
         // (e.g. Order was unchanged)
         const bool save_size    = (settings->SaveFlags & ImGuiTableFlags_Resizable) != 0;
@@ -3419,7 +3748,11 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
             buf->append("\n");
         }
         buf->append("\n");
+        settings->IniTextOffset = text_offset;
+        settings->IniTextLen = buf->size() - section_start - text_offset;
     }
+    g.SettingsTablesIniText.Buf.resize(0);
+    g.SettingsTablesIniText.append(buf->begin() + section_start, buf->end());
 }
 
 void ImGui::TableSettingsInstallHandler(ImGuiContext* context)
@@ -3494,6 +3827,12 @@ void ImGui::TableGcCompactSettings()
         if (settings->ID != 0)
             memcpy(new_chunk_stream.alloc_chunk(TableSettingsCalcChunkSize(settings->ColumnsCount)), settings, TableSettingsCalcChunkSize(settings->ColumnsCount));
     g.SettingsTables.swap(new_chunk_stream);
+
+    // Rebuild index
+    g.SettingsTablesById.Clear();
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+        if (TableSettingsFindByID(settings->ID) == NULL)
+            g.SettingsTablesById.SetInt(settings->ID, g.SettingsTables.offset_from_ptr(settings) + 1);
 }
 
 
@@ -3537,6 +3876,7 @@ void ImGui::DebugNodeTable(ImGuiTable* table)
     BulletText("CellPaddingX: %.1f, CellSpacingX: %.1f/%.1f, OuterPaddingX: %.1f", table->CellPaddingX, table->CellSpacingX1, table->CellSpacingX2, table->OuterPaddingX);
     BulletText("HoveredColumnBody: %d, HoveredColumnBorder: %d", table->HoveredColumnBody, table->HoveredColumnBorder);
     BulletText("ResizedColumn: %d, ReorderColumn: %d, HeldHeaderColumn: %d", table->ResizedColumn, table->ReorderColumn, table->HeldHeaderColumn);
+    BulletText("Virtualized: %d (WidthsReused: %d, Partial: %d), ColumnsVisibleCount: %d, ColumnsOutputCount: %d", table->IsVirtualized, table->IsLayoutWidthsReused, table->IsLayoutPartial, table->ColumnsVisibleCount, table->ColumnsOutputCount);
     //BulletText("BgDrawChannels: %d/%d", 0, table->BgDrawChannelUnfrozen);
     float sum_weights = 0.0f;
     for (int n = 0; n < table->ColumnsCount; n++)
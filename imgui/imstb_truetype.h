@@ -127,6 +127,12 @@
 //        #define STBTT_RASTERIZER_VERSION 1
 //   which will incur about a 15% speed hit.
 //
+//   [DEAR IMGUI] With the new rasterizer, you can
+//        #define STBTT_SSE2
+//   to accumulate coverage spans and scanlines 4 pixels at a time with SSE2
+//   intrinsics, and skip the rows without edges. The output matches the scalar rasterizer within 1 (out of 255),
+//   as float additions are done in a different order.
+//
 // ADDITIONAL DOCUMENTATION
 //
 //   Immediately after this block comment are a series of sample programs.
@@ -1102,6 +1108,11 @@ typedef int stbtt__test_oversample_pow2[(STBTT_MAX_OVERSAMPLE & (STBTT_MAX_OVERS
 #define STBTT_RASTERIZER_VERSION 2
 #endif
 
+// [DEAR IMGUI] SSE2 scanline accumulation (see STBTT_SSE2 above)
+#if defined(STBTT_SSE2) && STBTT_RASTERIZER_VERSION == 2
+#include <emmintrin.h>
+#endif
+
 #ifdef _MSC_VER
 #define STBTT__NOTUSED(v)  (void)(v)
 #else
@@ -3058,7 +3069,22 @@ static void stbtt__fill_active_edges_new(float *scanline, float *scanline_fill,
                scanline[x1] += area * (1-((x_top - x1)+(x1+1-x1))/2);
 
                step = sign * dy;
-               for (x = x1+1; x < x2; ++x) {
+               x = x1+1;
+#ifdef STBTT_SSE2
+               // [DEAR IMGUI] 4 pixels at a time, area is recomputed from the start of the span
+               if (x2 - x >= 4) {
+                  float area0 = area;
+                  int x_start = x;
+                  __m128 v_area = _mm_add_ps(_mm_set1_ps(area + step/2), _mm_mul_ps(_mm_set1_ps(step), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f)));
+                  __m128 v_step = _mm_set1_ps(step * 4);
+                  for (; x + 4 <= x2; x += 4) {
+                     _mm_storeu_ps(scanline + x, _mm_add_ps(_mm_loadu_ps(scanline + x), v_area));
+                     v_area = _mm_add_ps(v_area, v_step);
+                  }
+                  area = area0 + step * (float) (x - x_start);
+               }
+#endif
+               for (; x < x2; ++x) {
                   scanline[x] += area + step/2;
                   area += step;
                }
@@ -3133,12 +3159,59 @@ static void stbtt__fill_active_edges_new(float *scanline, float *scanline_fill,
    }
 }
 
+#ifdef STBTT_SSE2
+// [DEAR IMGUI] convert one row of coverage to pixels, 4 at a time: the running sum of scanline_fill
+// is a prefix sum within each group of 4 carried over to the next group. Both scanlines are cleared
+// as they are read, so that the caller doesn't have to clear them before the next row.
+static void stbtt__accumulate_scanline_sse2(unsigned char *pixels, float *scanline, float *scanline_fill, int len)
+{
+   const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+   const __m128 v_255 = _mm_set1_ps(255.0f);
+   const __m128 v_half = _mm_set1_ps(0.5f);
+   const __m128 zero = _mm_setzero_ps();
+   __m128 sum = zero;
+   float k, fsum;
+   int i = 0, m;
+   for (; i + 4 <= len; i += 4) {
+      __m128 fill = _mm_loadu_ps(scanline_fill + i);
+      __m128 cov = _mm_loadu_ps(scanline + i);
+      __m128i packed;
+      int out;
+      fill = _mm_add_ps(fill, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(fill), 4)));
+      fill = _mm_add_ps(fill, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(fill), 8)));
+      fill = _mm_add_ps(fill, sum);
+      sum = _mm_shuffle_ps(fill, fill, _MM_SHUFFLE(3, 3, 3, 3));
+      cov = _mm_and_ps(_mm_add_ps(cov, fill), abs_mask);
+      cov = _mm_min_ps(_mm_add_ps(_mm_mul_ps(cov, v_255), v_half), v_255);
+      packed = _mm_cvttps_epi32(cov);
+      packed = _mm_packs_epi32(packed, packed);
+      packed = _mm_packus_epi16(packed, packed);
+      out = _mm_cvtsi128_si32(packed);
+      STBTT_memcpy(pixels + i, &out, 4);
+      _mm_storeu_ps(scanline + i, zero);
+      _mm_storeu_ps(scanline_fill + i, zero);
+   }
+   fsum = _mm_cvtss_f32(sum);
+   for (; i < len; ++i) {
+      fsum += scanline_fill[i];
+      k = scanline[i] + fsum;
+      k = (float) STBTT_fabs(k)*255 + 0.5f;
+      m = (int) k;
+      if (m > 255) m = 255;
+      pixels[i] = (unsigned char) m;
+      scanline[i] = 0;
+      scanline_fill[i] = 0;
+   }
+   scanline_fill[len] = 0;
+}
+#endif
+
 // directly AA rasterize edges w/o supersampling
 static void stbtt__rasterize_sorted_edges(stbtt__bitmap *result, stbtt__edge *e, int n, int vsubsample, int off_x, int off_y, void *userdata)
 {
    stbtt__hheap hh = { 0, 0, 0 };
    stbtt__active_edge *active = NULL;
-   int y,j=0, i;
+   int y,j=0;
    float scanline_data[129], *scanline, *scanline2;
 
    STBTT__NOTUSED(vsubsample);
@@ -3153,14 +3226,20 @@ static void stbtt__rasterize_sorted_edges(stbtt__bitmap *result, stbtt__edge *e,
    y = off_y;
    e[n].y0 = (float) (off_y + result->h) + 1;
 
+#ifdef STBTT_SSE2
+   STBTT_memset(scanline, 0, (result->w*2+1)*sizeof(scanline[0])); // [DEAR IMGUI] then cleared by stbtt__accumulate_scanline_sse2()
+#endif
+
    while (j < result->h) {
       // find center of pixel for this scanline
       float scan_y_top    = y + 0.0f;
       float scan_y_bottom = y + 1.0f;
       stbtt__active_edge **step = &active;
 
+#ifndef STBTT_SSE2
       STBTT_memset(scanline , 0, result->w*sizeof(scanline[0]));
       STBTT_memset(scanline2, 0, (result->w+1)*sizeof(scanline[0]));
+#endif
 
       // update all active edges;
       // remove all active edges that terminate before the top of this scanline
@@ -3200,8 +3279,15 @@ static void stbtt__rasterize_sorted_edges(stbtt__bitmap *result, stbtt__edge *e,
       if (active)
          stbtt__fill_active_edges_new(scanline, scanline2+1, result->w, active, scan_y_top);
 
+#ifdef STBTT_SSE2
+      if (active)
+         stbtt__accumulate_scanline_sse2(result->pixels + j*result->stride, scanline, scanline2, result->w);
+      else
+         STBTT_memset(result->pixels + j*result->stride, 0, result->w); // [DEAR IMGUI] empty row, scanlines are still clear
+#else
       {
          float sum = 0;
+         int i;
          for (i=0; i < result->w; ++i) {
             float k;
             int m;
@@ -3213,6 +3299,7 @@ static void stbtt__rasterize_sorted_edges(stbtt__bitmap *result, stbtt__edge *e,
             result->pixels[j*result->stride + i] = (unsigned char) m;
          }
       }
+#endif
       // advance all the edges
       step = &active;
       while (*step) {
@@ -0,0 +1,481 @@
+/**
+ *
+ * imgui_bench: headless Dear ImGui CPU benchmark.
+ *
+ * Runs reproducible UI workloads for N frames with the null platform/renderer
+ * backends (no window, no GL context, no GPU) and reports per-frame CPU time
+ * percentiles, allocations and geometry counts.
+ *
+ * With --renderer softraster the draw data is also rasterized on the CPU into
+ * an offscreen framebuffer, and the rasterization time and throughput are
+ * reported separately. --snapshot writes the last frame as a binary PPM image.
+ *
+ * --capture records the draw data of the measured frames (and the font atlas)
+ * into a file which imgui_replay can feed to a renderer without any UI code.
+ *
+ * Usage:
+ *   imgui_bench [--workload demo|tables|text|custom|all] [--frames N] [--warmup N] [--json]
+ *               [--renderer null|softraster] [--raster-threads N] [--snapshot FILE.ppm]
+ *               [--capture FILE]
+ *
+ * With --json the report is a single JSON document on stdout, meant to be
+ * stored and diffed from one commit to another.
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_impl_capture.h"
+#include "imgui/imgui_impl_null.h"
+#include "imgui/imgui_impl_softraster.h"
+#include "imgui_bench_common.h"
+
+
+constexpr int32_t kDisplayWidth{1920};
+constexpr int32_t kDisplayHeight{1080};
+constexpr int32_t kDefaultFrames{600};
+constexpr int32_t kDefaultWarmupFrames{60};
+
+
+//
+// Allocation counting: installed with ImGui::SetAllocatorFunctions() before creating the context.
+//
+struct AllocCounters {
+  uint64_t count{0};
+  uint64_t bytes{0};
+};
+
+static AllocCounters allocCounters_;
+
+static void* CountingAlloc(size_t size, void*) {
+  allocCounters_.count++;
+  allocCounters_.bytes += size;
+  return malloc(size);
+}
+
+static void CountingFree(void* ptr, void*) {
+  free(ptr);
+}
+
+
+//
+// Workloads. Each one submits a full frame of UI, and must be deterministic given the frame index.
+//
+static void WorkloadDemo(int frame) {
+  ImGui::SetNextWindowPos(ImVec2(20.0f, 20.0f), ImGuiCond_Once);
+  ImGui::SetNextWindowSize(ImVec2(700.0f, 900.0f), ImGuiCond_Once);
+  ImGui::ShowDemoWindow();
+  ImGui::SetNextWindowPos(ImVec2(760.0f, 20.0f), ImGuiCond_Once);
+  ImGui::ShowMetricsWindow();
+  ImGui::SetNextWindowPos(ImVec2(1300.0f, 20.0f), ImGuiCond_Once);
+  ImGui::Begin("Style Editor");
+  ImGui::ShowStyleEditor();
+  ImGui::End();
+  (void)frame;
+}
+
+static void WorkloadTables(int frame) {
+  constexpr int kColumns{32};
+  constexpr int kRows{10000};
+
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+  ImGui::SetNextWindowSize(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+  ImGui::Begin("Tables", nullptr, ImGuiWindowFlags_NoSavedSettings);
+
+  // Large clipped table: typical "data grid" usage
+  const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable
+                              | ImGuiTableFlags_Hideable | ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY;
+  if (ImGui::BeginTable("grid", kColumns, flags, ImVec2(0.0f, kDisplayHeight * 0.6f))) {
+    ImGui::TableSetupScrollFreeze(1, 1);
+    for (int column = 0; column < kColumns; column++) {
+      char label[16];
+      snprintf(label, sizeof(label), "Col %d", column);
+      ImGui::TableSetupColumn(label, ImGuiTableColumnFlags_WidthFixed, 80.0f);
+    }
+    ImGui::TableHeadersRow();
+    ImGuiListClipper clipper;
+    clipper.Begin(kRows);
+    while (clipper.Step()) {
+      for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+        ImGui::TableNextRow();
+        for (int column = 0; column < kColumns; column++) {
+          ImGui::TableSetColumnIndex(column);
+          ImGui::Text("%d:%d %.2f", row, column, (float)(row * column + frame) * 0.01f);
+        }
+      }
+    }
+    ImGui::EndTable();
+  }
+
+  // Unclipped table with widgets in every cell
+  if (ImGui::BeginTable("widgets", 8, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingStretchSame)) {
+    static float values[64 * 8]{};
+    for (int row = 0; row < 64; row++) {
+      ImGui::TableNextRow();
+      for (int column = 0; column < 8; column++) {
+        ImGui::TableSetColumnIndex(column);
+        ImGui::PushID(row * 8 + column);
+        ImGui::SetNextItemWidth(-FLT_MIN);
+        ImGui::DragFloat("##v", &values[row * 8 + column], 0.01f);
+        ImGui::PopID();
+      }
+    }
+    ImGui::EndTable();
+  }
+  ImGui::End();
+}
+
+static void WorkloadText(int frame) {
+  static std::string longText;
+  if (longText.empty()) {
+    for (int line = 0; line < 5000; line++) {
+      char buf[128];
+      snprintf(buf, sizeof(buf), "%05d The quick brown fox jumps over the lazy dog. 0123456789 !@#$%%^&*()\n", line);
+      longText += buf;
+    }
+  }
+  static const char* paragraph =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. "
+    "Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat. "
+    "Duis aute irure dolor in reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla pariatur.";
+
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+  ImGui::SetNextWindowSize(ImVec2(kDisplayWidth * 0.5f, (float)kDisplayHeight));
+  ImGui::Begin("Long text", nullptr, ImGuiWindowFlags_NoSavedSettings);
+  ImGui::SetScrollY((float)((frame * 37) % 60000));
+  ImGui::TextUnformatted(longText.c_str(), longText.c_str() + longText.size());
+  ImGui::End();
+
+  ImGui::SetNextWindowPos(ImVec2(kDisplayWidth * 0.5f, 0.0f));
+  ImGui::SetNextWindowSize(ImVec2(kDisplayWidth * 0.5f, (float)kDisplayHeight));
+  ImGui::Begin("Wrapped text", nullptr, ImGuiWindowFlags_NoSavedSettings);
+  for (int n = 0; n < 40; n++) {
+    ImGui::TextWrapped("%d: %s", n, paragraph);
+    ImGui::Text("Value %d = %.3f, %s", n, n * 1.2345f + frame, (n & 1) ? "odd" : "even");
+    ImGui::BulletText("Bullet %d", n);
+  }
+  ImGui::End();
+}
+
+static void WorkloadCustom(int frame) {
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+  ImGui::SetNextWindowSize(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+  ImGui::Begin("Custom rendering", nullptr, ImGuiWindowFlags_NoSavedSettings);
+  ImDrawList* draw_list = ImGui::GetWindowDrawList();
+  const ImVec2 origin = ImGui::GetCursorScreenPos();
+  const float phase = frame * 0.05f;
+
+  // Waveform: long anti-aliased polyline
+  constexpr int kPoints{4000};
+  static ImVec2 points[kPoints];
+  for (int n = 0; n < kPoints; n++) {
+    const float x = n * (kDisplayWidth - 40.0f) / kPoints;
+    points[n] = ImVec2(origin.x + x, origin.y + 150.0f + sinf(x * 0.02f + phase) * 100.0f);
+  }
+  draw_list->AddPolyline(points, kPoints, IM_COL32(0, 255, 128, 255), ImDrawFlags_None, 1.5f);
+
+  // Shapes
+  for (int n = 0; n < 400; n++) {
+    const ImVec2 p(origin.x + (n % 40) * 45.0f + 20.0f, origin.y + 320.0f + (n / 40) * 45.0f);
+    const ImU32 col = IM_COL32((n * 37) & 255, (n * 71) & 255, (n * 113) & 255, 255);
+    switch (n % 4) {
+      case 0: draw_list->AddCircleFilled(p, 18.0f, col); break;
+      case 1: draw_list->AddRect(ImVec2(p.x - 18.0f, p.y - 18.0f), ImVec2(p.x + 18.0f, p.y + 18.0f), col, 6.0f, 0, 2.0f); break;
+      case 2: draw_list->AddNgon(p, 18.0f, col, 6, 2.0f); break;
+      case 3: draw_list->AddBezierCubic(ImVec2(p.x - 18.0f, p.y), ImVec2(p.x - 6.0f, p.y - 30.0f), ImVec2(p.x + 6.0f, p.y + 30.0f), ImVec2(p.x + 18.0f, p.y), col, 2.0f); break;
+    }
+  }
+
+  // Text through the draw list
+  for (int n = 0; n < 50; n++) {
+    draw_list->AddText(ImVec2(origin.x + 20.0f, origin.y + 800.0f + n * 4.0f), IM_COL32_WHITE, "Custom rendering text through ImDrawList::AddText()");
+  }
+  ImGui::End();
+}
+
+struct Workload {
+  const char* name;
+  void (*func)(int frame);
+};
+
+static const Workload workloads_[] = {
+  {"demo", WorkloadDemo},
+  {"tables", WorkloadTables},
+  {"text", WorkloadText},
+  {"custom", WorkloadCustom},
+};
+
+
+//
+// Runner
+//
+struct BenchOptions {
+  int frames{kDefaultFrames};
+  int warmupFrames{kDefaultWarmupFrames};
+  bool softRaster{false};
+  int rasterThreads{0};
+  std::string snapshotPath;
+  std::string capturePath;
+};
+
+struct BenchResult {
+  std::string name;
+  int frames{0};
+  double p50{0.0}, p90{0.0}, p99{0.0}, max{0.0}, mean{0.0}; // Microseconds
+  double allocsPerFrame{0.0};
+  double allocBytesPerFrame{0.0};
+  double vtxPerFrame{0.0};
+  double idxPerFrame{0.0};
+  double cmdPerFrame{0.0};
+  uint32_t lastChecksum{0};
+  double rasterMean{0.0};           // Microseconds, softraster renderer only
+  double trianglesPerFrame{0.0};
+};
+
+static double Percentile(const std::vector<double>& sorted, double p) {
+  const size_t index = std::min(sorted.size() - 1, (size_t)(p * (sorted.size() - 1) + 0.5));
+  return sorted[index];
+}
+
+static bool WriteSnapshot(const std::string& path, const std::vector<ImU32>& pixels, int width, int height) {
+  FILE* f = fopen(path.c_str(), "wb");
+  if (f == nullptr) {
+    return false;
+  }
+  fprintf(f, "P6\n%d %d\n255\n", width, height);
+  std::vector<unsigned char> row(width * 3);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      const ImU32 c = pixels[y * width + x];
+      row[x * 3 + 0] = (unsigned char)(c >> IM_COL32_R_SHIFT);
+      row[x * 3 + 1] = (unsigned char)(c >> IM_COL32_G_SHIFT);
+      row[x * 3 + 2] = (unsigned char)(c >> IM_COL32_B_SHIFT);
+    }
+    fwrite(row.data(), 1, row.size(), f);
+  }
+  fclose(f);
+  return true;
+}
+
+static BenchResult RunWorkload(const Workload& workload, const BenchOptions& options) {
+  const int frames = options.frames;
+  const int warmupFrames = options.warmupFrames;
+  ImGui::SetAllocatorFunctions(CountingAlloc, CountingFree);
+  ImGui::CreateContext();
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+  ImGui::StyleColorsDark();
+  ImGui_ImplNull_Init(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+  std::vector<ImU32> framebufferPixels;
+  ImGui_ImplSoftRaster_Framebuffer framebuffer{};
+  if (!options.softRaster) {
+    ImGui_ImplNullRender_Init();
+  } else {
+    ImGui_ImplSoftRaster_Init(options.rasterThreads);
+    framebufferPixels.resize((size_t)kDisplayWidth * kDisplayHeight);
+    framebuffer.Pixels = framebufferPixels.data();
+    framebuffer.Width = framebuffer.Stride = kDisplayWidth;
+    framebuffer.Height = kDisplayHeight;
+  }
+
+  // Scripted input: the mouse sweeps the display diagonally and the wheel scrolls now and then,
+  // so hover/scroll paths are exercised identically on every run.
+  const int totalFrames = warmupFrames + frames;
+  for (int frame = 0; frame < totalFrames; frame++) {
+    ImGui_ImplNull_ScriptMousePos(frame, ImVec2((float)((frame * 7) % kDisplayWidth), (float)((frame * 5) % kDisplayHeight)));
+    if ((frame % 30) == 15) {
+      ImGui_ImplNull_ScriptMouseWheel(frame, 0.0f, (frame % 60) < 30 ? -1.0f : 1.0f);
+    }
+  }
+
+  std::vector<double> times;
+  times.reserve(frames);
+  AllocCounters allocStart;
+  double rasterSum{0.0};
+  uint64_t trianglesStart{0};
+  uint64_t vtxTotal{0}, idxTotal{0}, cmdTotal{0};
+  ImGui_ImplCaptureWriter* captureWriter{nullptr};
+  for (int frame = 0; frame < totalFrames; frame++) {
+    if (frame == warmupFrames) {
+      if (!options.softRaster) {
+        ImGui_ImplNullRender_ResetStats();
+      }
+      allocStart = allocCounters_;
+      trianglesStart = options.softRaster ? ImGui_ImplSoftRaster_GetTrianglesRasterized() : 0;
+    }
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    if (options.softRaster) {
+      ImGui_ImplSoftRaster_NewFrame();
+    } else {
+      ImGui_ImplNullRender_NewFrame();
+    }
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    workload.func(frame);
+    ImGui::Render();
+    const auto t1 = std::chrono::high_resolution_clock::now();
+    if (options.softRaster) {
+      std::fill(framebufferPixels.begin(), framebufferPixels.end(), IM_COL32(115, 140, 153, 255));
+      ImGui_ImplSoftRaster_RenderDrawData(ImGui::GetDrawData(), framebuffer);
+    } else {
+      ImGui_ImplNullRender_RenderDrawData(ImGui::GetDrawData());
+    }
+    const auto t2 = std::chrono::high_resolution_clock::now();
+    if (frame >= warmupFrames) {
+      times.push_back(std::chrono::duration<double, std::micro>((options.softRaster ? t1 : t2) - t0).count());
+      rasterSum += std::chrono::duration<double, std::micro>(t2 - t1).count();
+      const ImDrawData* drawData = ImGui::GetDrawData();
+      vtxTotal += drawData->TotalVtxCount;
+      idxTotal += drawData->TotalIdxCount;
+      for (int n = 0; n < drawData->CmdListsCount; n++) {
+        cmdTotal += drawData->CmdLists[n]->CmdBuffer.Size;
+      }
+      if (!options.capturePath.empty()) {
+        // Opened once the renderer has built the font atlas and given it its texture identifier
+        if (captureWriter == nullptr && (captureWriter = ImGui_ImplCaptureWriter_Open(options.capturePath.c_str(), io.Fonts)) == nullptr) {
+          fprintf(stderr, "Could not write '%s'\n", options.capturePath.c_str());
+          exit(1);
+        }
+        ImGui_ImplCaptureWriter_AddFrame(captureWriter, drawData);
+      }
+    }
+  }
+  if (captureWriter != nullptr && !ImGui_ImplCaptureWriter_Close(captureWriter)) {
+    fprintf(stderr, "Could not write '%s'\n", options.capturePath.c_str());
+  }
+
+  BenchResult result;
+  result.name = workload.name;
+  result.frames = frames;
+  result.allocsPerFrame = (double)(allocCounters_.count - allocStart.count) / frames;
+  result.allocBytesPerFrame = (double)(allocCounters_.bytes - allocStart.bytes) / frames;
+  result.vtxPerFrame = (double)vtxTotal / frames;
+  result.idxPerFrame = (double)idxTotal / frames;
+  result.cmdPerFrame = (double)cmdTotal / frames;
+  if (options.softRaster) {
+    result.rasterMean = rasterSum / frames;
+    result.trianglesPerFrame = (double)(ImGui_ImplSoftRaster_GetTrianglesRasterized() - trianglesStart) / frames;
+    if (!options.snapshotPath.empty() && !WriteSnapshot(options.snapshotPath, framebufferPixels, kDisplayWidth, kDisplayHeight)) {
+      fprintf(stderr, "Could not write '%s'\n", options.snapshotPath.c_str());
+    }
+  } else {
+    result.lastChecksum = ImGui_ImplNullRender_GetStats()->LastChecksum;
+  }
+
+  double sum{0.0};
+  for (double t : times) {
+    sum += t;
+  }
+  std::sort(times.begin(), times.end());
+  result.mean = sum / frames;
+  result.p50 = Percentile(times, 0.50);
+  result.p90 = Percentile(times, 0.90);
+  result.p99 = Percentile(times, 0.99);
+  result.max = times.back();
+
+  if (options.softRaster) {
+    ImGui_ImplSoftRaster_Shutdown();
+  } else {
+    ImGui_ImplNullRender_Shutdown();
+  }
+  ImGui_ImplNull_Shutdown();
+  ImGui::DestroyContext();
+  return result;
+}
+
+static void PrintText(const std::vector<BenchResult>& results, bool softRaster) {
+  printf("Dear ImGui %s, %dx%d, %d bytes per vertex, times in microseconds\n", ImGui::GetVersion(), kDisplayWidth, kDisplayHeight, (int)sizeof(ImDrawVert));
+  printf("%-8s %6s %9s %9s %9s %9s %9s %10s %12s %9s %9s %7s %10s\n",
+         "workload", "frames", "mean", "p50", "p90", "p99", "max", "allocs/f", "bytes/f", "vtx/f", "idx/f", "cmd/f", "checksum");
+  for (const BenchResult& r : results) {
+    printf("%-8s %6d %9.1f %9.1f %9.1f %9.1f %9.1f %10.1f %12.0f %9.0f %9.0f %7.1f %08X\n",
+           r.name.c_str(), r.frames, r.mean, r.p50, r.p90, r.p99, r.max, r.allocsPerFrame, r.allocBytesPerFrame, r.vtxPerFrame, r.idxPerFrame, r.cmdPerFrame, r.lastChecksum);
+  }
+  if (softRaster) {
+    printf("\nsoftraster: times in microseconds, not included above\n");
+    printf("%-8s %9s %9s %10s\n", "workload", "raster", "tris/f", "Mtris/s");
+    for (const BenchResult& r : results) {
+      printf("%-8s %9.1f %9.0f %10.2f\n", r.name.c_str(), r.rasterMean, r.trianglesPerFrame, r.rasterMean > 0.0 ? r.trianglesPerFrame / r.rasterMean : 0.0);
+    }
+  }
+}
+
+static void PrintJson(const std::vector<BenchResult>& results, bool softRaster) {
+  printf("{\n  \"imgui_version\": \"%s\",\n  \"display\": [%d, %d],\n  \"sizeof_drawvert\": %d,\n  \"results\": [\n", ImGui::GetVersion(), kDisplayWidth, kDisplayHeight, (int)sizeof(ImDrawVert));
+  for (size_t n = 0; n < results.size(); n++) {
+    const BenchResult& r = results[n];
+    printf("    {\"workload\": \"%s\", \"frames\": %d, \"mean_us\": %.2f, \"p50_us\": %.2f, \"p90_us\": %.2f, \"p99_us\": %.2f, \"max_us\": %.2f, "
+           "\"allocs_per_frame\": %.2f, \"alloc_bytes_per_frame\": %.0f, \"vtx_per_frame\": %.1f, \"idx_per_frame\": %.1f, \"cmd_per_frame\": %.1f, \"checksum\": \"%08X\"",
+           r.name.c_str(), r.frames, r.mean, r.p50, r.p90, r.p99, r.max, r.allocsPerFrame, r.allocBytesPerFrame, r.vtxPerFrame, r.idxPerFrame, r.cmdPerFrame, r.lastChecksum);
+    if (softRaster) {
+      printf(", \"raster_us\": %.2f, \"tris_per_frame\": %.0f", r.rasterMean, r.trianglesPerFrame);
+    }
+    printf("}%s\n", (n + 1 < results.size()) ? "," : "");
+  }
+  printf("  ]\n}\n");
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  std::string workloadName{"all"};
+  BenchOptions options;
+  bool json{false};
+  bench::Args args(argc, argv,
+                   "[--workload demo|tables|text|custom|all] [--frames N] [--warmup N] [--json]\n"
+                   "          [--renderer null|softraster] [--raster-threads N] [--snapshot FILE.ppm]\n"
+                   "          [--capture FILE]");
+  while (args.Next()) {
+    const char* value{nullptr};
+    if (args.String("--workload", &value)) {
+      workloadName = value;
+    } else if (args.String("--renderer", &value)) {
+      if (strcmp(value, "softraster") != 0 && strcmp(value, "null") != 0) {
+        return args.Fail();
+      }
+      options.softRaster = strcmp(value, "softraster") == 0;
+    } else if (args.String("--snapshot", &value)) {
+      options.snapshotPath = value;
+    } else if (args.String("--capture", &value)) {
+      options.capturePath = value;
+    } else if (!args.Int("--frames", &options.frames) && !args.Int("--warmup", &options.warmupFrames) &&
+               !args.Int("--raster-threads", &options.rasterThreads) && !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (options.frames <= 0 || options.warmupFrames < 0) {
+    return args.Fail();
+  }
+
+  if (!options.capturePath.empty() && workloadName == "all") {
+    fprintf(stderr, "--capture needs a single --workload\n");
+    return 1;
+  }
+
+  std::vector<BenchResult> results;
+  for (const Workload& workload : workloads_) {
+    if (workloadName == "all" || workloadName == workload.name) {
+      results.push_back(RunWorkload(workload, options));
+    }
+  }
+  if (results.empty()) {
+    fprintf(stderr, "Unknown workload '%s'\n", workloadName.c_str());
+    return args.Fail();
+  }
+
+  if (json) {
+    PrintJson(results, options.softRaster);
+  } else {
+    PrintText(results, options.softRaster);
+  }
+  return 0;
+}
@@ -0,0 +1,304 @@
+/**
+ *
+ * imgui_bench_canvas: off-thread custom canvas tessellation benchmark.
+ *
+ * A window shows --canvases canvases, each one a waveform polyline of
+ * --points points plus filled markers and a label. The canvases are first
+ * drawn the usual way, into ImGui::GetWindowDrawList() on the UI thread, then
+ * built as standalone ImDrawList instances by 1, 2, 4 ... --threads-max worker
+ * threads (against a shared data snapshot, while the UI thread submits the
+ * window) and spliced into the window draw list with ImDrawList::AddDrawList().
+ * Frame times, splice times and the speedup over the UI thread are reported;
+ * the exit code is 2 if any run disagrees on the geometry counts.
+ *
+ * Usage:
+ *   imgui_bench_canvas [--canvases N] [--points N] [--threads-max N] [--frames N] [--json]
+ *
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_impl_null.h"
+#include "imgui_bench_common.h"
+
+
+constexpr int32_t kDisplayWidth{1920};
+constexpr int32_t kDisplayHeight{1080};
+constexpr int32_t kDefaultCanvases{16};
+constexpr int32_t kDefaultPoints{20000};
+constexpr int32_t kDefaultThreadsMax{8};
+constexpr int32_t kDefaultFrames{200};
+constexpr int32_t kWarmupFrames{10};
+constexpr float kCanvasWidth{440.0f};
+constexpr float kCanvasHeight{200.0f};
+
+
+//
+// Canvas content, in local coordinates (0,0)-(kCanvasWidth,kCanvasHeight) translated by 'origin'.
+//
+static void DrawCanvas(ImDrawList* drawList, const ImVec2& origin, int canvas, int frame, int points, std::vector<ImVec2>& scratch) {
+  const float phase = frame * 0.05f + canvas * 0.7f;
+  scratch.resize(points);
+  for (int n = 0; n < points; n++) {
+    const float x = n * kCanvasWidth / points;
+    const float y = kCanvasHeight * 0.5f + sinf(x * 0.05f + phase) * 60.0f + sinf(x * 0.71f + phase * 3.0f) * 20.0f;
+    scratch[n] = ImVec2(origin.x + x, origin.y + y);
+  }
+  drawList->AddRectFilled(origin, ImVec2(origin.x + kCanvasWidth, origin.y + kCanvasHeight), IM_COL32(20, 20, 30, 255));
+  drawList->AddPolyline(scratch.data(), points, IM_COL32(0, 255, 128, 255), ImDrawFlags_None, 1.5f);
+  for (int n = 0; n < 64; n++) {
+    const ImVec2& p = scratch[(n * points) / 64];
+    drawList->AddCircleFilled(p, 3.0f, IM_COL32(255, 200, 0, 255));
+  }
+  char label[32];
+  snprintf(label, sizeof(label), "Canvas %d", canvas);
+  drawList->AddText(ImVec2(origin.x + 4.0f, origin.y + 4.0f), IM_COL32_WHITE, label);
+}
+
+
+//
+// Worker pool: every frame, workers pick canvases from a shared counter and build them into their standalone list.
+//
+struct CanvasJobs {
+  std::mutex mutex;
+  std::condition_variable wakeCond;
+  std::condition_variable doneCond;
+  int generation{0};
+  int workersBusy{0};
+  bool quit{false};
+  std::atomic<int> nextCanvas{0};
+  int frame{0};
+  int points{0};
+  ImDrawListSharedData* sharedData{nullptr};
+  std::vector<ImDrawList*> lists;
+};
+
+static void WorkerMain(CanvasJobs* jobs) {
+  std::vector<ImVec2> scratch;
+  int generation{0};
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(jobs->mutex);
+      jobs->wakeCond.wait(lock, [&]() { return jobs->quit || jobs->generation != generation; });
+      if (jobs->quit) {
+        return;
+      }
+      generation = jobs->generation;
+    }
+    for (int canvas = jobs->nextCanvas.fetch_add(1); canvas < (int)jobs->lists.size(); canvas = jobs->nextCanvas.fetch_add(1)) {
+      ImDrawList* list = jobs->lists[canvas];
+      list->ResetStandalone(ImVec2(0.0f, 0.0f), ImVec2(kCanvasWidth, kCanvasHeight));
+      DrawCanvas(list, ImVec2(0.0f, 0.0f), canvas, jobs->frame, jobs->points, scratch);
+    }
+    std::unique_lock<std::mutex> lock(jobs->mutex);
+    if (--jobs->workersBusy == 0) {
+      jobs->doneCond.notify_one();
+    }
+  }
+}
+
+
+//
+// Runner
+//
+struct RunResult {
+  int threads{0};                   // 0: UI thread only
+  double frameMean{0.0};            // Microseconds
+  double frameP90{0.0};
+  double spliceMean{0.0};
+  double speedup{0.0};
+  double vtxPerFrame{0.0};
+  double idxPerFrame{0.0};
+};
+
+static double Percentile(const std::vector<double>& sorted, double p) {
+  const size_t index = std::min(sorted.size() - 1, (size_t)(p * (sorted.size() - 1) + 0.5));
+  return sorted[index];
+}
+
+static RunResult Run(int threadsCount, int canvases, int points, int frames) {
+  ImGui::CreateContext();
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+  ImGui::StyleColorsDark();
+  ImGui_ImplNull_Init(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+  ImGui_ImplNullRender_Init();
+
+  // The snapshot is taken once the font is set up (after the first NewFrame()), and the atlas is not modified afterwards
+  CanvasJobs jobs;
+  jobs.points = points;
+  std::vector<std::thread> workers;
+  std::vector<ImVec2> scratch;
+
+  std::vector<double> frameTimes, spliceTimes;
+  uint64_t vtxTotal{0}, idxTotal{0};
+  const int totalFrames = kWarmupFrames + frames;
+  for (int frame = 0; frame < totalFrames; frame++) {
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    const bool useWorkers = threadsCount > 0 && jobs.sharedData != nullptr;
+    if (useWorkers) {
+      std::unique_lock<std::mutex> lock(jobs.mutex);
+      jobs.frame = frame;
+      jobs.nextCanvas.store(0);
+      jobs.workersBusy = threadsCount;
+      jobs.generation++;
+      jobs.wakeCond.notify_all();
+    }
+
+    ImGui_ImplNullRender_NewFrame();
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+    ImGui::Begin("Canvases", nullptr, ImGuiWindowFlags_NoSavedSettings);
+    std::vector<ImVec2> positions(canvases);
+    for (int canvas = 0; canvas < canvases; canvas++) {
+      if (canvas % 4 != 0) {
+        ImGui::SameLine();
+      }
+      positions[canvas] = ImGui::GetCursorScreenPos();
+      ImGui::Dummy(ImVec2(kCanvasWidth, kCanvasHeight));
+    }
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    double spliceTime{0.0};
+    if (useWorkers) {
+      {
+        std::unique_lock<std::mutex> lock(jobs.mutex);
+        jobs.doneCond.wait(lock, [&]() { return jobs.workersBusy == 0; });
+      }
+      const auto s0 = std::chrono::high_resolution_clock::now();
+      for (int canvas = 0; canvas < canvases; canvas++) {
+        drawList->AddDrawList(jobs.lists[canvas], positions[canvas]);
+      }
+      const auto s1 = std::chrono::high_resolution_clock::now();
+      spliceTime = std::chrono::duration<double, std::micro>(s1 - s0).count();
+    } else {
+      for (int canvas = 0; canvas < canvases; canvas++) {
+        DrawCanvas(drawList, positions[canvas], canvas, frame, points, scratch);
+      }
+    }
+    ImGui::End();
+    ImGui::Render();
+    ImGui_ImplNullRender_RenderDrawData(ImGui::GetDrawData());
+    const auto t1 = std::chrono::high_resolution_clock::now();
+
+    // Workers start on the second frame, once the snapshot can be taken
+    if (threadsCount > 0 && jobs.sharedData == nullptr) {
+      jobs.sharedData = ImGui::CreateDrawListSharedDataSnapshot();
+      for (int canvas = 0; canvas < canvases; canvas++) {
+        jobs.lists.push_back(IM_NEW(ImDrawList)(jobs.sharedData));
+      }
+      for (int n = 0; n < threadsCount; n++) {
+        workers.emplace_back(WorkerMain, &jobs);
+      }
+    }
+    if (frame >= kWarmupFrames) {
+      frameTimes.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+      spliceTimes.push_back(spliceTime);
+      vtxTotal += ImGui::GetDrawData()->TotalVtxCount;
+      idxTotal += ImGui::GetDrawData()->TotalIdxCount;
+    }
+  }
+
+  if (!workers.empty()) {
+    {
+      std::unique_lock<std::mutex> lock(jobs.mutex);
+      jobs.quit = true;
+      jobs.wakeCond.notify_all();
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  }
+  for (ImDrawList* list : jobs.lists) {
+    IM_DELETE(list);
+  }
+  if (jobs.sharedData != nullptr) {
+    ImGui::DestroyDrawListSharedDataSnapshot(jobs.sharedData);
+  }
+
+  RunResult result;
+  result.threads = threadsCount;
+  double sum{0.0}, spliceSum{0.0};
+  for (size_t n = 0; n < frameTimes.size(); n++) {
+    sum += frameTimes[n];
+    spliceSum += spliceTimes[n];
+  }
+  std::sort(frameTimes.begin(), frameTimes.end());
+  result.frameMean = sum / frames;
+  result.frameP90 = Percentile(frameTimes, 0.90);
+  result.spliceMean = spliceSum / frames;
+  result.vtxPerFrame = (double)vtxTotal / frames;
+  result.idxPerFrame = (double)idxTotal / frames;
+
+  ImGui_ImplNullRender_Shutdown();
+  ImGui_ImplNull_Shutdown();
+  ImGui::DestroyContext();
+  return result;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  int canvases{kDefaultCanvases};
+  int points{kDefaultPoints};
+  int threadsMax{kDefaultThreadsMax};
+  int frames{kDefaultFrames};
+  bool json{false};
+  bench::Args args(argc, argv, "[--canvases N] [--points N] [--threads-max N] [--frames N] [--json]");
+  while (args.Next()) {
+    if (!args.Int("--canvases", &canvases) && !args.Int("--points", &points) && !args.Int("--threads-max", &threadsMax) &&
+        !args.Int("--frames", &frames) && !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (canvases <= 0 || points < 2 || threadsMax <= 0 || frames <= 0) {
+    return args.Fail();
+  }
+
+  std::vector<RunResult> results;
+  results.push_back(Run(0, canvases, points, frames));
+  for (int threadsCount = 1; threadsCount <= threadsMax; threadsCount *= 2) {
+    results.push_back(Run(threadsCount, canvases, points, frames));
+  }
+  bool countsMatch{true};
+  for (RunResult& r : results) {
+    r.speedup = results[0].frameMean / r.frameMean;
+    countsMatch &= (r.vtxPerFrame == results[0].vtxPerFrame && r.idxPerFrame == results[0].idxPerFrame);
+  }
+
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"hardware_threads\": %u,\n  \"canvases\": %d,\n  \"points\": %d,\n  \"frames\": %d,\n  \"results\": [\n",
+           ImGui::GetVersion(), std::thread::hardware_concurrency(), canvases, points, frames);
+    for (size_t n = 0; n < results.size(); n++) {
+      const RunResult& r = results[n];
+      printf("    {\"threads\": %d, \"frame_mean_us\": %.2f, \"frame_p90_us\": %.2f, \"splice_mean_us\": %.2f, \"speedup\": %.2f, \"vtx_per_frame\": %.0f, \"idx_per_frame\": %.0f}%s\n",
+             r.threads, r.frameMean, r.frameP90, r.spliceMean, r.speedup, r.vtxPerFrame, r.idxPerFrame, (n + 1 < results.size()) ? "," : "");
+    }
+    printf("  ],\n  \"counts_match\": %s\n}\n", countsMatch ? "true" : "false");
+  } else {
+    printf("Dear ImGui %s, %u hardware threads, %d canvases x %d points, %d frames, times in microseconds\n",
+           ImGui::GetVersion(), std::thread::hardware_concurrency(), canvases, points, frames);
+    printf("%-10s %10s %10s %10s %8s %9s %9s\n", "threads", "frame", "p90", "splice", "speedup", "vtx/f", "idx/f");
+    for (const RunResult& r : results) {
+      char name[16];
+      snprintf(name, sizeof(name), r.threads == 0 ? "ui-thread" : "%d", r.threads);
+      printf("%-10s %10.1f %10.1f %10.1f %8.2f %9.0f %9.0f\n", name, r.frameMean, r.frameP90, r.spliceMean, r.speedup, r.vtxPerFrame, r.idxPerFrame);
+    }
+    if (!countsMatch) {
+      printf("geometry counts DIFFER between runs\n");
+    }
+  }
+  return countsMatch ? 0 : 2;
+}
@@ -0,0 +1,135 @@
+/**
+ *
+ * imgui_bench_common: helpers shared by the benchmarks and the headless tools.
+ *
+ */
+#include "imgui_bench_common.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "imgui/imgui.h"
+
+namespace bench {
+
+double NanosecondsSince(std::chrono::high_resolution_clock::time_point t0) {
+  return std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - t0).count();
+}
+
+double MicrosecondsSince(std::chrono::high_resolution_clock::time_point t0) {
+  return std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - t0).count();
+}
+
+double MillisecondsSince(std::chrono::high_resolution_clock::time_point t0) {
+  return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - t0).count();
+}
+
+uint32_t NextRandom(uint32_t* state) {
+  *state = *state * 1664525u + 1013904223u;
+  return *state >> 8;
+}
+
+uint32_t HashBytes(uint32_t hash, const void* data, size_t size) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (size_t n = 0; n < size; n++) {
+    hash = (hash ^ bytes[n]) * 16777619u;
+  }
+  return hash;
+}
+
+uint32_t DrawDataChecksum(const ImDrawData* drawData) {
+  uint32_t hash{kHashSeed};
+  for (int n = 0; n < drawData->CmdListsCount; n++) {
+    const ImDrawList* drawList = drawData->CmdLists[n];
+    hash = HashBytes(hash, drawList->VtxBuffer.Data, drawList->VtxBuffer.size_in_bytes());
+    hash = HashBytes(hash, drawList->IdxBuffer.Data, drawList->IdxBuffer.size_in_bytes());
+  }
+  return hash;
+}
+
+bool LoadFile(const char* filename, std::vector<unsigned char>* data) {
+  FILE* f = fopen(filename, "rb");
+  if (f == nullptr) {
+    return false;
+  }
+  fseek(f, 0, SEEK_END);
+  const long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  data->resize(size > 0 ? (size_t)size : 0);
+  const bool ok = size > 0 && fread(data->data(), 1, data->size(), f) == data->size();
+  fclose(f);
+  return ok;
+}
+
+Args::Args(int argc, char** argv, const char* usage) : argc_(argc), argv_(argv), usage_(usage), n_(0) {}
+
+bool Args::Next() {
+  return ++n_ < argc_;
+}
+
+const char* Args::Value(const char* name) {
+  if (strcmp(argv_[n_], name) != 0 || n_ + 1 >= argc_) {
+    return nullptr;
+  }
+  return argv_[++n_];
+}
+
+bool Args::Int(const char* name, int* value) {
+  const char* arg = Value(name);
+  if (arg != nullptr) {
+    *value = atoi(arg);
+  }
+  return arg != nullptr;
+}
+
+bool Args::Float(const char* name, float* value) {
+  const char* arg = Value(name);
+  if (arg != nullptr) {
+    *value = (float)atof(arg);
+  }
+  return arg != nullptr;
+}
+
+bool Args::Double(const char* name, double* value) {
+  const char* arg = Value(name);
+  if (arg != nullptr) {
+    *value = atof(arg);
+  }
+  return arg != nullptr;
+}
+
+bool Args::String(const char* name, const char** value) {
+  const char* arg = Value(name);
+  if (arg != nullptr) {
+    *value = arg;
+  }
+  return arg != nullptr;
+}
+
+bool Args::Flag(const char* name, bool* value) {
+  if (strcmp(argv_[n_], name) != 0) {
+    return false;
+  }
+  *value = true;
+  return true;
+}
+
+bool Args::Positional(const char** value) {
+  if (argv_[n_][0] == '-') {
+    return false;
+  }
+  *value = argv_[n_];
+  return true;
+}
+
+void Args::PrintUsage() const {
+  fprintf(stderr, "Usage: %s %s\n", argv_[0], usage_);
+}
+
+int Args::Fail() const {
+  PrintUsage();
+  return 1;
+}
+
+}  // namespace bench
@@ -0,0 +1,68 @@
+/**
+ *
+ * imgui_bench_common: helpers shared by the benchmarks and the headless tools.
+ *
+ * Timing, deterministic pseudo-random numbers, FNV-1a hashing of draw data,
+ * file loading, and the command line parsing every executable does the same
+ * way: "--name value" options and "--name" flags, anything else printing the
+ * usage and failing.
+ *
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct ImDrawData;
+
+namespace bench {
+
+double NanosecondsSince(std::chrono::high_resolution_clock::time_point t0);
+double MicrosecondsSince(std::chrono::high_resolution_clock::time_point t0);
+double MillisecondsSince(std::chrono::high_resolution_clock::time_point t0);
+
+// Deterministic pseudo-random numbers (24 bits), so every mode of a benchmark sees the same inputs
+uint32_t NextRandom(uint32_t* state);
+
+// FNV-1a, start with kHashSeed
+constexpr uint32_t kHashSeed{2166136261u};
+uint32_t HashBytes(uint32_t hash, const void* data, size_t size);
+
+// Vertices and indices of every draw list
+uint32_t DrawDataChecksum(const ImDrawData* drawData);
+
+bool LoadFile(const char* filename, std::vector<unsigned char>* data);
+
+// Usage:
+//   bench::Args args(argc, argv, "[--frames N] [--json]");
+//   while (args.Next()) {
+//     if (!args.Int("--frames", &frames) && !args.Flag("--json", &json)) {
+//       return args.Fail();
+//     }
+//   }
+class Args {
+ public:
+  Args(int argc, char** argv, const char* usage);
+
+  bool Next();                                        // Move to the next argument, false past the last one
+  bool Int(const char* name, int* value);             // Whether the argument is 'name' followed by a value, which is then consumed
+  bool Float(const char* name, float* value);
+  bool Double(const char* name, double* value);
+  bool String(const char* name, const char** value);
+  bool Flag(const char* name, bool* value);           // Whether the argument is 'name', *value is then set to true
+  bool Positional(const char** value);                // Whether the argument isn't an option (doesn't start with '-')
+  void PrintUsage() const;
+  int Fail() const;                                   // PrintUsage(), then return 1 (exit code)
+
+ private:
+  const char* Value(const char* name);
+
+  int argc_;
+  char** argv_;
+  const char* usage_;
+  int n_;
+};
+
+}  // namespace bench
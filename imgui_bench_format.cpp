@@ -0,0 +1,308 @@
+/**
+ *
+ * imgui_bench_format: text formatting benchmark.
+ *
+ * Formats --values integers and floats (random magnitudes and digits, limits,
+ * rounding ties, negative zero, inf/nan) with the formats submitted by widgets
+ * ("%d", "%.3f", "%s: %u", "%08X"...) through ImFormatString() and vsnprintf(),
+ * into a large buffer and into truncating ones, and times both per format.
+ * Then times a property grid of --rows rows (LabelText, Text, DragFloat,
+ * DragInt, SliderFloat, InputScalar) with the default formats, and with the
+ * same formats given a width of 1 ("%1.3f"), which renders the same text but
+ * isn't handled by the ImFormatStringV() fast path and goes through vsnprintf().
+ * The exit code is 2 if any formatted string or length differs from
+ * vsnprintf(), or if the two property grids render differently.
+ *
+ * Usage:
+ *   imgui_bench_format [--values N] [--rows N] [--frames N] [--json]
+ *
+ */
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "imgui/imgui_impl_null.h"
+#include "imgui_bench_common.h"
+
+
+constexpr int32_t kDisplayWidth{1920};
+constexpr int32_t kDisplayHeight{1080};
+constexpr int32_t kDefaultValues{200000};
+constexpr int32_t kDefaultRows{2000};
+constexpr int32_t kDefaultFrames{100};
+constexpr int32_t kTimingRounds{5};
+constexpr size_t kTruncatedSizes[] = {1, 2, 4, 7};
+
+enum class ArgType { Int, UInt, LongLong, ULongLong, Double, String };
+
+struct FormatCase {
+  const char* format;
+  ArgType arg;
+};
+
+static const FormatCase kFormats[] = {
+    {"%d", ArgType::Int},
+    {"%u", ArgType::UInt},
+    {"%i items", ArgType::Int},
+    {"%08X", ArgType::UInt},
+    {"0x%x", ArgType::UInt},
+    {"%05d", ArgType::Int},
+    {"%lld", ArgType::LongLong},
+    {"%llu", ArgType::ULongLong},
+    {"%.3f", ArgType::Double},
+    {"%.0f", ArgType::Double},
+    {"%f", ArgType::Double},
+    {"%lf", ArgType::Double},
+    {"%.6f", ArgType::Double},
+    {"%.1f ms", ArgType::Double},
+    {"Value = %.2f%%", ArgType::Double},
+    {"%s: %s", ArgType::String},
+    {"%5d", ArgType::Int},          // Not handled by the fast path
+    {"%g", ArgType::Double},        // Not handled by the fast path
+};
+
+struct FormatResult {
+  const char* format{nullptr};
+  double fastNs{0.0};               // Per ImFormatString() call
+  double vsnprintfNs{0.0};          // Per vsnprintf() call
+  int mismatches{0};
+};
+
+struct GridResult {
+  double frameUs{0.0};
+  uint32_t checksum{0};
+};
+
+static char sink_;
+
+static int ReferenceFormat(char* buf, size_t bufSize, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  const int len = vsnprintf(buf, bufSize, format, args);
+  va_end(args);
+  return len;
+}
+
+struct Values {
+  std::vector<int64_t> ints;
+  std::vector<double> doubles;
+  std::vector<const char*> strings;
+};
+
+static Values MakeValues(int count) {
+  Values values;
+  std::mt19937_64 rng{42};
+  const int64_t intLimits[] = {0, 1, -1, INT32_MIN, INT32_MAX, (int64_t)UINT32_MAX, INT64_MIN, INT64_MAX};
+  const double doubleLimits[] = {0.0, -0.0, 0.5, 1.5, 2.5, -2.5, 0.0005, 0.0015, 0.125, 1e-300, 1e15, 1e22, 1e40, 1e300, -1e300,
+                                 std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::max(),
+                                 std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), std::nan("")};
+  values.ints.assign(std::begin(intLimits), std::end(intLimits));
+  values.doubles.assign(std::begin(doubleLimits), std::end(doubleLimits));
+  std::uniform_int_distribution<int> exponent(-12, 18);
+  std::uniform_int_distribution<int> digits(1, 6);
+  for (int n = 0; n < count; n++) {
+    const uint64_t bits = rng();
+    values.ints.push_back((int64_t)(bits >> (bits & 63)) * ((bits & 64) ? -1 : 1));
+    double value = std::ldexp((double)(rng() >> 11), -53) * std::pow(10.0, exponent(rng));
+    if (n % 4 == 1) {
+      value = std::round(value * std::pow(10.0, digits(rng))) / std::pow(10.0, digits(rng));  // Short decimals and ties
+    } else if (n % 4 == 2) {
+      value = (float)value;                                                                    // Floats promoted to double
+    }
+    values.doubles.push_back((bits & 128) ? -value : value);
+  }
+  values.strings = {"", "Speed", "Position", "A rather long property name to format"};
+  return values;
+}
+
+// Formats one value with ImFormatString() or vsnprintf(); arguments are passed the way widgets pass them.
+template <bool kFast>
+static int FormatOne(char* buf, size_t bufSize, const FormatCase& fc, const Values& values, size_t n) {
+  int (*format)(char*, size_t, const char*, ...) = kFast ? ImFormatString : ReferenceFormat;
+  const int64_t i = values.ints[n % values.ints.size()];
+  switch (fc.arg) {
+    case ArgType::Int:
+      return format(buf, bufSize, fc.format, (int)i);
+    case ArgType::UInt:
+      return format(buf, bufSize, fc.format, (unsigned int)i);
+    case ArgType::LongLong:
+      return format(buf, bufSize, fc.format, (long long)i);
+    case ArgType::ULongLong:
+      return format(buf, bufSize, fc.format, (unsigned long long)i);
+    case ArgType::Double:
+      return format(buf, bufSize, fc.format, values.doubles[n % values.doubles.size()]);
+    case ArgType::String:
+      return format(buf, bufSize, fc.format, values.strings[n % values.strings.size()], values.strings[(n / 4) % values.strings.size()]);
+  }
+  return 0;
+}
+
+static FormatResult RunFormat(const FormatCase& fc, const Values& values) {
+  FormatResult result;
+  result.format = fc.format;
+  const size_t count = values.ints.size() > values.doubles.size() ? values.ints.size() : values.doubles.size();
+
+  // ImFormatString() clamps its return value to the buffer like ImGui expects, vsnprintf() returns the untruncated length.
+  char fast[512];
+  char reference[512];
+  for (size_t n = 0; n < count; n++) {
+    const int fastLen = FormatOne<true>(fast, sizeof(fast), fc, values, n);
+    const int referenceLen = FormatOne<false>(reference, sizeof(reference), fc, values, n);
+    if (fastLen != referenceLen || strcmp(fast, reference) != 0) {
+      if (result.mismatches++ < 5) {
+        fprintf(stderr, "\"%s\": \"%s\" (%d), vsnprintf() gives \"%s\" (%d)\n", fc.format, fast, fastLen, reference, referenceLen);
+      }
+    }
+    for (size_t bufSize : kTruncatedSizes) {
+      FormatOne<true>(fast, bufSize, fc, values, n);
+      FormatOne<false>(reference, bufSize, fc, values, n);
+      if (strcmp(fast, reference) != 0) {
+        result.mismatches++;
+      }
+    }
+  }
+
+  double fastUs{0.0};
+  double vsnprintfUs{0.0};
+  for (int round = 0; round < kTimingRounds; round++) {
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (size_t n = 0; n < count; n++) {
+      FormatOne<true>(fast, sizeof(fast), fc, values, n);
+      sink_ ^= fast[0];
+    }
+    fastUs += bench::MicrosecondsSince(t0);
+    t0 = std::chrono::high_resolution_clock::now();
+    for (size_t n = 0; n < count; n++) {
+      FormatOne<false>(reference, sizeof(reference), fc, values, n);
+      sink_ ^= reference[0];
+    }
+    vsnprintfUs += bench::MicrosecondsSince(t0);
+  }
+  result.fastNs = fastUs * 1000.0 / ((double)kTimingRounds * count);
+  result.vsnprintfNs = vsnprintfUs * 1000.0 / ((double)kTimingRounds * count);
+  return result;
+}
+
+struct GridFormats {
+  const char* labelInt;
+  const char* text;
+  const char* dragFloat;
+  const char* dragInt;
+  const char* slider;
+  const char* input;
+};
+
+static const GridFormats kFastFormats{"%d", "%.3f ms", "%.3f", "%d", "%.2f", "%.6f"};
+static const GridFormats kFallbackFormats{"%1d", "%1.3f ms", "%1.3f", "%1d", "%1.2f", "%1.6f"};
+
+static void SubmitGrid(int rows, const GridFormats& formats, std::vector<float>& floats, std::vector<int>& ints) {
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f), ImGuiCond_Always);
+  ImGui::SetNextWindowSize(ImVec2((float)kDisplayWidth, (float)kDisplayHeight), ImGuiCond_Always);
+  ImGui::Begin("Properties", nullptr, ImGuiWindowFlags_NoSavedSettings);
+  // Every row is submitted: property grids which don't use a clipper are the case this is about
+  for (int row = 0; row < rows; row++) {
+    ImGui::PushID(row);
+    ImGui::LabelText("Id", formats.labelInt, row);
+    ImGui::Text(formats.text, floats[(size_t)row] * 0.5f);
+    ImGui::DragFloat("Position", &floats[(size_t)row], 0.01f, 0.0f, 0.0f, formats.dragFloat);
+    ImGui::DragInt("Count", &ints[(size_t)row], 1.0f, 0, 0, formats.dragInt);
+    ImGui::SliderFloat("Weight", &floats[(size_t)row], -1000.0f, 1000.0f, formats.slider);
+    double value = floats[(size_t)row] * 3.0;
+    ImGui::InputScalar("Scale", ImGuiDataType_Double, &value, nullptr, nullptr, formats.input);
+    ImGui::PopID();
+  }
+  ImGui::End();
+}
+
+static GridResult RunGrid(int rows, int frames, const GridFormats& formats) {
+  GridResult result;
+  ImGui::CreateContext();
+  ImGui::GetIO().IniFilename = nullptr;
+  ImGui_ImplNull_Init(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+  ImGui_ImplNullRender_Init();
+  std::vector<float> floats((size_t)rows);
+  std::vector<int> ints((size_t)rows);
+  for (int row = 0; row < rows; row++) {
+    floats[(size_t)row] = (float)(row * 37 % 2000 - 1000) * 0.731f;
+    ints[(size_t)row] = row * 7919 - 100000;
+  }
+
+  double frameSum{0.0};
+  for (int frame = 0; frame < frames; frame++) {
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    ImGui_ImplNullRender_NewFrame();
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    SubmitGrid(rows, formats, floats, ints);
+    ImGui::Render();
+    ImGui_ImplNullRender_RenderDrawData(ImGui::GetDrawData());
+    frameSum += bench::MicrosecondsSince(t0);
+  }
+  result.frameUs = frameSum / frames;
+  result.checksum = bench::DrawDataChecksum(ImGui::GetDrawData());
+
+  ImGui_ImplNullRender_Shutdown();
+  ImGui_ImplNull_Shutdown();
+  ImGui::DestroyContext();
+  return result;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  int valueCount{kDefaultValues};
+  int rows{kDefaultRows};
+  int frames{kDefaultFrames};
+  bool json{false};
+  bench::Args args(argc, argv, "[--values N] [--rows N] [--frames N] [--json]");
+  while (args.Next()) {
+    if (!args.Int("--values", &valueCount) && !args.Int("--rows", &rows) && !args.Int("--frames", &frames) &&
+        !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (valueCount <= 0 || rows <= 0 || frames <= 0) {
+    return args.Fail();
+  }
+
+  const Values values = MakeValues(valueCount);
+  std::vector<FormatResult> results;
+  int mismatches{0};
+  for (const FormatCase& fc : kFormats) {
+    results.push_back(RunFormat(fc, values));
+    mismatches += results.back().mismatches;
+  }
+  const GridResult fastGrid = RunGrid(rows, frames, kFastFormats);
+  const GridResult fallbackGrid = RunGrid(rows, frames, kFallbackFormats);
+  const bool gridMatches = fastGrid.checksum == fallbackGrid.checksum;
+
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"values\": %d,\n  \"formats\": [\n", ImGui::GetVersion(), valueCount);
+    for (size_t n = 0; n < results.size(); n++) {
+      const FormatResult& r = results[n];
+      printf("    {\"format\": \"%s\", \"imformatstring_ns\": %.1f, \"vsnprintf_ns\": %.1f, \"mismatches\": %d}%s\n",
+             r.format, r.fastNs, r.vsnprintfNs, r.mismatches, n + 1 < results.size() ? "," : "");
+    }
+    printf("  ],\n  \"grid_rows\": %d,\n  \"grid_frame_us\": %.1f,\n  \"grid_vsnprintf_frame_us\": %.1f,\n", rows, fastGrid.frameUs, fallbackGrid.frameUs);
+    printf("  \"mismatches\": %d,\n  \"grid_matches\": %s\n}\n", mismatches, gridMatches ? "true" : "false");
+  } else {
+    printf("Dear ImGui %s, %zu integers, %zu doubles\n", ImGui::GetVersion(), values.ints.size(), values.doubles.size());
+    printf("%-18s %16s %14s %10s\n", "format", "ImFormatString()", "vsnprintf()", "mismatches");
+    for (const FormatResult& r : results) {
+      printf("%-18s %13.1f ns %11.1f ns %10d\n", r.format, r.fastNs, r.vsnprintfNs, r.mismatches);
+    }
+    printf("property grid, %d rows:       %8.1f us/frame\n", rows, fastGrid.frameUs);
+    printf("same through vsnprintf():     %8.1f us/frame\n", fallbackGrid.frameUs);
+    printf("property grid output:         %s\n", gridMatches ? "same" : "DIFFER");
+  }
+  return (mismatches == 0 && gridMatches) ? 0 : 2;
+}
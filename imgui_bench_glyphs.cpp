@@ -0,0 +1,277 @@
+/**
+ *
+ * imgui_bench_glyphs: font glyph index benchmark.
+ *
+ * Loads the default font in --sizes sizes, each with custom glyphs in the
+ * private use area (icons) and in the emoji block U+1F600-U+1F64F, and
+ * reports the memory held by the paged glyph index of each font
+ * (IndexPages, IndexAdvanceX, IndexLookup) against the flat arrays indexed
+ * by code-point it replaced, which held one entry per code-point up to the
+ * highest one. Then times GetCharAdvance() and FindGlyph() over ASCII text
+ * and text with emojis against the flat arrays (rebuilt below as the
+ * reference), and CalcTextSizeA().
+ * The exit code is 2 if any advance or glyph differs from the flat arrays,
+ * for every code-point and after AddRemapChar() calls.
+ * Build with IMGUI_USE_WCHAR32 (imgui_bench_glyphs_wchar32) to load the emojis.
+ *
+ * Usage:
+ *   imgui_bench_glyphs [--sizes N] [--chars N] [--json]
+ *
+ */
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "imgui_bench_common.h"
+
+#if defined(_MSC_VER)
+#define BENCH_NOINLINE __declspec(noinline)
+#else
+#define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+
+constexpr int32_t kDefaultSizes{12};
+constexpr int32_t kDefaultChars{1 << 20};
+constexpr int32_t kTimingRounds{15};
+constexpr float kFirstSizePixels{10.0f};
+constexpr float kSizeStepPixels{2.0f};
+constexpr unsigned int kIconsFirst{0xE000};       // Private use area, where icon fonts usually live
+constexpr unsigned int kIconsCount{64};
+constexpr unsigned int kEmojisFirst{0x1F600};
+constexpr unsigned int kEmojisCount{80};
+constexpr unsigned int kEmojisEvery{8};            // One emoji every N characters in the "emoji" text
+
+// The flat arrays used before the paged index, built the same way ImFont::BuildLookupTable() did
+struct FlatIndex {
+  std::vector<float> advanceX;
+  std::vector<ImWchar> lookup;
+  const ImFontGlyph* glyphs{nullptr};
+  const ImFontGlyph* fallbackGlyph{nullptr};
+  float fallbackAdvanceX{0.0f};
+
+  void Build(const ImFont* font) {
+    unsigned int maxCodepoint{0};
+    for (const ImFontGlyph& glyph : font->Glyphs) {
+      maxCodepoint = glyph.Codepoint > maxCodepoint ? glyph.Codepoint : maxCodepoint;
+    }
+    advanceX.assign(maxCodepoint + 1, -1.0f);
+    lookup.assign(maxCodepoint + 1, (ImWchar)-1);
+    for (int n = 0; n < font->Glyphs.Size; n++) {
+      advanceX[font->Glyphs[n].Codepoint] = font->Glyphs[n].AdvanceX;
+      lookup[font->Glyphs[n].Codepoint] = (ImWchar)n;
+    }
+    glyphs = font->Glyphs.Data;
+    fallbackGlyph = font->FallbackGlyph;
+    fallbackAdvanceX = font->FallbackAdvanceX;
+    for (float& advance : advanceX) {
+      advance = advance < 0.0f ? fallbackAdvanceX : advance;
+    }
+  }
+
+  // Same as the previous ImFont::AddRemapChar(), except that the code-points it adds to the index get the fallback advance instead of -1
+  void AddRemapChar(ImWchar dst, ImWchar src, bool overwriteDst) {
+    const size_t size = lookup.size();
+    if (dst < size && lookup[dst] == (ImWchar)-1 && !overwriteDst) {
+      return;
+    }
+    if (src >= size && dst >= size) {
+      return;
+    }
+    if (dst >= size) {
+      advanceX.resize((size_t)dst + 1, fallbackAdvanceX);
+      lookup.resize((size_t)dst + 1, (ImWchar)-1);
+    }
+    lookup[dst] = (src < size) ? lookup[src] : (ImWchar)-1;
+    advanceX[dst] = (src < size) ? advanceX[src] : 1.0f;
+  }
+
+  size_t Bytes() const { return advanceX.size() * sizeof(float) + lookup.size() * sizeof(ImWchar); }
+  float GetCharAdvance(ImWchar c) const { return (c < advanceX.size()) ? advanceX[c] : fallbackAdvanceX; }
+  BENCH_NOINLINE const ImFontGlyph* FindGlyph(ImWchar c) const {
+    if (c >= lookup.size()) {
+      return fallbackGlyph;
+    }
+    const ImWchar n = lookup[c];
+    return (n == (ImWchar)-1) ? fallbackGlyph : &glyphs[n];
+  }
+};
+
+struct TimingResult {
+  const char* text{nullptr};
+  double advanceNs{0.0};            // Per character
+  double advanceFlatNs{0.0};
+  double findGlyphNs{0.0};
+  double findGlyphFlatNs{0.0};
+  double calcTextSizeNs{0.0};
+};
+
+static volatile float sink_;
+
+// Nanoseconds per character
+template <typename Lookup>
+static double TimeLoop(const std::vector<ImWchar>& text, std::vector<float>* out, Lookup lookup) {
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  float* dst = out->data();
+  for (size_t n = 0; n < text.size(); n++) {
+    dst[n] = lookup(text[n]);
+  }
+  const double ns = bench::NanosecondsSince(t0) / (double)text.size();
+  sink_ = dst[text.size() / 2];
+  return ns;
+}
+
+static size_t IndexBytes(const ImFont* font) {
+  return (size_t)font->IndexPages.Capacity * sizeof(ImU16) + (size_t)font->IndexAdvanceX.Capacity * sizeof(float) +
+         (size_t)font->IndexLookup.Capacity * sizeof(ImU16);
+}
+
+static void LoadFonts(ImFontAtlas* atlas, int sizes) {
+  for (int n = 0; n < sizes; n++) {
+    ImFontConfig config;
+    config.SizePixels = kFirstSizePixels + n * kSizeStepPixels;
+    ImFont* font = atlas->AddFontDefault(&config);
+    const int size = (int)config.SizePixels;
+    for (unsigned int c = kIconsFirst; c < kIconsFirst + kIconsCount; c++) {
+      atlas->AddCustomRectFontGlyph(font, (ImWchar)c, size, size, (float)size + 1.0f);
+    }
+    if (kEmojisFirst <= IM_UNICODE_CODEPOINT_MAX) {
+      for (unsigned int c = kEmojisFirst; c < kEmojisFirst + kEmojisCount; c++) {
+        atlas->AddCustomRectFontGlyph(font, (ImWchar)c, size, size, (float)size + 2.0f);
+      }
+    }
+  }
+  unsigned char* pixels{nullptr};
+  int width{0};
+  int height{0};
+  atlas->GetTexDataAsAlpha8(&pixels, &width, &height);
+}
+
+// Every code-point up to past the highest one, through GetCharAdvance(), FindGlyph() and FindGlyphNoFallback()
+static int CountMismatches(const ImFont* font, const FlatIndex& flat) {
+  int mismatches{0};
+  const unsigned int last = (unsigned int)flat.lookup.size() + 1024 < IM_UNICODE_CODEPOINT_MAX ? (unsigned int)flat.lookup.size() + 1024 : IM_UNICODE_CODEPOINT_MAX;
+  for (unsigned int c = 0; c <= last; c++) {
+    const ImFontGlyph* flatGlyph = flat.FindGlyph((ImWchar)c);
+    const ImFontGlyph* flatGlyphNoFallback = (c < flat.lookup.size() && flat.lookup[c] != (ImWchar)-1) ? flatGlyph : nullptr;
+    if (font->GetCharAdvance((ImWchar)c) != flat.GetCharAdvance((ImWchar)c) || font->FindGlyph((ImWchar)c) != flatGlyph ||
+        font->FindGlyphNoFallback((ImWchar)c) != flatGlyphNoFallback) {
+      mismatches++;
+    }
+  }
+  return mismatches;
+}
+
+static std::vector<ImWchar> MakeText(int chars, bool emojis) {
+  static const char kWords[] = "The quick brown fox jumps over the lazy dog. Window Settings: 12.5 ms/frame ";
+  std::vector<ImWchar> text((size_t)chars);
+  for (int n = 0; n < chars; n++) {
+    text[n] = (ImWchar)kWords[n % (sizeof(kWords) - 1)];
+    if (emojis && n % kEmojisEvery == kEmojisEvery - 1) {
+      const unsigned int first = kEmojisFirst <= IM_UNICODE_CODEPOINT_MAX ? kEmojisFirst : kIconsFirst;
+      text[n] = (ImWchar)(first + (unsigned int)n % kEmojisCount % kIconsCount);
+    }
+  }
+  return text;
+}
+
+static TimingResult TimeLookups(const char* name, const ImFont* font, const FlatIndex& flat, const std::vector<ImWchar>& text) {
+  std::vector<char> utf8(text.size() * 4 + 1);
+  ImTextStrToUtf8(utf8.data(), (int)utf8.size(), text.data(), text.data() + text.size());
+  const char* utf8End = utf8.data() + strlen(utf8.data());
+
+  // Interleaved rounds, keeping the best time of each, since the machine may be busy. The results are stored rather than summed,
+  // so that the loops aren't bound by the latency of additions.
+  TimingResult result;
+  result.text = name;
+  result.advanceNs = result.advanceFlatNs = result.findGlyphNs = result.findGlyphFlatNs = result.calcTextSizeNs = 1e30;
+  std::vector<float> out(text.size());
+  for (int round = 0; round < kTimingRounds; round++) {
+    result.advanceNs = ImMin(result.advanceNs, TimeLoop(text, &out, [font](ImWchar c) { return font->GetCharAdvance(c); }));
+    result.advanceFlatNs = ImMin(result.advanceFlatNs, TimeLoop(text, &out, [&flat](ImWchar c) { return flat.GetCharAdvance(c); }));
+    result.findGlyphNs = ImMin(result.findGlyphNs, TimeLoop(text, &out, [font](ImWchar c) { return font->FindGlyph(c)->X0; }));
+    result.findGlyphFlatNs = ImMin(result.findGlyphFlatNs, TimeLoop(text, &out, [&flat](ImWchar c) { return flat.FindGlyph(c)->X0; }));
+
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    sink_ = font->CalcTextSizeA(font->FontSize, FLT_MAX, 0.0f, utf8.data(), utf8End).x;
+    result.calcTextSizeNs = ImMin(result.calcTextSizeNs, bench::NanosecondsSince(t0) / (double)text.size());
+  }
+  return result;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  int sizes{kDefaultSizes};
+  int chars{kDefaultChars};
+  bool json{false};
+  bench::Args args(argc, argv, "[--sizes N] [--chars N] [--json]");
+  while (args.Next()) {
+    if (!args.Int("--sizes", &sizes) && !args.Int("--chars", &chars) && !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (sizes <= 0 || chars <= 0) {
+    return args.Fail();
+  }
+
+  ImFontAtlas atlas;
+  LoadFonts(&atlas, sizes);
+
+  size_t pagedBytes{0};
+  size_t flatBytes{0};
+  int mismatches{0};
+  std::vector<FlatIndex> flats((size_t)atlas.Fonts.Size);
+  for (int n = 0; n < atlas.Fonts.Size; n++) {
+    flats[n].Build(atlas.Fonts[n]);
+    pagedBytes += IndexBytes(atlas.Fonts[n]);
+    flatBytes += flats[n].Bytes();
+    mismatches += CountMismatches(atlas.Fonts[n], flats[n]);
+  }
+  const ImFont* font = atlas.Fonts[0];
+  const TimingResult timings[] = {
+      TimeLookups("ascii", font, flats[0], MakeText(chars, false)),
+      TimeLookups("emoji", font, flats[0], MakeText(chars, true)),
+  };
+
+  // Remapping into a page without glyphs, out of the index, and over existing glyphs
+  ImFont* remapped = atlas.Fonts[atlas.Fonts.Size - 1];
+  FlatIndex& remappedFlat = flats[atlas.Fonts.Size - 1];
+  const ImWchar remaps[][2] = {{(ImWchar)0x2026, (ImWchar)'.'}, {(ImWchar)0x4E00, (ImWchar)kIconsFirst}, {(ImWchar)'B', (ImWchar)(kIconsFirst + 1)},
+                               {(ImWchar)0x4E01, (ImWchar)0x3000}, {(ImWchar)0xFFFD, (ImWchar)'?'}};
+  for (const auto& remap : remaps) {
+    for (int overwrite = 0; overwrite < 2; overwrite++) {
+      remapped->AddRemapChar(remap[0], remap[1], overwrite != 0);
+      remappedFlat.AddRemapChar(remap[0], remap[1], overwrite != 0);
+    }
+  }
+  mismatches += CountMismatches(remapped, remappedFlat);
+
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"wchar_bytes\": %d,\n  \"fonts\": %d,\n  \"glyphs_per_font\": %d,\n",
+           ImGui::GetVersion(), (int)sizeof(ImWchar), sizes, font->Glyphs.Size);
+    printf("  \"index_bytes\": %zu,\n  \"flat_index_bytes\": %zu,\n", pagedBytes, flatBytes);
+    for (const TimingResult& r : timings) {
+      printf("  \"%s\": {\"get_char_advance_ns\": %.3f, \"get_char_advance_flat_ns\": %.3f, \"find_glyph_ns\": %.3f, "
+             "\"find_glyph_flat_ns\": %.3f, \"calc_text_size_ns_per_char\": %.3f},\n",
+             r.text, r.advanceNs, r.advanceFlatNs, r.findGlyphNs, r.findGlyphFlatNs, r.calcTextSizeNs);
+    }
+    printf("  \"mismatches\": %d\n}\n", mismatches);
+  } else {
+    printf("Dear ImGui %s, %d-bit ImWchar, %d fonts of %d glyphs\n", ImGui::GetVersion(), (int)sizeof(ImWchar) * 8, sizes, font->Glyphs.Size);
+    printf("glyph index memory:  paged %9.1f KB   flat %9.1f KB   (%.1fx less)\n", pagedBytes / 1024.0, flatBytes / 1024.0,
+           (double)flatBytes / (double)pagedBytes);
+    printf("%-6s %26s %26s %20s\n", "text", "GetCharAdvance() ns/char", "FindGlyph() ns/char", "CalcTextSizeA()");
+    for (const TimingResult& r : timings) {
+      printf("%-6s %10.3f (flat %7.3f) %10.3f (flat %7.3f) %12.3f ns/char\n", r.text, r.advanceNs, r.advanceFlatNs, r.findGlyphNs,
+             r.findGlyphFlatNs, r.calcTextSizeNs);
+    }
+    printf("advances and glyphs, paged vs flat:  %s\n", mismatches == 0 ? "same" : "DIFFER");
+  }
+  return mismatches == 0 ? 0 : 2;
+}
@@ -0,0 +1,186 @@
+/**
+ *
+ * imgui_bench_memory: memory accounting and budget-driven compaction
+ * benchmark.
+ *
+ * Submits --windows windows holding text and a table, showing --visible of
+ * them at a time and moving to the next group every 10 frames, so that most
+ * windows are hidden with their buffers still allocated. The run is done
+ * without a budget (buffers are only freed by io.ConfigMemoryCompactTimer,
+ * which doesn't fire here), then with io.ConfigMemoryCompactBudget set to
+ * --budget KB. Reports GetMemoryUsage() per subsystem, the peak after the
+ * first rotation, the number of compacted windows and the cost of a
+ * GetMemoryUsage() call.
+ * The exit code is 2 if the budget run stays over budget while compactable
+ * buffers remain, or if the rendered output of the two runs differs.
+ *
+ * Usage:
+ *   imgui_bench_memory [--windows N] [--visible N] [--budget KB] [--frames N] [--json]
+ *
+ */
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "imgui/imgui_impl_null.h"
+#include "imgui_bench_common.h"
+
+
+constexpr int32_t kDisplayWidth{1920};
+constexpr int32_t kDisplayHeight{1080};
+constexpr int32_t kDefaultWindows{200};
+constexpr int32_t kDefaultVisible{10};
+constexpr int32_t kDefaultBudgetKb{4096};
+constexpr int32_t kDefaultFrames{600};
+constexpr int32_t kFramesPerGroup{10};
+constexpr int32_t kTextLines{200};
+constexpr int32_t kTableRows{40};
+constexpr int32_t kTableColumns{8};
+constexpr int32_t kUsageRounds{200};
+static const char* const kCategoryNames[ImGuiMemoryCategory_COUNT] = {"windows", "draw_lists", "fonts", "tables", "storage", "settings", "text_layouts"};
+
+
+struct BenchResult {
+  size_t budgetBytes{0};
+  ImGuiMemoryUsage last;            // After the last frame
+  size_t peakBytes{0};              // Largest TotalBytes once every window was shown once
+  int compactedWindows{0};          // Windows with MemoryCompacted set after the last frame
+  double frameUs{0.0};
+  double usageNs{0.0};              // Per GetMemoryUsage() call
+  uint32_t checksum{0};             // Draw data of the last frame
+};
+
+static volatile size_t usageSink_;
+
+static void SubmitWindows(int frame, int windows, int visible) {
+  const int groups = (windows + visible - 1) / visible;
+  const int group = (frame / kFramesPerGroup) % groups;
+  char name[32];
+  for (int n = group * visible; n < windows && n < (group + 1) * visible; n++) {
+    snprintf(name, sizeof(name), "Window %04d", n);
+    ImGui::SetNextWindowPos(ImVec2((float)((n % visible) * 180), (float)((n % 3) * 300)), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(360.0f, 520.0f), ImGuiCond_Always);
+    ImGui::Begin(name, nullptr, ImGuiWindowFlags_NoSavedSettings);
+    for (int line = 0; line < kTextLines; line++) {
+      ImGui::Text("Window %d, line %d: %.3f", n, line, line * 0.125f);
+    }
+    if (ImGui::BeginTable("table", kTableColumns, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+      for (int row = 0; row < kTableRows; row++) {
+        ImGui::TableNextRow();
+        for (int column = 0; column < kTableColumns; column++) {
+          ImGui::TableSetColumnIndex(column);
+          ImGui::Text("%d", row * column + n);
+        }
+      }
+      ImGui::EndTable();
+    }
+    ImGui::End();
+  }
+}
+
+static BenchResult Run(int windows, int visible, size_t budgetBytes, int frames) {
+  BenchResult result;
+  result.budgetBytes = budgetBytes;
+  ImGui::CreateContext();
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+  io.ConfigMemoryCompactBudget = budgetBytes;
+  ImGui_ImplNull_Init(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+  ImGui_ImplNullRender_Init();
+
+  const int firstRotationFrames = ((windows + visible - 1) / visible) * kFramesPerGroup;
+  double frameSum{0.0};
+  for (int frame = 0; frame < frames; frame++) {
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    ImGui_ImplNullRender_NewFrame();
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    SubmitWindows(frame, windows, visible);
+    ImGui::Render();
+    ImGui_ImplNullRender_RenderDrawData(ImGui::GetDrawData());
+    frameSum += bench::MicrosecondsSince(t0);
+    if (frame >= firstRotationFrames) {
+      const size_t total = ImGui::GetMemoryUsage().TotalBytes;
+      result.peakBytes = total > result.peakBytes ? total : result.peakBytes;
+    }
+  }
+  result.frameUs = frameSum / frames;
+  result.checksum = bench::DrawDataChecksum(ImGui::GetDrawData());
+  result.last = ImGui::GetMemoryUsage();
+
+  ImGuiContext& g = *ImGui::GetCurrentContext();
+  for (ImGuiWindow* window : g.Windows) {
+    result.compactedWindows += window->MemoryCompacted ? 1 : 0;
+  }
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  for (int round = 0; round < kUsageRounds; round++) {
+    usageSink_ += ImGui::GetMemoryUsage().TotalBytes;
+  }
+  result.usageNs = bench::MicrosecondsSince(t0) * 1000.0 / kUsageRounds;
+
+  ImGui_ImplNullRender_Shutdown();
+  ImGui_ImplNull_Shutdown();
+  ImGui::DestroyContext();
+  return result;
+}
+
+static void PrintJson(const char* name, const BenchResult& r, bool last) {
+  printf("  \"%s\": {\"budget_bytes\": %zu, \"total_bytes\": %zu, \"peak_bytes\": %zu, \"compactable_bytes\": %zu, ",
+         name, r.budgetBytes, r.last.TotalBytes, r.peakBytes, r.last.CompactableBytes);
+  for (int n = 0; n < ImGuiMemoryCategory_COUNT; n++) {
+    printf("\"%s_bytes\": %zu, ", kCategoryNames[n], r.last.Bytes[n]);
+  }
+  printf("\"compacted_windows\": %d, \"frame_us\": %.1f, \"memory_usage_ns\": %.1f, \"checksum\": \"%08X\"}%s\n",
+         r.compactedWindows, r.frameUs, r.usageNs, r.checksum, last ? "" : ",");
+}
+
+static void PrintText(const char* name, const BenchResult& r) {
+  printf("%-10s total %8.1f KB  peak %8.1f KB  compactable %8.1f KB  compacted windows %4d  frame %7.1f us  GetMemoryUsage() %7.1f ns\n",
+         name, r.last.TotalBytes / 1024.0, r.peakBytes / 1024.0, r.last.CompactableBytes / 1024.0, r.compactedWindows, r.frameUs, r.usageNs);
+  printf("          ");
+  for (int n = 0; n < ImGuiMemoryCategory_COUNT; n++) {
+    printf(" %s %.1f KB", kCategoryNames[n], r.last.Bytes[n] / 1024.0);
+  }
+  printf("\n");
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  int windows{kDefaultWindows};
+  int visible{kDefaultVisible};
+  int budgetKb{kDefaultBudgetKb};
+  int frames{kDefaultFrames};
+  bool json{false};
+  bench::Args args(argc, argv, "[--windows N] [--visible N] [--budget KB] [--frames N] [--json]");
+  while (args.Next()) {
+    if (!args.Int("--windows", &windows) && !args.Int("--visible", &visible) && !args.Int("--budget", &budgetKb) &&
+        !args.Int("--frames", &frames) && !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (windows <= 0 || visible <= 0 || visible > windows || budgetKb <= 0 || frames <= 0) {
+    return args.Fail();
+  }
+
+  const BenchResult unbounded = Run(windows, visible, 0, frames);
+  const BenchResult budget = Run(windows, visible, (size_t)budgetKb * 1024, frames);
+  const bool withinBudget = budget.last.TotalBytes <= budget.budgetBytes || budget.last.CompactableBytes == 0;
+  const bool outputMatches = unbounded.checksum == budget.checksum;
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"windows\": %d,\n  \"visible\": %d,\n  \"frames\": %d,\n", ImGui::GetVersion(), windows, visible, frames);
+    PrintJson("no_budget", unbounded, false);
+    PrintJson("budget", budget, false);
+    printf("  \"within_budget\": %s,\n  \"output_matches\": %s\n}\n", withinBudget ? "true" : "false", outputMatches ? "true" : "false");
+  } else {
+    printf("Dear ImGui %s, %d windows, %d visible at a time, %d frames, budget %d KB\n", ImGui::GetVersion(), windows, visible, frames, budgetKb);
+    PrintText("no budget", unbounded);
+    PrintText("budget", budget);
+    printf("budget run within budget:              %s\n", withinBudget ? "yes" : "NO");
+    printf("rendered output, budget vs no budget:  %s\n", outputMatches ? "same" : "DIFFER");
+  }
+  return (withinBudget && outputMatches) ? 0 : 2;
+}
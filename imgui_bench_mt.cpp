@@ -0,0 +1,261 @@
+/**
+ *
+ * imgui_bench_mt: multi-context scaling benchmark.
+ *
+ * Builds with IMGUI_ENABLE_THREAD_LOCAL_CONTEXT: every thread creates its own
+ * Dear ImGui context (null platform/renderer backends) and all contexts share
+ * one font atlas, built and locked up-front. For 1, 2, 4 ... --threads-max
+ * threads, every thread renders --frames frames of the same UI, and the
+ * aggregate throughput is compared to the single threaded run.
+ *
+ * Usage:
+ *   imgui_bench_mt [--threads-max N] [--frames N] [--json]
+ *
+ */
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_impl_null.h"
+#include "imgui_bench_common.h"
+
+#ifndef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+#error "imgui_bench_mt must be compiled with IMGUI_ENABLE_THREAD_LOCAL_CONTEXT"
+#endif
+
+
+constexpr int32_t kDisplayWidth{1280};
+constexpr int32_t kDisplayHeight{720};
+constexpr int32_t kDefaultFrames{300};
+constexpr int32_t kDefaultThreadsMax{32};
+constexpr int32_t kWarmupFrames{10};
+constexpr int32_t kRows{200};
+
+
+//
+// Workload: all state lives in the per-thread UiState, nothing is static.
+//
+struct UiState {
+  float sliders[8]{};
+  float history[90]{};
+  bool checks[8]{};
+  int clicks{0};
+};
+
+static void BuildUi(UiState& state, int frame) {
+  ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiCond_Always);
+  ImGui::SetNextWindowSize(ImVec2(600.0f, 700.0f), ImGuiCond_Always);
+  ImGui::Begin("Report");
+  ImGui::Text("Frame %d, %d clicks", frame, state.clicks);
+  for (int n = 0; n < 8; n++) {
+    ImGui::PushID(n);
+    ImGui::Checkbox("##check", &state.checks[n]);
+    ImGui::SameLine();
+    ImGui::SliderFloat("value", &state.sliders[n], 0.0f, 1.0f);
+    ImGui::PopID();
+  }
+  if (ImGui::Button("Click")) {
+    state.clicks++;
+  }
+  state.history[frame % IM_ARRAYSIZE(state.history)] = state.sliders[frame % 8] + (float)(frame % 17) * 0.05f;
+  ImGui::PlotLines("history", state.history, IM_ARRAYSIZE(state.history), 0, nullptr, 0.0f, 1.0f, ImVec2(0.0f, 60.0f));
+
+  if (ImGui::BeginTable("rows", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY, ImVec2(0.0f, 400.0f))) {
+    ImGui::TableSetupScrollFreeze(0, 1);
+    ImGui::TableSetupColumn("Id");
+    ImGui::TableSetupColumn("Name");
+    ImGui::TableSetupColumn("Value");
+    ImGui::TableSetupColumn("Ratio");
+    ImGui::TableSetupColumn("Status");
+    ImGui::TableHeadersRow();
+    ImGuiListClipper clipper;
+    clipper.Begin(kRows);
+    while (clipper.Step()) {
+      for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::Text("%04d", row);
+        ImGui::TableNextColumn();
+        ImGui::Text("Item %d", row * 7 + frame % 3);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", row * 0.125f + frame * 0.001f);
+        ImGui::TableNextColumn();
+        ImGui::ProgressBar((float)((row + frame) % 100) / 100.0f, ImVec2(-FLT_MIN, 0.0f));
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted((row % 3) == 0 ? "ok" : "pending");
+      }
+    }
+    ImGui::EndTable();
+  }
+  ImGui::End();
+
+  ImGui::SetNextWindowPos(ImVec2(620.0f, 10.0f), ImGuiCond_Always);
+  ImGui::SetNextWindowSize(ImVec2(640.0f, 700.0f), ImGuiCond_Always);
+  ImGui::Begin("Canvas");
+  ImDrawList* drawList = ImGui::GetWindowDrawList();
+  const ImVec2 origin = ImGui::GetCursorScreenPos();
+  for (int n = 0; n < 64; n++) {
+    const float x = origin.x + (float)((n * 37 + frame) % 600);
+    const float y = origin.y + (float)((n * 53) % 600);
+    drawList->AddCircleFilled(ImVec2(x, y), 6.0f + (float)(n % 5), IM_COL32(255, 128 + n, 64, 200));
+    drawList->AddRect(ImVec2(x - 10.0f, y - 10.0f), ImVec2(x + 10.0f, y + 10.0f), IM_COL32(255, 255, 255, 128));
+  }
+  ImGui::End();
+}
+
+
+//
+// Runner
+//
+struct ThreadResult {
+  double seconds{0.0};
+  uint32_t lastChecksum{0};
+};
+
+static void ThreadMain(ImFontAtlas* sharedAtlas, int frames, std::atomic<int>* ready, std::atomic<bool>* go, ThreadResult* result) {
+  ImGui::CreateContext(sharedAtlas);
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+  ImGui::StyleColorsDark();
+  ImGui_ImplNull_Init(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+  ImGui_ImplNullRender_Init();
+  const int totalFrames = kWarmupFrames + frames;
+  for (int frame = 0; frame < totalFrames; frame++) {
+    ImGui_ImplNull_ScriptMousePos(frame, ImVec2((float)((frame * 7) % kDisplayWidth), (float)((frame * 3) % kDisplayHeight)));
+    if ((frame % 20) == 10) {
+      ImGui_ImplNull_ScriptMouseWheel(frame, 0.0f, (frame % 40) < 20 ? -1.0f : 1.0f);
+    }
+  }
+
+  UiState state;
+  auto runFrame = [&state](int frame) {
+    ImGui_ImplNullRender_NewFrame();
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    BuildUi(state, frame);
+    ImGui::Render();
+    ImGui_ImplNullRender_RenderDrawData(ImGui::GetDrawData());
+  };
+  for (int frame = 0; frame < kWarmupFrames; frame++) {
+    runFrame(frame);
+  }
+
+  // Start all threads at once
+  ready->fetch_add(1);
+  while (!go->load()) {
+    std::this_thread::yield();
+  }
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  for (int frame = kWarmupFrames; frame < totalFrames; frame++) {
+    runFrame(frame);
+  }
+  const auto t1 = std::chrono::high_resolution_clock::now();
+  result->seconds = std::chrono::duration<double>(t1 - t0).count();
+  result->lastChecksum = ImGui_ImplNullRender_GetStats()->LastChecksum;
+
+  ImGui_ImplNullRender_Shutdown();
+  ImGui_ImplNull_Shutdown();
+  ImGui::DestroyContext();
+}
+
+struct ScalingResult {
+  int threads{0};
+  double wallSeconds{0.0};
+  double framesPerSecond{0.0};
+  double speedup{0.0};
+  double efficiency{0.0};
+  bool checksumsMatch{true};
+};
+
+static ScalingResult RunScaling(ImFontAtlas* sharedAtlas, int threadsCount, int frames) {
+  std::vector<ThreadResult> results(threadsCount);
+  std::vector<std::thread> threads;
+  std::atomic<int> ready{0};
+  std::atomic<bool> go{false};
+  for (int n = 0; n < threadsCount; n++) {
+    threads.emplace_back(ThreadMain, sharedAtlas, frames, &ready, &go, &results[n]);
+  }
+  while (ready.load() < threadsCount) {
+    std::this_thread::yield();
+  }
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  go.store(true);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  const auto t1 = std::chrono::high_resolution_clock::now();
+
+  ScalingResult result;
+  result.threads = threadsCount;
+  result.wallSeconds = std::chrono::duration<double>(t1 - t0).count();
+  result.framesPerSecond = (double)threadsCount * frames / result.wallSeconds;
+  for (const ThreadResult& r : results) {
+    result.checksumsMatch &= (r.lastChecksum == results[0].lastChecksum);
+  }
+  return result;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  int threadsMax{kDefaultThreadsMax};
+  int frames{kDefaultFrames};
+  bool json{false};
+  bench::Args args(argc, argv, "[--threads-max N] [--frames N] [--json]");
+  while (args.Next()) {
+    if (!args.Int("--threads-max", &threadsMax) && !args.Int("--frames", &frames) && !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (threadsMax <= 0 || frames <= 0) {
+    return args.Fail();
+  }
+
+  // Shared atlas: built once, given the null renderer texture identifier, then locked so contexts only read from it.
+  ImFontAtlas sharedAtlas;
+  sharedAtlas.AddFontDefault();
+  unsigned char* pixels;
+  int width, height;
+  sharedAtlas.GetTexDataAsRGBA32(&pixels, &width, &height);
+  sharedAtlas.SetTexID((ImTextureID)(intptr_t)1);
+  sharedAtlas.Locked = true;
+
+  std::vector<ScalingResult> results;
+  for (int threadsCount = 1; threadsCount <= threadsMax; threadsCount *= 2) {
+    results.push_back(RunScaling(&sharedAtlas, threadsCount, frames));
+    results.back().speedup = results.back().framesPerSecond / results[0].framesPerSecond;
+    results.back().efficiency = results.back().speedup / threadsCount;
+  }
+  sharedAtlas.Locked = false;
+
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"hardware_threads\": %u,\n  \"frames_per_thread\": %d,\n  \"results\": [\n",
+           ImGui::GetVersion(), std::thread::hardware_concurrency(), frames);
+    for (size_t n = 0; n < results.size(); n++) {
+      const ScalingResult& r = results[n];
+      printf("    {\"threads\": %d, \"wall_s\": %.4f, \"frames_per_s\": %.1f, \"speedup\": %.2f, \"efficiency\": %.2f, \"checksums_match\": %s}%s\n",
+             r.threads, r.wallSeconds, r.framesPerSecond, r.speedup, r.efficiency, r.checksumsMatch ? "true" : "false", (n + 1 < results.size()) ? "," : "");
+    }
+    printf("  ]\n}\n");
+  } else {
+    printf("Dear ImGui %s, %u hardware threads, %d frames per thread, %dx%d\n",
+           ImGui::GetVersion(), std::thread::hardware_concurrency(), frames, kDisplayWidth, kDisplayHeight);
+    printf("%7s %9s %12s %8s %10s %9s\n", "threads", "wall_s", "frames/s", "speedup", "efficiency", "checksum");
+    for (const ScalingResult& r : results) {
+      printf("%7d %9.3f %12.1f %8.2f %10.2f %9s\n", r.threads, r.wallSeconds, r.framesPerSecond, r.speedup, r.efficiency, r.checksumsMatch ? "same" : "DIFFER");
+    }
+  }
+  for (const ScalingResult& r : results) {
+    if (!r.checksumsMatch) {
+      return 2;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,313 @@
+/**
+ *
+ * imgui_bench_pack: texture atlas rectangle packer benchmark.
+ *
+ * Packs the glyph rectangles of the full Chinese ranges
+ * (GetGlyphRangesChineseFull(), about 21k glyphs) at --size pixels (13, 18
+ * and 24 by default), sized as ImFontAtlas::Build() sizes them (3x
+ * horizontal oversampling, 1 pixel of padding), with stb_rect_pack's skyline
+ * packer and with ImRectPacker (guillotine), all at once and 64 at a time as
+ * a dynamic atlas would add them. Reports the time, the height used, the
+ * packing efficiency (area of the rectangles over the area used) and the
+ * texture size after rounding the height to a power of two.
+ * The glyph sizes are measured from --font when given (a CJK font), or else
+ * drawn at random with the proportions of CJK ideographs, kana, punctuation
+ * and Latin glyphs. Then times ImFontAtlas::Build() with the same rectangles
+ * as custom rectangles, with the packer it is built with:
+ * imgui_bench_pack_guillotine is built with IMGUI_ENABLE_GUILLOTINE_RECT_PACK.
+ * The exit code is 2 if a rectangle isn't packed, is out of the texture, or
+ * overlaps another one.
+ *
+ * Usage:
+ *   imgui_bench_pack [--font FILE] [--size N] [--rounds N] [--json]
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "imgui_bench_common.h"
+
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "imgui/imstb_rectpack.h"
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "imgui/imstb_truetype.h"
+
+
+constexpr int32_t kDefaultSizes[]{13, 18, 24};
+constexpr int32_t kDefaultRounds{5};
+constexpr int32_t kOversampleH{3};                 // ImFontConfig::OversampleH default
+constexpr int32_t kPadding{1};                     // ImFontAtlas::TexGlyphPadding default
+constexpr int32_t kTexHeightMax{1024 * 32};        // As ImFontAtlasBuildWithStbTruetype()
+constexpr int32_t kIncrementalChunk{64};
+constexpr uint32_t kRandomSeed{0x9E3779B9u};
+
+struct PackResult {
+  const char* packer{nullptr};
+  bool incremental{false};
+  double ms{1e30};
+  int packed{0};
+  int height{0};
+  float efficiency{0.0f};
+  int texHeight{0};                                // Rounded to a power of two
+  bool valid{false};
+};
+
+struct SizeResult {
+  int sizePixels{0};
+  int rects{0};
+  int texWidth{0};
+  int64_t area{0};
+  PackResult results[4];
+  double atlasBuildMs{1e30};
+  int atlasTexHeight{0};
+};
+
+// Between lo and hi times 'size'
+static int RandomSize(uint32_t* state, float size, float lo, float hi) {
+  const float t = (float)(bench::NextRandom(state) % 1024) / 1023.0f;
+  return (int)(size * (lo + (hi - lo) * t) + 0.5f);
+}
+
+// Glyph bitmap boxes (before oversampling, padding and the oversampling filter are added), in code-point order
+static std::vector<ImRectPackerRect> MakeGlyphBoxes(const stbtt_fontinfo* info, const ImWchar* ranges, float sizePixels) {
+  std::vector<ImRectPackerRect> boxes;
+  uint32_t state{kRandomSeed};
+  const float scale = info != nullptr ? stbtt_ScaleForPixelHeight(info, sizePixels) : 0.0f;
+  for (const ImWchar* range = ranges; range[0] && range[1]; range += 2) {
+    for (unsigned int c = range[0]; c <= range[1]; c++) {
+      ImRectPackerRect box{};
+      if (info != nullptr) {
+        const int index = stbtt_FindGlyphIndex(info, (int)c);
+        if (index == 0) {
+          continue;
+        }
+        int x0{0};
+        int y0{0};
+        int x1{0};
+        int y1{0};
+        stbtt_GetGlyphBitmapBoxSubpixel(info, index, scale * kOversampleH, scale, 0.0f, 0.0f, &x0, &y0, &x1, &y1);
+        box.W = x1 - x0;
+        box.H = y1 - y0;
+      } else if (c >= 0x4E00) {                    // Ideographs: nearly square
+        box.W = RandomSize(&state, sizePixels * kOversampleH, 0.80f, 0.95f);
+        box.H = RandomSize(&state, sizePixels, 0.78f, 0.95f);
+      } else if (c >= 0x3040 && c < 0x3100) {      // Kana
+        box.W = RandomSize(&state, sizePixels * kOversampleH, 0.45f, 0.85f);
+        box.H = RandomSize(&state, sizePixels, 0.50f, 0.85f);
+      } else if (c >= 0x3000) {                    // Punctuation, half-width and full-width forms
+        box.W = RandomSize(&state, sizePixels * kOversampleH, 0.15f, 0.90f);
+        box.H = RandomSize(&state, sizePixels, 0.10f, 0.90f);
+      } else {                                     // Latin
+        box.W = RandomSize(&state, sizePixels * kOversampleH, 0.20f, 0.60f);
+        box.H = RandomSize(&state, sizePixels, 0.08f, 0.80f);
+      }
+      boxes.push_back(box);
+    }
+  }
+  return boxes;
+}
+
+// Same sizes and texture width as ImFontAtlasBuildWithStbTruetype()
+static std::vector<ImRectPackerRect> MakeRects(const std::vector<ImRectPackerRect>& boxes, int* texWidth, int64_t* area) {
+  std::vector<ImRectPackerRect> rects(boxes.size());
+  *area = 0;
+  for (size_t n = 0; n < boxes.size(); n++) {
+    rects[n].W = boxes[n].W + kPadding + kOversampleH - 1;
+    rects[n].H = boxes[n].H + kPadding;
+    *area += (int64_t)rects[n].W * rects[n].H;
+  }
+  const int surfaceSqrt = (int)ImSqrt((float)*area) + 1;
+  *texWidth = (surfaceSqrt >= 4096 * 0.7f) ? 4096 : (surfaceSqrt >= 2048 * 0.7f) ? 2048 : (surfaceSqrt >= 1024 * 0.7f) ? 1024 : 512;
+  return rects;
+}
+
+// Every packed rectangle in the texture, without overlaps
+static bool Validate(const std::vector<ImRectPackerRect>& rects, int texWidth, int height) {
+  std::vector<bool> used((size_t)texWidth * (size_t)height, false);
+  for (const ImRectPackerRect& r : rects) {
+    if (!r.WasPacked || r.X < 0 || r.Y < 0 || r.X + r.W > texWidth || r.Y + r.H > height) {
+      return false;
+    }
+    for (int y = r.Y; y < r.Y + r.H; y++) {
+      for (int x = r.X; x < r.X + r.W; x++) {
+        const size_t n = (size_t)y * texWidth + x;
+        if (used[n]) {
+          return false;
+        }
+        used[n] = true;
+      }
+    }
+  }
+  return true;
+}
+
+static void Finish(PackResult* result, const std::vector<ImRectPackerRect>& rects, int texWidth, int64_t area) {
+  result->packed = 0;
+  result->height = 0;
+  for (const ImRectPackerRect& r : rects) {
+    result->packed += r.WasPacked ? 1 : 0;
+    result->height = r.WasPacked ? std::max(result->height, r.Y + r.H) : result->height;
+  }
+  result->efficiency = result->height > 0 ? (float)((double)area / ((double)texWidth * result->height)) : 0.0f;
+  result->texHeight = (int)ImUpperPowerOfTwo(result->height);
+  result->valid = result->packed == (int)rects.size() && Validate(rects, texWidth, result->height);
+}
+
+static void PackStbrp(std::vector<ImRectPackerRect>* rects, int texWidth, int chunk, PackResult* result) {
+  std::vector<stbrp_rect> stbrpRects(rects->size());
+  std::vector<stbrp_node> nodes((size_t)texWidth);
+  for (size_t n = 0; n < rects->size(); n++) {
+    memset(&stbrpRects[n], 0, sizeof(stbrp_rect));
+    stbrpRects[n].w = (stbrp_coord)(*rects)[n].W;
+    stbrpRects[n].h = (stbrp_coord)(*rects)[n].H;
+  }
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  stbrp_context context;
+  stbrp_init_target(&context, texWidth, kTexHeightMax, nodes.data(), (int)nodes.size());
+  for (size_t n = 0; n < stbrpRects.size(); n += (size_t)chunk) {
+    stbrp_pack_rects(&context, &stbrpRects[n], (int)std::min(stbrpRects.size() - n, (size_t)chunk));
+  }
+  result->ms = std::min(result->ms, bench::MillisecondsSince(t0));
+  for (size_t n = 0; n < rects->size(); n++) {
+    (*rects)[n].X = stbrpRects[n].x;
+    (*rects)[n].Y = stbrpRects[n].y;
+    (*rects)[n].WasPacked = stbrpRects[n].was_packed != 0;
+  }
+}
+
+static void PackGuillotine(std::vector<ImRectPackerRect>* rects, int texWidth, int chunk, PackResult* result) {
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  ImRectPacker packer;
+  packer.Init(texWidth, kTexHeightMax);
+  for (size_t n = 0; n < rects->size(); n += (size_t)chunk) {
+    packer.PackRects(&(*rects)[n], (int)std::min(rects->size() - n, (size_t)chunk));
+  }
+  result->ms = std::min(result->ms, bench::MillisecondsSince(t0));
+}
+
+static SizeResult Run(const stbtt_fontinfo* info, int sizePixels, int rounds) {
+  SizeResult result;
+  result.sizePixels = sizePixels;
+  ImFontAtlas atlas;
+  const std::vector<ImRectPackerRect> boxes = MakeGlyphBoxes(info, atlas.GetGlyphRangesChineseFull(), (float)sizePixels);
+  const std::vector<ImRectPackerRect> input = MakeRects(boxes, &result.texWidth, &result.area);
+  result.rects = (int)input.size();
+
+  // Interleaved rounds, keeping the best time of each, since the machine may be busy
+  const int all = result.rects;
+  result.results[0].packer = result.results[1].packer = "stb_rect_pack";
+  result.results[2].packer = result.results[3].packer = "guillotine";
+  result.results[1].incremental = result.results[3].incremental = true;
+  std::vector<ImRectPackerRect> rects[4];
+  for (int round = 0; round < rounds; round++) {
+    for (int n = 0; n < 4; n++) {
+      rects[n] = input;
+      const int chunk = result.results[n].incremental ? kIncrementalChunk : all;
+      if (n < 2) {
+        PackStbrp(&rects[n], result.texWidth, chunk, &result.results[n]);
+      } else {
+        PackGuillotine(&rects[n], result.texWidth, chunk, &result.results[n]);
+      }
+    }
+  }
+  for (int n = 0; n < 4; n++) {
+    Finish(&result.results[n], rects[n], result.texWidth, result.area);
+  }
+
+  // The same rectangles (with their padding) as custom rectangles of the atlas, the default font is tiny next to them
+  for (int round = 0; round < rounds; round++) {
+    atlas.Clear();
+    atlas.TexDesiredWidth = result.texWidth;
+    atlas.AddFontDefault();
+    for (const ImRectPackerRect& r : input) {
+      atlas.AddCustomRectRegular(r.W, r.H);
+    }
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    atlas.Build();
+    result.atlasBuildMs = std::min(result.atlasBuildMs, bench::MillisecondsSince(t0));
+  }
+  result.atlasTexHeight = atlas.TexHeight;
+  return result;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  const char* fontFilename{nullptr};
+  std::vector<int> sizes(std::begin(kDefaultSizes), std::end(kDefaultSizes));
+  int rounds{kDefaultRounds};
+  bool json{false};
+  bench::Args args(argc, argv, "[--font FILE] [--size N] [--rounds N] [--json]");
+  while (args.Next()) {
+    int size{0};
+    if (args.Int("--size", &size)) {
+      sizes.assign(1, size);
+    } else if (!args.String("--font", &fontFilename) && !args.Int("--rounds", &rounds) && !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (sizes[0] <= 0 || rounds <= 0) {
+    return args.Fail();
+  }
+
+  std::vector<unsigned char> fontData;
+  stbtt_fontinfo info;
+  if (fontFilename != nullptr) {
+    if (!bench::LoadFile(fontFilename, &fontData) || !stbtt_InitFont(&info, fontData.data(), stbtt_GetFontOffsetForIndex(fontData.data(), 0))) {
+      fprintf(stderr, "Could not load '%s'\n", fontFilename);
+      return 1;
+    }
+  }
+#ifdef IMGUI_ENABLE_GUILLOTINE_RECT_PACK
+  const char* atlasPacker{"guillotine"};
+#else
+  const char* atlasPacker{"stb_rect_pack"};
+#endif
+
+  std::vector<SizeResult> results;
+  bool valid{true};
+  for (int size : sizes) {
+    results.push_back(Run(fontFilename != nullptr ? &info : nullptr, size, rounds));
+    for (const PackResult& r : results.back().results) {
+      valid = valid && r.valid;
+    }
+  }
+
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"glyphs\": \"%s\",\n  \"atlas_packer\": \"%s\",\n  \"sizes\": [\n", ImGui::GetVersion(),
+           fontFilename != nullptr ? fontFilename : "random", atlasPacker);
+    for (size_t n = 0; n < results.size(); n++) {
+      const SizeResult& s = results[n];
+      printf("    {\"size_pixels\": %d, \"rects\": %d, \"tex_width\": %d,\n", s.sizePixels, s.rects, s.texWidth);
+      for (const PackResult& r : s.results) {
+        printf("     \"%s%s\": {\"ms\": %.3f, \"packed\": %d, \"height\": %d, \"efficiency\": %.4f, \"tex_height\": %d, \"valid\": %s},\n", r.packer,
+               r.incremental ? "_incremental" : "", r.ms, r.packed, r.height, r.efficiency, r.texHeight, r.valid ? "true" : "false");
+      }
+      printf("     \"atlas_build_ms\": %.3f, \"atlas_tex_height\": %d}%s\n", s.atlasBuildMs, s.atlasTexHeight, n + 1 < results.size() ? "," : "");
+    }
+    printf("  ],\n  \"valid\": %s\n}\n", valid ? "true" : "false");
+  } else {
+    printf("Dear ImGui %s, glyphs of GetGlyphRangesChineseFull() from %s, %dx oversampling, atlas packer: %s\n", ImGui::GetVersion(),
+           fontFilename != nullptr ? fontFilename : "random sizes", kOversampleH, atlasPacker);
+    for (const SizeResult& s : results) {
+      printf("%d px: %d rects, texture width %d\n", s.sizePixels, s.rects, s.texWidth);
+      for (const PackResult& r : s.results) {
+        printf("  %-14s %-11s %9.3f ms   height %5d   efficiency %5.1f%%   texture %dx%d (%.1f MB RGBA32)%s\n", r.packer,
+               r.incremental ? "64 at once" : "all at once", r.ms, r.height, r.efficiency * 100.0f, s.texWidth, r.texHeight,
+               (double)s.texWidth * r.texHeight * 4 / (1024.0 * 1024.0), r.valid ? "" : "   INVALID");
+      }
+      printf("  ImFontAtlas::Build() %9.3f ms   texture %dx%d\n", s.atlasBuildMs, s.texWidth, s.atlasTexHeight);
+    }
+    printf("rectangles packed, in the texture, without overlaps:  %s\n", valid ? "yes" : "NO");
+  }
+  return valid ? 0 : 2;
+}
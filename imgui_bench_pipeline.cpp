@@ -0,0 +1,239 @@
+/**
+ *
+ * imgui_bench_pipeline: pipelined UI/render threads benchmark.
+ *
+ * Runs the demo window with the null platform backend and the softraster
+ * renderer (rasterizing on the calling thread, standing in for GPU/driver
+ * work), first sequentially (UI, then render, on one thread) then pipelined
+ * with imgui_impl_pipeline: the UI thread builds frame N while a render
+ * thread rasterizes frame N-1. A user texture is created through the
+ * pipeline's texture queue. Frames/s, UI thread time and the speedup are
+ * reported; the exit code is 2 if the last frames differ.
+ *
+ * Usage:
+ *   imgui_bench_pipeline [--frames N] [--json]
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_impl_null.h"
+#include "imgui/imgui_impl_pipeline.h"
+#include "imgui/imgui_impl_softraster.h"
+#include "imgui_bench_common.h"
+
+
+constexpr int32_t kDisplayWidth{1920};
+constexpr int32_t kDisplayHeight{1080};
+constexpr int32_t kDefaultFrames{300};
+constexpr int32_t kWarmupFrames{10};
+constexpr int32_t kTextureSize{128};
+
+
+//
+// Render side (render thread when pipelined)
+//
+struct RenderTarget {
+  std::vector<ImU32> pixels;
+  ImGui_ImplSoftRaster_Framebuffer framebuffer{};
+  std::vector<ImGui_ImplSoftRaster_Texture*> textures;
+};
+
+static ImTextureID CreateTexture(int width, int height, const unsigned char* pixels, void* userData) {
+  RenderTarget* target = (RenderTarget*)userData;
+  ImU32* texturePixels = new ImU32[(size_t)width * height];
+  memcpy(texturePixels, pixels, (size_t)width * height * 4);
+  target->textures.push_back(new ImGui_ImplSoftRaster_Texture{texturePixels, width, height});
+  return (ImTextureID)(intptr_t)target->textures.back();
+}
+
+static void RenderFrame(RenderTarget* target, ImDrawData* drawData) {
+  std::fill(target->pixels.begin(), target->pixels.end(), IM_COL32(115, 140, 153, 255));
+  ImGui_ImplSoftRaster_RenderDrawData(drawData, target->framebuffer);
+}
+
+static uint32_t HashPixels(const std::vector<ImU32>& pixels) {
+  uint32_t hash{bench::kHashSeed};
+  for (ImU32 pixel : pixels) {
+    hash = (hash ^ pixel) * 16777619u;
+  }
+  return hash;
+}
+
+
+//
+// UI side. Deterministic given the frame index; the image is replaced by a placeholder of the same size until its texture exists.
+//
+static void BuildUI(int frame, ImTextureID texture, bool textureReady) {
+  ImGui::SetNextWindowPos(ImVec2(20.0f, 20.0f), ImGuiCond_Once);
+  ImGui::SetNextWindowSize(ImVec2(700.0f, 900.0f), ImGuiCond_Once);
+  ImGui::ShowDemoWindow();
+  ImGui::SetNextWindowPos(ImVec2(760.0f, 20.0f), ImGuiCond_Once);
+  ImGui::Begin("Style Editor");
+  ImGui::ShowStyleEditor();
+  ImGui::End();
+  ImGui::SetNextWindowPos(ImVec2(1400.0f, 20.0f), ImGuiCond_Once);
+  ImGui::Begin("User texture", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
+  if (textureReady) {
+    ImGui::Image(texture, ImVec2((float)kTextureSize * 2, (float)kTextureSize * 2));
+  } else {
+    ImGui::Dummy(ImVec2((float)kTextureSize * 2, (float)kTextureSize * 2));
+  }
+  ImGui::Text("Frame %d", frame);
+  ImGui::End();
+}
+
+
+//
+// Runner
+//
+struct RunResult {
+  const char* name{nullptr};
+  double framesPerSecond{0.0};
+  double uiMean{0.0};               // Microseconds spent by the UI thread per frame, excluding waits
+  double speedup{0.0};
+  uint32_t lastFrameHash{0};
+};
+
+static RunResult Run(bool pipelined, int frames) {
+  ImGui::CreateContext();
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+  ImGui::StyleColorsDark();
+  ImGui_ImplNull_Init(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+  ImGui_ImplSoftRaster_Init(1);
+  ImGui_ImplSoftRaster_NewFrame();  // Font texture, before the render thread starts using the backend
+
+  const int totalFrames = kWarmupFrames + frames;
+  for (int frame = 0; frame < totalFrames; frame++) {
+    ImGui_ImplNull_ScriptMousePos(frame, ImVec2((float)((frame * 7) % kDisplayWidth), (float)((frame * 5) % kDisplayHeight)));
+  }
+
+  RenderTarget target;
+  target.pixels.resize((size_t)kDisplayWidth * kDisplayHeight);
+  target.framebuffer.Pixels = target.pixels.data();
+  target.framebuffer.Width = target.framebuffer.Stride = kDisplayWidth;
+  target.framebuffer.Height = kDisplayHeight;
+
+  std::vector<unsigned char> checker((size_t)kTextureSize * kTextureSize * 4);
+  for (int y = 0; y < kTextureSize; y++) {
+    for (int x = 0; x < kTextureSize; x++) {
+      const ImU32 c = ((x / 16 + y / 16) & 1) ? IM_COL32(255, 160, 0, 255) : IM_COL32(40, 40, 40, 255);
+      memcpy(&checker[((size_t)y * kTextureSize + x) * 4], &c, 4);
+    }
+  }
+
+  ImGui_ImplPipeline* pipeline{nullptr};
+  std::thread renderThread;
+  int textureRequest{0};
+  ImTextureID texture{0};
+  bool textureReady{false};
+  if (pipelined) {
+    pipeline = ImGui_ImplPipeline_Create(CreateTexture, &target);
+    textureRequest = ImGui_ImplPipeline_QueueTexture(pipeline, kTextureSize, kTextureSize, checker.data());
+    renderThread = std::thread([pipeline, &target]() {
+      while (ImDrawData* drawData = ImGui_ImplPipeline_AcquireFrame(pipeline)) {
+        RenderFrame(&target, drawData);
+        ImGui_ImplPipeline_ReleaseFrame(pipeline);
+      }
+    });
+  } else {
+    texture = CreateTexture(kTextureSize, kTextureSize, checker.data(), &target);
+    textureReady = true;
+  }
+
+  double uiSum{0.0};
+  auto start = std::chrono::high_resolution_clock::now();
+  for (int frame = 0; frame < totalFrames; frame++) {
+    if (frame == kWarmupFrames) {
+      start = std::chrono::high_resolution_clock::now();
+    }
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    if (pipelined && !textureReady) {
+      textureReady = ImGui_ImplPipeline_GetTexture(pipeline, textureRequest, &texture);
+    }
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    BuildUI(frame, texture, textureReady);
+    ImGui::Render();
+    const auto t1 = std::chrono::high_resolution_clock::now();
+    if (pipelined) {
+      ImGui_ImplPipeline_PushFrame(pipeline, ImGui::GetDrawData());
+    } else {
+      RenderFrame(&target, ImGui::GetDrawData());
+    }
+    if (frame >= kWarmupFrames) {
+      uiSum += std::chrono::duration<double, std::micro>(t1 - t0).count();
+    }
+  }
+  if (pipelined) {
+    ImGui_ImplPipeline_Quit(pipeline);
+    renderThread.join();
+    ImGui_ImplPipeline_Destroy(pipeline);
+  }
+  const auto end = std::chrono::high_resolution_clock::now();
+
+  RunResult result;
+  result.name = pipelined ? "pipelined" : "sequential";
+  result.framesPerSecond = frames / std::chrono::duration<double>(end - start).count();
+  result.uiMean = uiSum / frames;
+  result.lastFrameHash = HashPixels(target.pixels);
+
+  for (ImGui_ImplSoftRaster_Texture* userTexture : target.textures) {
+    delete[] userTexture->Pixels;
+    delete userTexture;
+  }
+  ImGui_ImplSoftRaster_Shutdown();
+  ImGui_ImplNull_Shutdown();
+  ImGui::DestroyContext();
+  return result;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  int frames{kDefaultFrames};
+  bool json{false};
+  bench::Args args(argc, argv, "[--frames N] [--json]");
+  while (args.Next()) {
+    if (!args.Int("--frames", &frames) && !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (frames <= 0) {
+    return args.Fail();
+  }
+
+  RunResult results[2] = {Run(false, frames), Run(true, frames)};
+  for (RunResult& r : results) {
+    r.speedup = r.framesPerSecond / results[0].framesPerSecond;
+  }
+  const bool framesMatch = results[0].lastFrameHash == results[1].lastFrameHash;
+
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"hardware_threads\": %u,\n  \"frames\": %d,\n  \"results\": [\n", ImGui::GetVersion(), std::thread::hardware_concurrency(), frames);
+    for (int n = 0; n < 2; n++) {
+      const RunResult& r = results[n];
+      printf("    {\"mode\": \"%s\", \"frames_per_second\": %.2f, \"ui_mean_us\": %.2f, \"speedup\": %.2f, \"last_frame_hash\": \"%08X\"}%s\n",
+             r.name, r.framesPerSecond, r.uiMean, r.speedup, r.lastFrameHash, n == 0 ? "," : "");
+    }
+    printf("  ],\n  \"frames_match\": %s\n}\n", framesMatch ? "true" : "false");
+  } else {
+    printf("Dear ImGui %s, %u hardware threads, %d frames, softraster renderer, times in microseconds\n", ImGui::GetVersion(), std::thread::hardware_concurrency(), frames);
+    printf("%-10s %10s %10s %8s %10s\n", "mode", "frames/s", "ui", "speedup", "hash");
+    for (const RunResult& r : results) {
+      printf("%-10s %10.1f %10.1f %8.2f %08X\n", r.name, r.framesPerSecond, r.uiMean, r.speedup, r.lastFrameHash);
+    }
+    if (!framesMatch) {
+      printf("last frames DIFFER\n");
+    }
+  }
+  return framesMatch ? 0 : 2;
+}
@@ -0,0 +1,228 @@
+/**
+ *
+ * imgui_bench_raster: glyph rasterizer benchmark.
+ *
+ * Rasterizes every glyph of the full Chinese ranges
+ * (GetGlyphRangesChineseFull(): Latin, CJK punctuation, Hiragana, Katakana,
+ * half-width forms and all of the CJK ideographs) that the font has, at
+ * --size pixels with the default 3x horizontal oversampling of ImFontConfig,
+ * with two copies of imstb_truetype.h compiled in this program: the scalar
+ * reference and the SSE2 one (STBTT_SSE2, as imgui_draw.cpp compiles it,
+ * in imgui_bench_raster_stbtt.cpp).
+ * Reports the time of each and the largest pixel difference, then times
+ * ImFontAtlas::Build() for the same font and ranges.
+ * Without --font, the default font is used, which only has Latin glyphs:
+ * give it a CJK font (e.g. NotoSansCJK, DroidSansFallback) for the full run.
+ * The exit code is 2 if any pixel differs by more than 1 from the reference.
+ *
+ * Usage:
+ *   imgui_bench_raster [--font FILE] [--size N] [--rounds N] [--json]
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "imgui_bench_common.h"
+
+// The scalar reference: the same stb_truetype, without STBTT_SSE2. The SSE2 copy is in imgui_bench_raster_stbtt.cpp.
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "imgui/imstb_truetype.h"
+
+namespace raster_sse2 {
+bool Enabled();
+void* CreateFont(const unsigned char* data, int offset);
+void DestroyFont(void* font);
+void MakeGlyphBitmap(const void* font, unsigned char* output, int width, int height, int stride, float scaleX, float scaleY, int glyph);
+}  // namespace raster_sse2
+
+
+constexpr float kDefaultSizePixels{32.0f};
+constexpr int32_t kDefaultRounds{5};
+constexpr int32_t kOversampleH{3};                 // ImFontConfig::OversampleH default
+constexpr int32_t kOversampleV{1};
+constexpr int32_t kMaxDifference{1};
+
+struct Glyph {
+  int index{0};
+  int width{0};
+  int height{0};
+  size_t offset{0};
+};
+
+struct RasterResult {
+  int glyphs{0};
+  size_t pixels{0};
+  double referenceMs{1e30};
+  double sse2Ms{1e30};
+  double atlasBuildMs{1e30};
+  int atlasWidth{0};
+  int atlasHeight{0};
+  int maxDifference{0};
+  size_t differentPixels{0};
+};
+
+// The glyphs of the font in the ranges, with their bitmap box as ImFontAtlasBuildWithStbTruetype() computes it
+static std::vector<Glyph> ListGlyphs(const stbtt_fontinfo* info, const ImWchar* ranges, float scaleX, float scaleY, size_t* pixels) {
+  std::vector<Glyph> glyphs;
+  std::vector<bool> seen;
+  *pixels = 0;
+  for (const ImWchar* range = ranges; range[0] && range[1]; range += 2) {
+    for (unsigned int c = range[0]; c <= range[1]; c++) {
+      const int index = stbtt_FindGlyphIndex(info, (int)c);
+      if (index == 0) {
+        continue;
+      }
+      if ((size_t)index >= seen.size()) {
+        seen.resize((size_t)index + 1, false);
+      }
+      if (seen[index]) {
+        continue;
+      }
+      seen[index] = true;
+      int x0{0};
+      int y0{0};
+      int x1{0};
+      int y1{0};
+      stbtt_GetGlyphBitmapBoxSubpixel(info, index, scaleX, scaleY, 0.0f, 0.0f, &x0, &y0, &x1, &y1);
+      Glyph glyph;
+      glyph.index = index;
+      glyph.width = x1 - x0;
+      glyph.height = y1 - y0;
+      glyph.offset = *pixels;
+      if (glyph.width > 0 && glyph.height > 0) {
+        *pixels += (size_t)glyph.width * (size_t)glyph.height;
+        glyphs.push_back(glyph);
+      }
+    }
+  }
+  return glyphs;
+}
+
+template <typename MakeBitmap>
+static double Rasterize(const std::vector<Glyph>& glyphs, float scaleX, float scaleY, std::vector<unsigned char>* out, MakeBitmap makeBitmap) {
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  for (const Glyph& glyph : glyphs) {
+    makeBitmap(out->data() + glyph.offset, glyph.width, glyph.height, glyph.width, scaleX, scaleY, glyph.index);
+  }
+  return bench::MillisecondsSince(t0);
+}
+
+static RasterResult Run(std::vector<unsigned char>& fontData, float sizePixels, int rounds) {
+  RasterResult result;
+  ImFontAtlas atlas;
+  const ImWchar* ranges = atlas.GetGlyphRangesChineseFull();
+
+  stbtt_fontinfo referenceInfo;
+  const int fontOffset = stbtt_GetFontOffsetForIndex(fontData.data(), 0);
+  if (fontOffset < 0 || !stbtt_InitFont(&referenceInfo, fontData.data(), fontOffset)) {
+    return result;
+  }
+  void* sse2Font = raster_sse2::CreateFont(fontData.data(), fontOffset);
+  const float scale = stbtt_ScaleForPixelHeight(&referenceInfo, sizePixels);
+  const float scaleX = scale * kOversampleH;
+  const float scaleY = scale * kOversampleV;
+  const std::vector<Glyph> glyphs = ListGlyphs(&referenceInfo, ranges, scaleX, scaleY, &result.pixels);
+  result.glyphs = (int)glyphs.size();
+
+  // Interleaved rounds, keeping the best time of each, since the machine may be busy
+  std::vector<unsigned char> reference(result.pixels);
+  std::vector<unsigned char> sse2(result.pixels);
+  for (int round = 0; round < rounds; round++) {
+    result.referenceMs = std::min(result.referenceMs, Rasterize(glyphs, scaleX, scaleY, &reference,
+                                                                [&referenceInfo](unsigned char* output, int w, int h, int stride, float sx, float sy, int glyph) {
+                                                                  stbtt_MakeGlyphBitmap(&referenceInfo, output, w, h, stride, sx, sy, glyph);
+                                                                }));
+    result.sse2Ms = std::min(result.sse2Ms, Rasterize(glyphs, scaleX, scaleY, &sse2,
+                                                      [sse2Font](unsigned char* output, int w, int h, int stride, float sx, float sy, int glyph) {
+                                                        raster_sse2::MakeGlyphBitmap(sse2Font, output, w, h, stride, sx, sy, glyph);
+                                                      }));
+  }
+  raster_sse2::DestroyFont(sse2Font);
+  for (size_t n = 0; n < result.pixels; n++) {
+    const int difference = std::abs((int)reference[n] - (int)sse2[n]);
+    result.maxDifference = std::max(result.maxDifference, difference);
+    result.differentPixels += difference != 0 ? 1 : 0;
+  }
+
+  // The whole atlas build: rasterization, rectangle packing, and the 3x horizontal oversampling filter
+  for (int round = 0; round < rounds; round++) {
+    ImFontConfig config;
+    config.FontDataOwnedByAtlas = false;
+    config.OversampleH = kOversampleH;
+    config.OversampleV = kOversampleV;
+    atlas.Clear();
+    atlas.AddFontFromMemoryTTF(fontData.data(), (int)fontData.size(), sizePixels, &config, ranges);
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    atlas.Build();
+    result.atlasBuildMs = std::min(result.atlasBuildMs, bench::MillisecondsSince(t0));
+  }
+  result.atlasWidth = atlas.TexWidth;
+  result.atlasHeight = atlas.TexHeight;
+  return result;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  const char* fontFilename{nullptr};
+  float sizePixels{kDefaultSizePixels};
+  int rounds{kDefaultRounds};
+  bool json{false};
+  bench::Args args(argc, argv, "[--font FILE] [--size N] [--rounds N] [--json]");
+  while (args.Next()) {
+    if (!args.String("--font", &fontFilename) && !args.Float("--size", &sizePixels) && !args.Int("--rounds", &rounds) &&
+        !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (sizePixels <= 0.0f || rounds <= 0) {
+    return args.Fail();
+  }
+
+  // The default font is decompressed by AddFontDefault(), and kept by the atlas
+  std::vector<unsigned char> fontData;
+  if (fontFilename != nullptr) {
+    if (!bench::LoadFile(fontFilename, &fontData)) {
+      fprintf(stderr, "Could not load '%s'\n", fontFilename);
+      return 1;
+    }
+  } else {
+    ImFontAtlas defaultAtlas;
+    defaultAtlas.AddFontDefault();
+    const ImFontConfig& config = defaultAtlas.ConfigData[0];
+    fontData.assign((const unsigned char*)config.FontData, (const unsigned char*)config.FontData + config.FontDataSize);
+  }
+
+  const RasterResult r = Run(fontData, sizePixels, rounds);
+  if (r.glyphs == 0) {
+    fprintf(stderr, "No glyphs in '%s'\n", fontFilename != nullptr ? fontFilename : "default font");
+    return 1;
+  }
+  const bool ok = r.maxDifference <= kMaxDifference;
+  const bool sse2 = raster_sse2::Enabled();
+
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"font\": \"%s\",\n  \"size_pixels\": %.1f,\n  \"oversample_h\": %d,\n  \"sse2\": %s,\n",
+           ImGui::GetVersion(), fontFilename != nullptr ? fontFilename : "default", sizePixels, kOversampleH, sse2 ? "true" : "false");
+    printf("  \"glyphs\": %d,\n  \"pixels\": %zu,\n  \"reference_ms\": %.3f,\n  \"sse2_ms\": %.3f,\n", r.glyphs, r.pixels, r.referenceMs, r.sse2Ms);
+    printf("  \"atlas_build_ms\": %.3f,\n  \"atlas_width\": %d,\n  \"atlas_height\": %d,\n", r.atlasBuildMs, r.atlasWidth, r.atlasHeight);
+    printf("  \"max_difference\": %d,\n  \"different_pixels\": %zu\n}\n", r.maxDifference, r.differentPixels);
+  } else {
+    printf("Dear ImGui %s, %s at %.1f px, %dx%d oversampling, %d glyphs, %.1f Mpixels\n", ImGui::GetVersion(),
+           fontFilename != nullptr ? fontFilename : "default font", sizePixels, kOversampleH, kOversampleV, r.glyphs, r.pixels / 1e6);
+    printf("rasterize:  reference %9.3f ms   sse2 %9.3f ms   (%.2fx)%s\n", r.referenceMs, r.sse2Ms, r.referenceMs / r.sse2Ms,
+           sse2 ? "" : "   [SSE2 not available: same code]");
+    printf("ImFontAtlas::Build(): %9.3f ms, %dx%d texture\n", r.atlasBuildMs, r.atlasWidth, r.atlasHeight);
+    printf("pixels, sse2 vs reference:  max difference %d, %zu different (%.3f%%)  %s\n", r.maxDifference, r.differentPixels,
+           100.0 * (double)r.differentPixels / (double)r.pixels, ok ? "ok" : "DIFFER");
+  }
+  return ok ? 0 : 2;
+}
@@ -0,0 +1,48 @@
+/**
+ *
+ * imgui_bench_raster_stbtt: the SSE2 copy of stb_truetype for imgui_bench_raster.
+ *
+ * Compiled with STBTT_SSE2 as imgui_draw.cpp compiles it. The functions of
+ * stb_truetype have C linkage, so the reference copy in imgui_bench_raster.cpp
+ * and this one can't be in the same translation unit: this one is only
+ * reached through the functions below.
+ *
+ */
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+
+#ifdef IMGUI_ENABLE_SSE2
+#define STBTT_SSE2
+#endif
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "imgui/imstb_truetype.h"
+
+namespace raster_sse2 {
+
+bool Enabled() {
+#ifdef STBTT_SSE2
+  return true;
+#else
+  return false;
+#endif
+}
+
+void* CreateFont(const unsigned char* data, int offset) {
+  stbtt_fontinfo* info = new stbtt_fontinfo();
+  if (!stbtt_InitFont(info, data, offset)) {
+    delete info;
+    return nullptr;
+  }
+  return info;
+}
+
+void DestroyFont(void* font) {
+  delete (stbtt_fontinfo*)font;
+}
+
+void MakeGlyphBitmap(const void* font, unsigned char* output, int width, int height, int stride, float scaleX, float scaleY, int glyph) {
+  stbtt_MakeGlyphBitmap((const stbtt_fontinfo*)font, output, width, height, stride, scaleX, scaleY, glyph);
+}
+
+}  // namespace raster_sse2
@@ -0,0 +1,299 @@
+/**
+ *
+ * imgui_bench_sdf: signed distance field font benchmark.
+ *
+ * Builds the default font in --sizes sizes (multiples of 13 pixels, the
+ * size it is designed for) into one atlas, the usual way to get text of
+ * several sizes, and once at --base pixels with
+ * ImFontConfig::SignedDistanceField, then reports the build times and the
+ * texture memory: RGBA32, as the OpenGL3 backend uploaded the atlas before,
+ * and single channel, as it does now with texture swizzles.
+ * Then resamples every printable ASCII glyph on the CPU at each size, the
+ * way the OpenGL3 backend draws them (bilinear filtering, then distance to
+ * coverage over the distance covered by one pixel), and reports the mean
+ * difference with the glyph rasterized at that size, next to scaling the
+ * regular glyph of the base size (ImFont::Scale without distance fields).
+ * Also checks the draw commands: text of a distance field font goes to
+ * commands using ImFontAtlas::TexIDSdf, consecutive texts share one, other
+ * shapes stay on TexID, and everything uses TexID when the backend leaves
+ * TexIDSdf to 0. The exit code is 2 otherwise.
+ *
+ * Usage:
+ *   imgui_bench_sdf [--sizes N] [--base PX] [--reps N] [--json]
+ *
+ */
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "imgui_bench_common.h"
+
+
+constexpr int32_t kDefaultSizes{8};
+constexpr int32_t kDefaultBasePixels{26};
+constexpr int32_t kDefaultReps{5};
+constexpr int32_t kSizeStepPixels{13};
+constexpr ImTextureID kTexID{1};
+constexpr ImTextureID kTexIDSdf{2};
+
+struct BuildResult {
+  double buildMs{0.0};  // Best of --reps
+  int glyphs{0};
+  int texWidth{0};
+  int texHeight{0};
+  size_t Alpha8Bytes() const { return (size_t)texWidth * (size_t)texHeight; }
+  size_t Rgba32Bytes() const { return Alpha8Bytes() * 4; }
+};
+
+struct QualityResult {
+  int sizePixels{0};
+  double sdfError{0.0};     // Mean absolute coverage difference with the glyphs rasterized at that size, over the pixels covered by either
+  double scaledError{0.0};  // Same, scaling the regular glyphs of the base size
+};
+
+static void AddFonts(ImFontAtlas* atlas, const std::vector<int>& sizes, bool sdf) {
+  for (int size : sizes) {
+    ImFontConfig config;
+    config.SizePixels = (float)size;
+    config.SignedDistanceField = sdf;
+    atlas->AddFontDefault(&config);
+  }
+}
+
+static BuildResult TimeBuild(const std::vector<int>& sizes, bool sdf, int reps) {
+  BuildResult result;
+  result.buildMs = 1e30;
+  for (int rep = 0; rep < reps; rep++) {
+    ImFontAtlas atlas;
+    AddFonts(&atlas, sizes, sdf);
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    atlas.Build();
+    result.buildMs = ImMin(result.buildMs, bench::MillisecondsSince(t0));
+    result.glyphs = 0;
+    for (const ImFont* font : atlas.Fonts) {
+      result.glyphs += font->Glyphs.Size;
+    }
+    result.texWidth = atlas.TexWidth;
+    result.texHeight = atlas.TexHeight;
+  }
+  return result;
+}
+
+// Bilinear filtering of the atlas at texel coordinates, clamped to the edges, like GL_LINEAR
+static float SampleBilinear(const unsigned char* pixels, int width, int height, float x, float y) {
+  x -= 0.5f;
+  y -= 0.5f;
+  const float fx = x - floorf(x);
+  const float fy = y - floorf(y);
+  const int x0 = ImClamp((int)floorf(x), 0, width - 1);
+  const int y0 = ImClamp((int)floorf(y), 0, height - 1);
+  const int x1 = ImMin(x0 + 1, width - 1);
+  const int y1 = ImMin(y0 + 1, height - 1);
+  const float top = pixels[y0 * width + x0] + (pixels[y0 * width + x1] - pixels[y0 * width + x0]) * fx;
+  const float bottom = pixels[y1 * width + x0] + (pixels[y1 * width + x1] - pixels[y1 * width + x0]) * fx;
+  return (top + (bottom - top) * fy) / 255.0f;
+}
+
+// Draws one glyph in a cell, sampling the atlas at pixel centers, with the top left corner of its outline box (inside the distance
+// field padding) at (origin, origin). With sdf, converts distances into coverage like the OpenGL3 backend fragment shader, with
+// fwidth() taken from the next pixels.
+static void RenderGlyph(const ImFontAtlas* atlas, const ImFontGlyph* glyph, float scale, float padding, bool sdf, int cellSize, float origin,
+                        std::vector<float>* out) {
+  out->assign((size_t)cellSize * (size_t)cellSize, 0.0f);
+  if (!glyph->Visible) {
+    return;
+  }
+  const float x0 = origin - padding * scale;
+  const float y0 = origin - padding * scale;
+  const float x1 = x0 + (glyph->X1 - glyph->X0) * scale;
+  const float y1 = y0 + (glyph->Y1 - glyph->Y0) * scale;
+  const float texelsPerPixelX = (glyph->U1 - glyph->U0) * atlas->TexWidth / (x1 - x0);
+  const float texelsPerPixelY = (glyph->V1 - glyph->V0) * atlas->TexHeight / (y1 - y0);
+  for (int py = ImMax(0, (int)floorf(y0)); py < ImMin(cellSize, (int)ceilf(y1)); py++) {
+    for (int px = ImMax(0, (int)floorf(x0)); px < ImMin(cellSize, (int)ceilf(x1)); px++) {
+      const float cx = px + 0.5f;
+      const float cy = py + 0.5f;
+      if (cx < x0 || cx >= x1 || cy < y0 || cy >= y1) {
+        continue;
+      }
+      const float tx = glyph->U0 * atlas->TexWidth + (cx - x0) * texelsPerPixelX;
+      const float ty = glyph->V0 * atlas->TexHeight + (cy - y0) * texelsPerPixelY;
+      const float d = SampleBilinear(atlas->TexPixelsAlpha8, atlas->TexWidth, atlas->TexHeight, tx, ty);
+      if (!sdf) {
+        (*out)[(size_t)py * cellSize + px] = d;
+        continue;
+      }
+      const float dx = SampleBilinear(atlas->TexPixelsAlpha8, atlas->TexWidth, atlas->TexHeight, tx + texelsPerPixelX, ty) - d;
+      const float dy = SampleBilinear(atlas->TexPixelsAlpha8, atlas->TexWidth, atlas->TexHeight, tx, ty + texelsPerPixelY) - d;
+      const float width = ImMax(fabsf(dx) + fabsf(dy), 0.0001f);
+      (*out)[(size_t)py * cellSize + px] = ImSaturate((d - 0.5f) / width + 0.5f);
+    }
+  }
+}
+
+// Glyphs are aligned on their outline boxes, so that the differences come from the shapes rather than from the rounding of the
+// ascent, which ImGui does for each size.
+static QualityResult MeasureQuality(const ImFontAtlas* regularAtlas, const ImFont* regular, const ImFont* regularBase, const ImFontAtlas* sdfAtlas,
+                                    const ImFont* sdf) {
+  QualityResult result;
+  result.sizePixels = (int)regular->FontSize;
+  const int cellSize = (int)regular->FontSize * 2;
+  const float origin = regular->FontSize * 0.5f;
+  const float sdfPadding = (float)sdfAtlas->ConfigData[0].SdfPadding;
+  std::vector<float> reference, sdfCoverage, scaledCoverage;
+  double sdfError{0.0};
+  double scaledError{0.0};
+  double sdfCovered{0.0};
+  double scaledCovered{0.0};
+  for (ImWchar c = 0x21; c < 0x7F; c++) {
+    RenderGlyph(regularAtlas, regular->FindGlyph(c), 1.0f, 0.0f, false, cellSize, origin, &reference);
+    RenderGlyph(sdfAtlas, sdf->FindGlyph(c), regular->FontSize / sdf->FontSize, sdfPadding, true, cellSize, origin, &sdfCoverage);
+    RenderGlyph(regularAtlas, regularBase->FindGlyph(c), regular->FontSize / regularBase->FontSize, 0.0f, false, cellSize, origin, &scaledCoverage);
+    for (size_t n = 0; n < reference.size(); n++) {
+      sdfError += fabsf(sdfCoverage[n] - reference[n]);
+      scaledError += fabsf(scaledCoverage[n] - reference[n]);
+      sdfCovered += (sdfCoverage[n] > 0.0f || reference[n] > 0.0f) ? 1.0 : 0.0;
+      scaledCovered += (scaledCoverage[n] > 0.0f || reference[n] > 0.0f) ? 1.0 : 0.0;
+    }
+  }
+  result.sdfError = sdfCovered > 0.0 ? sdfError / sdfCovered : 0.0;
+  result.scaledError = scaledCovered > 0.0 ? scaledError / scaledCovered : 0.0;
+  return result;
+}
+
+// Texture ID and element count of the non-empty commands of a draw list
+static std::vector<ImDrawCmd> NonEmptyCommands(const ImDrawList* drawList) {
+  std::vector<ImDrawCmd> commands;
+  for (const ImDrawCmd& cmd : drawList->CmdBuffer) {
+    if (cmd.ElemCount > 0) {
+      commands.push_back(cmd);
+    }
+  }
+  return commands;
+}
+
+// Two texts, a rectangle, a text: with TexIDSdf, one command for both texts, one for the rectangle, one for the last text.
+// Without, a single command.
+static int CountCommandMismatches(ImFontAtlas* atlas, ImTextureID texIDSdf) {
+  ImGuiContext* context = ImGui::CreateContext(atlas);
+  ImGuiIO& io = ImGui::GetIO();
+  io.DisplaySize = ImVec2(1280.0f, 720.0f);
+  io.DeltaTime = 1.0f / 60.0f;
+  io.IniFilename = nullptr;
+  atlas->SetTexID(kTexID);
+  atlas->TexIDSdf = texIDSdf;
+  ImFont* font = atlas->Fonts[0];
+
+  ImGui::NewFrame();
+  ImDrawList* drawList = ImGui::GetForegroundDrawList();
+  drawList->AddText(font, 40.0f, ImVec2(10.0f, 10.0f), IM_COL32_WHITE, "one");
+  drawList->AddText(font, 80.0f, ImVec2(10.0f, 60.0f), IM_COL32_WHITE, "two");
+  drawList->AddRectFilled(ImVec2(10.0f, 200.0f), ImVec2(100.0f, 220.0f), IM_COL32_WHITE);
+  drawList->AddText(font, 20.0f, ImVec2(10.0f, 240.0f), IM_COL32_WHITE, "three");
+  ImGui::Render();
+
+  const std::vector<ImDrawCmd> commands = NonEmptyCommands(drawList);
+  int mismatches{0};
+  if (texIDSdf != (ImTextureID)0) {
+    const ImTextureID expectedTexIDs[] = {texIDSdf, kTexID, texIDSdf};
+    const unsigned int expectedElems[] = {6 * 6, 6, 5 * 6};
+    mismatches += commands.size() == IM_ARRAYSIZE(expectedTexIDs) ? 0 : 1;
+    for (size_t n = 0; n < commands.size() && n < IM_ARRAYSIZE(expectedTexIDs); n++) {
+      mismatches += (commands[n].TextureId == expectedTexIDs[n] && commands[n].ElemCount == expectedElems[n]) ? 0 : 1;
+    }
+  } else {
+    mismatches += (commands.size() == 1 && commands[0].TextureId == kTexID && commands[0].ElemCount == (6 + 1 + 5) * 6) ? 0 : 1;
+  }
+  ImGui::DestroyContext(context);
+  return mismatches;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  int sizeCount{kDefaultSizes};
+  int basePixels{kDefaultBasePixels};
+  int reps{kDefaultReps};
+  bool json{false};
+  bench::Args args(argc, argv, "[--sizes N] [--base PX] [--reps N] [--json]");
+  while (args.Next()) {
+    if (!args.Int("--sizes", &sizeCount) && !args.Int("--base", &basePixels) && !args.Int("--reps", &reps) &&
+        !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (sizeCount <= 0 || basePixels <= 0 || reps <= 0) {
+    return args.Fail();
+  }
+
+  // The regular atlas also holds the base size, to compare with scaling its glyphs
+  std::vector<int> sizes;
+  for (int n = 1; n <= sizeCount; n++) {
+    sizes.push_back(n * kSizeStepPixels);
+  }
+  std::vector<int> regularSizes = sizes;
+  if (basePixels % kSizeStepPixels != 0 || basePixels / kSizeStepPixels > sizeCount) {
+    regularSizes.push_back(basePixels);
+  }
+
+  const BuildResult regularBuild = TimeBuild(regularSizes, false, reps);
+  const BuildResult sdfBuild = TimeBuild(std::vector<int>{basePixels}, true, reps);
+
+  ImFontAtlas regularAtlas;
+  AddFonts(&regularAtlas, regularSizes, false);
+  regularAtlas.Build();
+  ImFontAtlas sdfAtlas;
+  AddFonts(&sdfAtlas, std::vector<int>{basePixels}, true);
+  sdfAtlas.Build();
+  const ImFont* regularBase = nullptr;
+  for (const ImFont* font : regularAtlas.Fonts) {
+    regularBase = (font->FontSize == (float)basePixels) ? font : regularBase;
+  }
+  std::vector<QualityResult> quality;
+  for (int n = 0; n < sizeCount; n++) {
+    quality.push_back(MeasureQuality(&regularAtlas, regularAtlas.Fonts[n], regularBase, &sdfAtlas, sdfAtlas.Fonts[0]));
+  }
+
+  int mismatches{0};
+  mismatches += CountCommandMismatches(&sdfAtlas, kTexIDSdf);
+  mismatches += CountCommandMismatches(&sdfAtlas, (ImTextureID)0);
+
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"sizes\": %d,\n  \"base_pixels\": %d,\n", ImGui::GetVersion(), (int)regularSizes.size(), basePixels);
+    printf("  \"regular\": {\"build_ms\": %.3f, \"glyphs\": %d, \"tex_width\": %d, \"tex_height\": %d, \"rgba32_bytes\": %zu, \"alpha8_bytes\": %zu},\n",
+           regularBuild.buildMs, regularBuild.glyphs, regularBuild.texWidth, regularBuild.texHeight, regularBuild.Rgba32Bytes(), regularBuild.Alpha8Bytes());
+    printf("  \"sdf\": {\"build_ms\": %.3f, \"glyphs\": %d, \"tex_width\": %d, \"tex_height\": %d, \"rgba32_bytes\": %zu, \"alpha8_bytes\": %zu},\n",
+           sdfBuild.buildMs, sdfBuild.glyphs, sdfBuild.texWidth, sdfBuild.texHeight, sdfBuild.Rgba32Bytes(), sdfBuild.Alpha8Bytes());
+    printf("  \"quality\": [");
+    for (size_t n = 0; n < quality.size(); n++) {
+      printf("%s\n    {\"size_pixels\": %d, \"sdf_error\": %.4f, \"scaled_error\": %.4f}", n ? "," : "", quality[n].sizePixels, quality[n].sdfError,
+             quality[n].scaledError);
+    }
+    printf("\n  ],\n  \"mismatches\": %d\n}\n", mismatches);
+  } else {
+    printf("Dear ImGui %s, default font, %d sizes from %d to %d px against one distance field font at %d px\n", ImGui::GetVersion(),
+           (int)regularSizes.size(), sizes.front(), sizes.back(), basePixels);
+    printf("%-16s %10s %8s %12s %12s %12s\n", "atlas", "build ms", "glyphs", "texture", "RGBA32 KB", "1 channel KB");
+    const BuildResult* builds[] = {&regularBuild, &sdfBuild};
+    const char* names[] = {"one per size", "distance field"};
+    for (int n = 0; n < 2; n++) {
+      char texture[32];
+      snprintf(texture, sizeof(texture), "%dx%d", builds[n]->texWidth, builds[n]->texHeight);
+      printf("%-16s %10.3f %8d %12s %12.1f %12.1f\n", names[n], builds[n]->buildMs, builds[n]->glyphs, texture, builds[n]->Rgba32Bytes() / 1024.0,
+             builds[n]->Alpha8Bytes() / 1024.0);
+    }
+    printf("texture memory: %.1fx less than one RGBA32 atlas per size\n", (double)regularBuild.Rgba32Bytes() / (double)sdfBuild.Alpha8Bytes());
+    printf("mean coverage difference with glyphs rasterized at each size (pixels covered by either):\n");
+    printf("%8s %16s %16s\n", "size px", "distance field", "scaled bitmap");
+    for (const QualityResult& q : quality) {
+      printf("%8d %15.1f%% %15.1f%%\n", q.sizePixels, q.sdfError * 100.0, q.scaledError * 100.0);
+    }
+    printf("draw commands (ImFontAtlas::TexIDSdf set, then left to 0):  %s\n", mismatches == 0 ? "as expected" : "DIFFER");
+  }
+  return mismatches == 0 ? 0 : 2;
+}
@@ -0,0 +1,234 @@
+/**
+ *
+ * imgui_bench_settings: .ini settings store benchmark.
+ *
+ * Builds with IMGUI_ENABLE_ASYNC_INI_SAVING. Submits --windows windows, the
+ * first --tables of them holding a sortable/resizable table, so that every
+ * window and table has settings, then times:
+ *   - FindWindowSettings() lookups (hashed index),
+ *   - SaveIniSettingsToMemory() the first time (every entry formatted), with
+ *     nothing changed, and with one window moved (only that entry formatted),
+ *   - SaveIniSettingsToDisk() on the UI thread (the file is written by the
+ *     background writer thread).
+ * The incremental output is checked against a full rewrite (the same text
+ * loaded into a fresh context and saved again), and the files written in the
+ * background against the saved text: FILE.ini, FILE.ini.second.ini and
+ * FILE.ini again are queued back to back, while the previous request is
+ * pending or being written. The exit code is 2 if anything differs or either
+ * file is missing.
+ *
+ * Usage:
+ *   imgui_bench_settings [--windows N] [--tables N] [--file FILE.ini] [--json]
+ *
+ */
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "imgui/imgui_impl_null.h"
+#include "imgui_bench_common.h"
+
+#ifndef IMGUI_ENABLE_ASYNC_INI_SAVING
+#error "imgui_bench_settings must be compiled with IMGUI_ENABLE_ASYNC_INI_SAVING"
+#endif
+
+
+constexpr int32_t kDisplayWidth{1920};
+constexpr int32_t kDisplayHeight{1080};
+constexpr int32_t kDefaultWindows{2000};
+constexpr int32_t kDefaultTables{500};
+constexpr int32_t kTableColumns{6};
+constexpr int32_t kLookupRounds{50};
+constexpr int32_t kSaveRounds{20};
+constexpr const char* kDefaultFile{"imgui_bench_settings.ini"};
+
+
+struct BenchResult {
+  int windows{0};
+  int tables{0};
+  size_t iniBytes{0};
+  double findNs{0.0};               // Per FindWindowSettings() call
+  double saveFirstUs{0.0};
+  double saveUnchangedUs{0.0};
+  double saveOneChangedUs{0.0};
+  double saveToDiskUs{0.0};         // UI thread only
+  bool incrementalMatches{false};
+  bool fileMatches{false};
+  bool secondFileMatches{false};    // Queued between two requests for the first one
+};
+
+static void WindowName(char* buf, size_t bufSize, int n) {
+  snprintf(buf, bufSize, "Window %05d", n);
+}
+
+static void BuildUi(int windows, int tables) {
+  char name[32];
+  for (int n = 0; n < windows; n++) {
+    WindowName(name, sizeof(name), n);
+    ImGui::SetNextWindowPos(ImVec2((float)((n * 37) % (kDisplayWidth - 300)), (float)((n * 23) % (kDisplayHeight - 200))), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(280.0f, 180.0f), ImGuiCond_FirstUseEver);
+    ImGui::Begin(name);
+    if (n < tables && ImGui::BeginTable("table", kTableColumns, ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable | ImGuiTableFlags_Sortable)) {
+      for (int column = 0; column < kTableColumns; column++) {
+        ImGui::TableSetupColumn(column == 0 ? "Name" : "Value", column == 0 ? ImGuiTableColumnFlags_DefaultSort : ImGuiTableColumnFlags_None);
+      }
+      ImGui::TableHeadersRow();
+      ImGui::EndTable();
+    }
+    ImGui::End();
+  }
+}
+
+static std::string SaveToString() {
+  size_t size = 0;
+  const char* data = ImGui::SaveIniSettingsToMemory(&size);
+  return std::string(data, size);
+}
+
+static bool FileMatches(const char* filename, const std::string& expected) {
+  size_t fileSize = 0;
+  char* fileData = (char*)ImFileLoadToMemory(filename, "rt", &fileSize, 1);
+  bool matches = fileData != nullptr && fileData == expected;
+  IM_FREE(fileData);
+  const std::string tmpFilename = std::string(filename) + ".tmp";
+  if (FILE* tmp = fopen(tmpFilename.c_str(), "rb")) {
+    fclose(tmp);
+    matches = false;                // Left behind: the rename failed
+  }
+  return matches;
+}
+
+static BenchResult Run(int windows, int tables, const char* filename) {
+  BenchResult result;
+  result.windows = windows;
+  result.tables = tables;
+
+  ImGuiContext* context = ImGui::CreateContext();
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;         // Saved explicitly below
+  io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+  ImGui_ImplNull_Init(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+  ImGui_ImplNullRender_Init();
+  for (int frame = 0; frame < 2; frame++) {
+    ImGui_ImplNullRender_NewFrame();
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    BuildUi(windows, tables);
+    ImGui::Render();
+  }
+
+  // Saves. The first one creates settings for every window and formats all of them.
+  auto t0 = std::chrono::high_resolution_clock::now();
+  std::string text = SaveToString();
+  result.saveFirstUs = bench::MicrosecondsSince(t0);
+  result.iniBytes = text.size();
+
+  t0 = std::chrono::high_resolution_clock::now();
+  for (int round = 0; round < kSaveRounds; round++) {
+    ImGui::SaveIniSettingsToMemory();
+  }
+  result.saveUnchangedUs = bench::MicrosecondsSince(t0) / kSaveRounds;
+
+  char name[32];
+  double oneChangedSum{0.0};
+  for (int round = 0; round < kSaveRounds; round++) {
+    WindowName(name, sizeof(name), (round * 97) % windows);
+    ImGui::SetWindowPos(name, ImVec2(10.0f + round, 20.0f + round));
+    t0 = std::chrono::high_resolution_clock::now();
+    text = SaveToString();
+    oneChangedSum += bench::MicrosecondsSince(t0);
+  }
+  result.saveOneChangedUs = oneChangedSum / kSaveRounds;
+
+  // Lookups
+  std::vector<ImGuiID> ids((size_t)windows);
+  for (int n = 0; n < windows; n++) {
+    WindowName(name, sizeof(name), n);
+    ids[(size_t)n] = ImHashStr(name);
+  }
+  int found{0};
+  t0 = std::chrono::high_resolution_clock::now();
+  for (int round = 0; round < kLookupRounds; round++) {
+    for (ImGuiID id : ids) {
+      found += ImGui::FindWindowSettings(id) != nullptr ? 1 : 0;
+    }
+  }
+  result.findNs = bench::MicrosecondsSince(t0) * 1000.0 / ((double)kLookupRounds * windows);
+  if (found != kLookupRounds * windows) {
+    fprintf(stderr, "FindWindowSettings() missed %d lookups\n", kLookupRounds * windows - found);
+  }
+
+  // Background writes, flushed by DestroyContext(). Each request is queued before the previous one is written.
+  const std::string secondFilename = std::string(filename) + ".second.ini";
+  remove(filename);
+  remove(secondFilename.c_str());
+  t0 = std::chrono::high_resolution_clock::now();
+  ImGui::SaveIniSettingsToDisk(filename);
+  result.saveToDiskUs = bench::MicrosecondsSince(t0);
+  const std::string savedText(ImGui::GetCurrentContext()->SettingsIniData.c_str());
+  ImGui::SaveIniSettingsToDisk(secondFilename.c_str());
+  ImGui::SaveIniSettingsToDisk(filename);
+
+  ImGui_ImplNullRender_Shutdown();
+  ImGui_ImplNull_Shutdown();
+  ImGui::DestroyContext(context);
+
+  // Full rewrite of the incremental output in a fresh context
+  ImGuiContext* check = ImGui::CreateContext();
+  ImGui::GetIO().IniFilename = nullptr;
+  ImGui::GetIO().ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+  ImGui::LoadIniSettingsFromMemory(text.c_str(), text.size());
+  result.incrementalMatches = SaveToString() == text;
+  ImGui::DestroyContext(check);
+
+  // Files written in the background
+  result.fileMatches = FileMatches(filename, savedText);
+  result.secondFileMatches = FileMatches(secondFilename.c_str(), savedText);
+  remove(filename);
+  remove(secondFilename.c_str());
+  return result;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  int windows{kDefaultWindows};
+  int tables{kDefaultTables};
+  const char* filename{kDefaultFile};
+  bool json{false};
+  bench::Args args(argc, argv, "[--windows N] [--tables N] [--file FILE.ini] [--json]");
+  while (args.Next()) {
+    if (!args.Int("--windows", &windows) && !args.Int("--tables", &tables) && !args.String("--file", &filename) &&
+        !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (windows <= 0 || tables < 0 || tables > windows) {
+    return args.Fail();
+  }
+
+  const BenchResult r = Run(windows, tables, filename);
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"windows\": %d,\n  \"tables\": %d,\n  \"ini_bytes\": %zu,\n", ImGui::GetVersion(), r.windows, r.tables, r.iniBytes);
+    printf("  \"find_window_settings_ns\": %.1f,\n  \"save_first_us\": %.1f,\n  \"save_unchanged_us\": %.1f,\n  \"save_one_changed_us\": %.1f,\n  \"save_to_disk_ui_us\": %.1f,\n",
+           r.findNs, r.saveFirstUs, r.saveUnchangedUs, r.saveOneChangedUs, r.saveToDiskUs);
+    printf("  \"incremental_matches\": %s,\n  \"file_matches\": %s,\n  \"second_file_matches\": %s\n}\n", r.incrementalMatches ? "true" : "false",
+           r.fileMatches ? "true" : "false", r.secondFileMatches ? "true" : "false");
+  } else {
+    printf("Dear ImGui %s, %d windows, %d tables, %zu bytes of .ini data\n", ImGui::GetVersion(), r.windows, r.tables, r.iniBytes);
+    printf("FindWindowSettings()                   %10.1f ns\n", r.findNs);
+    printf("SaveIniSettingsToMemory(), first       %10.1f us\n", r.saveFirstUs);
+    printf("SaveIniSettingsToMemory(), unchanged   %10.1f us\n", r.saveUnchangedUs);
+    printf("SaveIniSettingsToMemory(), one moved   %10.1f us\n", r.saveOneChangedUs);
+    printf("SaveIniSettingsToDisk(), UI thread     %10.1f us\n", r.saveToDiskUs);
+    printf("incremental output vs full rewrite:    %s\n", r.incrementalMatches ? "same" : "DIFFER");
+    printf("file written in the background:        %s\n", r.fileMatches ? "same" : "DIFFER");
+    printf("second file, queued in between:        %s\n", r.secondFileMatches ? "same" : "DIFFER");
+  }
+  return (r.incrementalMatches && r.fileMatches && r.secondFileMatches) ? 0 : 2;
+}
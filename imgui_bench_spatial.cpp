@@ -0,0 +1,255 @@
+/**
+ *
+ * imgui_bench_spatial: hovered window lookup and keyboard navigation scoring
+ * benchmark.
+ *
+ * Hover: submits --windows windows, either at pseudo-random overlapping
+ * positions ("scattered") or as child windows of a scrolling window, most of
+ * them clipped ("children"), then looks up the hovered window at --probes
+ * mouse positions, with the grid built by Begin() (g.WindowsHitGrid) and by
+ * testing every window front to back (Metrics/Debugger > Tools > Disable
+ * spatial index).
+ * Nav: submits one window holding --items buttons in rows of 100 and presses
+ * Right/Right/Down --moves times, with and without the early out before
+ * NavScoreItem(), and counts the items scored.
+ * The exit code is 2 if the hovered windows or the navigation paths differ.
+ *
+ * Usage:
+ *   imgui_bench_spatial [--windows N] [--probes N] [--items N] [--moves N] [--json]
+ *
+ */
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "imgui/imgui_impl_null.h"
+#include "imgui_bench_common.h"
+
+
+constexpr int32_t kDisplayWidth{1920};
+constexpr int32_t kDisplayHeight{1080};
+constexpr int32_t kDefaultWindows{10000};
+constexpr int32_t kDefaultProbes{20000};
+constexpr int32_t kDefaultItems{10000};
+constexpr int32_t kDefaultMoves{30};
+constexpr int32_t kItemsPerRow{100};
+constexpr int32_t kChildrenPerRow{20};
+constexpr int32_t kWarmupFrames{3};
+
+
+enum class HoverLayout { kScattered, kChildren };
+
+struct HoverResult {
+  double gridNs{0.0};               // Per UpdateHoveredWindowAndCaptureFlags() call
+  double linearNs{0.0};
+  int hoveredProbes{0};             // Probes over a window
+  bool matches{false};
+};
+
+struct NavResult {
+  double prunedFrameUs{0.0};        // Frames processing a move request
+  double fullFrameUs{0.0};
+  int64_t prunedScored{0};          // NavScoreItem() calls past the layer check (g.NavScoringDebugCount)
+  int64_t fullScored{0};
+  bool matches{false};
+};
+
+static void BeginContext(ImGuiConfigFlags configFlags) {
+  ImGui::CreateContext();
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+  io.ConfigFlags |= configFlags;
+  ImGui_ImplNull_Init(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+  ImGui_ImplNullRender_Init();
+}
+
+static void EndContext() {
+  ImGui_ImplNullRender_Shutdown();
+  ImGui_ImplNull_Shutdown();
+  ImGui::DestroyContext();
+}
+
+static void SubmitWindows(HoverLayout layout, int windows) {
+  if (layout == HoverLayout::kChildren) {
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+    ImGui::Begin("Children", nullptr, ImGuiWindowFlags_NoSavedSettings);
+    for (int n = 0; n < windows; n++) {
+      ImGui::PushID(n);
+      ImGui::BeginChild("child", ImVec2(88.0f, 48.0f), true);
+      ImGui::EndChild();
+      ImGui::PopID();
+      if ((n + 1) % kChildrenPerRow != 0) {
+        ImGui::SameLine();
+      }
+    }
+    ImGui::End();
+    return;
+  }
+
+  uint32_t random{12345u};
+  char name[32];
+  for (int n = 0; n < windows; n++) {
+    const float w = 80.0f + (float)(bench::NextRandom(&random) % 240);
+    const float h = 60.0f + (float)(bench::NextRandom(&random) % 160);
+    const float x = (float)(bench::NextRandom(&random) % (uint32_t)(kDisplayWidth - 40));
+    const float y = (float)(bench::NextRandom(&random) % (uint32_t)(kDisplayHeight - 40));
+    snprintf(name, sizeof(name), "Window %05d", n);
+    ImGui::SetNextWindowPos(ImVec2(x, y), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(w, h), ImGuiCond_Always);
+    ImGui::Begin(name, nullptr, ImGuiWindowFlags_NoSavedSettings);
+    ImGui::End();
+  }
+}
+
+static HoverResult RunHover(HoverLayout layout, int windows, int probes) {
+  HoverResult result;
+  BeginContext(ImGuiConfigFlags_None);
+  ImGuiContext& g = *ImGui::GetCurrentContext();
+  for (int frame = 0; frame < kWarmupFrames; frame++) {
+    ImGui_ImplNullRender_NewFrame();
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    SubmitWindows(layout, windows);
+    ImGui::Render();
+  }
+
+  // Same state as the hover lookup of the next NewFrame(): windows submitted in this frame are still Active
+  std::vector<ImVec2> positions((size_t)probes);
+  uint32_t random{67890u};
+  for (ImVec2& pos : positions) {
+    pos.x = (float)(bench::NextRandom(&random) % (uint32_t)kDisplayWidth);
+    pos.y = (float)(bench::NextRandom(&random) % (uint32_t)kDisplayHeight);
+  }
+  std::vector<ImGuiWindow*> hoveredGrid((size_t)probes), hoveredLinear((size_t)probes);
+  for (int mode = 0; mode < 2; mode++) {
+    g.DebugMetricsConfig.DisableSpatialIndex = (mode == 1);
+    std::vector<ImGuiWindow*>& hovered = (mode == 0) ? hoveredGrid : hoveredLinear;
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    for (int n = 0; n < probes; n++) {
+      g.IO.MousePos = positions[(size_t)n];
+      ImGui::UpdateHoveredWindowAndCaptureFlags();
+      hovered[(size_t)n] = g.HoveredWindow;
+    }
+    ((mode == 0) ? result.gridNs : result.linearNs) = bench::MicrosecondsSince(t0) * 1000.0 / probes;
+  }
+  for (ImGuiWindow* window : hoveredGrid) {
+    result.hoveredProbes += (window != nullptr) ? 1 : 0;
+  }
+  result.matches = hoveredGrid == hoveredLinear;
+  EndContext();
+  return result;
+}
+
+static void SubmitNavWindow(int items) {
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+  ImGui::SetNextWindowSize(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+  ImGui::Begin("Nav", nullptr, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_HorizontalScrollbar);
+  for (int n = 0; n < items; n++) {
+    ImGui::PushID(n);
+    ImGui::Button("##item", ImVec2(24.0f, 16.0f));
+    ImGui::PopID();
+    if ((n + 1) % kItemsPerRow != 0) {
+      ImGui::SameLine();
+    }
+  }
+  ImGui::End();
+}
+
+// Return the NavId after each move
+static std::vector<ImGuiID> RunNavMoves(int items, int moves, bool pruned, double* moveFrameUs, int64_t* scored) {
+  BeginContext(ImGuiConfigFlags_NavEnableKeyboard);
+  ImGuiContext& g = *ImGui::GetCurrentContext();
+  g.DebugMetricsConfig.DisableSpatialIndex = !pruned;
+
+  // Press on even frames, release on odd ones: the move request is scored in the frame of the press
+  for (int move = 0; move < moves; move++) {
+    const int key = (move % 3 == 2) ? ImGuiKey_DownArrow : ImGuiKey_RightArrow;
+    ImGui_ImplNull_ScriptKey(kWarmupFrames + move * 2, key, true);
+    ImGui_ImplNull_ScriptKey(kWarmupFrames + move * 2 + 1, key, false);
+  }
+
+  std::vector<ImGuiID> path;
+  double moveFrameSum{0.0};
+  *scored = 0;
+  const int frames = kWarmupFrames + moves * 2 + 1;
+  for (int frame = 0; frame < frames; frame++) {
+    const bool pressFrame = frame >= kWarmupFrames && (frame - kWarmupFrames) % 2 == 0 && frame < kWarmupFrames + moves * 2;
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    ImGui_ImplNullRender_NewFrame();
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    if (frame == 0) {
+      ImGui::SetNextWindowFocus();
+    }
+    SubmitNavWindow(items);
+    ImGui::Render();
+    if (pressFrame) {
+      moveFrameSum += bench::MicrosecondsSince(t0);
+      *scored += g.NavScoringDebugCount;
+    } else if (frame > kWarmupFrames) {
+      path.push_back(g.NavId);
+    }
+  }
+  *moveFrameUs = moveFrameSum / (moves > 0 ? moves : 1);
+  ImGui_ImplNull_ScriptClear();
+  EndContext();
+  return path;
+}
+
+static NavResult RunNav(int items, int moves) {
+  NavResult result;
+  const std::vector<ImGuiID> prunedPath = RunNavMoves(items, moves, true, &result.prunedFrameUs, &result.prunedScored);
+  const std::vector<ImGuiID> fullPath = RunNavMoves(items, moves, false, &result.fullFrameUs, &result.fullScored);
+  result.matches = prunedPath == fullPath && !prunedPath.empty() && prunedPath.back() != 0;
+  return result;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  int windows{kDefaultWindows};
+  int probes{kDefaultProbes};
+  int items{kDefaultItems};
+  int moves{kDefaultMoves};
+  bool json{false};
+  bench::Args args(argc, argv, "[--windows N] [--probes N] [--items N] [--moves N] [--json]");
+  while (args.Next()) {
+    if (!args.Int("--windows", &windows) && !args.Int("--probes", &probes) && !args.Int("--items", &items) &&
+        !args.Int("--moves", &moves) && !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (windows <= 0 || probes <= 0 || items <= 0 || moves <= 0) {
+    return args.Fail();
+  }
+
+  const HoverResult scattered = RunHover(HoverLayout::kScattered, windows, probes);
+  const HoverResult children = RunHover(HoverLayout::kChildren, windows, probes);
+  const NavResult nav = RunNav(items, moves);
+  const bool hoverMatches = scattered.matches && children.matches;
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"windows\": %d,\n  \"probes\": %d,\n  \"items\": %d,\n  \"moves\": %d,\n", ImGui::GetVersion(), windows, probes, items, moves);
+    printf("  \"hover_scattered_grid_ns\": %.1f,\n  \"hover_scattered_linear_ns\": %.1f,\n  \"hover_scattered_hits\": %d,\n",
+           scattered.gridNs, scattered.linearNs, scattered.hoveredProbes);
+    printf("  \"hover_children_grid_ns\": %.1f,\n  \"hover_children_linear_ns\": %.1f,\n  \"hover_children_hits\": %d,\n  \"hover_matches\": %s,\n",
+           children.gridNs, children.linearNs, children.hoveredProbes, hoverMatches ? "true" : "false");
+    printf("  \"nav_pruned_frame_us\": %.1f,\n  \"nav_full_frame_us\": %.1f,\n  \"nav_pruned_scored\": %lld,\n  \"nav_full_scored\": %lld,\n  \"nav_matches\": %s\n}\n",
+           nav.prunedFrameUs, nav.fullFrameUs, (long long)nav.prunedScored, (long long)nav.fullScored, nav.matches ? "true" : "false");
+  } else {
+    printf("Dear ImGui %s, %d windows, %d probes, %d nav items, %d moves\n", ImGui::GetVersion(), windows, probes, items, moves);
+    printf("hovered window, scattered, grid        %10.1f ns\n", scattered.gridNs);
+    printf("hovered window, scattered, all tested  %10.1f ns\n", scattered.linearNs);
+    printf("hovered window, children, grid         %10.1f ns\n", children.gridNs);
+    printf("hovered window, children, all tested   %10.1f ns\n", children.linearNs);
+    printf("nav move frame, pruned                 %10.1f us  (%lld items scored)\n", nav.prunedFrameUs, (long long)nav.prunedScored);
+    printf("nav move frame, all items scored       %10.1f us  (%lld items scored)\n", nav.fullFrameUs, (long long)nav.fullScored);
+    printf("hovered windows, grid vs all:          %s\n", hoverMatches ? "same" : "DIFFER");
+    printf("navigation path, pruned vs all:        %s\n", nav.matches ? "same" : "DIFFER");
+  }
+  return (hoverMatches && nav.matches) ? 0 : 2;
+}
@@ -0,0 +1,234 @@
+/**
+ *
+ * imgui_bench_textcache: text layout cache benchmark.
+ *
+ * Submits a help panel holding --paragraphs wrapped paragraphs of about
+ * --length bytes (TextWrapped(), most of them scrolled out of view), a tab bar
+ * whose long labels are clipped with an ellipsis, and an alerts window whose
+ * wrapped paragraphs are all visible, for --frames frames: with the text
+ * layout cache (io.ConfigTextLayoutCacheBudget, default budget), without it,
+ * with the first paragraph of each window changing every frame, and with a
+ * --budget KB budget smaller than the texts, to see the eviction at work.
+ * Reports the time per frame and the cache hits, misses and memory.
+ * The exit code is 2 if the draw data of any frame differs from the run
+ * without the cache, or if the cache goes over its budget with entries which
+ * weren't used during the frame.
+ *
+ * Usage:
+ *   imgui_bench_textcache [--paragraphs N] [--length N] [--frames N] [--budget KB] [--rounds N] [--json]
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "imgui/imgui_impl_null.h"
+#include "imgui_bench_common.h"
+
+
+constexpr int32_t kDisplayWidth{1920};
+constexpr int32_t kDisplayHeight{1080};
+constexpr float kPanelWidth{640.0f};
+constexpr float kAlertsWidth{420.0f};
+constexpr int32_t kAlerts{8};
+constexpr int32_t kTabs{8};
+constexpr int32_t kDefaultParagraphs{100};
+constexpr int32_t kDefaultLength{600};
+constexpr int32_t kDefaultFrames{200};
+constexpr int32_t kDefaultBudgetKB{4};
+constexpr int32_t kDefaultRounds{3};
+constexpr int32_t kWarmupFrames{2};
+
+static const char* const kWords[] = {
+    "the", "layout", "of", "each", "wrapped", "paragraph", "is", "computed", "once", "and", "reused", "until", "its", "text",
+    "changes", "press", "Ctrl+S", "to", "save", "settings,", "window", "docking", "font", "atlas.", "see", "also:", "alerts",
+    "are", "shown", "here;", "nothing", "else", "happens!", "configuration", "a", "longer", "word", "for", "wrapping", "tests.",
+};
+
+enum class Mode { kCached, kUncached, kChanging, kSmallBudget };
+
+struct RunResult {
+  double frameUs{1e30};             // Best of the rounds
+  std::vector<ImU32> checksums;     // Per frame
+  int hits{0};                      // Per frame, last frame
+  int misses{0};
+  int layouts{0};
+  size_t cacheBytes{0};             // GetMemoryUsage(), last frame
+  size_t peakBytes{0};              // ImTextLayoutCache::Bytes, all frames
+  bool overBudget{false};           // Over budget with entries not used during the frame
+};
+
+static std::vector<std::string> MakeParagraphs(int count, int length, uint32_t seed) {
+  std::vector<std::string> paragraphs((size_t)count);
+  uint32_t random{seed};
+  for (std::string& paragraph : paragraphs) {
+    while ((int)paragraph.size() < length) {
+      paragraph += kWords[bench::NextRandom(&random) % IM_ARRAYSIZE(kWords)];
+      paragraph += ' ';
+    }
+    paragraph.pop_back();
+  }
+  return paragraphs;
+}
+
+static void SubmitFrame(const std::vector<std::string>& paragraphs, const std::vector<std::string>& alerts, const std::vector<std::string>& tabs,
+                        int frame, bool changing) {
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+  ImGui::SetNextWindowSize(ImVec2(kPanelWidth, (float)kDisplayHeight));
+  ImGui::Begin("Help", nullptr, ImGuiWindowFlags_NoSavedSettings);
+  if (ImGui::BeginTabBar("Topics")) {
+    for (const std::string& tab : tabs) {
+      if (ImGui::BeginTabItem(tab.c_str())) {
+        ImGui::EndTabItem();
+      }
+    }
+    ImGui::EndTabBar();
+  }
+  for (size_t n = 0; n < paragraphs.size(); n++) {
+    if (changing && n == 0) {
+      ImGui::TextWrapped("Frame %d: %s", frame, paragraphs[n].c_str());
+    } else {
+      ImGui::TextWrapped("%s", paragraphs[n].c_str());
+    }
+    ImGui::Spacing();
+  }
+  ImGui::End();
+
+  ImGui::SetNextWindowPos(ImVec2(kPanelWidth + 20.0f, 0.0f));
+  ImGui::SetNextWindowSize(ImVec2(kAlertsWidth, (float)kDisplayHeight));
+  ImGui::Begin("Alerts", nullptr, ImGuiWindowFlags_NoSavedSettings);
+  for (size_t n = 0; n < alerts.size(); n++) {
+    if (changing && n == 0) {
+      ImGui::TextWrapped("Frame %d: %s", frame, alerts[n].c_str());
+    } else {
+      ImGui::TextWrapped("%s", alerts[n].c_str());
+    }
+    ImGui::Separator();
+  }
+  ImGui::End();
+}
+
+static RunResult Run(Mode mode, const std::vector<std::string>& paragraphs, const std::vector<std::string>& alerts,
+                     const std::vector<std::string>& tabs, int frames, int budgetKB) {
+  RunResult result;
+  ImGui::CreateContext();
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+  if (mode == Mode::kUncached) {
+    io.ConfigTextLayoutCacheBudget = 0;
+  } else if (mode == Mode::kSmallBudget) {
+    io.ConfigTextLayoutCacheBudget = (size_t)budgetKB * 1024;
+  }
+  ImGui_ImplNull_Init(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+  ImGui_ImplNullRender_Init();
+  ImGuiContext& g = *ImGui::GetCurrentContext();
+
+  double elapsedUs{0.0};
+  for (int frame = 0; frame < kWarmupFrames + frames; frame++) {
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    ImGui_ImplNullRender_NewFrame();
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    SubmitFrame(paragraphs, alerts, tabs, frame, mode == Mode::kChanging);
+    ImGui::Render();
+    ImGui_ImplNullRender_RenderDrawData(ImGui::GetDrawData());
+    if (frame >= kWarmupFrames) {
+      elapsedUs += bench::MicrosecondsSince(t0);
+    }
+    result.checksums.push_back(ImGui_ImplNullRender_GetStats()->LastChecksum);
+
+    // Over the budget, every entry must have been used during this frame
+    const ImTextLayoutCache& cache = g.TextLayoutCache;
+    result.peakBytes = std::max(result.peakBytes, cache.Bytes);
+    if (io.ConfigTextLayoutCacheBudget > 0 && cache.Bytes > io.ConfigTextLayoutCacheBudget) {
+      for (const ImTextLayout& layout : cache.Layouts) {
+        result.overBudget |= layout.LastFrameUsed != g.FrameCount;
+      }
+    }
+  }
+  result.frameUs = elapsedUs / frames;
+  result.hits = g.TextLayoutCache.FrameHits;
+  result.misses = g.TextLayoutCache.FrameMisses;
+  result.layouts = g.TextLayoutCache.Layouts.Size;
+  result.cacheBytes = ImGui::GetMemoryUsage().Bytes[ImGuiMemoryCategory_TextLayouts];
+
+  ImGui_ImplNullRender_Shutdown();
+  ImGui_ImplNull_Shutdown();
+  ImGui::DestroyContext();
+  return result;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  int paragraphCount{kDefaultParagraphs};
+  int length{kDefaultLength};
+  int frames{kDefaultFrames};
+  int budgetKB{kDefaultBudgetKB};
+  int rounds{kDefaultRounds};
+  bool json{false};
+  bench::Args args(argc, argv, "[--paragraphs N] [--length N] [--frames N] [--budget KB] [--rounds N] [--json]");
+  while (args.Next()) {
+    if (!args.Int("--paragraphs", &paragraphCount) && !args.Int("--length", &length) && !args.Int("--frames", &frames) &&
+        !args.Int("--budget", &budgetKB) && !args.Int("--rounds", &rounds) && !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (paragraphCount <= 0 || length <= 0 || frames <= 0 || budgetKB <= 0 || rounds <= 0) {
+    return args.Fail();
+  }
+
+  const std::vector<std::string> paragraphs = MakeParagraphs(paragraphCount, length, 12345u);
+  const std::vector<std::string> alerts = MakeParagraphs(kAlerts, length / 2, 67890u);
+  const std::vector<std::string> tabs = MakeParagraphs(kTabs, ImTextLayoutCache::MIN_TEXT_LEN + 16, 24680u);
+
+  // Interleaved rounds, keeping the best time of each, since the machine may be busy
+  RunResult results[4];
+  const Mode modes[4] = {Mode::kCached, Mode::kUncached, Mode::kChanging, Mode::kSmallBudget};
+  for (int round = 0; round < rounds; round++) {
+    for (int m = 0; m < 4; m++) {
+      const RunResult r = Run(modes[m], paragraphs, alerts, tabs, frames, budgetKB);
+      const double frameUs = std::min(results[m].frameUs, r.frameUs);
+      const size_t peakBytes = std::max(results[m].peakBytes, r.peakBytes);
+      const bool overBudget = results[m].overBudget || r.overBudget;
+      results[m] = r;
+      results[m].frameUs = frameUs;
+      results[m].peakBytes = peakBytes;
+      results[m].overBudget = overBudget;
+    }
+  }
+  const RunResult& cached = results[0];
+  const RunResult& uncached = results[1];
+  const RunResult& changing = results[2];
+  const RunResult& small = results[3];
+  const bool same = cached.checksums == uncached.checksums && small.checksums == uncached.checksums;
+  const bool ok = same && !small.overBudget && !cached.overBudget;
+
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"paragraphs\": %d,\n  \"length\": %d,\n  \"frames\": %d,\n", ImGui::GetVersion(), paragraphCount, length, frames);
+    printf("  \"uncached_frame_us\": %.2f,\n  \"cached_frame_us\": %.2f,\n  \"changing_frame_us\": %.2f,\n  \"small_budget_frame_us\": %.2f,\n",
+           uncached.frameUs, cached.frameUs, changing.frameUs, small.frameUs);
+    printf("  \"cached_hits\": %d,\n  \"cached_misses\": %d,\n  \"cached_layouts\": %d,\n  \"cached_bytes\": %zu,\n", cached.hits, cached.misses, cached.layouts, cached.cacheBytes);
+    printf("  \"changing_hits\": %d,\n  \"changing_misses\": %d,\n  \"changing_layouts\": %d,\n", changing.hits, changing.misses, changing.layouts);
+    printf("  \"small_budget_bytes\": %d,\n  \"small_budget_peak_bytes\": %zu,\n  \"small_budget_hits\": %d,\n  \"small_budget_misses\": %d,\n",
+           budgetKB * 1024, small.peakBytes, small.hits, small.misses);
+    printf("  \"same_output\": %s,\n  \"within_budget\": %s\n}\n", same ? "true" : "false", !small.overBudget && !cached.overBudget ? "true" : "false");
+  } else {
+    printf("Dear ImGui %s, %d paragraphs of %d bytes, %d alerts, %d tabs, %d frames\n", ImGui::GetVersion(), paragraphCount, length, kAlerts, kTabs, frames);
+    printf("no cache:          %9.2f us/frame\n", uncached.frameUs);
+    printf("cache:             %9.2f us/frame  (%.2fx)  %d hits, %d misses per frame, %d texts, %.1f KB\n", cached.frameUs,
+           uncached.frameUs / cached.frameUs, cached.hits, cached.misses, cached.layouts, cached.cacheBytes / 1024.0);
+    printf("cache, changing:   %9.2f us/frame  (%.2fx)  %d hits, %d misses per frame, %d texts\n", changing.frameUs, uncached.frameUs / changing.frameUs,
+           changing.hits, changing.misses, changing.layouts);
+    printf("cache, %4d KB:    %9.2f us/frame  (%.2fx)  %d hits, %d misses per frame, peak %.1f KB\n", budgetKB, small.frameUs, uncached.frameUs / small.frameUs,
+           small.hits, small.misses, small.peakBytes / 1024.0);
+    printf("draw data against no cache: %s, budget: %s\n", same ? "same" : "DIFFER", !small.overBudget && !cached.overBudget ? "ok" : "EXCEEDED");
+  }
+  return ok ? 0 : 2;
+}
@@ -0,0 +1,373 @@
+/**
+ *
+ * imgui_bench_utf8: UTF-8 <-> ImWchar conversion benchmark.
+ *
+ * Measures the throughput of ImTextStrFromUtf8(), ImTextCountCharsFromUtf8(),
+ * ImTextStrToUtf8() and ImTextCountUtf8BytesFromStr() on --size KB of text in
+ * several scripts (ASCII, Latin with accents, Cyrillic, CJK, emoji, and all
+ * of them mixed), against the one-character-at-a-time loops they replaced
+ * (copied below as the reference). Then compares both on --fuzz random
+ * inputs: valid and invalid UTF-8 (truncated, overlong and surrogate
+ * sequences, stray continuation bytes, code points above the maximum,
+ * embedded zeros) and random ImWchar strings, with small output buffers too.
+ * The exit code is 2 if any output, length or remaining pointer differs.
+ * Build with IMGUI_USE_WCHAR32 (imgui_bench_utf8_wchar32) for 32-bit ImWchar.
+ *
+ * Usage:
+ *   imgui_bench_utf8 [--size KB] [--fuzz N] [--json]
+ *
+ */
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "imgui_bench_common.h"
+
+
+constexpr int32_t kDefaultSizeKb{1024};
+constexpr int32_t kDefaultFuzz{200000};
+constexpr int32_t kTimingRounds{20};
+constexpr int32_t kFuzzMaxLength{96};
+
+struct Corpus {
+  const char* name;
+  std::vector<const char*> words;
+};
+
+static const Corpus kCorpora[] = {
+    {"ascii", {"The ", "quick ", "brown ", "fox ", "jumps ", "over ", "the ", "lazy ", "dog. ", "Window ", "Settings\n"}},
+    {"latin", {"Le ", "cœur ", "déçu ", "mais ", "l'âme ", "plutôt ", "naïve, ", "Louÿs ", "rêva ", "de ", "crapaüter. "}},
+    {"cyrillic", {"Съешь ", "же ", "ещё ", "этих ", "мягких ", "французских ", "булок, ", "да ", "выпей ", "чаю. "}},
+    {"cjk", {"我能吞下", "玻璃而不", "伤身体。", "私はガラスを", "食べられます。", "나는 ", "유리를 ", "먹을 ", "수 ", "있어요. "}},
+    {"emoji", {"😀", "🎉 ", "🚀", "👍🏽", "🍕 ", "𝄞", "🌍"}},
+    {"mixed", {"Frame ", "время ", "描画 ", "ms, ", "Größe ", "🚀 ", "x: ", "12.5, ", "Ελληνικά ", "ok\n"}},
+};
+
+struct ThroughputResult {
+  const char* corpus{nullptr};
+  double fromUtf8MBs{0.0};          // ImTextStrFromUtf8(), UTF-8 bytes per second
+  double fromUtf8RefMBs{0.0};
+  double countCharsMBs{0.0};        // ImTextCountCharsFromUtf8()
+  double countCharsRefMBs{0.0};
+  double toUtf8MBs{0.0};            // ImTextStrToUtf8(), UTF-8 bytes per second
+  double toUtf8RefMBs{0.0};
+  double countBytesMBs{0.0};        // ImTextCountUtf8BytesFromStr()
+  double countBytesRefMBs{0.0};
+  bool matches{true};
+};
+
+static volatile int sink_;
+
+//-----------------------------------------------------------------------------
+// Reference: the previous one-character-at-a-time implementations
+//-----------------------------------------------------------------------------
+
+static int RefTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const char* in_text_end, const char** in_text_remaining) {
+  ImWchar* buf_out = buf;
+  ImWchar* buf_end = buf + buf_size;
+  while (buf_out < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text) {
+    unsigned int c;
+    in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
+    if (c == 0) {
+      break;
+    }
+    *buf_out++ = (ImWchar)c;
+  }
+  *buf_out = 0;
+  if (in_text_remaining) {
+    *in_text_remaining = in_text;
+  }
+  return (int)(buf_out - buf);
+}
+
+static int RefTextCountCharsFromUtf8(const char* in_text, const char* in_text_end) {
+  int char_count = 0;
+  while ((!in_text_end || in_text < in_text_end) && *in_text) {
+    unsigned int c;
+    in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
+    if (c == 0) {
+      break;
+    }
+    char_count++;
+  }
+  return char_count;
+}
+
+static int RefTextCharToUtf8(char* buf, int buf_size, unsigned int c) {
+  if (c < 0x80) {
+    buf[0] = (char)c;
+    return 1;
+  }
+  if (c < 0x800) {
+    if (buf_size < 2) return 0;
+    buf[0] = (char)(0xc0 + (c >> 6));
+    buf[1] = (char)(0x80 + (c & 0x3f));
+    return 2;
+  }
+  if (c < 0x10000) {
+    if (buf_size < 3) return 0;
+    buf[0] = (char)(0xe0 + (c >> 12));
+    buf[1] = (char)(0x80 + ((c >> 6) & 0x3f));
+    buf[2] = (char)(0x80 + (c & 0x3f));
+    return 3;
+  }
+  if (c <= 0x10FFFF) {
+    if (buf_size < 4) return 0;
+    buf[0] = (char)(0xf0 + (c >> 18));
+    buf[1] = (char)(0x80 + ((c >> 12) & 0x3f));
+    buf[2] = (char)(0x80 + ((c >> 6) & 0x3f));
+    buf[3] = (char)(0x80 + (c & 0x3f));
+    return 4;
+  }
+  return 0;
+}
+
+static int RefTextStrToUtf8(char* out_buf, int out_buf_size, const ImWchar* in_text, const ImWchar* in_text_end) {
+  char* buf_p = out_buf;
+  const char* buf_end = out_buf + out_buf_size;
+  while (buf_p < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text) {
+    unsigned int c = (unsigned int)(*in_text++);
+    if (c < 0x80) {
+      *buf_p++ = (char)c;
+    } else {
+      buf_p += RefTextCharToUtf8(buf_p, (int)(buf_end - buf_p - 1), c);
+    }
+  }
+  *buf_p = 0;
+  return (int)(buf_p - out_buf);
+}
+
+static int RefTextCountUtf8BytesFromStr(const ImWchar* in_text, const ImWchar* in_text_end) {
+  int bytes_count = 0;
+  while ((!in_text_end || in_text < in_text_end) && *in_text) {
+    unsigned int c = (unsigned int)(*in_text++);
+    bytes_count += (c < 0x80) ? 1 : (c < 0x800) ? 2 : (c < 0x10000) ? 3 : (c <= 0x10FFFF) ? 4 : 3;
+  }
+  return bytes_count;
+}
+
+//-----------------------------------------------------------------------------
+// Throughput
+//-----------------------------------------------------------------------------
+
+static std::string MakeText(const Corpus& corpus, size_t size) {
+  std::mt19937 rng{7};
+  std::string text;
+  while (text.size() < size) {
+    text += corpus.words[rng() % corpus.words.size()];
+  }
+  return text;
+}
+
+template <typename F>
+static double MegabytesPerSecond(size_t bytes, F&& f) {
+  f();  // Warm up
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  for (int round = 0; round < kTimingRounds; round++) {
+    sink_ = sink_ + f();
+  }
+  return (double)bytes * kTimingRounds / bench::MicrosecondsSince(t0);
+}
+
+static ThroughputResult RunThroughput(const Corpus& corpus, size_t size) {
+  ThroughputResult result;
+  result.corpus = corpus.name;
+  const std::string text = MakeText(corpus, size);
+  const char* begin = text.c_str();
+  const char* end = begin + text.size();
+  std::vector<ImWchar> wide(text.size() + 1);
+  std::vector<ImWchar> wideRef(text.size() + 1);
+  std::vector<char> utf8(text.size() * 2 + 1);
+  std::vector<char> utf8Ref(text.size() * 2 + 1);
+  const int wideLen = ImTextStrFromUtf8(wide.data(), (int)wide.size(), begin, end);
+  const ImWchar* wideEnd = wide.data() + wideLen;
+
+  // Same functions as InputText(): NUL terminated input when activating, explicit ends otherwise
+  result.fromUtf8MBs = MegabytesPerSecond(text.size(), [&] { return ImTextStrFromUtf8(wide.data(), (int)wide.size(), begin, nullptr); });
+  result.fromUtf8RefMBs = MegabytesPerSecond(text.size(), [&] { return RefTextStrFromUtf8(wideRef.data(), (int)wideRef.size(), begin, nullptr, nullptr); });
+  result.countCharsMBs = MegabytesPerSecond(text.size(), [&] { return ImTextCountCharsFromUtf8(begin, end); });
+  result.countCharsRefMBs = MegabytesPerSecond(text.size(), [&] { return RefTextCountCharsFromUtf8(begin, end); });
+  result.toUtf8MBs = MegabytesPerSecond(text.size(), [&] { return ImTextStrToUtf8(utf8.data(), (int)utf8.size(), wide.data(), wideEnd); });
+  result.toUtf8RefMBs = MegabytesPerSecond(text.size(), [&] { return RefTextStrToUtf8(utf8Ref.data(), (int)utf8Ref.size(), wideRef.data(), wideEnd - wide.data() + wideRef.data()); });
+  result.countBytesMBs = MegabytesPerSecond(text.size(), [&] { return ImTextCountUtf8BytesFromStr(wide.data(), wideEnd); });
+  result.countBytesRefMBs = MegabytesPerSecond(text.size(), [&] { return RefTextCountUtf8BytesFromStr(wide.data(), wideEnd); });
+
+  result.matches = memcmp(wide.data(), wideRef.data(), (wideLen + 1) * sizeof(ImWchar)) == 0 && strcmp(utf8.data(), utf8Ref.data()) == 0 &&
+                   ImTextCountCharsFromUtf8(begin, end) == RefTextCountCharsFromUtf8(begin, end) &&
+                   ImTextCountUtf8BytesFromStr(wide.data(), wideEnd) == RefTextCountUtf8BytesFromStr(wide.data(), wideEnd);
+  return result;
+}
+
+//-----------------------------------------------------------------------------
+// Fuzzing
+//-----------------------------------------------------------------------------
+
+static void AppendCodepoint(std::string& s, unsigned int c) {
+  char buf[5];
+  s.append(buf, (size_t)RefTextCharToUtf8(buf, 5, c));
+}
+
+static std::string MakeFuzzUtf8(std::mt19937& rng) {
+  std::string s;
+  const int pieces = (int)(rng() % kFuzzMaxLength);
+  for (int n = 0; n < pieces; n++) {
+    switch (rng() % 10) {
+      case 0: case 1: case 2: {
+        const int run = 1 + (int)(rng() % 40);
+        for (int k = 0; k < run; k++) {
+          s += (char)(0x20 + rng() % 0x5F);
+        }
+        break;
+      }
+      case 3: AppendCodepoint(s, 0x80 + rng() % 0x780); break;
+      case 4: AppendCodepoint(s, 0x800 + rng() % 0xF800); break;            // Includes surrogates
+      case 5: AppendCodepoint(s, 0x10000 + rng() % 0x100000); break;
+      case 6: s += (char)(0x80 + rng() % 0x80); break;                       // Stray or lead byte
+      case 7: {                                                               // Truncated sequence
+        std::string full;
+        AppendCodepoint(full, 0x80 + rng() % 0x10FF80);
+        s += full.substr(0, 1 + rng() % (full.size() - 1 > 0 ? full.size() - 1 : 1));
+        break;
+      }
+      case 8: {                                                               // Overlong / out of range
+        static const char* const kBad[] = {"\xC0\x80", "\xC1\xBF", "\xE0\x80\x80", "\xE0\x9F\xBF", "\xF0\x80\x80\x80", "\xF4\x90\x80\x80", "\xF8\x88\x80\x80\x80", "\xFF", "\xED\xA0\x80"};
+        s += kBad[rng() % (sizeof(kBad) / sizeof(kBad[0]))];
+        break;
+      }
+      default:
+        if (rng() % 8 == 0) {
+          s += '\0';
+        } else {
+          s += (char)(rng() % 0x80);
+        }
+        break;
+    }
+  }
+  return s;
+}
+
+static std::vector<ImWchar> MakeFuzzWide(std::mt19937& rng) {
+  std::vector<ImWchar> s;
+  const int pieces = (int)(rng() % kFuzzMaxLength);
+  for (int n = 0; n < pieces; n++) {
+    const int run = 1 + (int)(rng() % 24);
+    const unsigned int kind = rng() % 6;
+    for (int k = 0; k < run; k++) {
+      unsigned int c;
+      switch (kind) {
+        case 0: c = 0x20 + rng() % 0x60; break;
+        case 1: c = 0x80 + rng() % 0x780; break;
+        case 2: c = 0x800 + rng() % 0xF800; break;
+        case 3: c = 1 + rng() % 0x110100; break;
+        case 4: c = (rng() % 3 == 0) ? 0x80 + rng() % 0x780 : 0x20 + rng() % 0x60; break;
+        default: c = (rng() % 16 == 0) ? 0 : 1 + rng() % 0x7FF; break;
+      }
+      s.push_back((ImWchar)c);
+    }
+  }
+  return s;
+}
+
+static int RunFuzz(int iterations) {
+  std::mt19937 rng{1234};
+  int mismatches{0};
+  std::vector<ImWchar> wide(kFuzzMaxLength * 48 + 8);
+  std::vector<ImWchar> wideRef(wide.size());
+  std::vector<char> utf8(kFuzzMaxLength * 24 * 4 + 8);
+  std::vector<char> utf8Ref(utf8.size());
+  for (int iteration = 0; iteration < iterations; iteration++) {
+    // UTF-8 -> ImWchar, explicit end and NUL terminated. The reference reads past the terminator after a truncated
+    // sequence and may carry on decoding behind it, so NUL terminated inputs are cut at their first zero and padded.
+    std::string s = MakeFuzzUtf8(rng);
+    const size_t len = s.size();
+    std::string terminated = s.substr(0, strlen(s.c_str()));
+    terminated.append(4, '\0');
+    s.append(4, '\0');
+    const int bufSize = (rng() % 4 == 0) ? 1 + (int)(rng() % 40) : (int)wide.size();
+    for (int nulTerminated = 0; nulTerminated < 2; nulTerminated++) {
+      const char* begin = nulTerminated ? terminated.data() : s.data();
+      const char* end = nulTerminated ? nullptr : s.data() + len;
+      const char* remaining = nullptr;
+      const char* remainingRef = nullptr;
+      const int n = ImTextStrFromUtf8(wide.data(), bufSize, begin, end, &remaining);
+      const int nRef = RefTextStrFromUtf8(wideRef.data(), bufSize, begin, end, &remainingRef);
+      const int count = ImTextCountCharsFromUtf8(begin, end);
+      const int countRef = RefTextCountCharsFromUtf8(begin, end);
+      if (n != nRef || remaining != remainingRef || memcmp(wide.data(), wideRef.data(), (n + 1) * sizeof(ImWchar)) != 0 || count != countRef) {
+        if (mismatches++ < 5) {
+          fprintf(stderr, "UTF-8 input #%d (%zu bytes, %s): %d/%d chars, %d/%d counted\n", iteration, len, end ? "explicit end" : "NUL terminated", n, nRef, count, countRef);
+        }
+      }
+    }
+
+    // ImWchar -> UTF-8
+    std::vector<ImWchar> w = MakeFuzzWide(rng);
+    const size_t wlen = w.size();
+    w.push_back(0);
+    const int outSize = (rng() % 4 == 0) ? 1 + (int)(rng() % 60) : (int)utf8.size();
+    const ImWchar* wend = (rng() % 2) ? w.data() + wlen : nullptr;
+    const int n = ImTextStrToUtf8(utf8.data(), outSize, w.data(), wend);
+    const int nRef = RefTextStrToUtf8(utf8Ref.data(), outSize, w.data(), wend);
+    const int bytes = ImTextCountUtf8BytesFromStr(w.data(), wend);
+    const int bytesRef = RefTextCountUtf8BytesFromStr(w.data(), wend);
+    if (n != nRef || memcmp(utf8.data(), utf8Ref.data(), (size_t)n + 1) != 0 || bytes != bytesRef) {
+      if (mismatches++ < 5) {
+        fprintf(stderr, "ImWchar input #%d (%zu chars, %s): %d/%d bytes written, %d/%d counted\n", iteration, wlen, wend ? "explicit end" : "NUL terminated", n, nRef, bytes, bytesRef);
+      }
+    }
+  }
+  return mismatches;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  int sizeKb{kDefaultSizeKb};
+  int fuzz{kDefaultFuzz};
+  bool json{false};
+  bench::Args args(argc, argv, "[--size KB] [--fuzz N] [--json]");
+  while (args.Next()) {
+    if (!args.Int("--size", &sizeKb) && !args.Int("--fuzz", &fuzz) && !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (sizeKb <= 0 || fuzz < 0) {
+    return args.Fail();
+  }
+
+  std::vector<ThroughputResult> results;
+  bool matches{true};
+  for (const Corpus& corpus : kCorpora) {
+    results.push_back(RunThroughput(corpus, (size_t)sizeKb * 1024));
+    matches &= results.back().matches;
+  }
+  const int mismatches = RunFuzz(fuzz);
+
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"wchar_bits\": %d,\n  \"size_kb\": %d,\n  \"corpora\": [\n", ImGui::GetVersion(), (int)sizeof(ImWchar) * 8, sizeKb);
+    for (size_t n = 0; n < results.size(); n++) {
+      const ThroughputResult& r = results[n];
+      printf("    {\"corpus\": \"%s\", \"from_utf8_mb_s\": %.0f, \"from_utf8_ref_mb_s\": %.0f, \"count_chars_mb_s\": %.0f, \"count_chars_ref_mb_s\": %.0f, "
+             "\"to_utf8_mb_s\": %.0f, \"to_utf8_ref_mb_s\": %.0f, \"count_bytes_mb_s\": %.0f, \"count_bytes_ref_mb_s\": %.0f, \"matches\": %s}%s\n",
+             r.corpus, r.fromUtf8MBs, r.fromUtf8RefMBs, r.countCharsMBs, r.countCharsRefMBs, r.toUtf8MBs, r.toUtf8RefMBs, r.countBytesMBs, r.countBytesRefMBs,
+             r.matches ? "true" : "false", n + 1 < results.size() ? "," : "");
+    }
+    printf("  ],\n  \"fuzz_iterations\": %d,\n  \"fuzz_mismatches\": %d\n}\n", fuzz, mismatches);
+  } else {
+    printf("Dear ImGui %s, %d-bit ImWchar, %d KB per corpus, MB/s of UTF-8 (reference: one character at a time)\n", ImGui::GetVersion(), (int)sizeof(ImWchar) * 8, sizeKb);
+    printf("%-9s %18s %18s %18s %18s\n", "corpus", "StrFromUtf8", "CountChars", "StrToUtf8", "CountUtf8Bytes");
+    for (const ThroughputResult& r : results) {
+      printf("%-9s %8.0f (%7.0f) %8.0f (%7.0f) %8.0f (%7.0f) %8.0f (%7.0f)%s\n", r.corpus, r.fromUtf8MBs, r.fromUtf8RefMBs, r.countCharsMBs, r.countCharsRefMBs,
+             r.toUtf8MBs, r.toUtf8RefMBs, r.countBytesMBs, r.countBytesRefMBs, r.matches ? "" : "  DIFFER");
+    }
+    printf("fuzzing, %d inputs:  %d mismatches\n", fuzz, mismatches);
+  }
+  return (matches && mismatches == 0) ? 0 : 2;
+}
@@ -0,0 +1,253 @@
+/**
+ *
+ * imgui_bench_widetable: wide tables benchmark.
+ *
+ * Submits a table of --rows rows (ImGuiListClipper) and 64, 512, 4096 and
+ * 8192 columns (or --columns N) of fixed width, with a frozen column and a
+ * frozen header row, sortable, resizable, reorderable and hideable, scrolling
+ * horizontally by a whole number of pixels every frame, for --frames frames.
+ * A third of the way through a column is hidden, and half of the way through
+ * the rows are sorted by the last column. Each size runs without horizontal
+ * virtualization (io.ConfigTablesVirtualizeColumnsMin = 0) and with it, the
+ * cells of every row submitted for all the columns (TableNextColumn()) or for
+ * the columns requesting output only (TableGetOutputColumnIndex()).
+ * Reports the time per frame, the number of visible and output columns and
+ * how many frames only laid out the columns in view.
+ * The exit code is 2 if the draw data of any frame differs from the run
+ * without virtualization submitting all the columns.
+ *
+ * Usage:
+ *   imgui_bench_widetable [--columns N] [--rows N] [--frames N] [--rounds N] [--json]
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "imgui/imgui_impl_null.h"
+#include "imgui_bench_common.h"
+
+
+constexpr int32_t kDisplayWidth{1920};
+constexpr int32_t kDisplayHeight{1080};
+constexpr float kFirstColumnWidth{60.0f};
+constexpr float kColumnWidth{80.0f};
+constexpr int32_t kScrollStep{53};
+constexpr int32_t kColumnCounts[] = {64, 512, 4096, 8192};
+constexpr int32_t kDefaultRows{200};
+constexpr int32_t kDefaultFrames{50};
+constexpr int32_t kDefaultRounds{3};
+constexpr int32_t kWarmupFrames{2};
+
+constexpr ImGuiTableFlags kTableFlags = ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY | ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+                                        ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable |
+                                        ImGuiTableFlags_Hideable | ImGuiTableFlags_Sortable;
+
+enum class Mode { kFullAllCells, kFullOutputCells, kVirtualAllCells, kVirtualOutputCells };
+
+struct RunResult {
+  double frameUs{1e30};             // Best of the rounds
+  std::vector<ImU32> checksums;     // Per frame
+  int visibleColumns{0};            // Last frame
+  int outputColumns{0};
+  int partialFrames{0};             // Frames which only laid out the columns in view
+};
+
+// Deterministic sort key of a cell, so every mode sorts the rows the same way
+static uint32_t CellKey(int row, int column) {
+  uint32_t key = (uint32_t)row * 2654435761u + (uint32_t)column * 40503u;
+  return key ^ (key >> 15);
+}
+
+static void SortRows(std::vector<int>* rowOrder, const ImGuiTableSortSpecs* specs) {
+  std::sort(rowOrder->begin(), rowOrder->end());
+  if (specs->SpecsCount == 0) {
+    return;
+  }
+  const ImGuiTableColumnSortSpecs& spec = specs->Specs[0];
+  std::stable_sort(rowOrder->begin(), rowOrder->end(), [&spec](int a, int b) {
+    const uint32_t keyA = CellKey(a, spec.ColumnIndex);
+    const uint32_t keyB = CellKey(b, spec.ColumnIndex);
+    return spec.SortDirection == ImGuiSortDirection_Ascending ? keyA < keyB : keyA > keyB;
+  });
+}
+
+static void SubmitFrame(const std::vector<std::string>& labels, std::vector<int>* rowOrder, int frame, int frames, bool outputCells, RunResult* result) {
+  const int columns = (int)labels.size();
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+  ImGui::SetNextWindowSize(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+  ImGui::Begin("Wide table", nullptr, ImGuiWindowFlags_NoSavedSettings);
+  if (ImGui::BeginTable("##cells", columns, kTableFlags)) {
+    ImGui::TableSetupScrollFreeze(1, 1);
+    for (int column = 0; column < columns; column++) {
+      ImGui::TableSetupColumn(labels[column].c_str(), column == 0 ? ImGuiTableColumnFlags_DefaultSort : ImGuiTableColumnFlags_None,
+                              column == 0 ? kFirstColumnWidth : kColumnWidth);
+    }
+    if (frame == kWarmupFrames + frames / 3) {
+      ImGui::TableSetColumnEnabled(2, false);
+    }
+    if (frame == kWarmupFrames + frames / 2) {
+      ImGui::TableSetColumnSortDirection(columns - 1, ImGuiSortDirection_Descending, false);
+    }
+    if (ImGuiTableSortSpecs* specs = ImGui::TableGetSortSpecs()) {
+      if (specs->SpecsDirty) {
+        SortRows(rowOrder, specs);
+        specs->SpecsDirty = false;
+      }
+    }
+    ImGui::TableHeadersRow();
+
+    ImGuiListClipper clipper;
+    clipper.Begin((int)rowOrder->size());
+    while (clipper.Step()) {
+      for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+        ImGui::TableNextRow();
+        const int rowId = (*rowOrder)[row];
+        const int cells = outputCells ? ImGui::TableGetOutputColumnCount() : columns;
+        for (int cell = 0; cell < cells; cell++) {
+          int column;
+          if (outputCells) {
+            column = ImGui::TableGetOutputColumnIndex(cell);
+            ImGui::TableSetColumnIndex(column);
+          } else {
+            column = cell;
+            ImGui::TableNextColumn();
+          }
+          if ((rowId + column) % 11 == 0) {
+            ImGui::TableSetBgColor(ImGuiTableBgTarget_CellBg, IM_COL32(80, 40, 40, 255));
+          }
+          ImGui::Text("%d:%d", rowId, column);
+        }
+      }
+    }
+
+    // Scroll changes are applied on the next frame
+    const int scrollMax = std::max(1, (int)ImGui::GetScrollMaxX());
+    ImGui::SetScrollX((float)((frame * kScrollStep) % scrollMax));
+
+    const ImGuiTable* table = ImGui::GetCurrentTable();
+    result->visibleColumns = table->ColumnsVisibleCount;
+    result->outputColumns = table->ColumnsOutputCount;
+    if (frame >= kWarmupFrames && table->IsLayoutPartial) {
+      result->partialFrames++;
+    }
+    ImGui::EndTable();
+  }
+  ImGui::End();
+}
+
+static RunResult Run(Mode mode, const std::vector<std::string>& labels, int rows, int frames) {
+  RunResult result;
+  ImGui::CreateContext();
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+  if (mode == Mode::kFullAllCells || mode == Mode::kFullOutputCells) {
+    io.ConfigTablesVirtualizeColumnsMin = 0;
+  }
+  const bool outputCells = mode == Mode::kFullOutputCells || mode == Mode::kVirtualOutputCells;
+  ImGui_ImplNull_Init(ImVec2((float)kDisplayWidth, (float)kDisplayHeight));
+  ImGui_ImplNullRender_Init();
+
+  std::vector<int> rowOrder((size_t)rows);
+  for (int row = 0; row < rows; row++) {
+    rowOrder[row] = row;
+  }
+  double elapsedUs{0.0};
+  for (int frame = 0; frame < kWarmupFrames + frames; frame++) {
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    ImGui_ImplNullRender_NewFrame();
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    SubmitFrame(labels, &rowOrder, frame, frames, outputCells, &result);
+    ImGui::Render();
+    ImGui_ImplNullRender_RenderDrawData(ImGui::GetDrawData());
+    if (frame >= kWarmupFrames) {
+      elapsedUs += bench::MicrosecondsSince(t0);
+    }
+    result.checksums.push_back(ImGui_ImplNullRender_GetStats()->LastChecksum);
+  }
+  result.frameUs = elapsedUs / frames;
+
+  ImGui_ImplNullRender_Shutdown();
+  ImGui_ImplNull_Shutdown();
+  ImGui::DestroyContext();
+  return result;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  std::vector<int> columnCounts(std::begin(kColumnCounts), std::end(kColumnCounts));
+  int rows{kDefaultRows};
+  int frames{kDefaultFrames};
+  int rounds{kDefaultRounds};
+  bool json{false};
+  bench::Args args(argc, argv, "[--columns N] [--rows N] [--frames N] [--rounds N] [--json]");
+  while (args.Next()) {
+    int columns{0};
+    if (args.Int("--columns", &columns)) {
+      columnCounts = {columns};
+    } else if (!args.Int("--rows", &rows) && !args.Int("--frames", &frames) && !args.Int("--rounds", &rounds) && !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (columnCounts[0] < 3 || columnCounts[0] > IMGUI_TABLE_MAX_COLUMNS || rows <= 0 || frames <= 0 || rounds <= 0) {
+    return args.Fail();
+  }
+
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"rows\": %d,\n  \"frames\": %d,\n  \"scroll_step\": %d,\n  \"tables\": [\n", ImGui::GetVersion(), rows, frames, kScrollStep);
+  } else {
+    printf("Dear ImGui %s, %d rows, %d frames, scrolling %d px per frame\n", ImGui::GetVersion(), rows, frames, kScrollStep);
+    printf("columns  full, all cells  full, output cells  virtualized, all cells  virtualized, output cells  visible  output  partial  draw data\n");
+  }
+  bool ok{true};
+  for (size_t size_n = 0; size_n < columnCounts.size(); size_n++) {
+    const int columns = columnCounts[size_n];
+    std::vector<std::string> labels((size_t)columns);
+    for (int column = 0; column < columns; column++) {
+      labels[column] = "Column " + std::to_string(column);
+    }
+
+    // Interleaved rounds, keeping the best time of each, since the machine may be busy
+    RunResult results[4];
+    const Mode modes[4] = {Mode::kFullAllCells, Mode::kFullOutputCells, Mode::kVirtualAllCells, Mode::kVirtualOutputCells};
+    for (int round = 0; round < rounds; round++) {
+      for (int m = 0; m < 4; m++) {
+        const RunResult r = Run(modes[m], labels, rows, frames);
+        const double frameUs = std::min(results[m].frameUs, r.frameUs);
+        results[m] = r;
+        results[m].frameUs = frameUs;
+      }
+    }
+    const RunResult& fullAll = results[0];
+    const RunResult& fullOutput = results[1];
+    const RunResult& virtualAll = results[2];
+    const RunResult& virtualOutput = results[3];
+    const bool same = fullOutput.checksums == fullAll.checksums && virtualAll.checksums == fullAll.checksums && virtualOutput.checksums == fullAll.checksums;
+    ok &= same;
+
+    if (json) {
+      printf("    {\n      \"columns\": %d,\n", columns);
+      printf("      \"full_all_cells_frame_us\": %.2f,\n      \"full_output_cells_frame_us\": %.2f,\n", fullAll.frameUs, fullOutput.frameUs);
+      printf("      \"virtualized_all_cells_frame_us\": %.2f,\n      \"virtualized_output_cells_frame_us\": %.2f,\n", virtualAll.frameUs, virtualOutput.frameUs);
+      printf("      \"visible_columns\": %d,\n      \"output_columns\": %d,\n      \"partial_layout_frames\": %d,\n", virtualOutput.visibleColumns,
+             virtualOutput.outputColumns, virtualOutput.partialFrames);
+      printf("      \"same_output\": %s\n    }%s\n", same ? "true" : "false", size_n + 1 < columnCounts.size() ? "," : "");
+    } else {
+      printf("%7d  %9.2f us/frame  %9.2f us/frame  %11.2f us/frame  %11.2f us/frame  %7d  %6d  %4d/%-4d  %s\n", columns, fullAll.frameUs, fullOutput.frameUs,
+             virtualAll.frameUs, virtualOutput.frameUs, virtualOutput.visibleColumns, virtualOutput.outputColumns, virtualOutput.partialFrames, frames,
+             same ? "same" : "DIFFER");
+    }
+  }
+  if (json) {
+    printf("  ],\n  \"same_output\": %s\n}\n", ok ? "true" : "false");
+  }
+  return ok ? 0 : 2;
+}
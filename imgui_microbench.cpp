@@ -0,0 +1,506 @@
+/**
+ *
+ * imgui_microbench: microbenchmarks for Dear ImGui core primitives.
+ *
+ * Each benchmark is calibrated to run batches of at least kMinBatchTime, repeated
+ * kRepetitions times; the median time per operation is reported.
+ *
+ * Usage:
+ *   imgui_microbench [--filter SUBSTR] [--json] [--save FILE] [--baseline FILE] [--threshold RATIO]
+ *
+ *   --json        Print results as JSON (one benchmark per line) instead of a text table.
+ *   --save        Also write results as JSON to FILE, to be used later as a baseline.
+ *   --baseline    Compare with results previously saved with --save. Exit code is 2 when
+ *                 any benchmark is slower than baseline by more than the threshold.
+ *   --threshold   Allowed slowdown ratio before reporting a regression (default 0.10 == 10%).
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "imgui_bench_common.h"
+
+
+constexpr double kMinBatchTime{0.02};    // Seconds
+constexpr int32_t kRepetitions{7};
+constexpr double kDefaultThreshold{0.10};
+
+// Results are accumulated here so the compiler can't discard the benchmarked work
+static volatile uint64_t sink_{0};
+
+// Only run benchmarks whose name contains this string (--filter)
+static const char* filter_{nullptr};
+
+struct BenchResult {
+  std::string name;
+  double nsPerOp{0.0};     // Median over repetitions
+  double nsPerOpMin{0.0};
+  int64_t iterations{0};   // Per repetition
+};
+
+using Clock = std::chrono::high_resolution_clock;
+
+// Run 'body(iterations)' with calibrated iteration count. 'body' must perform 'iterations' operations.
+// Returns a result with 0 iterations when filtered out.
+static BenchResult RunBench(const char* name, const std::function<void(int64_t)>& body) {
+  BenchResult result;
+  result.name = name;
+  if (filter_ != nullptr && result.name.find(filter_) == std::string::npos) {
+    return result;
+  }
+
+  int64_t iterations{1};
+  for (;;) {
+    const auto t0 = Clock::now();
+    body(iterations);
+    const double elapsed = std::chrono::duration<double>(Clock::now() - t0).count();
+    if (elapsed >= kMinBatchTime || iterations >= (int64_t(1) << 40)) {
+      break;
+    }
+    const double scale = (elapsed > 0.0) ? std::min(10.0, std::max(1.5, kMinBatchTime * 1.2 / elapsed)) : 10.0;
+    iterations = (int64_t)(iterations * scale) + 1;
+  }
+
+  std::vector<double> samples;
+  for (int rep = 0; rep < kRepetitions; rep++) {
+    const auto t0 = Clock::now();
+    body(iterations);
+    const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+    samples.push_back(elapsed / (double)iterations);
+  }
+  std::sort(samples.begin(), samples.end());
+
+  result.nsPerOp = samples[samples.size() / 2];
+  result.nsPerOpMin = samples.front();
+  result.iterations = iterations;
+  return result;
+}
+
+
+//
+// Shared fixtures
+//
+static const char* kLoremIpsum =
+  "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. "
+  "Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat. "
+  "Duis aute irure dolor in reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla pariatur.";
+
+static void NewFrameForBench() {
+  ImGuiIO& io = ImGui::GetIO();
+  io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+  io.DeltaTime = 1.0f / 60.0f;
+  ImGui::NewFrame();
+}
+
+static void ResetDrawList(ImDrawList* draw_list) {
+  draw_list->_ResetForNewFrame();
+  draw_list->PushClipRectFullScreen();
+  draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+}
+
+
+//
+// Benchmarks
+//
+static void BenchHashing(std::vector<BenchResult>& results) {
+  static const char* kShortString = "##SomeWidgetLabel";
+  std::vector<char> longString(256, 'x');
+  longString.back() = 0;
+  std::vector<unsigned char> data4k(4096);
+  for (size_t n = 0; n < data4k.size(); n++) {
+    data4k[n] = (unsigned char)(n * 31);
+  }
+
+  results.push_back(RunBench("ImHashStr/short", [](int64_t iterations) {
+    ImGuiID acc{0};
+    for (int64_t i = 0; i < iterations; i++) {
+      acc += ImHashStr(kShortString, 0, acc);
+    }
+    sink_ += acc;
+  }));
+  results.push_back(RunBench("ImHashStr/256", [&](int64_t iterations) {
+    ImGuiID acc{0};
+    for (int64_t i = 0; i < iterations; i++) {
+      acc += ImHashStr(longString.data(), 0, acc);
+    }
+    sink_ += acc;
+  }));
+  results.push_back(RunBench("ImHashData/16", [&](int64_t iterations) {
+    ImGuiID acc{0};
+    for (int64_t i = 0; i < iterations; i++) {
+      acc += ImHashData(data4k.data(), 16, acc);
+    }
+    sink_ += acc;
+  }));
+  results.push_back(RunBench("ImHashData/4096", [&](int64_t iterations) {
+    ImGuiID acc{0};
+    for (int64_t i = 0; i < iterations; i++) {
+      acc += ImHashData(data4k.data(), data4k.size(), acc);
+    }
+    sink_ += acc;
+  }));
+}
+
+static void BenchStorage(std::vector<BenchResult>& results) {
+  constexpr int kKeys{1000};
+  std::vector<ImGuiID> keys(kKeys);
+  for (int n = 0; n < kKeys; n++) {
+    keys[n] = ImHashData(&n, sizeof(n));
+  }
+  ImGuiStorage storage;
+  for (int n = 0; n < kKeys; n++) {
+    storage.SetInt(keys[n], n);
+  }
+
+  results.push_back(RunBench("ImGuiStorage/GetInt/1000", [&](int64_t iterations) {
+    int acc{0};
+    for (int64_t i = 0; i < iterations; i++) {
+      acc += storage.GetInt(keys[(size_t)(i % kKeys)]);
+    }
+    sink_ += (uint64_t)acc;
+  }));
+  results.push_back(RunBench("ImGuiStorage/SetInt/1000", [&](int64_t iterations) {
+    for (int64_t i = 0; i < iterations; i++) {
+      storage.SetInt(keys[(size_t)(i % kKeys)], (int)i);
+    }
+  }));
+  results.push_back(RunBench("ImGuiStorage/SetInt/insert", [&](int64_t iterations) {
+    ImGuiStorage local;
+    for (int64_t i = 0; i < iterations; i++) {
+      if ((i % kKeys) == 0) {
+        local.Clear();
+      }
+      local.SetInt(keys[(size_t)(i % kKeys)], (int)i);
+    }
+  }));
+}
+
+static void BenchText(std::vector<BenchResult>& results) {
+  ImFont* font = ImGui::GetFont();
+  const float size = font->FontSize;
+  const char* loremEnd = kLoremIpsum + strlen(kLoremIpsum);
+
+  results.push_back(RunBench("ImFont::CalcTextSizeA/label", [&](int64_t iterations) {
+    float acc{0.0f};
+    for (int64_t i = 0; i < iterations; i++) {
+      acc += font->CalcTextSizeA(size, FLT_MAX, 0.0f, "Some Button Label").x;
+    }
+    sink_ += (uint64_t)acc;
+  }));
+  results.push_back(RunBench("ImFont::CalcTextSizeA/paragraph", [&](int64_t iterations) {
+    float acc{0.0f};
+    for (int64_t i = 0; i < iterations; i++) {
+      acc += font->CalcTextSizeA(size, FLT_MAX, 0.0f, kLoremIpsum, loremEnd).x;
+    }
+    sink_ += (uint64_t)acc;
+  }));
+  results.push_back(RunBench("ImFont::CalcTextSizeA/paragraph_wrapped", [&](int64_t iterations) {
+    float acc{0.0f};
+    for (int64_t i = 0; i < iterations; i++) {
+      acc += font->CalcTextSizeA(size, FLT_MAX, 300.0f, kLoremIpsum, loremEnd).y;
+    }
+    sink_ += (uint64_t)acc;
+  }));
+
+  ImDrawList draw_list(ImGui::GetDrawListSharedData());
+  const ImVec4 clip_rect(0.0f, 0.0f, 1920.0f, 1080.0f);
+  results.push_back(RunBench("ImFont::RenderText/paragraph", [&](int64_t iterations) {
+    ResetDrawList(&draw_list);
+    for (int64_t i = 0; i < iterations; i++) {
+      if ((i & 63) == 63) {
+        ResetDrawList(&draw_list);
+      }
+      font->RenderText(&draw_list, size, ImVec2(10.0f, 10.0f), IM_COL32_WHITE, clip_rect, kLoremIpsum, loremEnd, 0.0f, false);
+    }
+    sink_ += (uint64_t)draw_list.VtxBuffer.Size;
+  }));
+  results.push_back(RunBench("ImFont::RenderText/paragraph_wrapped", [&](int64_t iterations) {
+    ResetDrawList(&draw_list);
+    for (int64_t i = 0; i < iterations; i++) {
+      if ((i & 63) == 63) {
+        ResetDrawList(&draw_list);
+      }
+      font->RenderText(&draw_list, size, ImVec2(10.0f, 10.0f), IM_COL32_WHITE, clip_rect, kLoremIpsum, loremEnd, 300.0f, false);
+    }
+    sink_ += (uint64_t)draw_list.VtxBuffer.Size;
+  }));
+}
+
+static void BenchDrawList(std::vector<BenchResult>& results) {
+  ImDrawList draw_list(ImGui::GetDrawListSharedData());
+  constexpr int kPoints{100};
+  static ImVec2 points[kPoints];
+  for (int n = 0; n < kPoints; n++) {
+    points[n] = ImVec2(10.0f + n * 7.0f, 300.0f + sinf(n * 0.3f) * 80.0f);
+  }
+  const ImDrawListFlags aaFlags = draw_list._Data->InitialFlags;
+
+  struct DrawCase {
+    const char* name;
+    ImDrawListFlags flags;
+    std::function<void(ImDrawList*)> draw;
+  };
+  const DrawCase cases[] = {
+    {"ImDrawList::AddPolyline/100pts_aa_thin", aaFlags, [](ImDrawList* dl) { dl->AddPolyline(points, kPoints, IM_COL32_WHITE, ImDrawFlags_None, 1.0f); }},
+    {"ImDrawList::AddPolyline/100pts_aa_thick", aaFlags, [](ImDrawList* dl) { dl->AddPolyline(points, kPoints, IM_COL32_WHITE, ImDrawFlags_None, 4.0f); }},
+    {"ImDrawList::AddPolyline/100pts_noaa", ImDrawListFlags_None, [](ImDrawList* dl) { dl->AddPolyline(points, kPoints, IM_COL32_WHITE, ImDrawFlags_None, 1.0f); }},
+    {"ImDrawList::AddPolyline/100pts_aa_closed", aaFlags, [](ImDrawList* dl) { dl->AddPolyline(points, kPoints, IM_COL32_WHITE, ImDrawFlags_Closed, 2.0f); }},
+    {"ImDrawList::AddRectFilled/square", aaFlags, [](ImDrawList* dl) { dl->AddRectFilled(ImVec2(10.0f, 10.0f), ImVec2(110.0f, 40.0f), IM_COL32_WHITE); }},
+    {"ImDrawList::AddRectFilled/rounded", aaFlags, [](ImDrawList* dl) { dl->AddRectFilled(ImVec2(10.0f, 10.0f), ImVec2(110.0f, 40.0f), IM_COL32_WHITE, 6.0f); }},
+    {"ImDrawList::PathArcTo/circle_stroke", aaFlags, [](ImDrawList* dl) { dl->PathArcTo(ImVec2(200.0f, 200.0f), 50.0f, 0.0f, IM_PI * 2.0f); dl->PathStroke(IM_COL32_WHITE, ImDrawFlags_Closed, 1.0f); }},
+    {"ImDrawList::PathArcTo/arc_fill", aaFlags, [](ImDrawList* dl) { dl->PathLineTo(ImVec2(200.0f, 200.0f)); dl->PathArcTo(ImVec2(200.0f, 200.0f), 50.0f, 0.0f, IM_PI * 0.75f); dl->PathFillConvex(IM_COL32_WHITE); }},
+  };
+  for (const DrawCase& c : cases) {
+    results.push_back(RunBench(c.name, [&](int64_t iterations) {
+      ResetDrawList(&draw_list);
+      draw_list.Flags = c.flags;
+      for (int64_t i = 0; i < iterations; i++) {
+        if ((i & 255) == 255) {
+          ResetDrawList(&draw_list);
+          draw_list.Flags = c.flags;
+        }
+        c.draw(&draw_list);
+      }
+      sink_ += (uint64_t)draw_list.VtxBuffer.Size;
+    }));
+  }
+
+  // Split/Merge cycle, as done by tables (one channel per column)
+  results.push_back(RunBench("ImDrawListSplitter::Merge/16ch", [&](int64_t iterations) {
+    ImDrawListSplitter splitter;
+    for (int64_t i = 0; i < iterations; i++) {
+      if ((i & 63) == 0) {
+        ResetDrawList(&draw_list);
+      }
+      splitter.Split(&draw_list, 16);
+      for (int channel = 0; channel < 16; channel++) {
+        splitter.SetCurrentChannel(&draw_list, channel);
+        draw_list.PushClipRect(ImVec2(channel * 50.0f, 0.0f), ImVec2(channel * 50.0f + 50.0f, 1080.0f));
+        for (int cell = 0; cell < 8; cell++) {
+          draw_list.AddRectFilled(ImVec2(channel * 50.0f, cell * 20.0f), ImVec2(channel * 50.0f + 40.0f, cell * 20.0f + 16.0f), IM_COL32_WHITE);
+        }
+        draw_list.PopClipRect();
+      }
+      splitter.Merge(&draw_list);
+    }
+    splitter.ClearFreeMemory();
+    sink_ += (uint64_t)draw_list.CmdBuffer.Size;
+  }));
+}
+
+static void BenchFontAtlas(std::vector<BenchResult>& results) {
+  results.push_back(RunBench("ImFontAtlas::Build/default", [](int64_t iterations) {
+    for (int64_t i = 0; i < iterations; i++) {
+      ImFontAtlas atlas;
+      atlas.AddFontDefault();
+      atlas.Build();
+      sink_ += (uint64_t)atlas.TexHeight;
+    }
+  }));
+  results.push_back(RunBench("ImFontAtlas::Build/default_x3_sizes", [](int64_t iterations) {
+    for (int64_t i = 0; i < iterations; i++) {
+      ImFontAtlas atlas;
+      for (int size = 13; size <= 26; size += 6) {
+        ImFontConfig config;
+        config.SizePixels = (float)size;
+        atlas.AddFontDefault(&config);
+      }
+      atlas.Build();
+      sink_ += (uint64_t)atlas.TexHeight;
+    }
+  }));
+}
+
+static void BenchTextFilter(std::vector<BenchResult>& results) {
+  std::vector<std::string> items;
+  for (int n = 0; n < 1000; n++) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%s_item_%04d_%s", (n % 3) ? "widget" : "panel", n, (n % 7) ? "value" : "bar");
+    items.push_back(buf);
+  }
+  ImGuiTextFilter simple("item_05");
+  ImGuiTextFilter multi("panel,widget,-bar");
+
+  results.push_back(RunBench("ImGuiTextFilter::PassFilter/simple", [&](int64_t iterations) {
+    int passed{0};
+    for (int64_t i = 0; i < iterations; i++) {
+      passed += simple.PassFilter(items[(size_t)(i % (int64_t)items.size())].c_str()) ? 1 : 0;
+    }
+    sink_ += (uint64_t)passed;
+  }));
+  results.push_back(RunBench("ImGuiTextFilter::PassFilter/multi", [&](int64_t iterations) {
+    int passed{0};
+    for (int64_t i = 0; i < iterations; i++) {
+      passed += multi.PassFilter(items[(size_t)(i % (int64_t)items.size())].c_str()) ? 1 : 0;
+    }
+    sink_ += (uint64_t)passed;
+  }));
+}
+
+// TableUpdateLayout() can't be called in isolation (it locks the layout and allocates draw channels),
+// so we measure BeginTable() + TableSetupColumn() + first TableNextRow() (which runs the layout) + EndTable(),
+// submitting kTables different tables per frame. Frame overhead is amortized over those tables.
+static void BenchTables(std::vector<BenchResult>& results) {
+  constexpr int kTables{32};
+  constexpr int kColumns{64};
+  ImGui::EndFrame();
+  results.push_back(RunBench("TableUpdateLayout/64cols", [](int64_t iterations) {
+    int64_t done{0};
+    while (done < iterations) {
+      NewFrameForBench();
+      ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+      ImGui::SetNextWindowSize(ImVec2(1920.0f, 1080.0f));
+      ImGui::Begin("Tables", nullptr, ImGuiWindowFlags_NoSavedSettings);
+      for (int table_n = 0; table_n < kTables && done < iterations; table_n++, done++) {
+        ImGui::PushID(table_n);
+        if (ImGui::BeginTable("table", kColumns, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable | ImGuiTableFlags_ScrollX, ImVec2(0.0f, 30.0f))) {
+          for (int column = 0; column < kColumns; column++) {
+            ImGui::TableSetupColumn("", ImGuiTableColumnFlags_WidthFixed, 40.0f);
+          }
+          ImGui::TableNextRow();
+          ImGui::EndTable();
+        }
+        ImGui::PopID();
+      }
+      ImGui::End();
+      ImGui::EndFrame();
+    }
+  }));
+  NewFrameForBench();
+}
+
+
+//
+// Output and baseline comparison
+//
+static void WriteJson(FILE* out, const std::vector<BenchResult>& results) {
+  fprintf(out, "{\"imgui_version\": \"%s\", \"results\": [\n", ImGui::GetVersion());
+  for (size_t n = 0; n < results.size(); n++) {
+    const BenchResult& r = results[n];
+    fprintf(out, "{\"name\": \"%s\", \"ns_per_op\": %.3f, \"ns_per_op_min\": %.3f, \"iterations\": %lld}%s\n",
+            r.name.c_str(), r.nsPerOp, r.nsPerOpMin, (long long)r.iterations, (n + 1 < results.size()) ? "," : "");
+  }
+  fprintf(out, "]}\n");
+}
+
+// Read back a file written by WriteJson(). Only supports that exact layout: one result per line.
+static bool ReadBaseline(const char* filename, std::vector<BenchResult>& out) {
+  FILE* f = fopen(filename, "rt");
+  if (f == nullptr) {
+    return false;
+  }
+  char line[512];
+  while (fgets(line, sizeof(line), f)) {
+    char name[256];
+    double nsPerOp{0.0};
+    if (sscanf(line, "{\"name\": \"%255[^\"]\", \"ns_per_op\": %lf", name, &nsPerOp) == 2) {
+      BenchResult r;
+      r.name = name;
+      r.nsPerOp = nsPerOp;
+      out.push_back(r);
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+static int CompareWithBaseline(const std::vector<BenchResult>& results, const std::vector<BenchResult>& baseline, double threshold) {
+  int regressions{0};
+  printf("\n%-44s %12s %12s %8s\n", "benchmark", "baseline ns", "current ns", "change");
+  for (const BenchResult& r : results) {
+    auto it = std::find_if(baseline.begin(), baseline.end(), [&](const BenchResult& b) { return b.name == r.name; });
+    if (it == baseline.end() || it->nsPerOp <= 0.0) {
+      printf("%-44s %12s %12.2f %8s\n", r.name.c_str(), "-", r.nsPerOp, "new");
+      continue;
+    }
+    const double change = r.nsPerOp / it->nsPerOp - 1.0;
+    const bool regressed = change > threshold;
+    regressions += regressed ? 1 : 0;
+    printf("%-44s %12.2f %12.2f %+7.1f%%%s\n", r.name.c_str(), it->nsPerOp, r.nsPerOp, change * 100.0, regressed ? "  REGRESSION" : "");
+  }
+  printf("%d regression(s) above %.1f%% threshold\n", regressions, threshold * 100.0);
+  return regressions;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  const char* saveFile{nullptr};
+  const char* baselineFile{nullptr};
+  double threshold{kDefaultThreshold};
+  bool json{false};
+  bench::Args args(argc, argv, "[--filter SUBSTR] [--json] [--save FILE] [--baseline FILE] [--threshold RATIO]");
+  while (args.Next()) {
+    if (!args.String("--filter", &filter_) && !args.String("--save", &saveFile) && !args.String("--baseline", &baselineFile) &&
+        !args.Double("--threshold", &threshold) && !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+
+  // A context is needed for fonts, draw list shared data and tables
+  ImGui::CreateContext();
+  ImGui::GetIO().IniFilename = nullptr;
+  unsigned char* pixels;
+  int width, height;
+  ImGui::GetIO().Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+  NewFrameForBench();
+
+  using BenchGroup = void (*)(std::vector<BenchResult>&);
+  const BenchGroup groups[] = {BenchHashing, BenchStorage, BenchText, BenchDrawList, BenchFontAtlas, BenchTextFilter, BenchTables};
+  std::vector<BenchResult> results;
+  for (BenchGroup group : groups) {
+    std::vector<BenchResult> groupResults;
+    group(groupResults);
+    for (const BenchResult& r : groupResults) {
+      if (r.iterations > 0) {
+        results.push_back(r);
+      }
+    }
+  }
+  ImGui::EndFrame();
+  ImGui::DestroyContext();
+
+  if (json) {
+    WriteJson(stdout, results);
+  } else {
+    printf("Dear ImGui %s\n%-44s %12s %12s %12s\n", ImGui::GetVersion(), "benchmark", "ns/op", "min ns/op", "iterations");
+    for (const BenchResult& r : results) {
+      printf("%-44s %12.2f %12.2f %12lld\n", r.name.c_str(), r.nsPerOp, r.nsPerOpMin, (long long)r.iterations);
+    }
+  }
+
+  if (saveFile != nullptr) {
+    FILE* f = fopen(saveFile, "wt");
+    if (f == nullptr) {
+      fprintf(stderr, "Cannot write '%s'\n", saveFile);
+      return 1;
+    }
+    WriteJson(f, results);
+    fclose(f);
+  }
+
+  if (baselineFile != nullptr) {
+    std::vector<BenchResult> baseline;
+    if (!ReadBaseline(baselineFile, baseline)) {
+      fprintf(stderr, "Cannot read baseline '%s'\n", baselineFile);
+      return 1;
+    }
+    if (CompareWithBaseline(results, baseline, threshold) > 0) {
+      return 2;
+    }
+  }
+  return 0;
+}
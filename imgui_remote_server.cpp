@@ -0,0 +1,253 @@
+/**
+ *
+ * imgui_remote_server: headless Dear ImGui application streamed to a remote viewer.
+ *
+ * Runs the Dear ImGui demo with the remote platform/renderer backend
+ * (imgui/imgui_impl_remote.cpp): no window and no GL context, every frame is
+ * delta-encoded and sent to the connected imgui_remote_viewer, which sends its
+ * inputs back. Bandwidth statistics are printed periodically.
+ *
+ * --loopback-test N runs N frames with an in-process viewer connected over
+ * 127.0.0.1 and scripted inputs, checks that every decoded frame is identical
+ * to the frame rendered by the application, and reports bandwidth per frame,
+ * compression ratio and input-to-frame latency. The exit code is 2 when a
+ * decoded frame differs.
+ *
+ * Usage:
+ *   imgui_remote_server [--bind ADDRESS] [--port N] [--frames N]
+ *   imgui_remote_server --loopback-test N [--json]
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_impl_remote.h"
+#include "imgui_bench_common.h"
+
+
+constexpr int32_t kDisplayWidth{1280};
+constexpr int32_t kDisplayHeight{720};
+constexpr int32_t kDefaultPort{7000};
+constexpr int32_t kStatsInterval{300};
+constexpr double kLoopbackTimeoutSeconds{5.0};
+
+
+//
+// FNV-1a over everything a renderer consumes, to compare the application and viewer draw data.
+//
+static uint32_t HashDrawData(const ImDrawData* drawData) {
+  uint32_t hash{bench::kHashSeed};
+  hash = bench::HashBytes(hash, &drawData->DisplaySize, sizeof(drawData->DisplaySize));
+  for (int n = 0; n < drawData->CmdListsCount; n++) {
+    const ImDrawList* cmdList = drawData->CmdLists[n];
+    for (const ImDrawCmd& cmd : cmdList->CmdBuffer) {
+      if (cmd.UserCallback != nullptr && cmd.UserCallback != ImDrawCallback_ResetRenderState) {
+        continue;
+      }
+      const ImTextureID texId = cmd.GetTexID();
+      hash = bench::HashBytes(hash, &cmd.ClipRect, sizeof(cmd.ClipRect));
+      hash = bench::HashBytes(hash, &texId, sizeof(texId));
+      hash = bench::HashBytes(hash, &cmd.VtxOffset, sizeof(cmd.VtxOffset));
+      hash = bench::HashBytes(hash, &cmd.IdxOffset, sizeof(cmd.IdxOffset));
+      hash = bench::HashBytes(hash, &cmd.ElemCount, sizeof(cmd.ElemCount));
+    }
+    hash = bench::HashBytes(hash, cmdList->VtxBuffer.Data, cmdList->VtxBuffer.size_in_bytes());
+    hash = bench::HashBytes(hash, cmdList->IdxBuffer.Data, cmdList->IdxBuffer.size_in_bytes());
+  }
+  return hash;
+}
+
+
+//
+// Application
+//
+struct AppState {
+  bool showDemo{true};
+  int frame{0};
+};
+
+static void BuildUi(AppState& state) {
+  const ImGui_ImplRemote_Stats* stats = ImGui_ImplRemote_GetStats();
+  ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiCond_FirstUseEver);
+  ImGui::Begin("Remote");
+  ImGui::Text("Frame %d", state.frame);
+  ImGui::Text("Last frame: %d bytes (%d raw), encoded in %.3f ms", stats->LastFrameBytes, stats->LastFrameBytesRaw, stats->LastEncodeTime);
+  ImGui::Text("Sent %d frames, dropped %d", stats->FramesSent, stats->FramesDropped);
+  ImGui::Checkbox("Demo Window", &state.showDemo);
+  ImGui::End();
+  if (state.showDemo) {
+    ImGui::ShowDemoWindow(&state.showDemo);
+  }
+  state.frame++;
+}
+
+static void PrintStats() {
+  const ImGui_ImplRemote_Stats* stats = ImGui_ImplRemote_GetStats();
+  const double frames = std::max(stats->FramesSent, 1);
+  printf("frames %d (dropped %d), %.0f bytes/frame (%.0f raw, ratio %.1fx), last encode %.3f ms, total %llu bytes\n",
+         stats->FramesSent, stats->FramesDropped, stats->FrameBytesSent / frames, stats->FrameBytesRaw / frames,
+         stats->FrameBytesSent ? (double)stats->FrameBytesRaw / stats->FrameBytesSent : 0.0, stats->LastEncodeTime,
+         (unsigned long long)stats->BytesSent);
+  fflush(stdout);
+}
+
+static int RunServer(const char* bindAddress, int port, int frames) {
+  if (!ImGui_ImplRemote_Init(bindAddress, port, ImVec2((float)kDisplayWidth, (float)kDisplayHeight))) {
+    fprintf(stderr, "Cannot listen on %s:%d\n", bindAddress, port);
+    return 1;
+  }
+  printf("Listening on %s:%d\n", bindAddress, ImGui_ImplRemote_GetPort());
+  fflush(stdout);
+
+  AppState state;
+  bool wasConnected{false};
+  for (int frame = 0; frames == 0 || frame < frames; frame++) {
+    const auto frameStart = std::chrono::steady_clock::now();
+    ImGui_ImplRemote_NewFrame();
+    ImGui::NewFrame();
+    BuildUi(state);
+    ImGui::Render();
+    ImGui_ImplRemote_RenderDrawData(ImGui::GetDrawData());
+
+    const bool connected = ImGui_ImplRemote_IsViewerConnected();
+    if (connected != wasConnected) {
+      printf("Viewer %s\n", connected ? "connected" : "disconnected");
+      wasConnected = connected;
+    }
+    if (connected && (frame % kStatsInterval) == kStatsInterval - 1) {
+      PrintStats();
+    }
+    std::this_thread::sleep_until(frameStart + std::chrono::microseconds(16667));
+  }
+  PrintStats();
+  ImGui_ImplRemote_Shutdown();
+  return 0;
+}
+
+
+//
+// Loopback test: application and viewer in the same process and thread.
+//
+static void ScriptViewerInput(ImGuiIO& viewerIo, int frame) {
+  viewerIo.DisplaySize = ImVec2((float)kDisplayWidth, (float)kDisplayHeight);
+  viewerIo.MousePos = ImVec2((float)((frame * 7) % kDisplayWidth), (float)((frame * 3) % kDisplayHeight));
+  viewerIo.MouseDown[0] = (frame % 30) == 15;
+  viewerIo.MouseWheel = ((frame % 20) == 10) ? ((frame % 40) < 20 ? -1.0f : 1.0f) : 0.0f;
+  viewerIo.InputQueueCharacters.resize(0);
+  if ((frame % 50) == 25) {
+    viewerIo.AddInputCharacter('a' + (frame / 50) % 26);
+  }
+}
+
+static int RunLoopbackTest(int frames, bool json) {
+  if (!ImGui_ImplRemote_Init("127.0.0.1", 0, ImVec2((float)kDisplayWidth, (float)kDisplayHeight))) {
+    fprintf(stderr, "Cannot listen on 127.0.0.1\n");
+    return 1;
+  }
+  ImGui_ImplRemoteViewer* viewer = ImGui_ImplRemoteViewer_Connect("127.0.0.1", ImGui_ImplRemote_GetPort(), nullptr, nullptr);
+  if (viewer == nullptr) {
+    fprintf(stderr, "Cannot connect to 127.0.0.1:%d\n", ImGui_ImplRemote_GetPort());
+    ImGui_ImplRemote_Shutdown();
+    return 1;
+  }
+
+  // The viewer only needs an ImGuiIO to snapshot inputs from: keys are given as ImGuiKey_XXX values.
+  ImGuiIO viewerIo;
+  for (int key = 0; key < ImGuiKey_COUNT; key++) {
+    viewerIo.KeyMap[key] = key;
+  }
+
+  AppState state;
+  int mismatches{0};
+  int timeouts{0};
+  for (int frame = 0; frame < frames; frame++) {
+    ScriptViewerInput(viewerIo, frame);
+    ImGui_ImplRemoteViewer_SendInput(viewer, viewerIo);
+
+    ImGui_ImplRemote_NewFrame();
+    ImGui::NewFrame();
+    BuildUi(state);
+    ImGui::Render();
+    ImGui_ImplRemote_RenderDrawData(ImGui::GetDrawData());
+    const uint32_t sentHash = HashDrawData(ImGui::GetDrawData());
+
+    // Pump both sides until the viewer decoded this frame
+    const auto t0 = std::chrono::steady_clock::now();
+    bool received{false};
+    while (!received && ImGui_ImplRemoteViewer_IsConnected(viewer)) {
+      ImGui_ImplRemote_Flush();
+      received = ImGui_ImplRemoteViewer_Update(viewer);
+      if (std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count() > kLoopbackTimeoutSeconds) {
+        break;
+      }
+    }
+    if (!received) {
+      timeouts++;
+      break;
+    }
+    if (HashDrawData(ImGui_ImplRemoteViewer_GetDrawData(viewer)) != sentHash) {
+      if (mismatches == 0) {
+        fprintf(stderr, "Frame %d: decoded draw data differs from the application draw data\n", frame);
+      }
+      mismatches++;
+    }
+  }
+
+  const ImGui_ImplRemote_Stats* stats = ImGui_ImplRemote_GetStats();
+  const ImGui_ImplRemoteViewer_Stats* viewerStats = ImGui_ImplRemoteViewer_GetStats(viewer);
+  const double framesReceived = std::max(viewerStats->FramesReceived, 1);
+  const double bytesPerFrame = viewerStats->FrameBytesReceived / framesReceived;
+  const double rawBytesPerFrame = viewerStats->FrameBytesRaw / framesReceived;
+  const double ratio = viewerStats->FrameBytesReceived ? (double)viewerStats->FrameBytesRaw / viewerStats->FrameBytesReceived : 0.0;
+  const double meanLatency = viewerStats->LatencySamples ? viewerStats->TotalLatency / viewerStats->LatencySamples : 0.0;
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"frames\": %d,\n  \"frames_received\": %d,\n  \"mismatches\": %d,\n  \"timeouts\": %d,\n",
+           ImGui::GetVersion(), frames, viewerStats->FramesReceived, mismatches, timeouts);
+    printf("  \"bytes_per_frame\": %.1f,\n  \"raw_bytes_per_frame\": %.1f,\n  \"compression_ratio\": %.2f,\n  \"connection_bytes\": %llu,\n",
+           bytesPerFrame, rawBytesPerFrame, ratio, (unsigned long long)viewerStats->BytesReceived);
+    printf("  \"latency_mean_ms\": %.3f,\n  \"latency_max_ms\": %.3f,\n  \"last_encode_ms\": %.3f\n}\n",
+           meanLatency, viewerStats->MaxLatency, stats->LastEncodeTime);
+  } else {
+    printf("Dear ImGui %s, loopback, %d frames, %dx%d\n", ImGui::GetVersion(), frames, kDisplayWidth, kDisplayHeight);
+    printf("frames received   %d (%d mismatches, %d timeouts)\n", viewerStats->FramesReceived, mismatches, timeouts);
+    printf("bytes/frame       %.1f (raw %.1f, ratio %.1fx)\n", bytesPerFrame, rawBytesPerFrame, ratio);
+    printf("connection bytes  %llu (including textures)\n", (unsigned long long)viewerStats->BytesReceived);
+    printf("latency           mean %.3f ms, max %.3f ms\n", meanLatency, viewerStats->MaxLatency);
+  }
+
+  ImGui_ImplRemoteViewer_Disconnect(viewer);
+  ImGui_ImplRemote_Shutdown();
+  return (mismatches > 0 || timeouts > 0) ? 2 : 0;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  const char* bindAddress{"127.0.0.1"};
+  int port{kDefaultPort};
+  int frames{0};
+  int loopbackFrames{0};
+  bool json{false};
+  bench::Args args(argc, argv, "[--bind ADDRESS] [--port N] [--frames N] | --loopback-test N [--json]");
+  while (args.Next()) {
+    if (!args.String("--bind", &bindAddress) && !args.Int("--port", &port) && !args.Int("--frames", &frames) &&
+        !args.Int("--loopback-test", &loopbackFrames) && !args.Flag("--json", &json)) {
+      return args.Fail();
+    }
+  }
+  if (port < 0 || frames < 0 || loopbackFrames < 0) {
+    return args.Fail();
+  }
+
+  ImGui::CreateContext();
+  ImGui::GetIO().IniFilename = nullptr;
+  ImGui::StyleColorsDark();
+  const int result = (loopbackFrames > 0) ? RunLoopbackTest(loopbackFrames, json) : RunServer(bindAddress, port, frames);
+  ImGui::DestroyContext();
+  return result;
+}
@@ -0,0 +1,147 @@
+/**
+ *
+ * imgui_remote_viewer: displays a Dear ImGui application running elsewhere.
+ *
+ * Connects to an imgui_remote_server (or any application using the remote
+ * backend in imgui/imgui_impl_remote.cpp), renders the received draw data with
+ * the OpenGL3 renderer backend and sends the window inputs back. A local
+ * overlay shows the bandwidth per frame and the input-to-frame latency.
+ *
+ * Usage:
+ *   imgui_remote_viewer [--host HOST] [--port N]
+ *
+ */
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_impl_glfw.h"
+#include "imgui/imgui_impl_opengl3.h"
+#include "imgui/imgui_impl_remote.h"
+
+
+constexpr int32_t kWidth{1280};
+constexpr int32_t kHeight{720};
+constexpr int32_t kDefaultPort{7000};
+
+const std::string glsl_version{"#version 130"};
+const std::string kTitle{"Dear ImGui remote viewer"};
+
+
+static ImTextureID CreateTexture(int width, int height, const unsigned char* pixels, void*) {
+  GLuint texture{0};
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D, texture);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+  return (ImTextureID)(intptr_t)texture;
+}
+
+static void ShowOverlay(ImGui_ImplRemoteViewer* viewer, const char* host, int port) {
+  const ImGui_ImplRemoteViewer_Stats* stats = ImGui_ImplRemoteViewer_GetStats(viewer);
+  ImGui::SetNextWindowPos(ImVec2(ImGui::GetIO().DisplaySize.x - 10.0f, 10.0f), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+  ImGui::SetNextWindowBgAlpha(0.5f);
+  ImGui::Begin("##overlay", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav);
+  ImGui::Text("%s:%d %s", host, port, ImGui_ImplRemoteViewer_IsConnected(viewer) ? "" : "(disconnected)");
+  ImGui::Text("Frames: %d", stats->FramesReceived);
+  ImGui::Text("Frame: %d bytes (%d raw)", stats->LastFrameBytes, stats->LastFrameBytesRaw);
+  if (stats->FramesReceived > 0) {
+    ImGui::Text("Average: %.0f bytes/frame (ratio %.1fx)", (double)stats->FrameBytesReceived / stats->FramesReceived,
+                stats->FrameBytesReceived ? (double)stats->FrameBytesRaw / stats->FrameBytesReceived : 0.0);
+  }
+  ImGui::Text("Latency: %.2f ms (mean %.2f ms, max %.2f ms)", stats->LastLatency,
+              stats->LatencySamples ? stats->TotalLatency / stats->LatencySamples : 0.0, stats->MaxLatency);
+  ImGui::End();
+}
+
+
+int main(int argc, char** argv) {
+  const char* host{"127.0.0.1"};
+  int port{kDefaultPort};
+  for (int n = 1; n < argc; n++) {
+    if (strcmp(argv[n], "--host") == 0 && n + 1 < argc) {
+      host = argv[++n];
+    } else if (strcmp(argv[n], "--port") == 0 && n + 1 < argc) {
+      port = atoi(argv[++n]);
+    } else {
+      fprintf(stderr, "Usage: %s [--host HOST] [--port N]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  glfwSetErrorCallback([](int error, const char *description) {
+    fprintf(stderr, "Glfw Error %d: %s\n", error, description);
+  });
+  if (!glfwInit()) {
+    return 1;
+  }
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  GLFWwindow* window = glfwCreateWindow(kWidth, kHeight, kTitle.c_str(), nullptr, nullptr);
+  if (window == nullptr) {
+    glfwTerminate();
+    return 1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSwapInterval(1);
+  glewExperimental = true;
+  if (glewInit() != GLEW_OK) {
+    glfwTerminate();
+    return 1;
+  }
+
+  ImGui::CreateContext();
+  ImGui::GetIO().IniFilename = nullptr;
+  ImGui::StyleColorsDark();
+  ImGui_ImplGlfw_InitForOpenGL(window, true);
+  ImGui_ImplOpenGL3_Init(glsl_version.c_str());
+
+  ImGui_ImplRemoteViewer* viewer = ImGui_ImplRemoteViewer_Connect(host, port, CreateTexture, nullptr);
+  if (viewer == nullptr) {
+    fprintf(stderr, "Cannot connect to %s:%d\n", host, port);
+  }
+
+  while (!glfwWindowShouldClose(window) && viewer != nullptr) {
+    glfwPollEvents();
+    ImGui_ImplOpenGL3_NewFrame();
+    ImGui_ImplGlfw_NewFrame();
+    ImGui::NewFrame();
+
+    // Inputs go to the application, the local context only draws the overlay
+    ImGui_ImplRemoteViewer_SendInput(viewer, ImGui::GetIO());
+    ImGui_ImplRemoteViewer_Update(viewer);
+    ShowOverlay(viewer, host, port);
+    ImGui::Render();
+
+    int displayWidth, displayHeight;
+    glfwGetFramebufferSize(window, &displayWidth, &displayHeight);
+    glViewport(0, 0, displayWidth, displayHeight);
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    if (ImDrawData* remoteDrawData = ImGui_ImplRemoteViewer_GetDrawData(viewer)) {
+      ImGui_ImplOpenGL3_RenderDrawData(remoteDrawData);
+    }
+    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    glfwSwapBuffers(window);
+  }
+
+  if (viewer != nullptr) {
+    ImGui_ImplRemoteViewer_Disconnect(viewer);
+  }
+  ImGui_ImplOpenGL3_Shutdown();
+  ImGui_ImplGlfw_Shutdown();
+  ImGui::DestroyContext();
+  glfwDestroyWindow(window);
+  glfwTerminate();
+  return 0;
+}
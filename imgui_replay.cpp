@@ -0,0 +1,197 @@
+/**
+ *
+ * imgui_replay: renderer benchmark on captured draw data.
+ *
+ * Replays a capture file (see imgui/imgui_impl_capture.h, e.g. recorded with
+ * imgui_bench --capture) through a renderer backend without running any UI
+ * code, and reports per-frame render time percentiles. Every run of a given
+ * file submits exactly the same draw data, so renderer changes can be A/B
+ * tested on identical workloads; the checksum printed at the end must not
+ * change between runs (or between renderer versions meant to be equivalent).
+ *
+ * Usage:
+ *   imgui_replay FILE [--renderer null|softraster] [--raster-threads N] [--loops N]
+ *                     [--snapshot FILE.ppm] [--json]
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_impl_capture.h"
+#include "imgui/imgui_impl_null.h"
+#include "imgui/imgui_impl_softraster.h"
+#include "imgui_bench_common.h"
+
+
+constexpr int32_t kDefaultLoops{1};
+
+
+struct ReplayOptions {
+  std::string capturePath;
+  bool softRaster{false};
+  int rasterThreads{0};
+  int loops{kDefaultLoops};
+  std::string snapshotPath;
+  bool json{false};
+};
+
+// Softraster textures point into the capture file mapping, which outlives them.
+static std::vector<std::unique_ptr<ImGui_ImplSoftRaster_Texture>> softRasterTextures_;
+
+static ImTextureID CreateSoftRasterTexture(int width, int height, const unsigned char* pixels, void*) {
+  softRasterTextures_.emplace_back(new ImGui_ImplSoftRaster_Texture{reinterpret_cast<const ImU32*>(pixels), width, height});
+  return (ImTextureID)(intptr_t)softRasterTextures_.back().get();
+}
+
+static double Percentile(const std::vector<double>& sorted, double p) {
+  const size_t index = std::min(sorted.size() - 1, (size_t)(p * (sorted.size() - 1) + 0.5));
+  return sorted[index];
+}
+
+static bool WriteSnapshot(const std::string& path, const std::vector<ImU32>& pixels, int width, int height) {
+  FILE* f = fopen(path.c_str(), "wb");
+  if (f == nullptr) {
+    return false;
+  }
+  fprintf(f, "P6\n%d %d\n255\n", width, height);
+  std::vector<unsigned char> row(width * 3);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      const ImU32 c = pixels[y * width + x];
+      row[x * 3 + 0] = (unsigned char)(c >> IM_COL32_R_SHIFT);
+      row[x * 3 + 1] = (unsigned char)(c >> IM_COL32_G_SHIFT);
+      row[x * 3 + 2] = (unsigned char)(c >> IM_COL32_B_SHIFT);
+    }
+    fwrite(row.data(), 1, row.size(), f);
+  }
+  fclose(f);
+  return true;
+}
+
+
+int main(int argc, char** argv) {
+  IMGUI_CHECKVERSION();
+
+  ReplayOptions options;
+  bench::Args args(argc, argv,
+                   "FILE [--renderer null|softraster] [--raster-threads N] [--loops N]\n"
+                   "          [--snapshot FILE.ppm] [--json]");
+  while (args.Next()) {
+    const char* value{nullptr};
+    if (args.String("--renderer", &value)) {
+      if (strcmp(value, "softraster") != 0 && strcmp(value, "null") != 0) {
+        return args.Fail();
+      }
+      options.softRaster = strcmp(value, "softraster") == 0;
+    } else if (args.String("--snapshot", &value)) {
+      options.snapshotPath = value;
+    } else if (args.Positional(&value) && options.capturePath.empty()) {
+      options.capturePath = value;
+    } else if (!args.Int("--raster-threads", &options.rasterThreads) && !args.Int("--loops", &options.loops) && !args.Flag("--json", &options.json)) {
+      return args.Fail();
+    }
+  }
+  if (options.capturePath.empty() || options.loops <= 0) {
+    return args.Fail();
+  }
+
+  // The renderer backends need a context, but no UI code runs and no font is used.
+  ImGui::CreateContext();
+  ImGui::GetIO().IniFilename = nullptr;
+  if (options.softRaster) {
+    ImGui_ImplSoftRaster_Init(options.rasterThreads);
+  } else {
+    ImGui_ImplNullRender_Init();
+  }
+
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  ImGui_ImplCaptureReplay* replay = ImGui_ImplCaptureReplay_Open(options.capturePath.c_str(), options.softRaster ? CreateSoftRasterTexture : nullptr, nullptr);
+  const auto t1 = std::chrono::high_resolution_clock::now();
+  if (replay == nullptr || ImGui_ImplCaptureReplay_GetFramesCount(replay) == 0) {
+    fprintf(stderr, "Could not read '%s'\n", options.capturePath.c_str());
+    return 1;
+  }
+  const int frames = ImGui_ImplCaptureReplay_GetFramesCount(replay);
+  const ImVec2 displaySize = ImGui_ImplCaptureReplay_GetDisplaySize(replay);
+
+  std::vector<ImU32> framebufferPixels;
+  ImGui_ImplSoftRaster_Framebuffer framebuffer{};
+  if (options.softRaster) {
+    framebuffer.Width = framebuffer.Stride = (int)displaySize.x;
+    framebuffer.Height = (int)displaySize.y;
+    framebufferPixels.resize((size_t)framebuffer.Width * framebuffer.Height);
+    framebuffer.Pixels = framebufferPixels.data();
+  }
+
+  std::vector<double> times;
+  times.reserve((size_t)frames * options.loops);
+  uint64_t vtxTotal{0}, idxTotal{0};
+  uint32_t checksum{bench::kHashSeed};
+  for (int loop = 0; loop < options.loops; loop++) {
+    for (int frame = 0; frame < frames; frame++) {
+      const auto f0 = std::chrono::high_resolution_clock::now();
+      ImDrawData* drawData = ImGui_ImplCaptureReplay_GetFrame(replay, frame);
+      if (options.softRaster) {
+        std::fill(framebufferPixels.begin(), framebufferPixels.end(), IM_COL32(115, 140, 153, 255));
+        ImGui_ImplSoftRaster_RenderDrawData(drawData, framebuffer);
+      } else {
+        ImGui_ImplNullRender_RenderDrawData(drawData);
+      }
+      const auto f1 = std::chrono::high_resolution_clock::now();
+      times.push_back(std::chrono::duration<double, std::micro>(f1 - f0).count());
+      vtxTotal += drawData->TotalVtxCount;
+      idxTotal += drawData->TotalIdxCount;
+
+      // Output checksum: the rendered pixels, or the geometry as walked by the null renderer
+      if (loop == 0) {
+        if (options.softRaster) {
+          checksum = bench::HashBytes(checksum, framebufferPixels.data(), framebufferPixels.size() * sizeof(ImU32));
+        } else {
+          const ImU32 frameChecksum = ImGui_ImplNullRender_GetStats()->LastChecksum;
+          checksum = bench::HashBytes(checksum, &frameChecksum, sizeof(frameChecksum));
+        }
+      }
+    }
+  }
+  if (options.softRaster && !options.snapshotPath.empty() && !WriteSnapshot(options.snapshotPath, framebufferPixels, framebuffer.Width, framebuffer.Height)) {
+    fprintf(stderr, "Could not write '%s'\n", options.snapshotPath.c_str());
+  }
+
+  double sum{0.0};
+  for (double t : times) {
+    sum += t;
+  }
+  const double submitted = (double)times.size();
+  std::sort(times.begin(), times.end());
+  const double openMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+  const char* rendererName = options.softRaster ? "softraster" : "null";
+  if (options.json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"file\": \"%s\",\n  \"renderer\": \"%s\",\n  \"frames\": %d,\n  \"loops\": %d,\n  \"display\": [%d, %d],\n",
+           ImGui::GetVersion(), options.capturePath.c_str(), rendererName, frames, options.loops, (int)displaySize.x, (int)displaySize.y);
+    printf("  \"open_ms\": %.3f,\n  \"mean_us\": %.2f,\n  \"p50_us\": %.2f,\n  \"p90_us\": %.2f,\n  \"p99_us\": %.2f,\n  \"max_us\": %.2f,\n",
+           openMs, sum / submitted, Percentile(times, 0.50), Percentile(times, 0.90), Percentile(times, 0.99), times.back());
+    printf("  \"vtx_per_frame\": %.1f,\n  \"idx_per_frame\": %.1f,\n  \"checksum\": \"%08X\"\n}\n", vtxTotal / submitted, idxTotal / submitted, checksum);
+  } else {
+    printf("Dear ImGui %s, %s: %d frames x %d loops, %dx%d, renderer %s, opened in %.3f ms\n",
+           ImGui::GetVersion(), options.capturePath.c_str(), frames, options.loops, (int)displaySize.x, (int)displaySize.y, rendererName, openMs);
+    printf("%9s %9s %9s %9s %9s %9s %9s %9s\n", "mean", "p50", "p90", "p99", "max", "vtx/f", "idx/f", "checksum");
+    printf("%9.1f %9.1f %9.1f %9.1f %9.1f %9.0f %9.0f %08X\n", sum / submitted, Percentile(times, 0.50), Percentile(times, 0.90),
+           Percentile(times, 0.99), times.back(), vtxTotal / submitted, idxTotal / submitted, checksum);
+  }
+
+  ImGui_ImplCaptureReplay_Close(replay);
+  if (options.softRaster) {
+    ImGui_ImplSoftRaster_Shutdown();
+  } else {
+    ImGui_ImplNullRender_Shutdown();
+  }
+  ImGui::DestroyContext();
+  return 0;
+}
@@ -0,0 +1,154 @@
+/**
+ *
+ * imgui_replay_gl: OpenGL3 renderer benchmark on captured draw data.
+ *
+ * Same as imgui_replay, with ImGui_ImplOpenGL3_RenderDrawData() as the
+ * renderer: every frame of the capture file is submitted in order, without
+ * running any UI code, and the time from submission to glFinish() is
+ * reported. Vsync is disabled so the measurements are not capped.
+ *
+ * Usage:
+ *   imgui_replay_gl FILE [--loops N] [--json]
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_impl_capture.h"
+#include "imgui/imgui_impl_opengl3.h"
+
+
+const std::string glsl_version{"#version 130"};
+const std::string kTitle{"Dear ImGui capture replay"};
+
+
+static ImTextureID CreateTexture(int width, int height, const unsigned char* pixels, void*) {
+  GLuint texture{0};
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D, texture);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+  return (ImTextureID)(intptr_t)texture;
+}
+
+static double Percentile(const std::vector<double>& sorted, double p) {
+  const size_t index = std::min(sorted.size() - 1, (size_t)(p * (sorted.size() - 1) + 0.5));
+  return sorted[index];
+}
+
+
+int main(int argc, char** argv) {
+  std::string capturePath;
+  int loops{1};
+  bool json{false};
+  for (int n = 1; n < argc; n++) {
+    if (strcmp(argv[n], "--loops") == 0 && n + 1 < argc) {
+      loops = atoi(argv[++n]);
+    } else if (strcmp(argv[n], "--json") == 0) {
+      json = true;
+    } else if (argv[n][0] != '-' && capturePath.empty()) {
+      capturePath = argv[n];
+    } else {
+      capturePath.clear();
+      break;
+    }
+  }
+  if (capturePath.empty() || loops <= 0) {
+    fprintf(stderr, "Usage: %s FILE [--loops N] [--json]\n", argv[0]);
+    return 1;
+  }
+
+  glfwSetErrorCallback([](int error, const char *description) {
+    fprintf(stderr, "Glfw Error %d: %s\n", error, description);
+  });
+  if (!glfwInit()) {
+    return 1;
+  }
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+  GLFWwindow* window = glfwCreateWindow(64, 64, kTitle.c_str(), nullptr, nullptr);
+  if (window == nullptr) {
+    glfwTerminate();
+    return 1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSwapInterval(0);
+  glewExperimental = true;
+  if (glewInit() != GLEW_OK) {
+    glfwTerminate();
+    return 1;
+  }
+
+  // The renderer backend needs a context, but no UI code runs.
+  ImGui::CreateContext();
+  ImGui::GetIO().IniFilename = nullptr;
+  ImGui_ImplOpenGL3_Init(glsl_version.c_str());
+
+  ImGui_ImplCaptureReplay* replay = ImGui_ImplCaptureReplay_Open(capturePath.c_str(), CreateTexture, nullptr);
+  if (replay == nullptr || ImGui_ImplCaptureReplay_GetFramesCount(replay) == 0) {
+    fprintf(stderr, "Could not read '%s'\n", capturePath.c_str());
+    return 1;
+  }
+  const int frames = ImGui_ImplCaptureReplay_GetFramesCount(replay);
+  const ImVec2 displaySize = ImGui_ImplCaptureReplay_GetDisplaySize(replay);
+  glfwSetWindowSize(window, (int)displaySize.x, (int)displaySize.y);
+
+  std::vector<double> times;
+  times.reserve((size_t)frames * loops);
+  for (int loop = 0; loop < loops; loop++) {
+    for (int frame = 0; frame < frames; frame++) {
+      ImGui_ImplOpenGL3_NewFrame();
+      int displayWidth, displayHeight;
+      glfwGetFramebufferSize(window, &displayWidth, &displayHeight);
+      glViewport(0, 0, displayWidth, displayHeight);
+      glClearColor(0.45f, 0.55f, 0.60f, 1.0f);
+      glClear(GL_COLOR_BUFFER_BIT);
+      glFinish();
+
+      const auto t0 = std::chrono::high_resolution_clock::now();
+      ImGui_ImplOpenGL3_RenderDrawData(ImGui_ImplCaptureReplay_GetFrame(replay, frame));
+      glFinish();
+      const auto t1 = std::chrono::high_resolution_clock::now();
+      times.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+      glfwSwapBuffers(window);
+      glfwPollEvents();
+    }
+  }
+
+  double sum{0.0};
+  for (double t : times) {
+    sum += t;
+  }
+  std::sort(times.begin(), times.end());
+  if (json) {
+    printf("{\n  \"imgui_version\": \"%s\",\n  \"file\": \"%s\",\n  \"renderer\": \"opengl3\",\n  \"frames\": %d,\n  \"loops\": %d,\n", ImGui::GetVersion(), capturePath.c_str(), frames, loops);
+    printf("  \"mean_us\": %.2f,\n  \"p50_us\": %.2f,\n  \"p90_us\": %.2f,\n  \"p99_us\": %.2f,\n  \"max_us\": %.2f\n}\n",
+           sum / times.size(), Percentile(times, 0.50), Percentile(times, 0.90), Percentile(times, 0.99), times.back());
+  } else {
+    printf("Dear ImGui %s, %s: %d frames x %d loops, renderer opengl3 (%s)\n", ImGui::GetVersion(), capturePath.c_str(), frames, loops, (const char*)glGetString(GL_RENDERER));
+    printf("%9s %9s %9s %9s %9s\n", "mean", "p50", "p90", "p99", "max");
+    printf("%9.1f %9.1f %9.1f %9.1f %9.1f\n", sum / times.size(), Percentile(times, 0.50), Percentile(times, 0.90), Percentile(times, 0.99), times.back());
+  }
+
+  ImGui_ImplCaptureReplay_Close(replay);
+  ImGui_ImplOpenGL3_Shutdown();
+  ImGui::DestroyContext();
+  glfwDestroyWindow(window);
+  glfwTerminate();
+  return 0;
+}
@@ -2,6 +2,8 @@
 #undef ANIMATED_COLOR
 #undef GRADIENT_COLOR
 #define ELEMENT_BUFFERS
+#undef PIPELINED_RENDERING
+#define PARALLEL_VIEWPORTS
 
 
 /**
@@ -29,6 +31,7 @@
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -42,6 +45,7 @@
 #include "imgui/imgui.h"
 #include "imgui/imgui_impl_glfw.h"
 #include "imgui/imgui_impl_opengl3.h"
+#include "imgui/imgui_impl_pipeline.h"
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
@@ -73,6 +77,9 @@ static GLFWwindow* window{nullptr};
 static ImVec4 bgColor{0.0f, 0.0f, 0.4f, 0.0f}; // Dark Blue
 static bool isRunning_{true};
 
+// Scene state written by the UI (and input callbacks) and read by drawScene(): only shared between threads with PIPELINED_RENDERING
+static std::mutex sceneMutex_;
+
 
 #if defined(SOLID_COLOR) || defined(ANIMATED_COLOR)
 static constexpr int32_t kMaxVertexBuffer{9};
@@ -332,6 +339,70 @@ static std::pair<GLuint, GLuint> PrepareVertexBuffer() {
 }
 
 
+#if defined(PIPELINED_RENDERING)
+// Called by the render thread (see ImGui_ImplPipeline_QueueTexture())
+static ImTextureID CreateTexture(int width, int height, const unsigned char* pixels, void*) {
+  GLuint texture{0};
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D, texture);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+  return (ImTextureID)(intptr_t)texture;
+}
+#endif
+
+// Called by the main thread between ImGui::NewFrame() and ImGui::Render(), in both loops
+// (with PIPELINED_RENDERING, while the render thread submits the previous frame)
+static void BuildUI(ImTextureID wallTexture) {
+  // BEGIN - MainMenuBar
+  if (ImGui::BeginMainMenuBar()) {
+    if (ImGui::BeginMenu("File")) {
+      // File/Quit
+      if (ImGui::MenuItem("Quit", "Alt+F4")) {
+        isRunning_ = false;
+      }
+      ImGui::EndMenu();
+    }
+    ImGui::EndMainMenuBar();
+  }
+  // END - MainMenuBar
+
+#if defined(SOLID_COLOR) || defined(ANIMATED_COLOR) || defined(GRADIENT_COLOR)
+  // BEGIN - Toolbar
+  ImGui::Begin("Camera");
+    ImGui::Text("Eye Position");
+    ImGui::SliderFloat("eye_x", &cameraPos.x, -100.0f, 100.0f);
+    ImGui::SliderFloat("eye_y", &cameraPos.y, -100.0f, 100.0f);
+    ImGui::SliderFloat("eye_z", &cameraPos.z, -100.0f, 100.0f);
+    if (ImGui::Button("Reset Eye Position")) cameraPos = glm::vec3{0.0f, 0.0f, 3.0f};
+
+    ImGui::Text("Center Position");
+    ImGui::SliderFloat("cam_x", &cameraFront.x, -10.0f, 10.0f);
+    ImGui::SliderFloat("cam_y", &cameraFront.y, -10.0f, 10.0f);
+    ImGui::SliderFloat("cam_z", &cameraFront.z, -10.0f, 10.0f);
+    if (ImGui::Button("Reset Center Position")) cameraFront = glm::vec3{0.0f, 0.0f, -1.0f};
+  ImGui::End();
+  // END - Toolbar
+#endif
+
+  ImGui::Begin("Hello, world!");
+    static float colorEdit[4] = { bgColor.x, bgColor.y, bgColor.z, bgColor.w };
+    ImGui::ColorEdit4("Background Color", colorEdit);
+    bgColor.x = colorEdit[0];
+    bgColor.y = colorEdit[1];
+    bgColor.z = colorEdit[2];
+    bgColor.w = colorEdit[3];
+
+    ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+    if (wallTexture != 0) {
+      ImGui::Image(wallTexture, ImVec2(256.0f, 256.0f));
+    }
+  ImGui::End();
+}
+
+
 /**
  *
  *
@@ -530,15 +601,18 @@ auto main(int argc, char **argv) -> int {
 
   ImGui::CreateContext();
 
-  auto io = ImGui::GetIO();
+  ImGuiIO& io = ImGui::GetIO();
 
   io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
   io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+#if !defined(PIPELINED_RENDERING)
+  // ImGui_ImplPipeline only hands the main viewport's draw data over to the render thread
   io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+#endif
 
   ImGui::StyleColorsDark();
 
-  auto style = ImGui::GetStyle();
+  ImGuiStyle& style = ImGui::GetStyle();
 
   if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
     style.WindowRounding = 0.0f;
@@ -552,8 +626,8 @@ auto main(int argc, char **argv) -> int {
   auto t_start = std::chrono::high_resolution_clock::now();
 
 
-  while (isRunning_) {
-
+  // Scene drawing, on the thread which owns the GL context (this one, or the render thread with PIPELINED_RENDERING)
+  auto drawScene = [&]() {
     // @BEGIN - ???
     auto t_now = std::chrono::high_resolution_clock::now();
     float time = std::chrono::duration_cast<std::chrono::duration<float>>(t_now - t_start).count();
@@ -681,72 +755,102 @@ auto main(int argc, char **argv) -> int {
 #else
 #endif
     // @END - Draw a triangle
+  };
 
 
-#if 0
-    ImGui_ImplOpenGL3_NewFrame();
+#if defined(PIPELINED_RENDERING)
+  // The UI is built on this thread while a render thread owns the GL context and submits the previous frame.
+  // Shaders and the font texture are created here first, then the GL context is handed over to the render thread.
+  assert(!(ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable) && "Secondary viewports are not rendered by ImGui_ImplPipeline");
+  ImGui_ImplOpenGL3_NewFrame();
+  ImGui_ImplPipeline* pipeline = ImGui_ImplPipeline_Create(CreateTexture, nullptr);
+  glfwMakeContextCurrent(nullptr);
+  std::thread renderThread([&]() {
+    glfwMakeContextCurrent(window);
+    while (ImDrawData* drawData = ImGui_ImplPipeline_AcquireFrame(pipeline)) {
+      {
+        std::lock_guard<std::mutex> lock(sceneMutex_);
+        drawScene();
+      }
+      ImGui_ImplOpenGL3_RenderDrawData(drawData);
+      ImGui_ImplPipeline_ReleaseFrame(pipeline);
+      glfwSwapBuffers(window);
+    }
+    glfwMakeContextCurrent(nullptr);
+  });
+
+  // Textures are created by the render thread, before the first frame pushed after the request
+  int wallTextureRequest{0};
+  {
+    int32_t width{0};
+    int32_t height{0};
+    int32_t nrChannels{0};
+
+    unsigned char *data = stbi_load("../../../wall.jpg", &width, &height, &nrChannels, 4);
+    if (data != nullptr) {
+      wallTextureRequest = ImGui_ImplPipeline_QueueTexture(pipeline, width, height, data);
+      stbi_image_free(data);
+    }
+  }
+  ImTextureID wallTexture{0};
+  bool wallTextureReady{false};
+
+  while (isRunning_) {
+    {
+      std::lock_guard<std::mutex> lock(sceneMutex_);
+      glfwPollEvents();
+    }
+
+    if ((wallTextureRequest != 0) && !wallTextureReady) {
+      wallTextureReady = ImGui_ImplPipeline_GetTexture(pipeline, wallTextureRequest, &wallTexture);
+    }
+
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
+    {
+      std::lock_guard<std::mutex> lock(sceneMutex_);
+      BuildUI(wallTextureReady ? wallTexture : 0);
+    }
+    ImGui::Render();
 
-    // BEGIN - MainMenuBar
-    if (ImGui::BeginMainMenuBar()) {
+    // Blocks only while the render thread still holds the two previous frames
+    ImGui_ImplPipeline_PushFrame(pipeline, ImGui::GetDrawData());
+  }
+
+  ImGui_ImplPipeline_Quit(pipeline);
+  renderThread.join();
+  glfwMakeContextCurrent(window);
+  ImGui_ImplPipeline_Destroy(pipeline);
+#else
+  while (isRunning_) {
+    drawScene();
 
-        if (ImGui::BeginMenu("File")) {
-            // File/Quit
-            if (ImGui::MenuItem("Quit", "Alt+F4")) {
-                isRunning_ = false;
-            }
-            ImGui::EndMenu();
-        }
 
-        ImGui::EndMainMenuBar();
-    }
-    // END - MainMenuBar
-
-    // BEGIN - Toolbar
-    ImGui::Begin("Camera");
-      ImGui::Text("Eye Position");
-      ImGui::SliderFloat("eye_x", &cameraPos.x, -100.0f, 100.0f);
-      ImGui::SliderFloat("eye_y", &cameraPos.y, -100.0f, 100.0f);
-      ImGui::SliderFloat("eye_z", &cameraPos.z, -100.0f, 100.0f);
-      if (ImGui::Button("Reset Eye Position")) cameraPos = glm::vec3{0.0f, 0.0f, 3.0f}; // @TODO It's not a good idea to create a new object
-
-      ImGui::Text("Center Position");
-      ImGui::SliderFloat("cam_x", &cameraFront.x, -10.0f, 10.0f);
-      ImGui::SliderFloat("cam_y", &cameraFront.y, -10.0f, 10.0f);
-      ImGui::SliderFloat("cam_z", &cameraFront.z, -10.0f, 10.0f);
-      if (ImGui::Button("Reset Center Position")) cameraFront = glm::vec3{0.0f, 0.0f, -1.0f}; // @TODO It's not a good idea to create a new object
-    ImGui::End();
-
-    ImGui::Begin("Hello, world!");
-      static float colorEdit[4] = { bgColor.x, bgColor.y, bgColor.z, bgColor.w };
-      ImGui::ColorEdit4("Background Color", colorEdit);
-      bgColor.x = colorEdit[0];
-      bgColor.y = colorEdit[1];
-      bgColor.z = colorEdit[2];
-      bgColor.w = colorEdit[3];
-
-      //ImGui::SameLine();
-      ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
-    ImGui::End();
-    // END - MainMenuBar
 
+    ImGui_ImplOpenGL3_NewFrame();
+    ImGui_ImplGlfw_NewFrame();
+    ImGui::NewFrame();
+    BuildUI(0);
     ImGui::Render();
 
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
-    auto io = ImGui::GetIO();
     if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
       auto backup_current_context = glfwGetCurrentContext();
       ImGui::UpdatePlatformWindows();
+#if defined(PARALLEL_VIEWPORTS)
+      // One render thread per secondary viewport, only the swap of the main window below waits for vsync
+      ImGui_ImplGlfw_RenderPlatformWindowsParallel();
+#else
       ImGui::RenderPlatformWindowsDefault();
+#endif
       glfwMakeContextCurrent(backup_current_context);
     }
-#endif
 
     glfwSwapBuffers(window);
     glfwPollEvents();
   }
+#endif
 
 
   glDeleteProgram(program_id_);